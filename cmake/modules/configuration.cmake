@@ -48,6 +48,14 @@ endif()
 # -----------------------------------------------------------------------------
 # Compiler options
 # -----------------------------------------------------------------------------
+# Numeric codec relies on floating point std::to_chars/std::from_chars
+if (CMAKE_CXX_COMPILER_ID STREQUAL "GNU" AND CMAKE_CXX_COMPILER_VERSION VERSION_LESS 11)
+  message(FATAL_ERROR "GCC 11 or newer is required, found ${CMAKE_CXX_COMPILER_VERSION}")
+endif()
+if (CMAKE_CXX_COMPILER_ID STREQUAL "Clang" AND CMAKE_CXX_COMPILER_VERSION VERSION_LESS 14)
+  message(FATAL_ERROR "Clang 14 or newer is required, found ${CMAKE_CXX_COMPILER_VERSION}")
+endif()
+
 if (COA_COVERAGE)
   message(STATUS "Enabling test coverage information")
   set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -O0 -g -fno-inline --coverage")
@@ -21,7 +21,9 @@
 #include "command_model_composer.h"
 
 #include "insert_item_command.h"
+#include "insert_items_command.h"
 #include "remove_item_command.h"
+#include "remove_items_command.h"
 #include "set_value_command.h"
 
 #include <mvvm/model/session_item.h>
@@ -44,6 +46,22 @@ std::unique_ptr<SessionItem> mvvm::CommandModelComposer::TakeItem(SessionItem *p
   return command ? command->GetResult() : std::unique_ptr<SessionItem>();
 }
 
+std::vector<SessionItem *> CommandModelComposer::InsertItems(
+    std::vector<std::unique_ptr<SessionItem>> items, SessionItem *parent,
+    const TagIndex &tag_index)
+{
+  auto command =
+      ProcessCommand<InsertItemsCommand>(m_composer.get(), std::move(items), parent, tag_index);
+  return command ? command->GetResult() : std::vector<SessionItem *>();
+}
+
+std::vector<std::unique_ptr<SessionItem>> CommandModelComposer::TakeItems(
+    SessionItem *parent, const TagIndex &tag_index, std::size_t count)
+{
+  auto command = ProcessCommand<RemoveItemsCommand>(m_composer.get(), parent, tag_index, count);
+  return command ? command->GetResult() : std::vector<std::unique_ptr<SessionItem>>();
+}
+
 bool CommandModelComposer::SetData(SessionItem *item, const variant_t &value, int role)
 {
   auto command = ProcessCommand<SetValueCommand>(m_composer.get(), item, value, role);
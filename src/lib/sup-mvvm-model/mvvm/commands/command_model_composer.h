@@ -49,6 +49,13 @@ public:
 
   std::unique_ptr<SessionItem> TakeItem(SessionItem* parent, const TagIndex& tag_index) override;
 
+  std::vector<SessionItem*> InsertItems(std::vector<std::unique_ptr<SessionItem>> items,
+                                        SessionItem* parent, const TagIndex& tag_index) override;
+
+  std::vector<std::unique_ptr<SessionItem>> TakeItems(SessionItem* parent,
+                                                      const TagIndex& tag_index,
+                                                      std::size_t count) override;
+
   bool SetData(SessionItem* item, const variant_t& value, int role) override;
 
   void ReplaceRootItem(std::unique_ptr<SessionItem>& old_root_item,
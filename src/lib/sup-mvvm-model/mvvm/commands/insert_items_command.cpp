@@ -0,0 +1,115 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "insert_items_command.h"
+
+#include <mvvm/core/mvvm_exceptions.h>
+#include <mvvm/model/i_model_composer.h>
+#include <mvvm/model/model_utils.h>
+#include <mvvm/model/path.h>
+#include <mvvm/model/session_item.h>
+
+#include <sstream>
+
+namespace
+{
+
+std::string GenerateDescription(mvvm::SessionItem* parent, std::size_t count,
+                                const mvvm::TagIndex& tag_index)
+{
+  std::ostringstream ostr;
+  const std::string parent_name = parent ? parent->GetDisplayName() : "nullptr";
+  ostr << "InsertItems: " << parent_name << " " << count << " " << tag_index.GetTag() << " "
+       << tag_index.GetIndex();
+  return ostr.str();
+}
+
+}  // namespace
+
+namespace mvvm
+{
+
+struct InsertItemsCommand::InsertItemsCommandImpl
+{
+  IModelComposer* m_composer{nullptr};
+  Path m_parent_path;
+  TagIndex m_tag_index;
+  std::size_t m_count{0};
+  std::vector<std::unique_ptr<SessionItem>> m_to_insert;  //!< original or taken back on undo
+  std::vector<SessionItem*> m_result;
+
+  InsertItemsCommandImpl(IModelComposer* composer, std::vector<std::unique_ptr<SessionItem>> items,
+                         SessionItem* parent, const TagIndex& tag_index)
+      : m_composer(composer)
+      , m_parent_path(utils::PathFromItem(parent))
+      , m_tag_index(tag_index)
+      , m_count(items.size())
+      , m_to_insert(std::move(items))
+  {
+  }
+
+  //! Find parent item.
+  SessionItem* FindParent() const
+  {
+    return utils::ItemFromPath(*m_composer->GetModel(), m_parent_path);
+  }
+};
+
+InsertItemsCommand::InsertItemsCommand(IModelComposer* composer,
+                                       std::vector<std::unique_ptr<SessionItem>> items,
+                                       SessionItem* parent, const TagIndex& tag_index)
+    : p_impl(std::make_unique<InsertItemsCommandImpl>(composer, std::move(items), parent,
+                                                      tag_index))
+{
+  SetDescription(GenerateDescription(parent, p_impl->m_count, tag_index));
+}
+
+InsertItemsCommand::~InsertItemsCommand() = default;
+
+std::vector<SessionItem*> InsertItemsCommand::GetResult() const
+{
+  return p_impl->m_result;
+}
+
+void InsertItemsCommand::ExecuteImpl()
+{
+  SetIsObsolete(false);
+
+  auto parent = p_impl->FindParent();
+
+  if (!parent)
+  {
+    throw RuntimeException("Can't find parent");
+  }
+
+  p_impl->m_result = p_impl->m_composer->InsertItems(std::move(p_impl->m_to_insert), parent,
+                                                     p_impl->m_tag_index);
+  p_impl->m_to_insert.clear();
+}
+
+void InsertItemsCommand::UndoImpl()
+{
+  // taken items are kept for redo, so no serialized backup of the whole range is needed
+  auto parent = p_impl->FindParent();
+  p_impl->m_to_insert = p_impl->m_composer->TakeItems(parent, p_impl->m_tag_index, p_impl->m_count);
+  p_impl->m_result.clear();
+}
+
+}  // namespace mvvm
@@ -0,0 +1,60 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_COMMANDS_INSERT_ITEMS_COMMAND_H_
+#define MVVM_COMMANDS_INSERT_ITEMS_COMMAND_H_
+
+#include <mvvm/commands/abstract_command.h>
+
+#include <memory>
+#include <vector>
+
+namespace mvvm
+{
+
+class SessionItem;
+class IModelComposer;
+class TagIndex;
+
+/**
+ * @brief The InsertItemsCommand class inserts a contiguous range of items into the parent as a
+ * single undoable operation.
+ */
+class MVVM_MODEL_EXPORT InsertItemsCommand : public AbstractCommand
+{
+public:
+  InsertItemsCommand(IModelComposer* composer, std::vector<std::unique_ptr<SessionItem>> items,
+                     SessionItem* parent, const TagIndex& tag_index);
+
+  ~InsertItemsCommand() override;
+
+  std::vector<SessionItem*> GetResult() const;
+
+private:
+  void ExecuteImpl() override;
+  void UndoImpl() override;
+
+  struct InsertItemsCommandImpl;
+  std::unique_ptr<InsertItemsCommandImpl> p_impl;
+};
+
+}  // namespace mvvm
+
+#endif  // MVVM_COMMANDS_INSERT_ITEMS_COMMAND_H_
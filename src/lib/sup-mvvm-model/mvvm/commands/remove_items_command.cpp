@@ -0,0 +1,131 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "remove_items_command.h"
+
+#include <mvvm/core/mvvm_exceptions.h>
+#include <mvvm/factories/item_backup_strategy_factory.h>
+#include <mvvm/model/i_item_backup_strategy.h>
+#include <mvvm/model/i_model_composer.h>
+#include <mvvm/model/item_factory.h>
+#include <mvvm/model/model_utils.h>
+#include <mvvm/model/path.h>
+#include <mvvm/model/session_item.h>
+
+#include <sstream>
+
+namespace
+{
+
+std::string GenerateDescription(mvvm::SessionItem* parent, const mvvm::TagIndex& tag_index,
+                                std::size_t count)
+{
+  std::ostringstream ostr;
+  ostr << "RemoveItems: " << parent->GetDisplayName() << " " << count << " " << tag_index.GetTag()
+       << " " << tag_index.GetIndex();
+  return ostr.str();
+}
+
+}  // namespace
+
+namespace mvvm
+{
+
+struct RemoveItemsCommand::RemoveItemsCommandImpl
+{
+  IModelComposer* m_composer{nullptr};
+  Path m_parent_path;
+  TagIndex m_tag_index;
+  std::size_t m_count{0};
+  std::vector<std::unique_ptr<IItemBackupStrategy>> m_backup_strategies;
+  std::vector<std::unique_ptr<SessionItem>> m_taken;
+
+  RemoveItemsCommandImpl(IModelComposer* composer, SessionItem* parent, const TagIndex& tag_index,
+                         std::size_t count)
+      : m_composer(composer)
+      , m_parent_path(utils::PathFromItem(parent))
+      , m_tag_index(tag_index)
+      , m_count(count)
+  {
+  }
+
+  SessionItem* FindParent() const
+  {
+    return utils::ItemFromPath(*m_composer->GetModel(), m_parent_path);
+  }
+};
+
+RemoveItemsCommand::RemoveItemsCommand(IModelComposer* composer, SessionItem* parent,
+                                       const TagIndex& tag_index, std::size_t count)
+    : p_impl(std::make_unique<RemoveItemsCommandImpl>(composer, parent, tag_index, count))
+{
+  SetDescription(GenerateDescription(parent, tag_index, count));
+}
+
+RemoveItemsCommand::~RemoveItemsCommand() = default;
+
+std::vector<std::unique_ptr<SessionItem>> RemoveItemsCommand::GetResult() const
+{
+  return std::move(p_impl->m_taken);
+}
+
+void RemoveItemsCommand::ExecuteImpl()
+{
+  SetIsObsolete(false);
+
+  auto parent = p_impl->FindParent();
+
+  if (!parent)
+  {
+    throw RuntimeException("Can't find parent");
+  }
+
+  auto taken = p_impl->m_composer->TakeItems(parent, p_impl->m_tag_index, p_impl->m_count);
+  if (taken.size() != p_impl->m_count)
+  {
+    throw RuntimeException("Can't take items");
+  }
+
+  p_impl->m_backup_strategies.clear();
+  for (const auto& item : taken)
+  {
+    auto strategy = CreateItemTreeDataBackupStrategy(&GetGlobalItemFactory());
+    strategy->SaveItem(*item);
+    p_impl->m_backup_strategies.push_back(std::move(strategy));
+  }
+
+  p_impl->m_taken = std::move(taken);
+}
+
+void RemoveItemsCommand::UndoImpl()
+{
+  auto parent = p_impl->FindParent();
+
+  std::vector<std::unique_ptr<SessionItem>> items;
+  items.reserve(p_impl->m_backup_strategies.size());
+  for (const auto& strategy : p_impl->m_backup_strategies)
+  {
+    items.push_back(strategy->RestoreItem());
+  }
+
+  p_impl->m_composer->InsertItems(std::move(items), parent, p_impl->m_tag_index);
+}
+
+}  // namespace mvvm
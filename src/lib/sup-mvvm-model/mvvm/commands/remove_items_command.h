@@ -0,0 +1,65 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_COMMANDS_REMOVE_ITEMS_COMMAND_H_
+#define MVVM_COMMANDS_REMOVE_ITEMS_COMMAND_H_
+
+#include <mvvm/commands/abstract_command.h>
+
+#include <memory>
+#include <vector>
+
+namespace mvvm
+{
+
+class SessionItem;
+class IModelComposer;
+class TagIndex;
+
+/**
+ * @brief The RemoveItemsCommand class removes a contiguous range of items from the parent as a
+ * single undoable operation.
+ */
+class MVVM_MODEL_EXPORT RemoveItemsCommand : public AbstractCommand
+{
+public:
+  RemoveItemsCommand(IModelComposer* composer, SessionItem* parent, const TagIndex& tag_index,
+                     std::size_t count);
+
+  ~RemoveItemsCommand() override;
+
+  /**
+   * @brief Returns removed items to the caller.
+   *
+   * Can be called only once after the execution, items are moved out.
+   */
+  std::vector<std::unique_ptr<SessionItem>> GetResult() const;
+
+private:
+  void ExecuteImpl() override;
+  void UndoImpl() override;
+
+  struct RemoveItemsCommandImpl;
+  std::unique_ptr<RemoveItemsCommandImpl> p_impl;
+};
+
+}  // namespace mvvm
+
+#endif  // MVVM_COMMANDS_REMOVE_ITEMS_COMMAND_H_
@@ -0,0 +1,125 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "atom.h"
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+
+namespace
+{
+
+/**
+ * @brief The AtomTable class holds all interned strings.
+ *
+ * Strings are stored in a deque, so references to them remain valid while the table grows.
+ * An empty string is always interned with identifier 0.
+ */
+class AtomTable
+{
+public:
+  using entry_t = std::pair<std::uint32_t, const std::string*>;
+
+  AtomTable() : m_empty(Insert({})) {}
+
+  static AtomTable& Instance()
+  {
+    static AtomTable table;
+    return table;
+  }
+
+  entry_t GetEmpty() const { return m_empty; }
+
+  std::optional<entry_t> Find(const std::string& name) const
+  {
+    const std::shared_lock lock(m_mutex);
+    return FindImpl(name);
+  }
+
+  entry_t Intern(const std::string& name)
+  {
+    if (auto entry = Find(name); entry.has_value())
+    {
+      return entry.value();
+    }
+
+    const std::unique_lock lock(m_mutex);
+    if (auto entry = FindImpl(name); entry.has_value())
+    {
+      return entry.value();  // was interned by another thread meanwhile
+    }
+    return Insert(name);
+  }
+
+private:
+  std::optional<entry_t> FindImpl(const std::string& name) const
+  {
+    auto iter = m_index.find(name);
+    return iter == m_index.end() ? std::optional<entry_t>{} : iter->second;
+  }
+
+  entry_t Insert(const std::string& name)
+  {
+    const auto id = static_cast<std::uint32_t>(m_names.size());
+    const auto& interned = m_names.emplace_back(name);
+    const entry_t result{id, &interned};
+    m_index.emplace(std::string_view(interned), result);
+    return result;
+  }
+
+  mutable std::shared_mutex m_mutex;
+  std::deque<std::string> m_names;
+  std::unordered_map<std::string_view, entry_t> m_index;
+  entry_t m_empty;
+};
+
+}  // namespace
+
+namespace mvvm
+{
+
+Atom::Atom()
+{
+  std::tie(m_id, m_name) = AtomTable::Instance().GetEmpty();
+}
+
+Atom::Atom(const std::string& name)
+{
+  auto [id, interned] = AtomTable::Instance().Intern(name);
+  m_id = id;
+  m_name = interned;
+}
+
+std::optional<Atom> Atom::Find(const std::string& name)
+{
+  if (auto entry = AtomTable::Instance().Find(name); entry.has_value())
+  {
+    return Atom(entry->first, entry->second);
+  }
+  return {};
+}
+
+Atom::Atom(std::uint32_t id, const std::string* name) : m_id(id), m_name(name) {}
+
+}  // namespace mvvm
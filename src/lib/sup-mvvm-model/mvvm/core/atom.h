@@ -0,0 +1,89 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_CORE_ATOM_H_
+#define MVVM_CORE_ATOM_H_
+
+#include <mvvm/model_export.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace mvvm
+{
+
+/**
+ * @brief The Atom class represents a string interned in the global table of names.
+ *
+ * Atoms are used to hold tag names and item types. The string is interned once on atom
+ * construction, after that atom comparison is a comparison of two integers, and access to the
+ * string doesn't require a copy. Interned strings live until the end of the program.
+ */
+class MVVM_MODEL_EXPORT Atom
+{
+public:
+  /**
+   * @brief Default c-tor constructs an atom representing an empty string.
+   */
+  Atom();
+
+  /**
+   * @brief Constructs an atom for the given name, interns the name if necessary.
+   */
+  explicit Atom(const std::string& name);
+
+  /**
+   * @brief Returns an atom for the given name if the name was interned already.
+   *
+   * Doesn't intern anything. Can be used for lookups, since a name which was never interned
+   * can't match any existing atom.
+   */
+  static std::optional<Atom> Find(const std::string& name);
+
+  /**
+   * @brief Returns unique integer identifier of the atom.
+   */
+  std::uint32_t GetId() const { return m_id; }
+
+  /**
+   * @brief Returns interned string.
+   */
+  const std::string& GetName() const { return *m_name; }
+
+  /**
+   * @brief Checks if atom represents an empty string.
+   */
+  bool IsEmpty() const { return m_id == 0; }
+
+  bool operator==(const Atom& other) const { return m_id == other.m_id; }
+  bool operator!=(const Atom& other) const { return m_id != other.m_id; }
+  bool operator<(const Atom& other) const { return m_id < other.m_id; }
+
+private:
+  Atom(std::uint32_t id, const std::string* name);
+
+  std::uint32_t m_id{0};
+  const std::string* m_name{nullptr};
+};
+
+}  // namespace mvvm
+
+#endif  // MVVM_CORE_ATOM_H_
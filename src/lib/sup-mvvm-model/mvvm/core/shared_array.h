@@ -0,0 +1,128 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_CORE_SHARED_ARRAY_H_
+#define MVVM_CORE_SHARED_ARRAY_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+namespace mvvm
+{
+
+/**
+ * @brief The SharedArray class is an immutable array with reference counted storage.
+ *
+ * Copies of the array share the same storage, so copying is O(1) regardless of the array size.
+ * This makes it suitable for large data in variant_t: reading the data from an item, taking
+ * snapshots for undo/redo, or passing the data to Qt doesn't copy the values.
+ *
+ * The content is accessed through span-like methods (data, size, begin, end). The only way to
+ * change the content is GetMutableVector(), which detaches the storage from other copies first
+ * (copy-on-write).
+ */
+template <typename T>
+class SharedArray
+{
+public:
+  using value_type = T;
+  using const_iterator = const T*;
+
+  SharedArray() = default;
+
+  explicit SharedArray(std::vector<T> values)
+      : m_storage(values.empty() ? nullptr
+                                 : std::make_shared<const std::vector<T>>(std::move(values)))
+  {
+  }
+
+  explicit SharedArray(std::initializer_list<T> values) : SharedArray(std::vector<T>(values)) {}
+
+  const T* data() const { return m_storage ? m_storage->data() : nullptr; }
+
+  std::size_t size() const { return m_storage ? m_storage->size() : 0; }
+
+  bool empty() const { return size() == 0; }
+
+  const_iterator begin() const { return data(); }
+
+  const_iterator end() const { return data() + size(); }
+
+  const T& operator[](std::size_t index) const { return (*m_storage)[index]; }
+
+  /**
+   * @brief Returns a copy of the content as a vector.
+   */
+  std::vector<T> ToVector() const { return {begin(), end()}; }
+
+  /**
+   * @brief Returns the vector for modification.
+   *
+   * If the storage is shared with other copies, it is copied first, so other copies are not
+   * affected. The reference is valid until the next copy of this array is made.
+   */
+  std::vector<T>& GetMutableVector()
+  {
+    if (!m_storage || m_storage.use_count() > 1)
+    {
+      m_storage = m_storage ? std::make_shared<const std::vector<T>>(*m_storage)
+                            : std::make_shared<const std::vector<T>>();
+    }
+    // the storage is owned exclusively at this point, so const can be removed safely
+    return const_cast<std::vector<T>&>(*m_storage);
+  }
+
+  /**
+   * @brief Checks if two arrays share the same storage.
+   */
+  bool IsSharedWith(const SharedArray& other) const
+  {
+    return m_storage && m_storage == other.m_storage;
+  }
+
+  bool operator==(const SharedArray& other) const
+  {
+    // comparison of arrays sharing the storage doesn't depend on the size
+    return m_storage == other.m_storage || std::equal(begin(), end(), other.begin(), other.end());
+  }
+
+  bool operator!=(const SharedArray& other) const { return !(*this == other); }
+
+  bool operator<(const SharedArray& other) const
+  {
+    return std::lexicographical_compare(begin(), end(), other.begin(), other.end());
+  }
+
+  bool operator>(const SharedArray& other) const { return other < *this; }
+
+  bool operator<=(const SharedArray& other) const { return !(other < *this); }
+
+  bool operator>=(const SharedArray& other) const { return !(*this < other); }
+
+private:
+  std::shared_ptr<const std::vector<T>> m_storage;
+};
+
+}  // namespace mvvm
+
+#endif  // MVVM_CORE_SHARED_ARRAY_H_
@@ -78,7 +78,12 @@ std::string TypeName(const variant_t &variant)
       {TypeCode::String, constants::kStringTypeName},
       {TypeCode::VectorOfDouble, constants::kVectorDoubleTypeName},
       {TypeCode::ComboProperty, constants::kComboPropertyTypeName},
-      {TypeCode::ExternalProperty, constants::kExternalPropertyTypeName}};
+      {TypeCode::ExternalProperty, constants::kExternalPropertyTypeName},
+      {TypeCode::SharedVectorOfDouble, constants::kSharedVectorDoubleTypeName},
+      {TypeCode::VectorOfFloat32, constants::kVectorFloat32TypeName},
+      {TypeCode::VectorOfInt32, constants::kVectorInt32TypeName},
+      {TypeCode::VectorOfInt64, constants::kVectorInt64TypeName},
+      {TypeCode::VectorOfUInt16, constants::kVectorUInt16TypeName}};
   return kTypeNameMap[static_cast<TypeCode>(variant.index())];
 }
 
@@ -25,6 +25,7 @@
 //! Defines all supported elementary data types.
 
 #include <mvvm/core/basic_scalar_types.h>
+#include <mvvm/core/shared_array.h>
 #include <mvvm/model/combo_property.h>
 #include <mvvm/model/external_property.h>
 #include <mvvm/model_export.h>
@@ -54,12 +55,19 @@ enum class TypeCode : uint32
   String,
   VectorOfDouble,
   ComboProperty,
-  ExternalProperty
+  ExternalProperty,
+  SharedVectorOfDouble,
+  VectorOfFloat32,
+  VectorOfInt32,
+  VectorOfInt64,
+  VectorOfUInt16
 };
 
 using variant_t = std::variant<std::monostate, boolean, char8, int8, uint8, int16, uint16, int32,
                                uint32, int64, uint64, float32, float64, std::string,
-                               std::vector<float64>, ComboProperty, ExternalProperty>;
+                               std::vector<float64>, ComboProperty, ExternalProperty,
+                               SharedArray<float64>, std::vector<float32>, std::vector<int32>,
+                               std::vector<int64>, std::vector<uint16>>;
 
 using role_data_t = std::pair<int, variant_t>;
 bool operator==(const role_data_t& lhs, const role_data_t& rhs);
@@ -93,6 +101,11 @@ const std::string kStringTypeName = "string";
 const std::string kVectorDoubleTypeName = "vector_double";
 const std::string kComboPropertyTypeName = "ComboProperty";
 const std::string kExternalPropertyTypeName = "ExternalProperty";
+const std::string kSharedVectorDoubleTypeName = "shared_vector_double";
+const std::string kVectorFloat32TypeName = "vector_float32";
+const std::string kVectorInt32TypeName = "vector_int32";
+const std::string kVectorInt64TypeName = "vector_int64";
+const std::string kVectorUInt16TypeName = "vector_uint16";
 }  // namespace mvvm::constants
 
 namespace mvvm::utils
@@ -20,6 +20,7 @@
 
 #include "variant_value_visitor.h"
 
+#include <mvvm/utils/numeric_codec.h>
 #include <mvvm/utils/string_utils.h>
 
 namespace mvvm
@@ -38,57 +39,57 @@ std::string VariantValueVisitor::operator()(boolean value)
 
 std::string VariantValueVisitor::operator()(char8 value)
 {
-  return std::to_string(value);
+  return mvvm::utils::IntegerToString(value);
 }
 
 std::string VariantValueVisitor::operator()(int8 value)
 {
-  return {std::to_string(value)};
+  return mvvm::utils::IntegerToString(value);
 }
 
 std::string VariantValueVisitor::operator()(uint8 value)
 {
-  return {std::to_string(value)};
+  return mvvm::utils::IntegerToString(value);
 }
 
 std::string VariantValueVisitor::operator()(int16 value)
 {
-  return {std::to_string(value)};
+  return mvvm::utils::IntegerToString(value);
 }
 
 std::string VariantValueVisitor::operator()(uint16 value)
 {
-  return {std::to_string(value)};
+  return mvvm::utils::IntegerToString(value);
 }
 
 std::string VariantValueVisitor::operator()(int32 value)
 {
-  return {std::to_string(value)};
+  return mvvm::utils::IntegerToString(value);
 }
 
 std::string VariantValueVisitor::operator()(uint32 value)
 {
-  return {std::to_string(value)};
+  return mvvm::utils::IntegerToString(value);
 }
 
 std::string VariantValueVisitor::operator()(int64 value)
 {
-  return {std::to_string(value)};
+  return mvvm::utils::IntegerToString(value);
 }
 
 std::string VariantValueVisitor::operator()(uint64 value)
 {
-  return {std::to_string(value)};
+  return mvvm::utils::IntegerToString(value);
 }
 
 std::string VariantValueVisitor::operator()(float32 value)
 {
-  return mvvm::utils::DoubleToString(value);
+  return mvvm::utils::FloatToString(value);
 }
 
 std::string VariantValueVisitor::operator()(float64 value)
 {
-  return mvvm::utils::DoubleToString(value);
+  return mvvm::utils::FloatToString(value);
 }
 
 std::string VariantValueVisitor::operator()(std::string value)
@@ -111,4 +112,29 @@ std::string VariantValueVisitor::operator()(const ExternalProperty &value)
   return value.ToString();
 }
 
+std::string VariantValueVisitor::operator()(const SharedArray<double> &value)
+{
+  return {mvvm::utils::ToSeparatedString(value.data(), value.size(), ", ")};
+}
+
+std::string VariantValueVisitor::operator()(const std::vector<float32> &value)
+{
+  return {mvvm::utils::ToSeparatedString(value.data(), value.size(), ", ")};
+}
+
+std::string VariantValueVisitor::operator()(const std::vector<int32> &value)
+{
+  return {mvvm::utils::ToSeparatedString(value.data(), value.size(), ", ")};
+}
+
+std::string VariantValueVisitor::operator()(const std::vector<int64> &value)
+{
+  return {mvvm::utils::ToSeparatedString(value.data(), value.size(), ", ")};
+}
+
+std::string VariantValueVisitor::operator()(const std::vector<uint16> &value)
+{
+  return {mvvm::utils::ToSeparatedString(value.data(), value.size(), ", ")};
+}
+
 }  // namespace mvvm
@@ -64,6 +64,16 @@ struct VariantValueVisitor
   std::string operator()(const mvvm::ComboProperty &value);
 
   std::string operator()(const mvvm::ExternalProperty &value);
+
+  std::string operator()(const mvvm::SharedArray<double> &value);
+
+  std::string operator()(const std::vector<mvvm::float32> &value);
+
+  std::string operator()(const std::vector<mvvm::int32> &value);
+
+  std::string operator()(const std::vector<mvvm::int64> &value);
+
+  std::string operator()(const std::vector<mvvm::uint16> &value);
 };
 
 }  // namespace mvvm
@@ -70,6 +70,25 @@ std::unique_ptr<SessionItem> mvvm::ApplicationModelComposer::TakeItem(SessionIte
   return {};
 }
 
+std::vector<SessionItem *> ApplicationModelComposer::InsertItems(
+    std::vector<std::unique_ptr<SessionItem>> items, SessionItem *parent,
+    const TagIndex &tag_index)
+{
+  (void)items;
+  (void)parent;
+  (void)tag_index;
+  return {};
+}
+
+std::vector<std::unique_ptr<SessionItem>> ApplicationModelComposer::TakeItems(
+    SessionItem *parent, const TagIndex &tag_index, std::size_t count)
+{
+  (void)parent;
+  (void)tag_index;
+  (void)count;
+  return {};
+}
+
 bool ApplicationModelComposer::SetData(SessionItem *item, const variant_t &value, int role)
 {
   auto command =
@@ -25,6 +25,7 @@
 #include <mvvm/model_export.h>
 
 #include <memory>
+#include <vector>
 
 namespace mvvm
 {
@@ -69,6 +70,29 @@ public:
    */
   virtual std::unique_ptr<SessionItem> TakeItem(SessionItem* parent, const TagIndex& tag_index) = 0;
 
+  /**
+   * @brief Inserts items as a contiguous range into the given parent and takes ownership of them.
+   *
+   * @param items Items to insert.
+   * @param parent The parent where to insert.
+   * @param tag_index A tag_index pointing to the insert place of the first item.
+   * @return Pointers to the inserted items.
+   */
+  virtual std::vector<SessionItem*> InsertItems(std::vector<std::unique_ptr<SessionItem>> items,
+                                                SessionItem* parent, const TagIndex& tag_index) = 0;
+
+  /**
+   * @brief Takes a contiguous range of children from a parent and returns them to the caller.
+   *
+   * @param parent A parent item from where take the items.
+   * @param tag_index A tag_index pointing to the first child.
+   * @param count The number of children to take.
+   * @return Taken items.
+   */
+  virtual std::vector<std::unique_ptr<SessionItem>> TakeItems(SessionItem* parent,
+                                                              const TagIndex& tag_index,
+                                                              std::size_t count) = 0;
+
   /**
    * @brief Sets the value to the given data role of the given item.
    *
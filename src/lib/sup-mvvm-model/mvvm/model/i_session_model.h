@@ -26,6 +26,7 @@
 #include <mvvm/model_export.h>
 
 #include <memory>
+#include <vector>
 
 namespace mvvm
 {
@@ -102,6 +103,33 @@ public:
    */
   virtual std::unique_ptr<SessionItem> TakeItem(SessionItem* parent, const TagIndex& tag_index) = 0;
 
+  /**
+   * @brief Inserts a contiguous range of items into the given parent and takes ownership of them.
+   *
+   * The whole range is validated once and is inserted as a single operation. Observers are
+   * notified with a single ItemsInsertedEvent, undo stack gets a single command.
+   *
+   * @param items Items to insert.
+   * @param parent The parent where to insert.
+   * @param tag_index A tag_index pointing to the place of the first inserted item.
+   * @return Pointers to inserted items.
+   */
+  virtual std::vector<SessionItem*> InsertItems(std::vector<std::unique_ptr<SessionItem>> items,
+                                                SessionItem* parent,
+                                                const TagIndex& tag_index) = 0;
+
+  /**
+   * @brief Takes a contiguous range of children from a parent and returns them to the caller.
+   *
+   * @param parent A parent item from where take items.
+   * @param tag_index A tag_index pointing to the first child to take.
+   * @param count The number of children to take.
+   * @return Taken items.
+   */
+  virtual std::vector<std::unique_ptr<SessionItem>> TakeItems(SessionItem* parent,
+                                                              const TagIndex& tag_index,
+                                                              std::size_t count) = 0;
+
   /**
    * @brief Removes an item from the model and discards it.
    *
@@ -0,0 +1,122 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "item_arena.h"
+
+namespace
+{
+
+/**
+ * @brief The size of the header placed in front of the item storage to remember its resource.
+ */
+const std::size_t kHeaderSize = alignof(std::max_align_t);
+
+static_assert(sizeof(std::pmr::memory_resource*) <= kHeaderSize);
+
+thread_local std::pmr::memory_resource* current_item_resource{nullptr};
+
+}  // namespace
+
+namespace mvvm
+{
+
+ItemArena::ItemArena(std::pmr::memory_resource* upstream) : m_pool(upstream) {}
+
+ItemArena::~ItemArena() = default;
+
+std::size_t ItemArena::GetAllocationCount() const
+{
+  return m_allocation_count;
+}
+
+std::size_t ItemArena::GetAllocatedBytes() const
+{
+  return m_allocated_bytes;
+}
+
+bool ItemArena::Release()
+{
+  if (m_allocation_count > 0)
+  {
+    return false;
+  }
+
+  m_pool.release();
+  return true;
+}
+
+void* ItemArena::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+  auto result = m_pool.allocate(bytes, alignment);
+  ++m_allocation_count;
+  m_allocated_bytes += bytes;
+  return result;
+}
+
+void ItemArena::do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment)
+{
+  m_pool.deallocate(ptr, bytes, alignment);
+  --m_allocation_count;
+  m_allocated_bytes -= bytes;
+}
+
+bool ItemArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+  return this == &other;
+}
+
+ItemMemoryScope::ItemMemoryScope(std::pmr::memory_resource* resource)
+    : m_previous(current_item_resource)
+{
+  current_item_resource = resource;
+}
+
+ItemMemoryScope::~ItemMemoryScope()
+{
+  current_item_resource = m_previous;
+}
+
+std::pmr::memory_resource* GetItemMemoryResource()
+{
+  return current_item_resource ? current_item_resource : std::pmr::get_default_resource();
+}
+
+void* AllocateItemStorage(std::size_t size)
+{
+  auto resource = GetItemMemoryResource();
+  auto storage = static_cast<std::byte*>(
+      resource->allocate(size + kHeaderSize, alignof(std::max_align_t)));
+  *reinterpret_cast<std::pmr::memory_resource**>(storage) = resource;
+  return storage + kHeaderSize;
+}
+
+void DeallocateItemStorage(void* ptr, std::size_t size) noexcept
+{
+  if (!ptr)
+  {
+    return;
+  }
+
+  auto storage = static_cast<std::byte*>(ptr) - kHeaderSize;
+  auto resource = *reinterpret_cast<std::pmr::memory_resource**>(storage);
+  resource->deallocate(storage, size + kHeaderSize, alignof(std::max_align_t));
+}
+
+}  // namespace mvvm
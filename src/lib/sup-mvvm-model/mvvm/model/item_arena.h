@@ -0,0 +1,143 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_MODEL_ITEM_ARENA_H_
+#define MVVM_MODEL_ITEM_ARENA_H_
+
+#include <mvvm/model_export.h>
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace mvvm
+{
+
+/**
+ * @brief The ItemArena class is a memory resource intended for the internals of SessionItem
+ * (implementation object, data map nodes, tag containers).
+ *
+ * Memory is taken from upstream in big chunks and reused, so items created one after another
+ * are located close to each other. The arena keeps track of live allocations, which makes it
+ * possible to release all memory at once, when the last item is gone.
+ *
+ * The arena is used only for items created while ItemMemoryScope with the arena is active, items
+ * created outside of the scope (e.g. by the usual SessionModel::InsertItem call) are allocated from
+ * the default resource and get no benefit from it.
+ *
+ * All items allocated in the arena must be destroyed before the arena itself.
+ */
+class MVVM_MODEL_EXPORT ItemArena : public std::pmr::memory_resource
+{
+public:
+  explicit ItemArena(std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+  ~ItemArena() override;
+
+  ItemArena(const ItemArena&) = delete;
+  ItemArena& operator=(const ItemArena&) = delete;
+  ItemArena(ItemArena&&) = delete;
+  ItemArena& operator=(ItemArena&&) = delete;
+
+  /**
+   * @brief Returns the number of allocations which are still alive.
+   */
+  std::size_t GetAllocationCount() const;
+
+  /**
+   * @brief Returns the number of bytes occupied by alive allocations.
+   */
+  std::size_t GetAllocatedBytes() const;
+
+  /**
+   * @brief Returns all memory to the upstream resource.
+   *
+   * The release happens only if there are no alive allocations.
+   *
+   * @return True if memory was released.
+   */
+  bool Release();
+
+private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override;
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+  std::pmr::unsynchronized_pool_resource m_pool;
+  std::size_t m_allocation_count{0};
+  std::size_t m_allocated_bytes{0};
+};
+
+/**
+ * @brief The ItemMemoryScope class sets the memory resource for internals of all items created in
+ * the current thread while the scope is alive.
+ *
+ * @code{.cpp}
+ * SessionModel model;
+ * model.SetItemArena(std::make_unique<ItemArena>());
+ * {
+ *   ItemMemoryScope scope(model.GetItemArena());
+ *   model.InsertItem<CompoundItem>();
+ * }
+ * @endcode
+ */
+class MVVM_MODEL_EXPORT ItemMemoryScope
+{
+public:
+  /**
+   * @brief Main c-tor.
+   *
+   * @param resource The resource to use, nullptr means default resource.
+   */
+  explicit ItemMemoryScope(std::pmr::memory_resource* resource);
+  ~ItemMemoryScope();
+
+  ItemMemoryScope(const ItemMemoryScope&) = delete;
+  ItemMemoryScope& operator=(const ItemMemoryScope&) = delete;
+  ItemMemoryScope(ItemMemoryScope&&) = delete;
+  ItemMemoryScope& operator=(ItemMemoryScope&&) = delete;
+
+private:
+  std::pmr::memory_resource* m_previous{nullptr};
+};
+
+/**
+ * @brief Returns the memory resource which should be used for the internals of newly created
+ * items.
+ *
+ * It is the resource of the innermost ItemMemoryScope, or default resource if no scope is active.
+ */
+MVVM_MODEL_EXPORT std::pmr::memory_resource* GetItemMemoryResource();
+
+/**
+ * @brief Allocates a storage for the object of the given size from the current item memory
+ * resource.
+ *
+ * The resource is remembered in front of the storage, so the object can be deallocated later
+ * without knowing the scope. Intended to be used by class-specific operator new.
+ */
+MVVM_MODEL_EXPORT void* AllocateItemStorage(std::size_t size);
+
+/**
+ * @brief Returns storage allocated via AllocateItemStorage to its memory resource.
+ */
+MVVM_MODEL_EXPORT void DeallocateItemStorage(void* ptr, std::size_t size) noexcept;
+
+}  // namespace mvvm
+
+#endif  // MVVM_MODEL_ITEM_ARENA_H_
@@ -75,6 +75,7 @@ void InitItemFactory(ItemFactory& factory)
   factory.RegisterItem<CompoundItem>();
   factory.RegisterItem<ContainerItem>();
   factory.RegisterItem<Data1DItem>();
+  factory.RegisterItem<Data2DItem>();
   factory.RegisterItem<FixedBinAxisItem>();
   factory.RegisterItem<GraphItem>();
   factory.RegisterItem<GraphViewportItem>();
@@ -86,6 +87,7 @@ void InitItemFactory(ItemFactory& factory)
   factory.RegisterItem<PointwiseAxisItem>();
   factory.RegisterItem<PropertyItem>();
   factory.RegisterItem<SessionItem>();
+  factory.RegisterItem<StreamData1DItem>();
   factory.RegisterItem<TextItem>();
   factory.RegisterItem<VectorItem>();
   factory.RegisterItem<ViewportAxisItem>();
@@ -335,8 +335,11 @@ bool HasAppearanceFlag(const SessionItem& item, Appearance flag)
 
 bool ReplaceData(SessionItem& item, const variant_t& value, int role)
 {
-  item.SetData(variant_t(), role);   // will remove old variant for given role
-  return item.SetData(value, role);  // will succeed
+  BeginMacro(item, "ReplaceData");
+  item.SetData(variant_t(), role);                // will remove old variant for given role
+  const bool result = item.SetData(value, role);  // will succeed
+  EndMacro(item);
+  return result;
 }
 
 bool MoveUp(SessionItem& item)
@@ -215,6 +215,9 @@ MVVM_MODEL_EXPORT bool HasAppearanceFlag(const SessionItem& item, Appearance fla
  * item.SetData("abc", role); <-- will fail because we do not allow to switch data
  * ReplaceData(&item, "abc", role); <-- will succeed, new data will be std::string, instead of
  * double
+ *
+ * If the item belongs to the model with undo/redo enabled, the replacement is a single macro
+ * command.
  */
 MVVM_MODEL_EXPORT bool ReplaceData(SessionItem& item, const variant_t& value, int role);
 
@@ -41,6 +41,20 @@ std::unique_ptr<SessionItem> ModelComposer::TakeItem(SessionItem *parent, const
   return parent->TakeItem(tag_index);
 }
 
+std::vector<SessionItem *> ModelComposer::InsertItems(
+    std::vector<std::unique_ptr<SessionItem>> items, SessionItem *parent,
+    const TagIndex &tag_index)
+{
+  return parent->InsertItems(std::move(items), tag_index);
+}
+
+std::vector<std::unique_ptr<SessionItem>> ModelComposer::TakeItems(SessionItem *parent,
+                                                                   const TagIndex &tag_index,
+                                                                   std::size_t count)
+{
+  return parent->TakeItems(tag_index, count);
+}
+
 bool ModelComposer::SetData(SessionItem *item, const variant_t &value, int role)
 {
   return item->SetDataImpl(value, role);
@@ -61,6 +61,26 @@ public:
     return result;
   }
 
+  std::vector<SessionItem*> InsertItems(std::vector<std::unique_ptr<SessionItem>> items,
+                                        SessionItem* parent, const TagIndex& tag_index) override
+  {
+    const auto count = items.size();
+    m_event_handler->Notify<AboutToInsertItemsEvent>(parent, tag_index, count);
+    auto result = T::InsertItems(std::move(items), parent, tag_index);
+    m_event_handler->Notify<ItemsInsertedEvent>(parent, tag_index, count);
+    return result;
+  }
+
+  std::vector<std::unique_ptr<SessionItem>> TakeItems(SessionItem* parent,
+                                                      const TagIndex& tag_index,
+                                                      std::size_t count) override
+  {
+    m_event_handler->Notify<AboutToRemoveItemsEvent>(parent, tag_index, count);
+    auto result = T::TakeItems(parent, tag_index, count);
+    m_event_handler->Notify<ItemsRemovedEvent>(parent, tag_index, count);
+    return result;
+  }
+
   bool SetData(SessionItem* item, const variant_t& value, int role) override
   {
     auto result = T::SetData(item, value, role);
@@ -55,7 +55,7 @@ SessionItem::SessionItem(const std::string& item_type)
 
 SessionItem::SessionItem(const std::string& item_type, std::unique_ptr<SessionItemData> data,
                          std::unique_ptr<TaggedItems> tags)
-    : p_impl(std::make_unique<SessionItemImpl>(item_type, std::move(data), std::move(tags)))
+    : p_impl(std::make_unique<SessionItemImpl>(Atom(item_type), std::move(data), std::move(tags)))
 {
 }
 
@@ -87,11 +87,16 @@ std::unique_ptr<SessionItem> SessionItem::Clone() const
   return std::make_unique<SessionItem>(*this);
 }
 
-std::string SessionItem::GetType() const
+const std::string& SessionItem::GetType() const
 {
   return p_impl->GetType();
 }
 
+Atom SessionItem::GetTypeAtom() const
+{
+  return p_impl->GetTypeAtom();
+}
+
 std::string SessionItem::GetIdentifier() const
 {
   return Data<std::string>(DataRole::kIdentifier);
@@ -210,6 +215,35 @@ std::unique_ptr<SessionItem> SessionItem::TakeItem(const TagIndex& tag_index)
   return result;
 }
 
+std::vector<SessionItem*> SessionItem::InsertItems(std::vector<std::unique_ptr<SessionItem>> items,
+                                                   const TagIndex& tag_index)
+{
+  auto insert_tag_index = GetTaggedItems()->GetInsertTagIndex(tag_index);
+  utils::ValidateItemsInsert(items, this, insert_tag_index);
+
+  auto result = p_impl->GetTaggedItems()->InsertItems(std::move(items), insert_tag_index);
+  for (auto item : result)
+  {
+    item->SetParent(this);
+    item->SetModel(GetModel());
+  }
+  return result;
+}
+
+std::vector<std::unique_ptr<SessionItem>> SessionItem::TakeItems(const TagIndex& tag_index,
+                                                                 std::size_t count)
+{
+  utils::ValidateTakeItems(this, tag_index, count);
+
+  auto result = p_impl->GetTaggedItems()->TakeItems(tag_index, count);
+  for (auto& item : result)
+  {
+    item->SetParent(nullptr);
+    item->SetModel(nullptr);
+  }
+  return result;
+}
+
 bool SessionItem::IsEditable() const
 {
   return !(appearance(*this) & Appearance::kReadOnly);
@@ -323,7 +357,7 @@ void SessionItem::SetParent(SessionItem* parent)
 void SessionItem::SetDataAndTags(std::unique_ptr<SessionItemData> data,
                                  std::unique_ptr<TaggedItems> tags)
 {
-  p_impl = std::make_unique<SessionItemImpl>(GetType(), std::move(data), std::move(tags));
+  p_impl = std::make_unique<SessionItemImpl>(GetTypeAtom(), std::move(data), std::move(tags));
 }
 
 }  // namespace mvvm
@@ -21,6 +21,7 @@
 #ifndef MVVM_MODEL_SESSION_ITEM_H_
 #define MVVM_MODEL_SESSION_ITEM_H_
 
+#include <mvvm/core/atom.h>
 #include <mvvm/core/mvvm_exceptions.h>
 #include <mvvm/core/variant.h>
 #include <mvvm/model/mvvm_types.h>
@@ -84,7 +85,12 @@ public:
   /**
    * @brief Returns the type of the item.
    */
-  std::string GetType() const;
+  const std::string& GetType() const;
+
+  /**
+   * @brief Returns the type of the item as interned atom.
+   */
+  Atom GetTypeAtom() const;
 
   /**
    * @brief Returns item unique identifier.
@@ -271,6 +277,23 @@ public:
    */
   std::unique_ptr<SessionItem> TakeItem(const TagIndex& tag_index);
 
+  /**
+   * @brief Inserts items as a contiguous range starting from the given tag_index, ownership is
+   * taken.
+   *
+   * @param items Items to insert.
+   * @param tag_index A tag_index pointing to the insert place of the first item.
+   * @return Convenience pointers to just inserted items.
+   */
+  std::vector<SessionItem*> InsertItems(std::vector<std::unique_ptr<SessionItem>> items,
+                                        const TagIndex& tag_index);
+
+  /**
+   * @brief Removes a contiguous range of items starting from the given tag_index, returns them to
+   * the caller.
+   */
+  std::vector<std::unique_ptr<SessionItem>> TakeItems(const TagIndex& tag_index, std::size_t count);
+
   /**
    * @brief Returns true if this item has editable flag set.
    *
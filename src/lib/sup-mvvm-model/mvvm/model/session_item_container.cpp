@@ -20,6 +20,7 @@
 
 #include "session_item_container.h"
 
+#include "item_arena.h"
 #include "session_item.h"
 
 #include <mvvm/utils/container_utils.h>
@@ -29,12 +30,23 @@
 namespace mvvm
 {
 
-SessionItemContainer::SessionItemContainer(mvvm::TagInfo tag_info) : m_tag_info(std::move(tag_info))
+SessionItemContainer::SessionItemContainer(mvvm::TagInfo tag_info)
+    : m_tag_info(std::move(tag_info)), m_items(GetItemMemoryResource())
 {
 }
 
 SessionItemContainer::~SessionItemContainer() = default;
 
+void* SessionItemContainer::operator new(std::size_t size)
+{
+  return AllocateItemStorage(size);
+}
+
+void SessionItemContainer::operator delete(void* ptr, std::size_t size) noexcept
+{
+  DeallocateItemStorage(ptr, size);
+}
+
 bool SessionItemContainer::IsEmpty() const
 {
   return m_items.empty();
@@ -61,7 +73,7 @@ bool SessionItemContainer::CanInsertItem(const SessionItem* item, std::size_t in
     return false;
   }
 
-  return CanInsertType(item->GetType(), index);
+  return CanInsertType(item->GetTypeAtom(), index);
 }
 
 bool SessionItemContainer::CanInsertType(const std::string& item_type, std::size_t index) const
@@ -72,9 +84,17 @@ bool SessionItemContainer::CanInsertType(const std::string& item_type, std::size
   return valid_index && enough_place && valid_type;
 }
 
+bool SessionItemContainer::CanInsertType(Atom item_type, std::size_t index) const
+{
+  const bool valid_index = index <= GetItemCount();
+  const bool enough_place = !IsMaximumReached();
+  const bool valid_type = m_tag_info.IsValidType(item_type);
+  return valid_index && enough_place && valid_type;
+}
+
 bool SessionItemContainer::CanMoveItem(const SessionItem* item, std::size_t index) const
 {
-  if (!item || !m_tag_info.IsValidType(item->GetType()))
+  if (!item || !m_tag_info.IsValidType(item->GetTypeAtom()))
   {
     return false;
   }
@@ -136,6 +156,62 @@ std::unique_ptr<SessionItem> SessionItemContainer::TakeItem(std::size_t index)
   return nullptr;
 }
 
+bool SessionItemContainer::CanInsertItems(const std::vector<std::unique_ptr<SessionItem>>& items,
+                                          std::size_t index) const
+{
+  if (!CanInsertRange(items.size(), index))
+  {
+    return false;
+  }
+
+  // items with a parent (including children of this container) are rejected by the caller, so the
+  // check of the membership isn't repeated here
+  auto is_valid = [this](const auto& item)
+  { return item && m_tag_info.IsValidType(item->GetTypeAtom()); };
+  return std::all_of(items.begin(), items.end(), is_valid);
+}
+
+std::vector<SessionItem*> SessionItemContainer::InsertItems(
+    std::vector<std::unique_ptr<SessionItem>> items, std::size_t index)
+{
+  if (!CanInsertRange(items.size(), index))
+  {
+    return {};
+  }
+
+  auto result = utils::GetVectorOfPtrs(items);
+  m_items.insert(std::next(m_items.begin(), index), std::make_move_iterator(items.begin()),
+                 std::make_move_iterator(items.end()));
+  return result;
+}
+
+bool SessionItemContainer::CanTakeItems(std::size_t index, std::size_t count) const
+{
+  const bool valid_range = index < GetItemCount() && count <= GetItemCount() - index;
+  return valid_range && GetItemCount() - count >= m_tag_info.GetMin();
+}
+
+std::vector<std::unique_ptr<SessionItem>> SessionItemContainer::TakeItems(std::size_t index,
+                                                                          std::size_t count)
+{
+  if (!CanTakeItems(index, count))
+  {
+    return {};
+  }
+
+  auto begin = std::next(m_items.begin(), index);
+  auto end = std::next(begin, count);
+  std::vector<std::unique_ptr<SessionItem>> result(std::make_move_iterator(begin),
+                                                   std::make_move_iterator(end));
+  m_items.erase(begin, end);
+  return result;
+}
+
+bool SessionItemContainer::CanInsertRange(std::size_t count, std::size_t index) const
+{
+  return index <= GetItemCount() && m_tag_info.GetMax() - GetItemCount() >= count;
+}
+
 std::optional<std::size_t> SessionItemContainer::IndexOfItem(const SessionItem* item) const
 {
   auto pos = std::find_if(m_items.begin(), m_items.end(),
@@ -148,11 +224,16 @@ SessionItem* SessionItemContainer::ItemAt(std::size_t index) const
   return index < GetItemCount() ? m_items[index].get() : nullptr;
 }
 
-std::string SessionItemContainer::GetName() const
+const std::string& SessionItemContainer::GetName() const
 {
   return m_tag_info.GetName();
 }
 
+Atom SessionItemContainer::GetNameAtom() const
+{
+  return m_tag_info.GetNameAtom();
+}
+
 TagInfo SessionItemContainer::GetTagInfo() const
 {
   return m_tag_info;
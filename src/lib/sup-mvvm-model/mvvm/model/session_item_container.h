@@ -24,6 +24,7 @@
 #include <mvvm/model/taginfo.h>
 
 #include <memory>
+#include <memory_resource>
 #include <vector>
 
 namespace mvvm
@@ -38,7 +39,7 @@ class SessionItem;
 class MVVM_MODEL_EXPORT SessionItemContainer
 {
 public:
-  using container_t = std::vector<std::unique_ptr<SessionItem>>;
+  using container_t = std::pmr::vector<std::unique_ptr<SessionItem>>;
   using const_iterator = container_t::const_iterator;
 
   explicit SessionItemContainer(TagInfo tag_info);
@@ -47,6 +48,9 @@ public:
 
   ~SessionItemContainer();
 
+  static void* operator new(std::size_t size);
+  static void operator delete(void* ptr, std::size_t size) noexcept;
+
   /**
    * @brief Checks if the container is empty.
    */
@@ -86,6 +90,12 @@ public:
    */
   bool CanInsertType(const std::string& item_type, std::size_t new_index) const;
 
+  /**
+   * @brief Checks if a new item with the given type can be inserted into the given index (atom
+   * version).
+   */
+  bool CanInsertType(Atom item_type, std::size_t new_index) const;
+
   /**
    * @brief Checks if the item can be moved into the given index.
    *
@@ -105,6 +115,42 @@ public:
    */
   std::unique_ptr<SessionItem> TakeItem(std::size_t index);
 
+  /**
+   * @brief Checks if the given items can be inserted as a contiguous range starting from the given
+   * index.
+   */
+  bool CanInsertItems(const std::vector<std::unique_ptr<SessionItem>>& items,
+                      std::size_t index) const;
+
+  /**
+   * @brief Inserts items as a contiguous range starting from the given index, returns pointers to
+   * the items in the case of success.
+   *
+   * Items are expected to be validated by CanInsertItems beforehand, here only the index and the
+   * number of items are checked. If the range doesn't fit (wrong index or maximum number of items
+   * exceeded), will return an empty vector.
+   *
+   * @param items Items to be inserted, ownership will be taken.
+   * @param index Insert index of the first item in a range [0, itemCount]
+   * @return Pointers to just inserted items.
+   */
+  std::vector<SessionItem*> InsertItems(std::vector<std::unique_ptr<SessionItem>> items,
+                                        std::size_t index);
+
+  /**
+   * @brief Checks if the given number of items can be removed starting from the given index.
+   */
+  bool CanTakeItems(std::size_t index, std::size_t count) const;
+
+  /**
+   * @brief Removes a contiguous range of items starting from the given index, and returns them to
+   * the user.
+   *
+   * If items can't be removed (wrong range, or minimum number of items would be violated), will
+   * return an empty vector.
+   */
+  std::vector<std::unique_ptr<SessionItem>> TakeItems(std::size_t index, std::size_t count);
+
   /**
    * @brief Returns index of item in a vector of items.
    *
@@ -120,7 +166,12 @@ public:
   /**
    * @brief Returns the name of the container.
    */
-  std::string GetName() const;
+  const std::string& GetName() const;
+
+  /**
+   * @brief Returns the name of the container as interned atom.
+   */
+  Atom GetNameAtom() const;
 
   /**
    * @brief Returns TagInfo describing this container.
@@ -153,6 +204,12 @@ public:
   bool IsMinimumReached() const;
 
 private:
+  /**
+   * @brief Checks if the given number of items fits into the container starting from the given
+   * index.
+   */
+  bool CanInsertRange(std::size_t count, std::size_t index) const;
+
   TagInfo m_tag_info;
   container_t m_items;
 };
@@ -20,14 +20,61 @@
 
 #include "session_item_data.h"
 
+#include "item_arena.h"
+
 #include <mvvm/core/mvvm_exceptions.h>
 
 #include <algorithm>
+#include <atomic>
 #include <sstream>
 
+namespace
+{
+
+/**
+ * @brief Returns next revision number, unique across the application.
+ */
+std::uint64_t GetNextRevision()
+{
+  static std::atomic<std::uint64_t> revision{0};
+  return ++revision;
+}
+
+}  // namespace
+
 namespace mvvm
 {
 
+SessionItemData::SessionItemData()
+    : m_values(GetItemMemoryResource()), m_revision(GetNextRevision())
+{
+}
+
+SessionItemData::SessionItemData(const SessionItemData& other)
+    : m_values(other.m_values, GetItemMemoryResource()), m_revision(GetNextRevision())
+{
+}
+
+SessionItemData& SessionItemData::operator=(const SessionItemData& other)
+{
+  if (this != &other)
+  {
+    m_values = other.m_values;
+    m_revision = GetNextRevision();
+  }
+  return *this;
+}
+
+void* SessionItemData::operator new(std::size_t size)
+{
+  return AllocateItemStorage(size);
+}
+
+void SessionItemData::operator delete(void* ptr, std::size_t size) noexcept
+{
+  DeallocateItemStorage(ptr, size);
+}
+
 std::vector<std::int32_t> SessionItemData::GetRoles() const
 {
   std::vector<std::int32_t> result;
@@ -42,6 +89,24 @@ variant_t SessionItemData::Data(std::int32_t role) const
   return iter == m_values.end() ? variant_t() : iter->second;
 }
 
+const variant_t& SessionItemData::DataReference(std::int32_t role) const
+{
+  static const variant_t kEmptyData;
+  auto iter = m_values.find(role);
+  return iter == m_values.end() ? kEmptyData : iter->second;
+}
+
+variant_t* SessionItemData::GetMutableData(std::int32_t role)
+{
+  auto iter = m_values.find(role);
+  if (iter == m_values.end())
+  {
+    return nullptr;
+  }
+  m_revision = GetNextRevision();
+  return &iter->second;
+}
+
 bool SessionItemData::SetData(const variant_t& value, std::int32_t role)
 {
   auto iter = m_values.find(role);
@@ -52,6 +117,7 @@ bool SessionItemData::SetData(const variant_t& value, std::int32_t role)
     if (utils::IsValid(value))
     {
       m_values.insert(iter, {role, value});
+      m_revision = GetNextRevision();
       return true;
     }
     return false;  // invalid value is ignored
@@ -69,11 +135,13 @@ bool SessionItemData::SetData(const variant_t& value, std::int32_t role)
       return false;  // same value is ignored
     }
     iter->second = value;
+    m_revision = GetNextRevision();
     return true;
   }
 
   // if new value is invalid, it will erase old value and role
   m_values.erase(iter);
+  m_revision = GetNextRevision();
   return true;
 }
 
@@ -82,6 +150,11 @@ bool SessionItemData::HasData(std::int32_t role) const
   return m_values.find(role) != m_values.end();
 }
 
+std::uint64_t SessionItemData::GetRevision() const
+{
+  return m_revision;
+}
+
 void SessionItemData::AssureCompatibility(const variant_t& old_value, const variant_t& new_value,
                                           std::int32_t role) const
 {
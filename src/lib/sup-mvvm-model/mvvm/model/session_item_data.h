@@ -24,6 +24,7 @@
 #include <mvvm/core/variant.h>
 
 #include <map>
+#include <memory_resource>
 
 namespace mvvm
 {
@@ -34,9 +35,43 @@ namespace mvvm
 class MVVM_MODEL_EXPORT SessionItemData
 {
 public:
-  using container_t = std::map<std::int32_t, variant_t>;
+  using container_t = std::pmr::map<std::int32_t, variant_t>;
   using const_iterator = container_t::const_iterator;
 
+  /**
+   * @brief Default c-tor.
+   *
+   * Data nodes will be allocated from the current item memory resource.
+   */
+  SessionItemData();
+
+  /**
+   * @brief Copy c-tor.
+   *
+   * The copy is allocated from the current item memory resource, and not from the resource of
+   * the original.
+   */
+  SessionItemData(const SessionItemData& other);
+
+  /**
+   * @brief Copy assignment, the container gets a new revision.
+   */
+  SessionItemData& operator=(const SessionItemData& other);
+
+  /**
+   * @brief Move c-tor, the container keeps its memory resource and revision.
+   */
+  SessionItemData(SessionItemData&& other) = default;
+
+  /**
+   * @brief Move assignment, the container keeps its own memory resource and takes the revision of
+   * the other.
+   */
+  SessionItemData& operator=(SessionItemData&& other) = default;
+
+  static void* operator new(std::size_t size);
+  static void operator delete(void* ptr, std::size_t size) noexcept;
+
   /**
    * @brief Returns vector of all roles for which data exists.
    */
@@ -49,6 +84,24 @@ public:
    */
   variant_t Data(std::int32_t role) const;
 
+  /**
+   * @brief Returns a reference to the data for a given role, without copying the variant.
+   *
+   * Will return a reference to non-initialized variant if the role doesn't exist. The reference
+   * is valid until the data for this role is changed.
+   */
+  const variant_t& DataReference(std::int32_t role) const;
+
+  /**
+   * @brief Returns a pointer to the data for a given role for modification in place, or nullptr
+   * if the role doesn't exist.
+   *
+   * The container gets a new revision. It is the responsibility of the caller to keep the type of
+   * the variant and to notify about the change. The pointer is valid until the data for this role
+   * is changed.
+   */
+  variant_t* GetMutableData(std::int32_t role);
+
   /**
    * @brief Sets the data for a given role and returns true if data was changed.
    *
@@ -57,7 +110,8 @@ public:
    *
    * If the new variant is incompatible with the existing variant (i.e. has an underlying type that
    * differs from current type), exception will be thrown. This means that it is not possible to
-   * change the type of variant, once the role was set.
+   * change the type of variant, once the role was set. Arrays of numbers are the exception, see
+   * utils::AreCompatible.
    *
    * @see also utils::ReplaceData
    */
@@ -68,6 +122,15 @@ public:
    */
   bool HasData(std::int32_t role) const;
 
+  /**
+   * @brief Returns the revision of the container.
+   *
+   * Revision is a number unique across all containers of the application. It is updated each
+   * time the data is changed, so it can be used as a key to validate quantities derived from the
+   * data and cached elsewhere. Zero is never used as a revision.
+   */
+  std::uint64_t GetRevision() const;
+
   const_iterator begin() const;
 
   const_iterator end() const;
@@ -82,6 +145,7 @@ private:
                            std::int32_t role) const;
 
   container_t m_values;
+  std::uint64_t m_revision{0};
 };
 
 }  // namespace mvvm
@@ -21,6 +21,7 @@
 #include "session_item_impl.h"
 
 #include "i_session_model.h"
+#include "item_arena.h"
 #include "session_item.h"
 #include "session_item_data.h"
 #include "tagged_items.h"
@@ -30,17 +31,39 @@
 namespace mvvm
 {
 
-SessionItemImpl::SessionItemImpl(std::string item_type, std::unique_ptr<SessionItemData> data,
+SessionItemImpl::SessionItemImpl(Atom item_type, std::unique_ptr<SessionItemData> data,
                                  std::unique_ptr<TaggedItems> tags)
-    : m_item_type(std::move(item_type))
+    : m_item_type(item_type)
     , m_item_data(std::move(data))
     , m_tagged_items(std::move(tags))
 {
 }
 
+SessionItemImpl::SessionItemImpl(const std::string &item_type,
+                                 std::unique_ptr<SessionItemData> data,
+                                 std::unique_ptr<TaggedItems> tags)
+    : SessionItemImpl(Atom(item_type), std::move(data), std::move(tags))
+{
+}
+
 SessionItemImpl::~SessionItemImpl() = default;
 
-std::string SessionItemImpl::GetType() const
+void* SessionItemImpl::operator new(std::size_t size)
+{
+  return AllocateItemStorage(size);
+}
+
+void SessionItemImpl::operator delete(void* ptr, std::size_t size) noexcept
+{
+  DeallocateItemStorage(ptr, size);
+}
+
+const std::string &SessionItemImpl::GetType() const
+{
+  return m_item_type.GetName();
+}
+
+Atom SessionItemImpl::GetTypeAtom() const
 {
   return m_item_type;
 }
@@ -21,6 +21,7 @@
 #ifndef MVVM_MODEL_SESSION_ITEM_IMPL_H_
 #define MVVM_MODEL_SESSION_ITEM_IMPL_H_
 
+#include <mvvm/core/atom.h>
 #include <mvvm/core/variant.h>
 #include <mvvm/signals/signal_slot_fwd.h>
 
@@ -45,7 +46,9 @@ class TaggedItems;
 class SessionItemImpl
 {
 public:
-  SessionItemImpl(std::string item_type, std::unique_ptr<SessionItemData> data,
+  SessionItemImpl(Atom item_type, std::unique_ptr<SessionItemData> data,
+                  std::unique_ptr<TaggedItems> tags);
+  SessionItemImpl(const std::string& item_type, std::unique_ptr<SessionItemData> data,
                   std::unique_ptr<TaggedItems> tags);
   ~SessionItemImpl();
 
@@ -54,7 +57,15 @@ public:
   SessionItemImpl(SessionItemImpl&&) = delete;
   SessionItemImpl& operator=(SessionItemImpl&&) = delete;
 
-  std::string GetType() const;
+  /**
+   * @brief Allocates implementation from the current item memory resource.
+   */
+  static void* operator new(std::size_t size);
+  static void operator delete(void* ptr, std::size_t size) noexcept;
+
+  const std::string& GetType() const;
+
+  Atom GetTypeAtom() const;
 
   variant_t Data(std::int32_t role);
 
@@ -86,7 +97,7 @@ public:
   Slot* GetSlot();
 
 private:
-  std::string m_item_type;
+  Atom m_item_type;
   std::unique_ptr<SessionItemData> m_item_data;
   std::unique_ptr<TaggedItems> m_tagged_items;
   SessionItem* m_parent{nullptr};
@@ -20,6 +20,7 @@
 
 #include "session_model.h"
 
+#include "item_arena.h"
 #include "item_pool.h"
 #include "model_composer.h"
 #include "model_utils.h"
@@ -51,6 +52,7 @@ struct SessionModel::SessionModelImpl
 {
   SessionModel* m_self{nullptr};
   std::string m_model_type;
+  std::unique_ptr<ItemArena> m_item_arena;  //!< should outlive all items, hence declared first
   std::shared_ptr<ItemPool> m_pool;
   std::unique_ptr<IModelComposer> m_composer;
   std::unique_ptr<SessionItem> m_root_item;
@@ -131,6 +133,37 @@ std::unique_ptr<SessionItem> SessionModel::TakeItem(SessionItem* parent, const T
   return p_impl->m_composer->TakeItem(parent, tag_index);
 }
 
+std::vector<SessionItem*> SessionModel::InsertItems(std::vector<std::unique_ptr<SessionItem>> items,
+                                                    SessionItem* parent, const TagIndex& tag_index)
+{
+  if (!parent)
+  {
+    parent = GetRootItem();
+  }
+
+  if (items.empty())
+  {
+    return {};
+  }
+
+  auto actual_tagindex = utils::GetInsertTagIndex(parent, tag_index);
+  utils::ValidateItemsInsert(items, parent, actual_tagindex);
+  return p_impl->m_composer->InsertItems(std::move(items), parent, actual_tagindex);
+}
+
+std::vector<std::unique_ptr<SessionItem>> SessionModel::TakeItems(SessionItem* parent,
+                                                                  const TagIndex& tag_index,
+                                                                  std::size_t count)
+{
+  if (count == 0)
+  {
+    return {};
+  }
+
+  utils::ValidateTakeItems(parent, tag_index, count);
+  return p_impl->m_composer->TakeItems(parent, tag_index, count);
+}
+
 void SessionModel::RemoveItem(SessionItem* item)
 {
   if (!item)
@@ -171,6 +204,12 @@ SessionItem* SessionModel::FindItem(const std::string& id) const
 void SessionModel::Clear()
 {
   ReplaceRootItem(utils::CreateEmptyRootItem());
+
+  if (p_impl->m_item_arena)
+  {
+    // does nothing if some items from the arena are still alive (i.e. kept by the command stack)
+    p_impl->m_item_arena->Release();
+  }
 }
 
 void SessionModel::ReplaceRootItem(std::unique_ptr<SessionItem> root_item)
@@ -193,4 +232,18 @@ void SessionModel::SetComposer(std::unique_ptr<IModelComposer> composer)
   p_impl->m_composer = std::move(composer);
 }
 
+void SessionModel::SetItemArena(std::unique_ptr<ItemArena> arena)
+{
+  if (p_impl->m_item_arena && p_impl->m_item_arena->GetAllocationCount() > 0)
+  {
+    throw LogicErrorException("Can't replace an arena which still holds alive items");
+  }
+  p_impl->m_item_arena = std::move(arena);
+}
+
+ItemArena* SessionModel::GetItemArena() const
+{
+  return p_impl->m_item_arena.get();
+}
+
 }  // namespace mvvm
@@ -31,6 +31,7 @@ namespace mvvm
 class SessionItem;
 class ItemPool;
 class IModelComposer;
+class ItemArena;
 
 /**
  * @brief The SessionModel class is the main model to hold hierarchy of SessionItem objects.
@@ -62,6 +63,13 @@ public:
 
   std::unique_ptr<SessionItem> TakeItem(SessionItem* parent, const TagIndex& tag_index) override;
 
+  std::vector<SessionItem*> InsertItems(std::vector<std::unique_ptr<SessionItem>> items,
+                                        SessionItem* parent, const TagIndex& tag_index) override;
+
+  std::vector<std::unique_ptr<SessionItem>> TakeItems(SessionItem* parent,
+                                                      const TagIndex& tag_index,
+                                                      std::size_t count) override;
+
   void RemoveItem(SessionItem* item) override;
 
   void MoveItem(SessionItem* item, SessionItem* new_parent, const TagIndex& tag_index) override;
@@ -83,6 +91,20 @@ public:
    */
   void SetComposer(std::unique_ptr<IModelComposer> composer);
 
+  /**
+   * @brief Sets an arena to hold the internals of model's items.
+   *
+   * The arena is used only for items created while ItemMemoryScope with this arena is active.
+   * The memory of the arena is released in bulk on Clear(), if no items from the arena are
+   * alive anymore. Items allocated in the arena must not outlive the model.
+   */
+  void SetItemArena(std::unique_ptr<ItemArena> arena);
+
+  /**
+   * @brief Returns an arena used by this model, or nullptr if no arena was set.
+   */
+  ItemArena* GetItemArena() const;
+
 private:
   friend class SessionItem;
 
@@ -20,6 +20,7 @@
 
 #include "tagged_items.h"
 
+#include "item_arena.h"
 #include "session_item.h"
 #include "session_item_container.h"
 
@@ -28,10 +29,20 @@
 namespace mvvm
 {
 
-TaggedItems::TaggedItems() = default;
+TaggedItems::TaggedItems() : m_containers(GetItemMemoryResource()) {}
 
 TaggedItems::~TaggedItems() = default;
 
+void* TaggedItems::operator new(std::size_t size)
+{
+  return AllocateItemStorage(size);
+}
+
+void TaggedItems::operator delete(void* ptr, std::size_t size) noexcept
+{
+  DeallocateItemStorage(ptr, size);
+}
+
 void TaggedItems::RegisterTag(const TagInfo& tag_info, bool set_as_default)
 {
   if (HasTag(tag_info.GetName()))
@@ -42,30 +53,24 @@ void TaggedItems::RegisterTag(const TagInfo& tag_info, bool set_as_default)
   m_containers.emplace_back(std::make_unique<SessionItemContainer>(tag_info));
   if (set_as_default)
   {
-    m_default_tag = tag_info.GetName();
+    m_default_tag = tag_info.GetNameAtom();
   }
 }
 
 bool TaggedItems::HasTag(const std::string& tag) const
 {
-  for (auto& container : m_containers)
-  {
-    if (container->GetName() == tag)
-    {
-      return true;
-    }
-  }
-  return false;
+  auto atom = Atom::Find(tag);
+  return atom.has_value() && !atom->IsEmpty() && FindContainer(atom.value()) != nullptr;
 }
 
-std::string TaggedItems::GetDefaultTag() const
+const std::string& TaggedItems::GetDefaultTag() const
 {
-  return m_default_tag;
+  return m_default_tag.GetName();
 }
 
 void TaggedItems::SetDefaultTag(const std::string& tag)
 {
-  m_default_tag = tag;
+  m_default_tag = Atom(tag);
 }
 
 std::size_t TaggedItems::GetItemCount(const std::string& tag) const
@@ -110,6 +115,37 @@ std::unique_ptr<SessionItem> TaggedItems::TakeItem(const TagIndex& tag_index)
   return GetContainer(tag_index.GetTag())->TakeItem(tag_index.GetIndex());
 }
 
+bool TaggedItems::CanInsertItems(const std::vector<std::unique_ptr<SessionItem>>& items,
+                                 const TagIndex& tag_index) const
+{
+  if (auto container = FindContainer(tag_index.GetTag()); container)
+  {
+    return container->CanInsertItems(items, tag_index.GetIndex());
+  }
+  return false;
+}
+
+std::vector<SessionItem*> TaggedItems::InsertItems(std::vector<std::unique_ptr<SessionItem>> items,
+                                                   const TagIndex& tag_index)
+{
+  return GetContainer(tag_index.GetTag())->InsertItems(std::move(items), tag_index.GetIndex());
+}
+
+bool TaggedItems::CanTakeItems(const TagIndex& tag_index, std::size_t count) const
+{
+  if (auto container = FindContainer(tag_index.GetTag()); container)
+  {
+    return container->CanTakeItems(tag_index.GetIndex(), count);
+  }
+  return false;
+}
+
+std::vector<std::unique_ptr<SessionItem>> TaggedItems::TakeItems(const TagIndex& tag_index,
+                                                                 std::size_t count)
+{
+  return GetContainer(tag_index.GetTag())->TakeItems(tag_index.GetIndex(), count);
+}
+
 bool TaggedItems::CanMoveItem(const SessionItem* item, const TagIndex& tag_index) const
 {
   if (auto container = FindContainer(tag_index.GetTag()); container)
@@ -206,10 +242,22 @@ SessionItemContainer* TaggedItems::GetContainer(const std::string& tag) const
 
 SessionItemContainer* TaggedItems::FindContainer(const std::string& tag) const
 {
-  const std::string tag_name_to_use = tag.empty() ? GetDefaultTag() : tag;
+  // the tag which was never interned can't be the name of any container
+  auto atom = Atom::Find(tag);
+  return atom.has_value() ? FindContainer(atom.value()) : nullptr;
+}
+
+SessionItemContainer* TaggedItems::FindContainer(Atom tag) const
+{
+  const Atom tag_to_use = tag.IsEmpty() ? m_default_tag : tag;
+  if (tag_to_use.IsEmpty())
+  {
+    return nullptr;
+  }
+
   for (const auto& container : m_containers)
   {
-    if (container->GetName() == tag_name_to_use)
+    if (container->GetNameAtom() == tag_to_use)
     {
       return container.get();
     }
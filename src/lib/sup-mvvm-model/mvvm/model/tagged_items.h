@@ -21,10 +21,12 @@
 #ifndef MVVM_MODEL_TAGGED_ITEMS_H_
 #define MVVM_MODEL_TAGGED_ITEMS_H_
 
+#include <mvvm/core/atom.h>
 #include <mvvm/model/tagindex.h>
 #include <mvvm/model_export.h>
 
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
@@ -48,7 +50,7 @@ class SessionItem;
 class MVVM_MODEL_EXPORT TaggedItems
 {
 public:
-  using container_t = std::vector<std::unique_ptr<SessionItemContainer>>;
+  using container_t = std::pmr::vector<std::unique_ptr<SessionItemContainer>>;
   using const_iterator = container_t::const_iterator;
 
   TaggedItems();
@@ -56,6 +58,9 @@ public:
   TaggedItems(const TaggedItems&) = delete;
   TaggedItems& operator=(const TaggedItems&) = delete;
 
+  static void* operator new(std::size_t size);
+  static void operator delete(void* ptr, std::size_t size) noexcept;
+
   /**
    * @brief Registers tag.
    *
@@ -75,7 +80,7 @@ public:
   /**
    * @brief Returns the name of the default tag.
    */
-  std::string GetDefaultTag() const;
+  const std::string& GetDefaultTag() const;
 
   /**
    * @brief Sets the default tag name.
@@ -127,6 +132,37 @@ public:
    */
   std::unique_ptr<SessionItem> TakeItem(const TagIndex& tag_index);
 
+  /**
+   * @brief Checks if the given items can be inserted as a contiguous range starting from the given
+   * place.
+   *
+   * A TagIndex should be in a valid state, TagIndex::Append() should be converted already to normal
+   * index using TaggedItems::GetInsertTagIndex().
+   */
+  bool CanInsertItems(const std::vector<std::unique_ptr<SessionItem>>& items,
+                      const TagIndex& tag_index) const;
+
+  /**
+   * @brief Inserts items as a contiguous range starting from the given tag_index, ownership is
+   * taken.
+   *
+   * @return Convenience pointers to just inserted items.
+   */
+  std::vector<SessionItem*> InsertItems(std::vector<std::unique_ptr<SessionItem>> items,
+                                        const TagIndex& tag_index);
+
+  /**
+   * @brief Checks if the given number of items can be removed starting from the given place.
+   */
+  bool CanTakeItems(const TagIndex& tag_index, std::size_t count) const;
+
+  /**
+   * @brief Removes a contiguous range of items starting from the given tag_index, returns them to
+   * the caller.
+   */
+  std::vector<std::unique_ptr<SessionItem>> TakeItems(const TagIndex& tag_index,
+                                                      std::size_t count);
+
   /**
    * @brief Checks if the item can be moved into the given index.
    *
@@ -214,6 +250,14 @@ public:
    */
   SessionItemContainer* FindContainer(const std::string& tag) const;
 
+  /**
+   * @brief Returns container corresponding to the given tag atom, or nullptr if container doesn't
+   * exist.
+   *
+   * If the provided atom is empty, will try to find a container registered by default.
+   */
+  SessionItemContainer* FindContainer(Atom tag) const;
+
   /**
    * @brief Converts insert index into an actual TagIndex.
    *
@@ -228,7 +272,7 @@ public:
 
 private:
   container_t m_containers;
-  std::string m_default_tag;
+  Atom m_default_tag;
 };
 
 }  // namespace mvvm
@@ -43,7 +43,7 @@ TagIndex::TagIndex(const std::string& name, std::size_t index) : m_tag(name), m_
 
 TagIndex::TagIndex(const char* name, std::size_t index) : m_tag(name), m_index(index) {}
 
-std::string TagIndex::GetTag() const
+const std::string& TagIndex::GetTag() const
 {
   return m_tag;
 }
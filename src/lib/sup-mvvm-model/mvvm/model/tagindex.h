@@ -67,7 +67,7 @@ public:
   /**
    * @brief Returns tag.
    */
-  std::string GetTag() const;
+  const std::string& GetTag() const;
 
   /**
    * @brief Returns index.
@@ -23,6 +23,7 @@
 #include <mvvm/core/mvvm_exceptions.h>
 #include <mvvm/utils/container_utils.h>
 
+#include <algorithm>
 #include <limits>
 
 namespace mvvm
@@ -30,9 +31,9 @@ namespace mvvm
 
 TagInfo::TagInfo(std::string name, const std::optional<std::size_t>& min,
                  const std::optional<std::size_t>& max, std::vector<std::string> item_types)
-    : m_name(std::move(name)), m_min(min), m_max(max), m_item_types(std::move(item_types))
+    : m_name(name), m_min(min), m_max(max)
 {
-  if (m_name.empty())
+  if (m_name.IsEmpty())
   {
     throw RuntimeException("Tag name can't be empty");
   }
@@ -41,6 +42,9 @@ TagInfo::TagInfo(std::string name, const std::optional<std::size_t>& min,
   {
     throw RuntimeException("TagInfo can't have min > max");
   }
+
+  std::transform(item_types.begin(), item_types.end(), std::back_inserter(m_item_types),
+                 [](const auto& item_type) { return Atom(item_type); });
 }
 
 TagInfo TagInfo::CreateUniversalTag(std::string name, std::vector<std::string> item_types)
@@ -53,7 +57,12 @@ TagInfo TagInfo::CreatePropertyTag(std::string name, std::string item_type)
   return TagInfo(std::move(name), 1U, 1U, {std::move(item_type)});
 }
 
-std::string TagInfo::GetName() const
+const std::string& TagInfo::GetName() const
+{
+  return m_name.GetName();
+}
+
+Atom TagInfo::GetNameAtom() const
 {
   return m_name;
 }
@@ -80,10 +89,25 @@ std::size_t TagInfo::GetMax() const
 
 std::vector<std::string> TagInfo::GetItemTypes() const
 {
-  return m_item_types;
+  std::vector<std::string> result;
+  std::transform(m_item_types.begin(), m_item_types.end(), std::back_inserter(result),
+                 [](auto item_type) { return item_type.GetName(); });
+  return result;
 }
 
 bool TagInfo::IsValidType(const std::string& item_type) const
+{
+  if (m_item_types.empty())
+  {
+    return true;  // if vector is empty, every type is considered as matching
+  }
+
+  // the type which was never interned can't be in the list
+  auto atom = Atom::Find(item_type);
+  return atom.has_value() && IsValidType(atom.value());
+}
+
+bool TagInfo::IsValidType(Atom item_type) const
 {
   // if vector is empty, every type is considered as matching
   return m_item_types.empty() ? true : utils::Contains(m_item_types, item_type);
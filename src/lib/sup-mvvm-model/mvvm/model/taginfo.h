@@ -21,6 +21,7 @@
 #ifndef MVVM_MODEL_TAGINFO_H_
 #define MVVM_MODEL_TAGINFO_H_
 
+#include <mvvm/core/atom.h>
 #include <mvvm/model_export.h>
 
 #include <optional>
@@ -79,7 +80,12 @@ public:
   /**
    * @brief Returns the name of this class.
    */
-  std::string GetName() const;
+  const std::string& GetName() const;
+
+  /**
+   * @brief Returns the name of this class as interned atom.
+   */
+  Atom GetNameAtom() const;
 
   /**
    * @brief Checks if the tag has a user-defined minimum allowed number of items.
@@ -111,14 +117,19 @@ public:
    */
   bool IsValidType(const std::string& item_type) const;
 
+  /**
+   * @brief Checks if given item's type matches the list of possible item types (atom version).
+   */
+  bool IsValidType(Atom item_type) const;
+
   bool operator==(const TagInfo& other) const;
   bool operator!=(const TagInfo& other) const;
 
 private:
-  std::string m_name;                     //!< the name of the tag
-  std::optional<std::size_t> m_min;       //!< minimum allowed number of items in a tag
-  std::optional<std::size_t> m_max;       //!< maximum allowed number of items in a tag
-  std::vector<std::string> m_item_types;  //!< vector of allowed item types
+  Atom m_name;                       //!< the name of the tag
+  std::optional<std::size_t> m_min;  //!< minimum allowed number of items in a tag
+  std::optional<std::size_t> m_max;  //!< maximum allowed number of items in a tag
+  std::vector<Atom> m_item_types;    //!< vector of allowed item types
 };
 
 }  // namespace mvvm
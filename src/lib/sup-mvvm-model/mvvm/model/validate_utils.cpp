@@ -90,6 +90,54 @@ void ValidateItemInsert(const SessionItem *item, const SessionItem *parent,
   }
 }
 
+std::pair<bool, std::string> CanInsertItems(const std::vector<std::unique_ptr<SessionItem>> &items,
+                                            const SessionItem *parent, const TagIndex &tag_index)
+{
+  if (!parent)
+  {
+    return {kFailure, "Invalid parent item"};
+  }
+
+  for (const auto &item : items)
+  {
+    if (!item)
+    {
+      return {kFailure, "Invalid input item"};
+    }
+
+    if (item.get() == parent)
+    {
+      return {kFailure, "Attempt to insert to itself"};
+    }
+
+    if (item->GetParent())
+    {
+      return {kFailure, "Item belongs to another parent"};
+    }
+
+    if (utils::IsItemAncestor(parent, item.get()))
+    {
+      return {kFailure, "Attempt to turn ancestor into a child"};
+    }
+  }
+
+  if (!parent->GetTaggedItems()->CanInsertItems(items, GetInsertTagIndex(parent, tag_index)))
+  {
+    return {kFailure, "Can't insert items to parent"};
+  }
+
+  return {kSuccess, ""};
+}
+
+void ValidateItemsInsert(const std::vector<std::unique_ptr<SessionItem>> &items,
+                         const SessionItem *parent, const TagIndex &tag_index)
+{
+  if (auto [flag, reason] = CanInsertItems(items, parent, tag_index); !flag)
+  {
+    throw InvalidOperationException(reason);
+  }
+}
+
 std::pair<bool, std::string> CanInsertType(const std::string &item_type, const SessionItem *parent,
                                            const TagIndex &tag_index)
 {
@@ -190,4 +238,28 @@ void ValidateTakeItem(const SessionItem *parent, const TagIndex &tag_index)
   }
 }
 
+std::pair<bool, std::string> CanTakeItems(const SessionItem *parent, const TagIndex &tag_index,
+                                          std::size_t count)
+{
+  if (!parent)
+  {
+    return {kFailure, "Parent is not defined"};
+  }
+
+  if (!parent->GetTaggedItems()->CanTakeItems(tag_index, count))
+  {
+    return {kFailure, "Can't take items from parent"};
+  }
+
+  return {kSuccess, ""};
+}
+
+void ValidateTakeItems(const SessionItem *parent, const TagIndex &tag_index, std::size_t count)
+{
+  if (auto [flag, reason] = CanTakeItems(parent, tag_index, count); !flag)
+  {
+    throw InvalidOperationException(reason);
+  }
+}
+
 }  // namespace mvvm::utils
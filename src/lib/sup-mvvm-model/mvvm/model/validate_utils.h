@@ -24,7 +24,9 @@
 //! @file
 //! Collection of utility function to check if certain operations on the model are valid.
 
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace mvvm
 {
@@ -57,6 +59,24 @@ std::pair<bool, std::string> CanInsertItem(const SessionItem* item, const Sessio
 void ValidateItemInsert(const SessionItem* item, const SessionItem* parent,
                         const TagIndex& tag_index);
 
+/**
+ * @brief Perform validation if insert of the range of items is allowed.
+ *
+ * Items will be inserted one after another starting from the given tag_index.
+ *
+ * @return Success flag, and the reason if insert is not possible.
+ */
+std::pair<bool, std::string> CanInsertItems(const std::vector<std::unique_ptr<SessionItem>>& items,
+                                            const SessionItem* parent, const TagIndex& tag_index);
+
+/**
+ * @brief Perform validation if insert of the range of items is allowed.
+ *
+ * Will throw InvalidOperationException otherwise.
+ */
+void ValidateItemsInsert(const std::vector<std::unique_ptr<SessionItem>>& items,
+                         const SessionItem* parent, const TagIndex& tag_index);
+
 /**
  * @brief Perform validation if insert of the new item of the given type is allowed.
  *
@@ -101,6 +121,22 @@ std::pair<bool, std::string> CanTakeItem(const SessionItem* parent, const TagInd
  */
 void ValidateTakeItem(const SessionItem* parent, const TagIndex& tag_index);
 
+/**
+ * @brief Perform validation if take of the given number of items starting from the given
+ * tag_index is allowed.
+ *
+ * @return Success flag, and the reason if take is not possible.
+ */
+std::pair<bool, std::string> CanTakeItems(const SessionItem* parent, const TagIndex& tag_index,
+                                          std::size_t count);
+
+/**
+ * @brief Perform validation if take of the given number of items is allowed.
+ *
+ * Will throw InvalidOperationException otherwise.
+ */
+void ValidateTakeItems(const SessionItem* parent, const TagIndex& tag_index, std::size_t count);
+
 }  // namespace mvvm::utils
 
 #endif  // MVVM_MODEL_VALIDATE_UTILS_H_
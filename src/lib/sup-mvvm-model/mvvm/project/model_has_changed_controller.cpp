@@ -33,8 +33,11 @@ ModelHasChangedController::ModelHasChangedController(ISessionModel* model,
     : ModelListener(model), m_callback(callback)
 {
   Connect<DataChangedEvent>([this](auto) { OnChange(); });
+  Connect<DataRegionChangedEvent>([this](auto) { OnChange(); });
   Connect<ItemInsertedEvent>([this](auto) { OnChange(); });
   Connect<ItemRemovedEvent>([this](auto) { OnChange(); });
+  Connect<ItemsInsertedEvent>([this](auto) { OnChange(); });
+  Connect<ItemsRemovedEvent>([this](auto) { OnChange(); });
   Connect<ModelResetEvent>([this](auto) { OnChange(); });
 }
 
@@ -25,9 +25,9 @@
 
 #include <mvvm/core/mvvm_exceptions.h>
 #include <mvvm/utils/container_utils.h>
+#include <mvvm/utils/numeric_codec.h>
 #include <mvvm/utils/string_utils.h>
 
-#include <charconv>
 #include <functional>
 #include <map>
 
@@ -83,6 +83,11 @@ mvvm::role_data_t to_double(const tree_data_t& tree_data);
 
 //! Converts TreeData to role_data_t holding vector<double>.
 mvvm::role_data_t to_vector_double(const tree_data_t& tree_data);
+mvvm::role_data_t to_shared_vector_double(const tree_data_t& tree_data);
+
+//! Converts TreeData to role_data_t holding vector of narrow numeric type.
+template <typename T>
+mvvm::role_data_t to_vector(const tree_data_t& tree_data);
 
 //! Converts role_data_t holding ComboProperty to the TreeData object.
 tree_data_t from_combo_property(const role_data_t& role_data);
@@ -198,17 +203,13 @@ mvvm::role_data_t to_bool(const tree_data_t& tree_data)
 template <typename T>
 mvvm::role_data_t to_int(const tree_data_t& tree_data)
 {
-  const auto text = tree_data.GetContent();
-  T parsed_value;
-  const std::from_chars_result result =
-      std::from_chars(text.data(), text.data() + text.size(), parsed_value);
-
-  if (result.ec == std::errc::invalid_argument || result.ec == std::errc::result_out_of_range)
+  auto value = mvvm::utils::ParseNumber<T>(mvvm::utils::TrimWhitespace(tree_data.GetContent()));
+  if (!value.has_value())
   {
     throw RuntimeException("Can't parse int stored in TreeData");
   }
 
-  return {GetRole(tree_data), mvvm::variant_t(parsed_value)};
+  return {GetRole(tree_data), mvvm::variant_t(value.value())};
 }
 
 mvvm::role_data_t to_string(const tree_data_t& tree_data)
@@ -219,11 +220,11 @@ mvvm::role_data_t to_string(const tree_data_t& tree_data)
 template <typename T>
 mvvm::role_data_t to_double(const tree_data_t& tree_data)
 {
-  // we use own conversion to double instead of std::stod to not to depend on user's locale
-  if (auto value = mvvm::utils::StringToDouble(tree_data.GetContent()); value)
+  // value is parsed directly into the target type, locale independent and without double rounding
+  auto value = mvvm::utils::ParseNumber<T>(mvvm::utils::TrimWhitespace(tree_data.GetContent()));
+  if (value.has_value())
   {
-    T concrete_value(value.value());
-    return {GetRole(tree_data), mvvm::variant_t(concrete_value)};
+    return {GetRole(tree_data), mvvm::variant_t(value.value())};
   }
   throw mvvm::RuntimeException("Error in variant converter: malformed double number");
 }
@@ -234,6 +235,24 @@ mvvm::role_data_t to_vector_double(const tree_data_t& tree_data)
   return {GetRole(tree_data), mvvm::variant_t(values)};
 }
 
+mvvm::role_data_t to_shared_vector_double(const tree_data_t& tree_data)
+{
+  auto values = mvvm::utils::ParseCommaSeparatedDoubles(tree_data.GetContent());
+  return {GetRole(tree_data), mvvm::variant_t(mvvm::SharedArray<double>(std::move(values)))};
+}
+
+template <typename T>
+mvvm::role_data_t to_vector(const tree_data_t& tree_data)
+{
+  // numbers are parsed directly into the element type, without a vector<double> in between
+  std::vector<T> values;
+  if (!mvvm::utils::ParseSeparatedNumbers(tree_data.GetContent(), ',', values))
+  {
+    throw mvvm::RuntimeException("Error in variant converter: malformed array of numbers");
+  }
+  return {GetRole(tree_data), mvvm::variant_t(std::move(values))};
+}
+
 tree_data_t from_combo_property(const role_data_t& role_data)
 {
   tree_data_t result(kVariantElementType);
@@ -285,7 +304,13 @@ std::map<std::string, Converters> GetConverters()
       {constants::kFloat64TypeName, {from_roledata_default_impl, to_double<mvvm::float64>}},
       {constants::kVectorDoubleTypeName, {from_roledata_default_impl, to_vector_double}},
       {constants::kComboPropertyTypeName, {from_combo_property, to_combo_property}},
-      {constants::kExternalPropertyTypeName, {from_roledata_default_impl, to_external_property}}};
+      {constants::kExternalPropertyTypeName, {from_roledata_default_impl, to_external_property}},
+      {constants::kSharedVectorDoubleTypeName,
+       {from_roledata_default_impl, to_shared_vector_double}},
+      {constants::kVectorFloat32TypeName, {from_roledata_default_impl, to_vector<mvvm::float32>}},
+      {constants::kVectorInt32TypeName, {from_roledata_default_impl, to_vector<mvvm::int32>}},
+      {constants::kVectorInt64TypeName, {from_roledata_default_impl, to_vector<mvvm::int64>}},
+      {constants::kVectorUInt16TypeName, {from_roledata_default_impl, to_vector<mvvm::uint16>}}};
 
   return result;
 }
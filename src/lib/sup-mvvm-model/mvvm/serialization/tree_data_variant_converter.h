@@ -33,6 +33,8 @@
 //! - <Variant role = "0" type = "vector_double">1.0, 2.0</Variant>
 //! - <Variant role = "0" type = "ComboProperty" selections="1,2">a1;a2</Variant>
 //! - <Variant role = "0" type = "ExternalProperty">text;color;identifier</Variant>
+//! - <Variant role = "0" type = "shared_vector_double">1.0, 2.0</Variant>
+//! - <Variant role = "0" type = "vector_int32">1, 2</Variant>
 
 #include <mvvm/core/variant.h>
 #include <mvvm/model_export.h>
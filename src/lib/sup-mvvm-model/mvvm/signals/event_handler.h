@@ -25,9 +25,10 @@
 #include <mvvm/core/variant_index.h>
 #include <mvvm/signals/signal_slot.h>
 
+#include <array>
 #include <functional>
-#include <map>
 #include <memory>
+#include <variant>
 
 namespace mvvm
 {
@@ -36,7 +37,9 @@ namespace mvvm
  * @brief The EventHandler class provides a subscription/notification mechanism for various event
  * types.
  *
- * It relies on the functionality, provided by lsignal library.
+ * It relies on the functionality, provided by lsignal library. Signals are stored in an array
+ * indexed by the index of the event type in the variant, so the lookup on notification doesn't
+ * require any search.
  *
  * @tparam EventVariantT A variant to store the value of concrete event.
  * @see event_variant_t, ModelEventHandler
@@ -158,9 +161,11 @@ public:
   template <typename EventT>
   void Register()
   {
-    auto signal_for_event_type = std::make_unique<signal_t>();
-    const std::size_t index = variant_index<EventVariantT, EventT>();
-    m_signals.insert({index, std::move(signal_for_event_type)});
+    auto& signal_for_event_type = m_signals[variant_index<EventVariantT, EventT>()];
+    if (!signal_for_event_type)
+    {
+      signal_for_event_type = std::make_unique<signal_t>();
+    }
   }
 
 private:
@@ -178,20 +183,21 @@ private:
    */
   signal_t& GetSignal(std::size_t index)
   {
-    auto iter = m_signals.find(index);
-    if (iter == m_signals.end())
+    auto& result = m_signals[index];
+    if (!result)
     {
       throw RuntimeException("The type is not supported");
     }
-    return *iter->second.get();
+    return *result;
   }
 
   /**
-   * @brief A map of signals, registered for concret event types.
+   * @brief An array of signals, indexed by the index of concrete event type in the variant.
    *
-   * A single signal holds a collection of callbacks to notify.
+   * A single signal holds a collection of callbacks to notify. Not registered event types have
+   * nullptr.
    */
-  std::map<std::size_t, std::unique_ptr<signal_t>> m_signals;
+  std::array<std::unique_ptr<signal_t>, std::variant_size_v<EventVariantT>> m_signals;
 };
 
 }  // namespace mvvm
@@ -107,6 +107,91 @@ bool ItemRemovedEvent::operator!=(const ItemRemovedEvent& other) const
   return !(*this == other);
 }
 
+// ----------------------------------------------------------------------------
+// AboutToInsertItemsEvent
+// ----------------------------------------------------------------------------
+
+bool AboutToInsertItemsEvent::operator==(const AboutToInsertItemsEvent& other) const
+{
+  return item == other.item && tag_index == other.tag_index && count == other.count;
+}
+
+bool AboutToInsertItemsEvent::operator!=(const AboutToInsertItemsEvent& other) const
+{
+  return !(*this == other);
+}
+
+// ----------------------------------------------------------------------------
+// ItemsInsertedEvent
+// ----------------------------------------------------------------------------
+
+bool ItemsInsertedEvent::operator==(const ItemsInsertedEvent& other) const
+{
+  return item == other.item && tag_index == other.tag_index && count == other.count;
+}
+
+bool ItemsInsertedEvent::operator!=(const ItemsInsertedEvent& other) const
+{
+  return !(*this == other);
+}
+
+// ----------------------------------------------------------------------------
+// AboutToRemoveItemsEvent
+// ----------------------------------------------------------------------------
+
+bool AboutToRemoveItemsEvent::operator==(const AboutToRemoveItemsEvent& other) const
+{
+  return item == other.item && tag_index == other.tag_index && count == other.count;
+}
+
+bool AboutToRemoveItemsEvent::operator!=(const AboutToRemoveItemsEvent& other) const
+{
+  return !(*this == other);
+}
+
+// ----------------------------------------------------------------------------
+// ItemsRemovedEvent
+// ----------------------------------------------------------------------------
+
+bool ItemsRemovedEvent::operator==(const ItemsRemovedEvent& other) const
+{
+  return item == other.item && tag_index == other.tag_index && count == other.count;
+}
+
+bool ItemsRemovedEvent::operator!=(const ItemsRemovedEvent& other) const
+{
+  return !(*this == other);
+}
+
+// ----------------------------------------------------------------------------
+// DataAppendedEvent
+// ----------------------------------------------------------------------------
+
+bool DataAppendedEvent::operator==(const DataAppendedEvent& other) const
+{
+  return item == other.item && appended_count == other.appended_count
+         && removed_count == other.removed_count;
+}
+
+bool DataAppendedEvent::operator!=(const DataAppendedEvent& other) const
+{
+  return !(*this == other);
+}
+
+// ----------------------------------------------------------------------------
+// DataRegionChangedEvent
+// ----------------------------------------------------------------------------
+
+bool DataRegionChangedEvent::operator==(const DataRegionChangedEvent& other) const
+{
+  return item == other.item && region == other.region;
+}
+
+bool DataRegionChangedEvent::operator!=(const DataRegionChangedEvent& other) const
+{
+  return !(*this == other);
+}
+
 // ----------------------------------------------------------------------------
 // ModelAboutToBeResetEvent
 // ----------------------------------------------------------------------------
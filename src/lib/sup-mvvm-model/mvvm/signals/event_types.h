@@ -25,6 +25,7 @@
 //! Defines collection of event types.
 
 #include <mvvm/model/tagindex.h>
+#include <mvvm/utils/data_region.h>
 
 #include <variant>
 
@@ -119,6 +120,102 @@ struct ItemRemovedEvent
   bool operator!=(const ItemRemovedEvent& other) const;
 };
 
+/**
+ * @brief The AboutToInsertItemsEvent struct represents an event when a range of items is about to
+ * be inserted in the model.
+ *
+ * It reports the parent, the address of the first child, and the number of children.
+ */
+struct AboutToInsertItemsEvent
+{
+  SessionItem* item{nullptr};  //! item that is about to get new children
+  TagIndex tag_index;          //! position of the first child
+  std::size_t count{0};        //! number of children
+
+  bool operator==(const AboutToInsertItemsEvent& other) const;
+  bool operator!=(const AboutToInsertItemsEvent& other) const;
+};
+
+/**
+ * @brief The ItemsInsertedEvent struct represents an event when a range of items was inserted in
+ * the model.
+ *
+ * It reports the parent, the address of the first child, and the number of children.
+ */
+struct ItemsInsertedEvent
+{
+  SessionItem* item{nullptr};  //! item that got new children (i.e. parent)
+  TagIndex tag_index;          //! position of the first child
+  std::size_t count{0};        //! number of children
+
+  bool operator==(const ItemsInsertedEvent& other) const;
+  bool operator!=(const ItemsInsertedEvent& other) const;
+};
+
+/**
+ * @brief The AboutToRemoveItemsEvent struct represents an event when a range of items is about to
+ * be removed from the model.
+ *
+ * It reports the parent, the address of the first child, and the number of children.
+ */
+struct AboutToRemoveItemsEvent
+{
+  SessionItem* item{nullptr};  //! item whose children are about to be removed
+  TagIndex tag_index;          //! position of the first child
+  std::size_t count{0};        //! number of children
+
+  bool operator==(const AboutToRemoveItemsEvent& other) const;
+  bool operator!=(const AboutToRemoveItemsEvent& other) const;
+};
+
+/**
+ * @brief The ItemsRemovedEvent struct represents an event when a range of items was removed from
+ * the model.
+ *
+ * It reports the parent, the address of the first child, and the number of children.
+ */
+struct ItemsRemovedEvent
+{
+  SessionItem* item{nullptr};  //! item whose children were removed
+  TagIndex tag_index;          //! position of the first child
+  std::size_t count{0};        //! number of children
+
+  bool operator==(const ItemsRemovedEvent& other) const;
+  bool operator!=(const ItemsRemovedEvent& other) const;
+};
+
+/**
+ * @brief The DataAppendedEvent struct represents an event when new samples were appended to the
+ * stream data item.
+ *
+ * It reports the number of samples appended to the end of the buffer, and the number of the
+ * oldest samples dropped from its beginning.
+ */
+struct DataAppendedEvent
+{
+  SessionItem* item{nullptr};     //! item which got new samples
+  std::size_t appended_count{0};  //! number of samples appended to the end
+  std::size_t removed_count{0};   //! number of samples removed from the beginning
+
+  bool operator==(const DataAppendedEvent& other) const;
+  bool operator!=(const DataAppendedEvent& other) const;
+};
+
+/**
+ * @brief The DataRegionChangedEvent struct represents an event when values of a region of
+ * two-dimensional data were changed in place.
+ *
+ * It reports the region of changed cells, so listeners can update only this region.
+ */
+struct DataRegionChangedEvent
+{
+  SessionItem* item{nullptr};  //! item whose data was changed
+  DataRegion region;           //! region of changed cells
+
+  bool operator==(const DataRegionChangedEvent& other) const;
+  bool operator!=(const DataRegionChangedEvent& other) const;
+};
+
 /**
  * @brief The ModelAboutToBeResetEvent struct represents an event when the root item of the model is
  * about to be reset.
@@ -158,7 +255,9 @@ struct ModelAboutToBeDestroyedEvent
 using event_variant_t =
     std::variant<DataChangedEvent, PropertyChangedEvent, AboutToInsertItemEvent, ItemInsertedEvent,
                  AboutToRemoveItemEvent, ItemRemovedEvent, ModelAboutToBeResetEvent,
-                 ModelResetEvent, ModelAboutToBeDestroyedEvent>;
+                 ModelResetEvent, ModelAboutToBeDestroyedEvent, AboutToInsertItemsEvent,
+                 ItemsInsertedEvent, AboutToRemoveItemsEvent, ItemsRemovedEvent,
+                 DataAppendedEvent, DataRegionChangedEvent>;
 
 }  // namespace mvvm
 
@@ -47,6 +47,18 @@ struct ItemEventVisitor
 
   void operator()(const mvvm::ItemRemovedEvent& event) { m_source = event.item; }
 
+  void operator()(const mvvm::AboutToInsertItemsEvent& event) { m_source = event.item; }
+
+  void operator()(const mvvm::ItemsInsertedEvent& event) { m_source = event.item; }
+
+  void operator()(const mvvm::AboutToRemoveItemsEvent& event) { m_source = event.item; }
+
+  void operator()(const mvvm::ItemsRemovedEvent& event) { m_source = event.item; }
+
+  void operator()(const mvvm::DataAppendedEvent& event) { m_source = event.item; }
+
+  void operator()(const mvvm::DataRegionChangedEvent& event) { m_source = event.item; }
+
   void operator()(const mvvm::ModelAboutToBeResetEvent& event)
   {
     (void)event;
@@ -28,61 +28,37 @@ SOFTWARE.
 #define MVVM_SIGNALS_LSIGNAL_H_
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <list>
 #include <memory>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace lsignal
 {
-template <int>
-struct placeholder_lsignal
-{
-};
-}  // namespace lsignal
-
-namespace std
-{
-// custom std::placeholders
-
-template <int N>
-struct is_placeholder<lsignal::placeholder_lsignal<N>> : integral_constant<int, N + 1>
-{
-};
-}  // namespace std
-
-namespace lsignal
-{
-// std::integer_sequence for C++11
-
-template <int... Ns>
-struct int_sequence
-{
-};
+// connection
 
-//! @cond DoNotRaiseWarning
-template <int N, int... Ns>
-struct make_int_sequence : make_int_sequence<N - 1, N - 1, Ns...>
-{
-};
-//! @endcond
+// Connections are identified by an integer id within the signal they belong to. The signal keeps
+// its callbacks in a contiguous vector sorted by id. Disconnected callbacks are marked as dead
+// (tombstoned) and removed later, so it is safe to disconnect while the signal is being emitted.
+// Callbacks connected during the emission are kept aside and appended after it.
 
-template <int... Ns>
-struct make_int_sequence<0, Ns...> : int_sequence<Ns...>
+class connection_core
 {
-};
-
-// connection
+public:
+  virtual ~connection_core() = default;
 
-struct connection_data
-{
-  bool locked;
+  virtual bool is_locked(std::uint64_t id) const = 0;
+  virtual void set_lock(std::uint64_t id, const bool lock) = 0;
+  virtual void disconnect(std::uint64_t id) = 0;
 };
 
 struct connection_cleaner
 {
-  std::function<void(std::shared_ptr<connection_data>)> deleter;
-  std::shared_ptr<connection_data> data;
+  std::shared_ptr<connection_core> core;
+  std::uint64_t id;
 };
 
 class connection
@@ -91,7 +67,7 @@ class connection
   friend class signal;
 
 public:
-  connection(std::shared_ptr<connection_data>&& data);
+  connection() = default;
   virtual ~connection();
 
   bool is_locked() const;
@@ -100,33 +76,65 @@ public:
   void disconnect();
 
 private:
-  std::shared_ptr<connection_data> _data;
+  connection(std::shared_ptr<connection_core> core, std::uint64_t id);
+
+  void remove_cleaner(const connection_core* core, std::uint64_t id);
+
+  std::shared_ptr<connection_core> _core;
+  std::uint64_t _id{0};
   std::vector<connection_cleaner> _cleaners;
 };
 
-inline connection::connection(std::shared_ptr<connection_data>&& data) : _data(std::move(data)) {}
+inline connection::connection(std::shared_ptr<connection_core> core, std::uint64_t id)
+    : _core(std::move(core)), _id(id)
+{
+}
 
 inline connection::~connection() {}
 
 inline bool connection::is_locked() const
 {
-  return _data->locked;
+  return _core ? _core->is_locked(_id) : false;
 }
 
 inline void connection::set_lock(const bool lock)
 {
-  _data->locked = lock;
+  if (_core)
+  {
+    _core->set_lock(_id, lock);
+  }
 }
 
 inline void connection::disconnect()
 {
-  decltype(_cleaners) cleaners = _cleaners;
+  // cleaners are moved out, since each disconnection removes the cleaner from the owner
+  auto cleaners = std::move(_cleaners);
+  _cleaners.clear();
 
-  for (auto iter = cleaners.cbegin(); iter != cleaners.cend(); ++iter)
+  if (auto core = std::move(_core); core)
   {
-    const connection_cleaner& cleaner = *iter;
+    core->disconnect(_id);
+  }
+
+  for (const auto& cleaner : cleaners)
+  {
+    cleaner.core->disconnect(cleaner.id);
+  }
+}
+
+inline void connection::remove_cleaner(const connection_core* core, std::uint64_t id)
+{
+  auto iter = std::find_if(_cleaners.begin(), _cleaners.end(), [core, id](const auto& cleaner)
+                           { return cleaner.core.get() == core && cleaner.id == id; });
+  if (iter != _cleaners.end())
+  {
+    *iter = std::move(_cleaners.back());
+    _cleaners.pop_back();
+  }
 
-    cleaner.deleter(cleaner.data);
+  if (_core.get() == core && _id == id)
+  {
+    _core.reset();
   }
 }
 
@@ -139,7 +147,7 @@ public:
   ~slot() override;
 };
 
-inline slot::slot() : connection(std::shared_ptr<connection_data>()) {}
+inline slot::slot() : connection() {}
 
 inline slot::~slot()
 {
@@ -164,8 +172,9 @@ public:
   signal(const signal& rhs);
   signal& operator=(const signal& rhs);
 
-  signal(signal&& rhs) = default;
-  signal& operator=(signal&& rhs) = default;
+  // the moved-from signal remains valid and has no connections
+  signal(signal&& rhs);
+  signal& operator=(signal&& rhs);
 
   bool is_locked() const;
   void set_lock(const bool lock);
@@ -192,84 +201,226 @@ public:
 private:
   struct joint
   {
+    std::uint64_t id;
     callback_type callback;
-    std::shared_ptr<connection_data> connection;
     slot* owner;
+    bool locked;
+    bool alive;
+  };
+
+  // Storage of callbacks shared with all connections made to the signal.
+  class core : public connection_core
+  {
+  public:
+    bool is_locked(std::uint64_t id) const override
+    {
+      const joint* jnt = const_cast<core*>(this)->find(id);
+      return jnt != nullptr && jnt->locked;
+    }
+
+    void set_lock(std::uint64_t id, const bool lock) override
+    {
+      if (joint* jnt = find(id); jnt != nullptr)
+      {
+        jnt->locked = lock;
+      }
+    }
+
+    void disconnect(std::uint64_t id) override
+    {
+      joint* jnt = find(id);
+      if (jnt == nullptr || !jnt->alive)
+      {
+        return;
+      }
+
+      jnt->alive = false;
+      if (jnt->owner != nullptr)
+      {
+        jnt->owner->remove_cleaner(this, id);
+        jnt->owner = nullptr;
+      }
+
+      if (emit_depth > 0)
+      {
+        ++tombstones;  // callback might be running, it will be removed after the emission
+        return;
+      }
+
+      jnt->callback = nullptr;
+      ++tombstones;
+      if (tombstones * 2 >= joints.size())
+      {
+        compact();
+      }
+    }
+
+    joint* find(std::uint64_t id)
+    {
+      auto& container = !pending.empty() && id >= pending.front().id ? pending : joints;
+      auto iter = std::lower_bound(container.begin(), container.end(), id,
+                                   [](const joint& jnt, std::uint64_t value)
+                                   { return jnt.id < value; });
+      return iter != container.end() && iter->id == id ? &(*iter) : nullptr;
+    }
+
+    // Appends callbacks connected during the emission, and removes disconnected ones.
+    void flush()
+    {
+      for (auto& jnt : pending)
+      {
+        if (jnt.alive)
+        {
+          joints.push_back(std::move(jnt));
+        }
+      }
+      pending.clear();
+
+      if (tombstones > 0)
+      {
+        compact();
+      }
+    }
+
+    void compact()
+    {
+      auto last = std::remove_if(joints.begin(), joints.end(),
+                                 [](const joint& jnt) { return !jnt.alive; });
+      joints.erase(last, joints.end());
+      tombstones = 0;
+    }
+
+    // Disconnects all callbacks. During the emission callbacks are only marked as dead, since
+    // one of them might be running.
+    void release()
+    {
+      if (emit_depth == 0)
+      {
+        clear();
+        return;
+      }
+
+      for (auto* container : {&joints, &pending})
+      {
+        for (const auto& jnt : *container)
+        {
+          disconnect(jnt.id);
+        }
+      }
+    }
+
+    void clear()
+    {
+      for (auto* container : {&joints, &pending})
+      {
+        for (auto& jnt : *container)
+        {
+          if (jnt.alive && jnt.owner != nullptr)
+          {
+            jnt.owner->remove_cleaner(this, jnt.id);
+          }
+        }
+        container->clear();
+      }
+      tombstones = 0;
+    }
+
+    std::vector<joint> joints;
+    std::vector<joint> pending;
+    std::uint64_t next_id{1};
+    std::size_t emit_depth{0};
+    std::size_t tombstones{0};
+  };
+
+  // Marks the duration of the emission.
+  class emit_guard
+  {
+  public:
+    explicit emit_guard(core& state) : _state(state) { ++_state.emit_depth; }
+    ~emit_guard()
+    {
+      if (--_state.emit_depth == 0 && (_state.tombstones > 0 || !_state.pending.empty()))
+      {
+        _state.flush();
+      }
+    }
+
+    emit_guard(const emit_guard&) = delete;
+    emit_guard& operator=(const emit_guard&) = delete;
+
+  private:
+    core& _state;
   };
 
-  //  mutable std::mutex _mutex;
   bool _locked;
 
-  std::list<joint> _callbacks;
+  std::shared_ptr<core> _core;
 
   signal* _parent;
   std::list<signal*> _children;
 
-  template <typename T, typename U, int... Ns>
-  callback_type construct_mem_fn(const T& fn, U* p, int_sequence<Ns...>) const;
-
-  void copy_callbacks(const std::list<joint>& callbacks);
+  void copy_callbacks(const core& callbacks);
 
-  std::shared_ptr<connection_data> create_connection(callback_type&& fn, slot* owner);
-  void destroy_connection(std::shared_ptr<connection_data> connection);
+  void unlink();
+  void take_links(signal& rhs);
 
-  connection prepare_connection(connection&& conn);
+  connection create_connection(callback_type&& fn, slot* owner);
 };
 
 template <typename R, typename... Args>
-signal<R(Args...)>::signal() : _locked(false), _parent(nullptr)
+signal<R(Args...)>::signal() : _locked(false), _core(std::make_shared<core>()), _parent(nullptr)
 {
 }
 
 template <typename R, typename... Args>
 signal<R(Args...)>::~signal()
 {
-  //  std::lock_guard<std::mutex> locker(_mutex);
+  // the core can outlive the signal, if connections or the running emission hold it, but it
+  // will be empty
+  _core->release();
+  unlink();
+}
 
-  for (auto iter = _callbacks.begin(); iter != _callbacks.end(); ++iter)
-  {
-    const joint& jnt = *iter;
+template <typename R, typename... Args>
+signal<R(Args...)>::signal(const signal& rhs)
+    : _locked(rhs._locked), _core(std::make_shared<core>()), _parent(nullptr)
+{
+  copy_callbacks(*rhs._core);
+}
 
-    if (jnt.owner != nullptr)
-    {
-      jnt.owner->_data = nullptr;
-      jnt.owner->_cleaners.clear();
-    }
-  }
+template <typename R, typename... Args>
+signal<R(Args...)>& signal<R(Args...)>::operator=(const signal& rhs)
+{
+  _locked = rhs._locked;
 
-  if (_parent != nullptr)
+  if (this != &rhs)
   {
-    _parent->_children.remove(this);
+    copy_callbacks(*rhs._core);
   }
 
-  for (signal* sig : _children)
-  {
-    sig->_parent = nullptr;
-  }
+  return *this;
 }
 
 template <typename R, typename... Args>
-signal<R(Args...)>::signal(const signal& rhs) : _locked(rhs._locked)
+signal<R(Args...)>::signal(signal&& rhs)
+    : _locked(rhs._locked)
+    , _core(std::exchange(rhs._core, std::make_shared<core>()))
+    , _parent(nullptr)
 {
-  //  std::unique_lock<std::mutex> lock_own(_mutex, std::defer_lock);
-  //  std::unique_lock<std::mutex> lock_rhs(rhs._mutex, std::defer_lock);
-
-  //  std::lock(lock_own, lock_rhs);
-
-  copy_callbacks(rhs._callbacks);
+  take_links(rhs);
 }
 
 template <typename R, typename... Args>
-signal<R(Args...)>& signal<R(Args...)>::operator=(const signal& rhs)
+signal<R(Args...)>& signal<R(Args...)>::operator=(signal&& rhs)
 {
-  //  std::unique_lock<std::mutex> lock_own(_mutex, std::defer_lock);
-  //  std::unique_lock<std::mutex> lock_rhs(rhs._mutex, std::defer_lock);
-
-  //  std::lock(lock_own, lock_rhs);
-
-  _locked = rhs._locked;
-
-  copy_callbacks(rhs._callbacks);
+  if (this != &rhs)
+  {
+    _locked = rhs._locked;
+    _core->release();
+    _core = std::exchange(rhs._core, std::make_shared<core>());
+    unlink();
+    take_links(rhs);
+  }
 
   return *this;
 }
@@ -289,9 +440,6 @@ void signal<R(Args...)>::set_lock(const bool lock)
 template <typename R, typename... Args>
 void signal<R(Args...)>::connect(signal* sg)
 {
-  //  std::lock_guard<std::mutex> locker_own(_mutex);
-  //  std::lock_guard<std::mutex> locker_sg(sg->_mutex);
-
   if (_parent == sg)
   {
     return;
@@ -310,8 +458,6 @@ void signal<R(Args...)>::connect(signal* sg)
 template <typename R, typename... Args>
 void signal<R(Args...)>::disconnect(signal* sg)
 {
-  //  std::lock_guard<std::mutex> locker(_mutex);
-
   _children.remove(sg);
 }
 
@@ -331,7 +477,8 @@ template <typename R, typename... Args>
 template <typename T, typename U>
 connection signal<R(Args...)>::connect(T* p, const U& fn, slot* owner)
 {
-  auto mem_fn = std::move(construct_mem_fn(fn, p, make_int_sequence<sizeof...(Args)>{}));
+  auto mem_fn = [p, fn](Args... args) -> R
+  { return std::invoke(fn, p, std::forward<Args>(args)...); };
 
   return create_connection(std::move(mem_fn), owner);
 }
@@ -339,32 +486,54 @@ connection signal<R(Args...)>::connect(T* p, const U& fn, slot* owner)
 template <typename R, typename... Args>
 void signal<R(Args...)>::disconnect(const connection& connection)
 {
-  destroy_connection(connection._data);
+  // connection made to another signal is ignored
+  if (connection._core == _core)
+  {
+    _core->disconnect(connection._id);
+  }
 }
 
 template <typename R, typename... Args>
 void signal<R(Args...)>::disconnect(slot* owner)
 {
-  if (owner != nullptr)
+  if (owner == nullptr)
+  {
+    return;
+  }
+
+  std::vector<std::uint64_t> ids;
+  for (const auto& cleaner : owner->_cleaners)
+  {
+    if (cleaner.core == _core)
+    {
+      ids.push_back(cleaner.id);
+    }
+  }
+
+  for (auto id : ids)
   {
-    destroy_connection(owner->_data);
+    _core->disconnect(id);
   }
 }
 
 template <typename R, typename... Args>
 void signal<R(Args...)>::disconnect_all()
 {
-  //  std::lock_guard<std::mutex> locker(_mutex);
-
-  for (const auto& jnt : _callbacks)
+  if (_core->emit_depth > 0)
   {
-    if (jnt.owner != nullptr)
+    for (auto* container : {&_core->joints, &_core->pending})
     {
-      jnt.owner->_data = nullptr;
-      jnt.owner->_cleaners.clear();
+      for (const auto& jnt : *container)
+      {
+        _core->disconnect(jnt.id);
+      }
     }
   }
-  _callbacks.clear();
+  else
+  {
+    _core->clear();
+  }
+
   for (auto sig : _children)
   {
     if (sig->_parent == this)  // should be an assert
@@ -378,32 +547,48 @@ void signal<R(Args...)>::disconnect_all()
 template <typename R, typename... Args>
 R signal<R(Args...)>::operator()(Args... args)
 {
-  //  std::lock_guard<std::mutex> locker(_mutex);
+  if (_locked)
+  {
+    return R();
+  }
 
-  if (!_locked)
+  for (signal* sig : _children)
   {
-    for (signal* sig : _children)
-    {
-      sig->operator()(std::forward<Args>(args)...);
-    }
+    sig->operator()(std::forward<Args>(args)...);
+  }
 
-    for (auto iter = _callbacks.cbegin(); iter != _callbacks.cend(); ++iter)
-    {
-      const joint& jnt = *iter;
+  // the signal can be destroyed by one of its callbacks, the core stays alive until the end
+  const std::shared_ptr<core> state_holder = _core;
+  core& state = *state_holder;
+  const emit_guard guard(state);
 
-      if (!jnt.connection->locked)
-      {
-        if (std::next(iter, 1) == _callbacks.cend())
-        {
-          return jnt.callback(std::forward<Args>(args)...);
-        }
+  // callbacks connected during the emission go to the pending list and are not called
+  const std::size_t count = state.joints.size();
 
+  if constexpr (std::is_void_v<R>)
+  {
+    for (std::size_t index = 0; index < count; ++index)
+    {
+      const joint& jnt = state.joints[index];
+      if (jnt.alive && !jnt.locked)
+      {
         jnt.callback(std::forward<Args>(args)...);
       }
     }
   }
-
-  return R();
+  else
+  {
+    R result{};
+    for (std::size_t index = 0; index < count; ++index)
+    {
+      const joint& jnt = state.joints[index];
+      if (jnt.alive && !jnt.locked)
+      {
+        result = jnt.callback(std::forward<Args>(args)...);
+      }
+    }
+    return result;
+  }
 }
 
 template <typename R, typename... Args>
@@ -412,8 +597,6 @@ R signal<R(Args...)>::operator()(Args... args, const T& agg)
 {
   std::vector<R> result;
 
-  //  std::lock_guard<std::mutex> locker(_mutex);
-
   if (!_locked)
   {
     for (signal* sig : _children)
@@ -421,15 +604,19 @@ R signal<R(Args...)>::operator()(Args... args, const T& agg)
       sig->operator()(std::forward<Args>(args)...);
     }
 
-    result.reserve(_callbacks.size());
+    const std::shared_ptr<core> state_holder = _core;
+    core& state = *state_holder;
+    const emit_guard guard(state);
 
-    for (auto iter = _callbacks.cbegin(); iter != _callbacks.cend(); ++iter)
-    {
-      const joint& jnt = *iter;
+    const std::size_t count = state.joints.size();
+    result.reserve(count);
 
-      if (!jnt.connection->locked)
+    for (std::size_t index = 0; index < count; ++index)
+    {
+      const joint& jnt = state.joints[index];
+      if (jnt.alive && !jnt.locked)
       {
-        result.push_back(std::move(jnt.callback(std::forward<Args>(args)...)));
+        result.push_back(jnt.callback(std::forward<Args>(args)...));
       }
     }
   }
@@ -438,89 +625,73 @@ R signal<R(Args...)>::operator()(Args... args, const T& agg)
 }
 
 template <typename R, typename... Args>
-template <typename T, typename U, int... Ns>
-typename signal<R(Args...)>::callback_type signal<R(Args...)>::construct_mem_fn(
-    const T& fn, U* p, int_sequence<Ns...>) const
+void signal<R(Args...)>::copy_callbacks(const core& callbacks)
 {
-  return std::bind(fn, p, placeholder_lsignal<Ns>{}...);
-}
-
-template <typename R, typename... Args>
-void signal<R(Args...)>::copy_callbacks(const std::list<joint>& callbacks)
-{
-  for (auto iter = callbacks.begin(); iter != callbacks.end(); ++iter)
+  for (const auto* container : {&callbacks.joints, &callbacks.pending})
   {
-    const joint& jn = *iter;
-
-    if (jn.owner == nullptr)
+    for (const auto& jnt : *container)
     {
-      joint jnt;
-
-      jnt.callback = jn.callback;
-      jnt.connection = jn.connection;
-      jnt.owner = nullptr;
-
-      _callbacks.push_back(std::move(jnt));
+      if (jnt.alive && jnt.owner == nullptr)
+      {
+        create_connection(static_cast<callback_type>(jnt.callback), nullptr).set_lock(jnt.locked);
+      }
     }
   }
 }
 
 template <typename R, typename... Args>
-std::shared_ptr<connection_data> signal<R(Args...)>::create_connection(callback_type&& fn,
-                                                                       slot* owner)
+void signal<R(Args...)>::unlink()
 {
-  std::shared_ptr<connection_data> connection = std::make_shared<connection_data>();
-
-  if (owner != nullptr)
+  if (_parent != nullptr)
   {
-    auto deleter = [this](std::shared_ptr<connection_data> connection)
-    { destroy_connection(connection); };
-
-    connection_cleaner cleaner;
-
-    cleaner.deleter = deleter;
-    cleaner.data = connection;
-
-    owner->_data = connection;
-    owner->_cleaners.emplace_back(cleaner);
+    _parent->_children.remove(this);
+    _parent = nullptr;
   }
 
-  joint jnt;
-
-  jnt.callback = std::move(fn);
-  jnt.connection = connection;
-  jnt.owner = owner;
-
-  //  std::lock_guard<std::mutex> locker(_mutex);
-
-  _callbacks.push_back(std::move(jnt));
-
-  return connection;
+  for (signal* sig : _children)
+  {
+    sig->_parent = nullptr;
+  }
+  _children.clear();
 }
 
 template <typename R, typename... Args>
-void signal<R(Args...)>::destroy_connection(std::shared_ptr<connection_data> connection)
+void signal<R(Args...)>::take_links(signal& rhs)
 {
-  //  std::lock_guard<std::mutex> locker(_mutex);
+  if (rhs._parent != nullptr)
+  {
+    std::replace(rhs._parent->_children.begin(), rhs._parent->_children.end(), &rhs, this);
+    std::swap(_parent, rhs._parent);
+  }
 
-  for (auto iter = _callbacks.begin(); iter != _callbacks.end(); ++iter)
+  _children = std::move(rhs._children);
+  rhs._children.clear();
+  for (signal* sig : _children)
   {
-    const joint& jnt = *iter;
+    sig->_parent = this;
+  }
+}
 
-    if (jnt.connection == connection)
-    {
-      if (jnt.owner != nullptr)
-      {
-        jnt.owner->_data = nullptr;
-        jnt.owner->_cleaners.clear();
-      }
+template <typename R, typename... Args>
+connection signal<R(Args...)>::create_connection(callback_type&& fn, slot* owner)
+{
+  core& state = *_core;
+  const std::uint64_t id = state.next_id++;
 
-      _callbacks.erase(iter);
+  // during the emission the storage of callbacks can't be reallocated
+  auto& container = state.emit_depth > 0 ? state.pending : state.joints;
+  container.push_back(joint{id, std::move(fn), owner, false, true});
 
-      break;
-    }
+  if (owner != nullptr)
+  {
+    owner->_core = _core;
+    owner->_id = id;
+    owner->_cleaners.push_back(connection_cleaner{_core, id});
   }
+
+  return connection(_core, id);
 }
+
 }  // namespace lsignal
 
 #endif  // MVVM_SIGNALS_LSIGNAL_H_
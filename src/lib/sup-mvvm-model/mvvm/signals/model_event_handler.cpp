@@ -36,6 +36,12 @@ ModelEventHandler::ModelEventHandler()
   Register<ModelAboutToBeResetEvent>();
   Register<ModelResetEvent>();
   Register<ModelAboutToBeDestroyedEvent>();
+  Register<AboutToInsertItemsEvent>();
+  Register<ItemsInsertedEvent>();
+  Register<AboutToRemoveItemsEvent>();
+  Register<ItemsRemovedEvent>();
+  Register<DataAppendedEvent>();
+  Register<DataRegionChangedEvent>();
 }
 
 }  // namespace mvvm
@@ -22,6 +22,10 @@
 
 #include "plottable_items.h"
 
+#include <mvvm/model/item_utils.h>
+#include <mvvm/model/session_item_data.h>
+#include <mvvm/utils/numeric_array_utils.h>
+
 namespace
 {
 const double kDefaultAxisMin = 0.0;
@@ -114,6 +118,11 @@ void ViewportAxisItem::SetInLog(bool value)
 
 BinnedAxisItem::BinnedAxisItem(const std::string& model_type) : BasicAxisItem(model_type) {}
 
+DataRange BinnedAxisItem::GetBinCentersRange() const
+{
+  return utils::FindDataRange(GetBinCenters());
+}
+
 static inline const std::string kNbins = "kNbins";
 
 // --- FixedBinAxisItem ------------------------------------------------------
@@ -160,16 +169,41 @@ int FixedBinAxisItem::GetSize() const
 
 std::vector<double> FixedBinAxisItem::GetBinCenters() const
 {
-  std::vector<double> result;
   const int nbins = GetSize();
-  const double step = (GetMax() - GetMin()) / nbins;
+  const double xmin = GetMin();
+  const double xmax = GetMax();
 
-  result.resize(static_cast<size_t>(nbins), 0.0);
-  for (int i = 0; i < nbins; ++i)
+  const bool is_valid_cache = nbins == m_cache.nbins && xmin == m_cache.xmin
+                              && xmax == m_cache.xmax
+                              && m_cache.centers.size() == static_cast<size_t>(nbins);
+  if (!is_valid_cache)
   {
-    result[i] = GetMin() + step * (i + 0.5);
+    const double step = (xmax - xmin) / nbins;
+    m_cache.centers.resize(static_cast<size_t>(nbins), 0.0);
+    for (int i = 0; i < nbins; ++i)
+    {
+      m_cache.centers[i] = xmin + step * (i + 0.5);
+    }
+    m_cache.nbins = nbins;
+    m_cache.xmin = xmin;
+    m_cache.xmax = xmax;
   }
 
+  return m_cache.centers;
+}
+
+DataRange FixedBinAxisItem::GetBinCentersRange() const
+{
+  DataRange result;
+  const int nbins = GetSize();
+  if (nbins > 0)
+  {
+    const double xmin = GetMin();
+    const double step = (GetMax() - xmin) / nbins;
+    result.Add(xmin + step * 0.5);
+    result.Add(xmin + step * (nbins - 0.5));
+    result.count = static_cast<std::size_t>(nbins);
+  }
   return result;
 }
 
@@ -178,7 +212,7 @@ std::vector<double> FixedBinAxisItem::GetBinCenters() const
 PointwiseAxisItem::PointwiseAxisItem(const std::string& model_type) : BinnedAxisItem(model_type)
 {
   // vector of points matching default xmin, xmax
-  SetData(std::vector<double>{kDefaultAxisMin, kDefaultAxisMax});
+  SetData(SharedArray<double>{kDefaultAxisMin, kDefaultAxisMax});
   SetEditable(false);  // prevent editing in widgets, since there is no corresponding editor
 }
 
@@ -194,7 +228,16 @@ std::unique_ptr<SessionItem> PointwiseAxisItem::Clone() const
 
 void PointwiseAxisItem::SetParameters(const std::vector<double>& data)
 {
-  SetData(data);
+  const variant_t points = SharedArray<double>(data);
+  // points of axes loaded from older projects are stored in a plain vector
+  if (GetItemData()->DataReference(DataRole::kData).index() == points.index())
+  {
+    SetData(points);
+  }
+  else
+  {
+    utils::ReplaceData(*this, points, DataRole::kData);
+  }
 }
 
 std::unique_ptr<PointwiseAxisItem> PointwiseAxisItem::Create(const std::vector<double>& data)
@@ -206,19 +249,49 @@ std::unique_ptr<PointwiseAxisItem> PointwiseAxisItem::Create(const std::vector<d
 
 std::pair<double, double> PointwiseAxisItem::GetRange() const
 {
-  auto data = GetBinCenters();
-  return GetBinCenters().empty() ? std::make_pair(kDefaultAxisMin, kDefaultAxisMax)
-                                 : std::make_pair(data.front(), data.back());
+  const auto& info = GetPointsInfo();
+  return info.range.count == 0 ? std::make_pair(kDefaultAxisMin, kDefaultAxisMax)
+                               : std::make_pair(info.front, info.back);
 }
 
 int PointwiseAxisItem::GetSize() const
 {
-  return static_cast<int>(GetBinCenters().size());
+  return static_cast<int>(GetPointsInfo().range.count);
 }
 
 std::vector<double> PointwiseAxisItem::GetBinCenters() const
 {
-  return Data<std::vector<double>>();
+  const auto& points = GetItemData()->DataReference(DataRole::kData);
+  return utils::IsNumericArray(points) ? utils::ToDoubleVector(points) : std::vector<double>{};
+}
+
+DataRange PointwiseAxisItem::GetBinCentersRange() const
+{
+  return GetPointsInfo().range;
+}
+
+const PointwiseAxisItem::PointsInfo& PointwiseAxisItem::GetPointsInfo() const
+{
+  const auto revision = GetItemData()->GetRevision();
+  if (revision != m_points_info.revision)
+  {
+    const auto& points = GetItemData()->DataReference(DataRole::kData);
+    m_points_info = {revision, 0.0, 0.0, {}};
+    if (utils::IsNumericArray(points))
+    {
+      auto on_points = [this](const auto* data, std::size_t size)
+      {
+        if (size > 0)
+        {
+          m_points_info.front = static_cast<double>(data[0]);
+          m_points_info.back = static_cast<double>(data[size - 1]);
+        }
+      };
+      utils::VisitNumericArray(points, on_points);
+      m_points_info.range = utils::FindNumericArrayRange(points);
+    }
+  }
+  return m_points_info;
 }
 
 }  // namespace mvvm
@@ -25,6 +25,7 @@
 //! Collection of axis items for 1D and 2D data/plotting support.
 
 #include <mvvm/model/compound_item.h>
+#include <mvvm/utils/data_range.h>
 
 #include <memory>
 #include <vector>
@@ -108,6 +109,13 @@ public:
   virtual int GetSize() const = 0;
 
   virtual std::vector<double> GetBinCenters() const = 0;
+
+  /**
+   * @brief Returns min and max of bin centers.
+   *
+   * Default implementation goes through all bin centers, derived classes provide cheaper ways.
+   */
+  virtual DataRange GetBinCentersRange() const;
 };
 
 /**
@@ -132,13 +140,34 @@ public:
 
   int GetSize() const override;
 
+  /**
+   * @brief Returns bin centers.
+   *
+   * Bin centers are cached and rebuilt only when axis parameters change.
+   */
   std::vector<double> GetBinCenters() const override;
+
+  /**
+   * @brief Returns min and max of bin centers, calculated from axis parameters.
+   */
+  DataRange GetBinCentersRange() const override;
+
+private:
+  struct BinCentersCache
+  {
+    int nbins{0};
+    double xmin{0.0};
+    double xmax{0.0};
+    std::vector<double> centers;
+  };
+  mutable BinCentersCache m_cache;
 };
 
 /**
  * @brief The PointwiseAxisItem class represents a pointwise axis.
  *
- * Defines an axis via an array of points representing point coordinates.
+ * Defines an axis via an array of points representing point coordinates. Points are kept in
+ * SharedArray, so reading them from the item doesn't copy the data.
  */
 class MVVM_MODEL_EXPORT PointwiseAxisItem : public BinnedAxisItem
 {
@@ -158,6 +187,27 @@ public:
   int GetSize() const override;
 
   std::vector<double> GetBinCenters() const override;
+
+  DataRange GetBinCentersRange() const override;
+
+private:
+  /**
+   * @brief The PointsInfo struct holds quantities derived from the points of the axis.
+   */
+  struct PointsInfo
+  {
+    std::uint64_t revision{0};  //!< revision of item data the info was calculated for
+    double front{0.0};
+    double back{0.0};
+    DataRange range;
+  };
+
+  /**
+   * @brief Returns info about axis points, recalculates it if the data of the item has changed.
+   */
+  const PointsInfo& GetPointsInfo() const;
+
+  mutable PointsInfo m_points_info;
 };
 
 }  // namespace mvvm
@@ -23,6 +23,9 @@
 #include "axis_items.h"
 
 #include <mvvm/model/i_session_model.h>
+#include <mvvm/model/item_utils.h>
+#include <mvvm/model/session_item_data.h>
+#include <mvvm/utils/numeric_array_utils.h>
 
 namespace
 {
@@ -38,12 +41,12 @@ namespace mvvm
 
 static inline const std::string kAxis = "kAxis";
 
-Data1DItem::Data1DItem() : CompoundItem(GetStaticType())
+Data1DItem::Data1DItem(const std::string& model_type) : CompoundItem(model_type)
 {
   // prevent editing in widgets, since there is no corresponding editor
-  AddProperty(kValues, std::vector<double>()).SetDisplayName("Values").SetEditable(false);
+  AddProperty(kValues, SharedArray<double>()).SetDisplayName("Values").SetEditable(false);
 
-  AddProperty(kErrors, std::vector<double>()).SetDisplayName("Errors").SetEditable(false);
+  AddProperty(kErrors, SharedArray<double>()).SetDisplayName("Errors").SetEditable(false);
 
   RegisterTag(
       TagInfo(kAxis, 0, 1, {FixedBinAxisItem::GetStaticType(), PointwiseAxisItem::GetStaticType()}),
@@ -68,24 +71,62 @@ std::vector<double> Data1DItem::GetBinCenters() const
   return axis ? axis->GetBinCenters() : std::vector<double>{};
 }
 
+//! Returns min and max of bin centers.
+
+DataRange Data1DItem::GetBinCentersRange() const
+{
+  auto axis = GetItem<BinnedAxisItem>(kAxis);
+  return axis ? axis->GetBinCentersRange() : DataRange{};
+}
+
 //! Sets internal data buffer to given data. If size of axis doesn't match the size of the data,
 //! exception will be thrown.
 
 void Data1DItem::SetValues(const std::vector<double>& data)
 {
-  if (total_bin_count(this) != data.size())
+  SetRawValues(SharedArray<double>(data));
+}
+
+//! Returns values stored in bins. Values stored in a narrow numeric type are converted to double.
+
+std::vector<double> Data1DItem::GetValues() const
+{
+  const auto& values = GetRawValues();
+  return utils::IsNumericArray(values) ? utils::ToDoubleVector(values) : std::vector<double>{};
+}
+
+//! Sets internal data buffer to given array of numbers, keeping the numeric type of the array.
+//! Allows to store data which is natively float32, int32, int64 or uint16 without widening it to
+//! double. If size of axis doesn't match the size of the data, exception will be thrown.
+
+void Data1DItem::SetRawValues(const variant_t& data)
+{
+  if (!utils::IsNumericArray(data))
+  {
+    throw RuntimeException("Error in Data1DItem: data is not an array of numbers");
+  }
+
+  if (total_bin_count(this) != utils::GetNumericArraySize(data))
   {
     throw RuntimeException("Error in Data1DItem: data doesn't match size of axis");
   }
 
-  SetProperty(kValues, data);
+  SetArrayProperty(kValues, data);
 }
 
-//! Returns values stored in bins.
+//! Returns values stored in bins in their stored numeric type. The reference points to the data
+//! of the item and is valid until values change.
 
-std::vector<double> Data1DItem::GetValues() const
+const variant_t& Data1DItem::GetRawValues() const
+{
+  return GetItem(kValues)->GetItemData()->DataReference(DataRole::kData);
+}
+
+//! Returns min and max of values. The range is cached until values change.
+
+DataRange Data1DItem::GetValuesRange() const
 {
-  return Property<std::vector<double>>(kValues);
+  return GetCachedRange(kValues, m_values_range);
 }
 
 //! Sets errors on values in bins.
@@ -97,14 +138,22 @@ void Data1DItem::SetErrors(const std::vector<double>& errors)
     throw RuntimeException("Error in Data1DItem: data doesn't match size of axis");
   }
 
-  SetProperty(kErrors, errors);
+  SetArrayProperty(kErrors, SharedArray<double>(errors));
 }
 
 //! Returns value errors stored in bins.
 
 std::vector<double> Data1DItem::GetErrors() const
 {
-  return Property<std::vector<double>>(kErrors);
+  const auto& errors = GetItem(kErrors)->GetItemData()->DataReference(DataRole::kData);
+  return utils::IsNumericArray(errors) ? utils::ToDoubleVector(errors) : std::vector<double>{};
+}
+
+//! Returns min and max of errors. The range is cached until errors change.
+
+DataRange Data1DItem::GetErrorsRange() const
+{
+  return GetCachedRange(kErrors, m_errors_range);
 }
 
 BinnedAxisItem* Data1DItem::GetAxis() const
@@ -126,4 +175,32 @@ void Data1DItem::SetAxis(std::unique_ptr<BinnedAxisItem> axis)
   SetValues(std::vector<double>(GetAxis()->GetSize(), 0.0));
 }
 
+void Data1DItem::SetArrayProperty(const std::string& property_name, const variant_t& data)
+{
+  // the type changes if the array is narrow-typed, or was loaded from older projects as a vector
+  auto property = GetItem(property_name);
+  if (property->GetItemData()->DataReference(DataRole::kData).index() == data.index())
+  {
+    property->SetData(data);
+  }
+  else
+  {
+    utils::ReplaceData(*property, data, DataRole::kData);
+  }
+}
+
+DataRange Data1DItem::GetCachedRange(const std::string& property_name, RangeCache& cache) const
+{
+  auto property = GetItem(property_name);
+  const auto revision = property->GetItemData()->GetRevision();
+  if (revision != cache.revision)
+  {
+    const auto& values = property->GetItemData()->DataReference(DataRole::kData);
+    cache.range =
+        utils::IsNumericArray(values) ? utils::FindNumericArrayRange(values) : DataRange{};
+    cache.revision = revision;
+  }
+  return cache.range;
+}
+
 }  // namespace mvvm
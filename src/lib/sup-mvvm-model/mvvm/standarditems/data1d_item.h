@@ -21,7 +21,9 @@
 #ifndef MVVM_STANDARDITEMS_DATA1D_ITEM_H_
 #define MVVM_STANDARDITEMS_DATA1D_ITEM_H_
 
+#include <mvvm/core/variant.h>
 #include <mvvm/model/compound_item.h>
+#include <mvvm/utils/data_range.h>
 
 #include <vector>
 
@@ -32,7 +34,10 @@ class BinnedAxisItem;
 
 //! Represents one-dimensional data (axis and values).
 //! Values are stored in Data1DItem itself, axis is attached as a child. Corresponding plot
-//! properties will be served by GraphItem.
+//! properties will be served by GraphItem. Values and errors of double type are kept in
+//! SharedArray, so reading the raw data or taking undo snapshots doesn't copy it.
+//! Getters and setters of data are virtual, items keeping data differently (e.g. StreamData1DItem)
+//! override them, so they can be used via a pointer to Data1DItem.
 
 class MVVM_MODEL_EXPORT Data1DItem : public CompoundItem
 {
@@ -40,19 +45,28 @@ public:
   static inline const std::string kValues = "kValues";
   static inline const std::string kErrors = "kErrors";
 
-  Data1DItem();
+  explicit Data1DItem(const std::string& model_type = GetStaticType());
 
   static std::string GetStaticType();
 
   std::unique_ptr<SessionItem> Clone() const override;
 
-  std::vector<double> GetBinCenters() const;
+  virtual std::vector<double> GetBinCenters() const;
 
-  void SetValues(const std::vector<double>& data);
-  std::vector<double> GetValues() const;
+  virtual DataRange GetBinCentersRange() const;
 
-  void SetErrors(const std::vector<double>& errors);
-  std::vector<double> GetErrors() const;
+  virtual void SetValues(const std::vector<double>& data);
+  virtual std::vector<double> GetValues() const;
+
+  virtual void SetRawValues(const variant_t& data);
+  const variant_t& GetRawValues() const;
+
+  virtual DataRange GetValuesRange() const;
+
+  virtual void SetErrors(const std::vector<double>& errors);
+  virtual std::vector<double> GetErrors() const;
+
+  virtual DataRange GetErrorsRange() const;
 
   BinnedAxisItem* GetAxis() const;
 
@@ -60,7 +74,20 @@ public:
   template <typename T, typename... Args>
   T* SetAxis(Args&&... args);
 
-  void SetAxis(std::unique_ptr<BinnedAxisItem> axis);
+  virtual void SetAxis(std::unique_ptr<BinnedAxisItem> axis);
+
+private:
+  struct RangeCache
+  {
+    std::uint64_t revision{0};  //!< revision of property data the range was found for
+    DataRange range;
+  };
+
+  void SetArrayProperty(const std::string& property_name, const variant_t& data);
+  DataRange GetCachedRange(const std::string& property_name, RangeCache& cache) const;
+
+  mutable RangeCache m_values_range;
+  mutable RangeCache m_errors_range;
 };
 
 template <typename T, typename... Args>
@@ -0,0 +1,288 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "data2d_item.h"
+
+#include "axis_items.h"
+
+#include <mvvm/commands/abstract_command.h>
+#include <mvvm/commands/i_command_stack.h>
+#include <mvvm/model/i_session_model.h>
+#include <mvvm/model/model_utils.h>
+#include <mvvm/model/path.h>
+#include <mvvm/model/session_item_data.h>
+#include <mvvm/signals/model_event_handler.h>
+
+#include <algorithm>
+
+namespace mvvm
+{
+
+static inline const std::string kXAxis = "kXAxis";
+static inline const std::string kYAxis = "kYAxis";
+
+//! Command to replace values in the region of bins. Keeps values of the region only, executing and
+//! undoing the command swaps them with values of the item.
+
+class Data2DItem::SetValuesInRegionCommand : public AbstractCommand
+{
+public:
+  SetValuesInRegionCommand(Data2DItem* item, const DataRegion& region, std::vector<double> data)
+      : m_model(item->GetModel())
+      , m_item_path(utils::PathFromItem(item))
+      , m_region(region)
+      , m_values(std::move(data))
+  {
+    SetDescription("Set values in region");
+  }
+
+private:
+  void ExecuteImpl() override { SwapValues(); }
+
+  void UndoImpl() override { SwapValues(); }
+
+  void SwapValues()
+  {
+    auto item = dynamic_cast<Data2DItem*>(utils::ItemFromPath(*m_model, m_item_path));
+    if (!item)
+    {
+      throw RuntimeException("Error in Data2DItem: can't find the item to set values in region");
+    }
+    m_values = item->ReplaceValuesInRegion(m_region, m_values);
+  }
+
+  const ISessionModel* m_model{nullptr};
+  Path m_item_path;
+  DataRegion m_region;
+  std::vector<double> m_values;  //!< values to set on the next execute or undo
+};
+
+Data2DItem::Data2DItem(const std::string& model_type) : CompoundItem(model_type)
+{
+  // prevent editing in widgets, since there is no corresponding editor
+  AddProperty(kValues, SharedArray<double>()).SetDisplayName("Values").SetEditable(false);
+
+  const std::vector<std::string> axis_types{FixedBinAxisItem::GetStaticType(),
+                                            PointwiseAxisItem::GetStaticType()};
+  RegisterTag(TagInfo(kXAxis, 0, 1, axis_types));
+  RegisterTag(TagInfo(kYAxis, 0, 1, axis_types));
+}
+
+std::string Data2DItem::GetStaticType()
+{
+  return "Data2D";
+}
+
+std::unique_ptr<SessionItem> Data2DItem::Clone() const
+{
+  return std::make_unique<Data2DItem>(*this);
+}
+
+BinnedAxisItem* Data2DItem::GetXAxis() const
+{
+  return GetItem<BinnedAxisItem>({kXAxis, 0});
+}
+
+BinnedAxisItem* Data2DItem::GetYAxis() const
+{
+  return GetItem<BinnedAxisItem>({kYAxis, 0});
+}
+
+void Data2DItem::SetAxes(std::unique_ptr<BinnedAxisItem> x_axis,
+                         std::unique_ptr<BinnedAxisItem> y_axis)
+{
+  // we disable possibility to re-create axes to facilitate undo/redo
+  if (GetXAxis() || GetYAxis())
+  {
+    throw RuntimeException("Error in Data2DItem: axes were already set");
+  }
+
+  if (!x_axis || !y_axis)
+  {
+    throw RuntimeException("Error in Data2DItem: axis is not defined");
+  }
+
+  if (GetModel())
+  {
+    GetModel()->InsertItem(std::move(x_axis), this, {kXAxis, 0});
+    GetModel()->InsertItem(std::move(y_axis), this, {kYAxis, 0});
+  }
+  else
+  {
+    InsertItem(std::move(x_axis), {kXAxis, 0});
+    InsertItem(std::move(y_axis), {kYAxis, 0});
+  }
+
+  SetValues(std::vector<double>(GetXSize() * GetYSize(), 0.0));
+}
+
+//! Returns number of bins along x.
+
+std::size_t Data2DItem::GetXSize() const
+{
+  auto axis = GetXAxis();
+  return axis ? static_cast<std::size_t>(axis->GetSize()) : 0;
+}
+
+//! Returns number of bins along y.
+
+std::size_t Data2DItem::GetYSize() const
+{
+  auto axis = GetYAxis();
+  return axis ? static_cast<std::size_t>(axis->GetSize()) : 0;
+}
+
+//! Sets internal data buffer to given data. If the size of the data doesn't match the number of
+//! bins, exception will be thrown.
+
+void Data2DItem::SetValues(const std::vector<double>& data)
+{
+  SetValues(SharedArray<double>(data));
+}
+
+//! Sets internal data buffer to given array. The array is shared, not copied.
+
+void Data2DItem::SetValues(const SharedArray<double>& data)
+{
+  if (data.size() != GetXSize() * GetYSize())
+  {
+    throw RuntimeException("Error in Data2DItem: data doesn't match size of axes");
+  }
+
+  SetProperty(kValues, data);
+}
+
+//! Returns a copy of values stored in bins.
+
+std::vector<double> Data2DItem::GetValues() const
+{
+  return GetValuesArray().ToVector();
+}
+
+//! Returns values stored in bins. The array shares the buffer with the item.
+
+SharedArray<double> Data2DItem::GetValuesArray() const
+{
+  return Property<SharedArray<double>>(kValues);
+}
+
+//! Replaces values of the given region of bins with given data, where data contains values of the
+//! region row by row. Values are modified in place and the change is reported by a single
+//! DataRegionChangedEvent, so listeners can update only this region. The buffer is copied only if
+//! it is shared with other arrays. If the model has the undo stack, the change is recorded as a
+//! command keeping old values of the region only.
+
+void Data2DItem::SetValuesInRegion(const DataRegion& region, const std::vector<double>& data)
+{
+  const DataRegion full_region{0, 0, GetXSize(), GetYSize()};
+  if (region.Intersected(full_region) != region)
+  {
+    throw RuntimeException("Error in Data2DItem: region is outside of the data");
+  }
+
+  if (data.size() != region.GetWidth() * region.GetHeight())
+  {
+    throw RuntimeException("Error in Data2DItem: data doesn't match size of the region");
+  }
+
+  if (GetValuesArray().size() != full_region.GetWidth() * full_region.GetHeight())
+  {
+    throw RuntimeException("Error in Data2DItem: values don't match size of axes");
+  }
+
+  if (region.IsEmpty())
+  {
+    return;
+  }
+
+  if (auto command_stack = GetModel() ? GetModel()->GetCommandStack() : nullptr; command_stack)
+  {
+    command_stack->Execute(std::make_unique<SetValuesInRegionCommand>(this, region, data));
+  }
+  else
+  {
+    ReplaceValuesInRegion(region, data);
+  }
+}
+
+//! Returns min and max of values. The range is cached until values change.
+
+DataRange Data2DItem::GetValuesRange() const
+{
+  const auto revision = GetValuesRevision();
+  if (revision != m_values_range.revision)
+  {
+    const auto values = GetValuesArray();
+    m_values_range.range = utils::FindDataRange(values.data(), values.size());
+    m_values_range.revision = revision;
+  }
+  return m_values_range.range;
+}
+
+std::uint64_t Data2DItem::GetValuesRevision() const
+{
+  return GetItem(kValues)->GetItemData()->GetRevision();
+}
+
+//! Writes given data into the region of values, reports the change and returns overwritten values.
+//! The region and the size of data are expected to be validated.
+
+std::vector<double> Data2DItem::ReplaceValuesInRegion(const DataRegion& region,
+                                                      const std::vector<double>& data)
+{
+  // the cached range stays valid, if none of overwritten values is the minimum or the maximum
+  bool is_valid_range = m_values_range.revision == GetValuesRevision();
+  const auto range = m_values_range.range;
+  auto is_extremum = [&range](double value) { return value == range.min || value == range.max; };
+
+  std::vector<double> result(data.size());
+  auto value = GetItem(kValues)->GetItemData()->GetMutableData(DataRole::kData);
+  auto& values = std::get<SharedArray<double>>(*value).GetMutableVector();
+  const auto width = region.GetWidth();
+  for (auto y = region.y_begin; y < region.y_end; ++y)
+  {
+    const auto offset = (y - region.y_begin) * width;
+    auto target = values.data() + y * GetXSize() + region.x_begin;
+    is_valid_range = is_valid_range && std::none_of(target, target + width, is_extremum);
+    std::copy(target, target + width, result.data() + offset);
+    std::copy(data.data() + offset, data.data() + offset + width, target);
+  }
+
+  if (is_valid_range)
+  {
+    auto new_range = range;
+    new_range.Merge(utils::FindDataRange(data.data(), data.size()));
+    new_range.count = range.count;
+    m_values_range = {GetValuesRevision(), new_range};
+  }
+
+  NotifyDataRegionChanged(region);
+  return result;
+}
+
+void Data2DItem::NotifyDataRegionChanged(const DataRegion& region)
+{
+  if (auto model = GetModel(); model && model->GetEventHandler())
+  {
+    model->GetEventHandler()->Notify<DataRegionChangedEvent>(this, region);
+  }
+}
+
+}  // namespace mvvm
@@ -0,0 +1,92 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_STANDARDITEMS_DATA2D_ITEM_H_
+#define MVVM_STANDARDITEMS_DATA2D_ITEM_H_
+
+#include <mvvm/core/shared_array.h>
+#include <mvvm/model/compound_item.h>
+#include <mvvm/utils/data_range.h>
+#include <mvvm/utils/data_region.h>
+
+#include <vector>
+
+namespace mvvm
+{
+
+class BinnedAxisItem;
+
+//! Represents two-dimensional data (two axes and values).
+//! Values are stored in a single contiguous buffer shared between copies of the data, row by row,
+//! the value of the bin (x, y) has index y * GetXSize() + x. Axes are attached as children.
+//! Corresponding plot properties will be served by the color map.
+
+class MVVM_MODEL_EXPORT Data2DItem : public CompoundItem
+{
+public:
+  static inline const std::string kValues = "kValues";
+
+  explicit Data2DItem(const std::string& model_type = GetStaticType());
+
+  static std::string GetStaticType();
+
+  std::unique_ptr<SessionItem> Clone() const override;
+
+  BinnedAxisItem* GetXAxis() const;
+
+  BinnedAxisItem* GetYAxis() const;
+
+  //! Inserts both axes and initializes values with zeros.
+  void SetAxes(std::unique_ptr<BinnedAxisItem> x_axis, std::unique_ptr<BinnedAxisItem> y_axis);
+
+  std::size_t GetXSize() const;
+
+  std::size_t GetYSize() const;
+
+  void SetValues(const std::vector<double>& data);
+  void SetValues(const SharedArray<double>& data);
+
+  std::vector<double> GetValues() const;
+  SharedArray<double> GetValuesArray() const;
+
+  void SetValuesInRegion(const DataRegion& region, const std::vector<double>& data);
+
+  DataRange GetValuesRange() const;
+
+private:
+  struct RangeCache
+  {
+    std::uint64_t revision{0};  //!< revision of values the range was found for
+    DataRange range;
+  };
+
+  class SetValuesInRegionCommand;
+
+  std::uint64_t GetValuesRevision() const;
+  std::vector<double> ReplaceValuesInRegion(const DataRegion& region,
+                                            const std::vector<double>& data);
+  void NotifyDataRegionChanged(const DataRegion& region);
+
+  mutable RangeCache m_values_range;
+};
+
+}  // namespace mvvm
+
+#endif  // MVVM_STANDARDITEMS_DATA2D_ITEM_H_
@@ -92,6 +92,20 @@ std::vector<double> GraphItem::GetErrors() const
   return GetDataItem() ? GetDataItem()->GetErrors() : std::vector<double>();
 }
 
+//! Returns min and max of bin centers of the data item, without copying the data.
+
+DataRange GraphItem::GetBinCentersRange() const
+{
+  return GetDataItem() ? GetDataItem()->GetBinCentersRange() : DataRange{};
+}
+
+//! Returns min and max of values of the data item, without copying the data.
+
+DataRange GraphItem::GetValuesRange() const
+{
+  return GetDataItem() ? GetDataItem()->GetValuesRange() : DataRange{};
+}
+
 //! Returns color name in `#RRGGBB` format.
 
 std::string GraphItem::GetNamedColor() const
@@ -22,6 +22,7 @@
 #define MVVM_STANDARDITEMS_GRAPH_ITEM_H_
 
 #include <mvvm/model/compound_item.h>
+#include <mvvm/utils/data_range.h>
 
 namespace mvvm
 {
@@ -57,6 +58,10 @@ public:
 
   std::vector<double> GetErrors() const;
 
+  DataRange GetBinCentersRange() const;
+
+  DataRange GetValuesRange() const;
+
   std::string GetNamedColor() const;
   void SetNamedColor(const std::string& named_color);
 
@@ -32,20 +32,21 @@ const double kFallBackMin = 0.0;
 const double kFallBackMax = 1.0;
 
 //! Find min and max values along all data points in all graphs.
-//! Function 'func' is used to run either through binCenters or binValues.
+//! Function 'func' is used to get the range of either binCenters or binValues of a graph. Ranges
+//! are cached by data items, so the cost doesn't depend on the number of points.
 
 template <typename T>
 auto GetMinMax(const std::vector<mvvm::GraphItem*>& graphs, T func)
 {
-  std::vector<double> values;
+  mvvm::DataRange range;
   for (auto graph : graphs)
   {
-    const auto array = func(graph);
-    std::copy(std::begin(array), std::end(array), std::back_inserter(values));
+    range.Merge(func(graph));
   }
 
-  auto [xmin, xmax] = std::minmax_element(std::begin(values), std::end(values));
-  return xmin != xmax ? std::make_pair(*xmin, *xmax) : std::make_pair(kFallBackMin, kFallBackMax);
+  // less than two points are not enough to define the range
+  return range.count > 1 && !range.IsEmpty() ? std::make_pair(range.min, range.max)
+                                             : std::make_pair(kFallBackMin, kFallBackMax);
 }
 
 }  // namespace
@@ -126,14 +127,16 @@ void GraphViewportItem::SetAllVisible()
 
 std::pair<double, double> GraphViewportItem::GetDataXRange() const
 {
-  return GetMinMax(GetVisibleGraphItems(), [](GraphItem* graph) { return graph->GetBinCenters(); });
+  return GetMinMax(GetVisibleGraphItems(),
+                   [](GraphItem* graph) { return graph->GetBinCentersRange(); });
 }
 
 //! Returns lower, upper range on y-axis occupied by all data points of all graphs.
 
 std::pair<double, double> GraphViewportItem::GetDataYRange() const
 {
-  return GetMinMax(GetVisibleGraphItems(), [](GraphItem* graph) { return graph->GetValues(); });
+  return GetMinMax(GetVisibleGraphItems(),
+                   [](GraphItem* graph) { return graph->GetValuesRange(); });
 }
 
 }  // namespace mvvm
@@ -30,6 +30,7 @@
 #include <mvvm/standarditems/chart_viewport_item.h>
 #include <mvvm/standarditems/container_item.h>
 #include <mvvm/standarditems/data1d_item.h>
+#include <mvvm/standarditems/data2d_item.h>
 #include <mvvm/standarditems/graph_item.h>
 #include <mvvm/standarditems/graph_viewport_item.h>
 #include <mvvm/standarditems/line_series_data_item.h>
@@ -37,6 +38,7 @@
 #include <mvvm/standarditems/linked_item.h>
 #include <mvvm/standarditems/plottable_items.h>
 #include <mvvm/standarditems/point_item.h>
+#include <mvvm/standarditems/stream_data1d_item.h>
 #include <mvvm/standarditems/vector_item.h>
 
 #endif  // MVVM_STANDARDITEMS_STANDARD_ITEM_INCLUDES_H_
@@ -0,0 +1,263 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "stream_data1d_item.h"
+
+#include "axis_items.h"
+
+#include <mvvm/core/mvvm_exceptions.h>
+#include <mvvm/model/i_session_model.h>
+#include <mvvm/signals/model_event_handler.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace mvvm
+{
+
+StreamData1DItem::StreamData1DItem() : Data1DItem(GetStaticType())
+{
+  AddProperty(kCapacity, 0).SetDisplayName("Capacity").SetToolTip("Maximum number of samples");
+}
+
+std::string StreamData1DItem::GetStaticType()
+{
+  return "StreamData1D";
+}
+
+std::unique_ptr<SessionItem> StreamData1DItem::Clone() const
+{
+  return std::make_unique<StreamData1DItem>(*this);
+}
+
+std::vector<double> StreamData1DItem::GetBinCenters() const
+{
+  return {m_x.begin(), m_x.end()};
+}
+
+std::vector<double> StreamData1DItem::GetValues() const
+{
+  return {m_y.begin(), m_y.end()};
+}
+
+std::vector<double> StreamData1DItem::GetErrors() const
+{
+  return {};
+}
+
+DataRange StreamData1DItem::GetBinCentersRange() const
+{
+  return m_x_range.Get();
+}
+
+DataRange StreamData1DItem::GetValuesRange() const
+{
+  return m_y_range.Get();
+}
+
+DataRange StreamData1DItem::GetErrorsRange() const
+{
+  return {};
+}
+
+void StreamData1DItem::SetValues(const std::vector<double>& data)
+{
+  (void)data;
+  throw RuntimeException("StreamData1DItem: values can't be set, samples have to be appended");
+}
+
+void StreamData1DItem::SetRawValues(const variant_t& data)
+{
+  (void)data;
+  throw RuntimeException("StreamData1DItem: values can't be set, samples have to be appended");
+}
+
+void StreamData1DItem::SetErrors(const std::vector<double>& errors)
+{
+  (void)errors;
+  throw RuntimeException("StreamData1DItem: the stream doesn't have errors");
+}
+
+void StreamData1DItem::SetAxis(std::unique_ptr<BinnedAxisItem> axis)
+{
+  (void)axis;
+  throw RuntimeException("StreamData1DItem: the stream doesn't have an axis");
+}
+
+std::size_t StreamData1DItem::GetCapacity() const
+{
+  return static_cast<std::size_t>(std::max(Property<int>(kCapacity), 0));
+}
+
+void StreamData1DItem::SetCapacity(std::size_t capacity)
+{
+  SetProperty(kCapacity, static_cast<int>(capacity));
+  if (ApplyCapacity() > 0)
+  {
+    NotifyDataChanged();
+  }
+}
+
+std::size_t StreamData1DItem::GetPointCount() const
+{
+  return m_x.size();
+}
+
+std::pair<double, double> StreamData1DItem::GetPoint(std::size_t index) const
+{
+  if (index >= m_x.size())
+  {
+    throw RuntimeException("StreamData1DItem: index is out of range");
+  }
+  return {m_x[index], m_y[index]};
+}
+
+void StreamData1DItem::AppendPoint(double x, double y)
+{
+  m_x.push_back(x);
+  m_y.push_back(y);
+  m_x_range.Add(x);
+  m_y_range.Add(y);
+  NotifyDataAppended(1, ApplyCapacity());
+}
+
+void StreamData1DItem::AppendPoints(const std::vector<double>& x, const std::vector<double>& y)
+{
+  if (x.size() != y.size())
+  {
+    throw RuntimeException("StreamData1DItem: size of x and y arrays doesn't match");
+  }
+
+  if (x.empty())
+  {
+    return;
+  }
+
+  m_x.insert(m_x.end(), x.begin(), x.end());
+  m_y.insert(m_y.end(), y.begin(), y.end());
+  for (std::size_t index = 0; index < x.size(); ++index)
+  {
+    m_x_range.Add(x[index]);
+    m_y_range.Add(y[index]);
+  }
+
+  // samples dropped right after insertion are not reported as appended
+  auto removed_count = ApplyCapacity();
+  auto appended_count = std::min(x.size(), m_x.size());
+  NotifyDataAppended(appended_count, removed_count - (x.size() - appended_count));
+}
+
+void StreamData1DItem::ClearPoints()
+{
+  if (m_x.empty())
+  {
+    return;
+  }
+
+  m_x.clear();
+  m_y.clear();
+  m_x_range = {};
+  m_y_range = {};
+  NotifyDataChanged();
+}
+
+std::size_t StreamData1DItem::ApplyCapacity()
+{
+  const auto capacity = GetCapacity();
+  if (capacity == 0 || m_x.size() <= capacity)
+  {
+    return 0;
+  }
+
+  const auto removed_count = m_x.size() - capacity;
+  for (std::size_t index = 0; index < removed_count; ++index)
+  {
+    m_x_range.Remove(m_x[index]);
+    m_y_range.Remove(m_y[index]);
+  }
+  m_x.erase(m_x.begin(), m_x.begin() + static_cast<std::ptrdiff_t>(removed_count));
+  m_y.erase(m_y.begin(), m_y.begin() + static_cast<std::ptrdiff_t>(removed_count));
+  return removed_count;
+}
+
+void StreamData1DItem::NotifyDataAppended(std::size_t appended_count, std::size_t removed_count)
+{
+  if (auto model = GetModel(); model && model->GetEventHandler())
+  {
+    model->GetEventHandler()->Notify<DataAppendedEvent>(this, appended_count, removed_count);
+  }
+}
+
+void StreamData1DItem::NotifyDataChanged()
+{
+  if (auto model = GetModel(); model && model->GetEventHandler())
+  {
+    model->GetEventHandler()->Notify<DataChangedEvent>(this, DataRole::kData);
+  }
+}
+
+void StreamData1DItem::RangeCache::Add(double value)
+{
+  ++count;
+  if (std::isnan(value))
+  {
+    return;  // NaN values are counted, but don't take part in the range
+  }
+
+  while (!min_candidates.empty() && min_candidates.back() > value)
+  {
+    min_candidates.pop_back();
+  }
+  min_candidates.push_back(value);
+
+  while (!max_candidates.empty() && max_candidates.back() < value)
+  {
+    max_candidates.pop_back();
+  }
+  max_candidates.push_back(value);
+}
+
+void StreamData1DItem::RangeCache::Remove(double value)
+{
+  // the value is the oldest sample, it can only be at the front of the queues
+  --count;
+  if (!min_candidates.empty() && min_candidates.front() == value)
+  {
+    min_candidates.pop_front();
+  }
+  if (!max_candidates.empty() && max_candidates.front() == value)
+  {
+    max_candidates.pop_front();
+  }
+}
+
+DataRange StreamData1DItem::RangeCache::Get() const
+{
+  DataRange result;
+  if (!min_candidates.empty())
+  {
+    result.min = min_candidates.front();
+    result.max = max_candidates.front();
+  }
+  result.count = count;
+  return result;
+}
+
+}  // namespace mvvm
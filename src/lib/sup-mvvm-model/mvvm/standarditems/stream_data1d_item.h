@@ -0,0 +1,187 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_STANDARDITEMS_STREAM_DATA1D_ITEM_H_
+#define MVVM_STANDARDITEMS_STREAM_DATA1D_ITEM_H_
+
+#include <mvvm/standarditems/data1d_item.h>
+
+#include <deque>
+
+namespace mvvm
+{
+
+/**
+ * @brief The StreamData1DItem class represents one-dimensional data acquired sample by sample.
+ *
+ * Samples are appended to the end of the buffer. If the capacity is set, the buffer works as a
+ * ring buffer and the oldest samples are dropped when it is full, otherwise the buffer simply
+ * grows. Each append is reported by a single DataAppendedEvent carrying the number of appended
+ * and dropped samples, so plot controllers can update plots incrementally. Clearing the buffer, or
+ * shrinking it by a smaller capacity, is reported by DataChangedEvent with DataRole::kData.
+ *
+ * Samples are kept in the item itself, outside of item data roles. They are not serialized and
+ * their changes are not undoable: samples dropped by the ring buffer, by ClearPoints() or by
+ * SetCapacity() are lost, and undoing the capacity change doesn't bring them back.
+ *
+ * Values, errors and the axis of the base class are not used. Getters of the base class are
+ * overridden to report samples, setters throw, so the item behaves the same when accessed via a
+ * pointer to Data1DItem.
+ */
+class MVVM_MODEL_EXPORT StreamData1DItem : public Data1DItem
+{
+public:
+  static inline const std::string kCapacity = "kCapacity";
+
+  StreamData1DItem();
+
+  static std::string GetStaticType();
+
+  std::unique_ptr<SessionItem> Clone() const override;
+
+  /**
+   * @brief Returns x-coordinates of all samples, from the oldest to the newest.
+   */
+  std::vector<double> GetBinCenters() const override;
+
+  /**
+   * @brief Returns values of all samples, from the oldest to the newest.
+   */
+  std::vector<double> GetValues() const override;
+
+  /**
+   * @brief Returns an empty vector, the stream doesn't have errors.
+   */
+  std::vector<double> GetErrors() const override;
+
+  /**
+   * @brief Returns min and max of x-coordinates of all samples.
+   *
+   * The range is maintained on append and on drop of the oldest samples in amortized constant
+   * time, samples are never searched again.
+   */
+  DataRange GetBinCentersRange() const override;
+
+  /**
+   * @brief Returns min and max of values of all samples, see GetBinCentersRange().
+   */
+  DataRange GetValuesRange() const override;
+
+  /**
+   * @brief Returns an empty range, the stream doesn't have errors.
+   */
+  DataRange GetErrorsRange() const override;
+
+  /**
+   * @brief Returns maximum number of samples kept in the buffer. Zero means no limit.
+   */
+  std::size_t GetCapacity() const;
+
+  /**
+   * @brief Sets maximum number of samples kept in the buffer. Zero means no limit.
+   *
+   * The oldest samples exceeding new capacity are dropped, this can't be undone.
+   */
+  void SetCapacity(std::size_t capacity);
+
+  /**
+   * @brief Returns number of samples in the buffer.
+   */
+  std::size_t GetPointCount() const;
+
+  /**
+   * @brief Returns (x,y) coordinates of the sample with given index, zero is the oldest.
+   */
+  std::pair<double, double> GetPoint(std::size_t index) const;
+
+  /**
+   * @brief Appends a sample to the buffer.
+   */
+  void AppendPoint(double x, double y);
+
+  /**
+   * @brief Appends several samples to the buffer, reports them with a single event.
+   *
+   * Will throw if arrays have different size.
+   */
+  void AppendPoints(const std::vector<double>& x, const std::vector<double>& y);
+
+  /**
+   * @brief Removes all samples from the buffer.
+   */
+  void ClearPoints();
+
+  /**
+   * @brief Throws, the stream doesn't have values of Data1DItem, samples are appended instead.
+   */
+  void SetValues(const std::vector<double>& data) override;
+
+  /**
+   * @brief Throws, see SetValues().
+   */
+  void SetRawValues(const variant_t& data) override;
+
+  /**
+   * @brief Throws, the stream doesn't have errors.
+   */
+  void SetErrors(const std::vector<double>& errors) override;
+
+  /**
+   * @brief Throws, the stream doesn't have an axis, x-coordinates are given with samples.
+   */
+  void SetAxis(std::unique_ptr<BinnedAxisItem> axis) override;
+
+  using Data1DItem::SetAxis;
+
+private:
+  /**
+   * @brief Drops the oldest samples exceeding the capacity, returns the number of dropped samples.
+   */
+  std::size_t ApplyCapacity();
+
+  void NotifyDataAppended(std::size_t appended_count, std::size_t removed_count);
+  void NotifyDataChanged();
+
+  /**
+   * @brief The RangeCache struct maintains min and max of samples in a sliding window.
+   *
+   * Samples are added to the back and removed from the front in the order of addition. Monotonic
+   * queues of candidates keep the current minimum and maximum at their fronts.
+   */
+  struct RangeCache
+  {
+    std::deque<double> min_candidates;  //!< non-decreasing values, the front is the minimum
+    std::deque<double> max_candidates;  //!< non-increasing values, the front is the maximum
+    std::size_t count{0};
+
+    void Add(double value);
+    void Remove(double value);
+    DataRange Get() const;
+  };
+
+  std::deque<double> m_x;
+  std::deque<double> m_y;
+  RangeCache m_x_range;
+  RangeCache m_y_range;
+};
+
+}  // namespace mvvm
+
+#endif  // MVVM_STANDARDITEMS_STREAM_DATA1D_ITEM_H_
@@ -0,0 +1,98 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "data_range.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MVVM_DATA_RANGE_USE_SSE2
+#endif
+
+namespace mvvm
+{
+
+bool DataRange::operator==(const DataRange& other) const
+{
+  if (IsEmpty() || other.IsEmpty())
+  {
+    return IsEmpty() == other.IsEmpty() && count == other.count;
+  }
+  return min == other.min && max == other.max && count == other.count;
+}
+
+bool DataRange::operator!=(const DataRange& other) const
+{
+  return !(*this == other);
+}
+
+namespace utils
+{
+
+DataRange FindDataRange(const double* data, std::size_t size)
+{
+  DataRange result;
+  std::size_t index{0};
+
+#ifdef MVVM_DATA_RANGE_USE_SSE2
+  // Two pairs of accumulators to hide the latency of min/max instructions. The accumulator is
+  // the second operand of min/max, so NaN values from the data are skipped.
+  const std::size_t kStep = 4;
+  if (size >= kStep)
+  {
+    __m128d min0 = _mm_set1_pd(result.min);
+    __m128d min1 = min0;
+    __m128d max0 = _mm_set1_pd(result.max);
+    __m128d max1 = max0;
+    for (; index + kStep <= size; index += kStep)
+    {
+      const __m128d values0 = _mm_loadu_pd(data + index);
+      const __m128d values1 = _mm_loadu_pd(data + index + 2);
+      min0 = _mm_min_pd(values0, min0);
+      min1 = _mm_min_pd(values1, min1);
+      max0 = _mm_max_pd(values0, max0);
+      max1 = _mm_max_pd(values1, max1);
+    }
+
+    double mins[2];
+    double maxs[2];
+    _mm_storeu_pd(mins, _mm_min_pd(min0, min1));
+    _mm_storeu_pd(maxs, _mm_max_pd(max0, max1));
+    result.min = mins[0] < mins[1] ? mins[0] : mins[1];
+    result.max = maxs[0] > maxs[1] ? maxs[0] : maxs[1];
+    result.count = index;
+  }
+#endif
+
+  for (; index < size; ++index)
+  {
+    result.Add(data[index]);
+  }
+
+  return result;
+}
+
+DataRange FindDataRange(const std::vector<double>& data)
+{
+  return FindDataRange(data.data(), data.size());
+}
+
+}  // namespace utils
+
+}  // namespace mvvm
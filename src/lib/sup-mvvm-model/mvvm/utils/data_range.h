@@ -0,0 +1,93 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_UTILS_DATA_RANGE_H_
+#define MVVM_UTILS_DATA_RANGE_H_
+
+#include <mvvm/model_export.h>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace mvvm
+{
+
+/**
+ * @brief The DataRange struct holds minimum and maximum of an array of values.
+ *
+ * NaN values are skipped while looking for the minimum and maximum, but are included into the
+ * count of values. The range of an array without numbers is empty.
+ */
+struct MVVM_MODEL_EXPORT DataRange
+{
+  double min{std::numeric_limits<double>::infinity()};
+  double max{-std::numeric_limits<double>::infinity()};
+  std::size_t count{0};  //!< the number of values the range was found over
+
+  /**
+   * @brief Checks if the range doesn't contain any number.
+   */
+  bool IsEmpty() const { return !(min <= max); }
+
+  /**
+   * @brief Extends the range with the given value.
+   */
+  void Add(double value)
+  {
+    min = value < min ? value : min;
+    max = value > max ? value : max;
+    ++count;
+  }
+
+  /**
+   * @brief Extends the range with another range.
+   */
+  void Merge(const DataRange& other)
+  {
+    min = other.min < min ? other.min : min;
+    max = other.max > max ? other.max : max;
+    count += other.count;
+  }
+
+  bool operator==(const DataRange& other) const;
+  bool operator!=(const DataRange& other) const;
+};
+
+namespace utils
+{
+
+/**
+ * @brief Finds the range of the given array.
+ *
+ * Uses SIMD instructions, when they are available on the target platform.
+ */
+MVVM_MODEL_EXPORT DataRange FindDataRange(const double* data, std::size_t size);
+
+/**
+ * @brief Finds the range of the given vector.
+ */
+MVVM_MODEL_EXPORT DataRange FindDataRange(const std::vector<double>& data);
+
+}  // namespace utils
+
+}  // namespace mvvm
+
+#endif  // MVVM_UTILS_DATA_RANGE_H_
@@ -0,0 +1,46 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "data_region.h"
+
+#include <algorithm>
+
+namespace mvvm
+{
+
+DataRegion DataRegion::Intersected(const DataRegion& other) const
+{
+  DataRegion result{std::max(x_begin, other.x_begin), std::max(y_begin, other.y_begin),
+                    std::min(x_end, other.x_end), std::min(y_end, other.y_end)};
+  return result.IsEmpty() ? DataRegion{} : result;
+}
+
+bool DataRegion::operator==(const DataRegion& other) const
+{
+  return x_begin == other.x_begin && y_begin == other.y_begin && x_end == other.x_end
+         && y_end == other.y_end;
+}
+
+bool DataRegion::operator!=(const DataRegion& other) const
+{
+  return !(*this == other);
+}
+
+}  // namespace mvvm
@@ -0,0 +1,62 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_UTILS_DATA_REGION_H_
+#define MVVM_UTILS_DATA_REGION_H_
+
+#include <mvvm/model_export.h>
+
+#include <cstddef>
+
+namespace mvvm
+{
+
+/**
+ * @brief The DataRegion struct defines a rectangular region of a two-dimensional array.
+ *
+ * Cell indices are half-open, [x_begin, x_end) along x and [y_begin, y_end) along y.
+ */
+struct MVVM_MODEL_EXPORT DataRegion
+{
+  std::size_t x_begin{0};
+  std::size_t y_begin{0};
+  std::size_t x_end{0};
+  std::size_t y_end{0};
+
+  std::size_t GetWidth() const { return x_end > x_begin ? x_end - x_begin : 0; }
+  std::size_t GetHeight() const { return y_end > y_begin ? y_end - y_begin : 0; }
+
+  /**
+   * @brief Checks if the region doesn't contain any cell.
+   */
+  bool IsEmpty() const { return GetWidth() == 0 || GetHeight() == 0; }
+
+  /**
+   * @brief Returns the region which is common for this and the other region.
+   */
+  DataRegion Intersected(const DataRegion& other) const;
+
+  bool operator==(const DataRegion& other) const;
+  bool operator!=(const DataRegion& other) const;
+};
+
+}  // namespace mvvm
+
+#endif  // MVVM_UTILS_DATA_REGION_H_
@@ -0,0 +1,323 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "minmax_pyramid.h"
+
+#include <mvvm/core/mvvm_exceptions.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+
+//! The number of points in the bucket of the finest pyramid level.
+const std::size_t kBaseBucketSize = 4;
+
+//! Visible data is returned without decimation when it has less points than pixel_count * factor.
+const std::size_t kDecimationThresholdFactor = 2;
+
+}  // namespace
+
+namespace mvvm
+{
+
+MinMaxPyramid::MinMaxPyramid(std::vector<double> x, std::vector<double> y)
+{
+  SetData(std::move(x), std::move(y));
+}
+
+void MinMaxPyramid::SetData(std::vector<double> x, std::vector<double> y)
+{
+  if (x.size() != y.size())
+  {
+    throw RuntimeException("MinMaxPyramid: size of x and y arrays doesn't match");
+  }
+
+  if (x.size() > std::numeric_limits<std::uint32_t>::max())
+  {
+    throw RuntimeException("MinMaxPyramid: too many points");
+  }
+
+  m_x = std::move(x);
+  m_y = std::move(y);
+  m_descent_count = 0;
+  for (std::size_t index = 1; index < m_x.size(); ++index)
+  {
+    m_descent_count += IsDescent(index) ? 1 : 0;
+  }
+  BuildLevels();
+}
+
+void MinMaxPyramid::SetPoint(std::size_t index, double x, double y)
+{
+  if (index >= m_x.size())
+  {
+    throw RuntimeException("MinMaxPyramid: point index is out of range");
+  }
+
+  // sortedness is tracked by the number of descents, only two of them can change
+  const auto first = index > 0 ? index : index + 1;
+  const auto last = std::min(index + 2, m_x.size());
+  for (auto pos = first; pos < last; ++pos)
+  {
+    m_descent_count -= IsDescent(pos) ? 1 : 0;
+  }
+  m_x[index] = x;
+  m_y[index] = y;
+  for (auto pos = first; pos < last; ++pos)
+  {
+    m_descent_count += IsDescent(pos) ? 1 : 0;
+  }
+
+  // buckets holding the point are updated from the finest level up
+  auto bucket_index = index / kBaseBucketSize;
+  for (std::size_t level = 0; level < m_levels.size(); ++level, bucket_index /= 2)
+  {
+    if (bucket_index >= m_levels[level].size())
+    {
+      break;  // trailing points not covered by buckets
+    }
+    UpdateBucket(level, bucket_index);
+  }
+}
+
+std::size_t MinMaxPyramid::GetSize() const
+{
+  return m_x.size();
+}
+
+std::size_t MinMaxPyramid::GetLevelCount() const
+{
+  return m_levels.size();
+}
+
+bool MinMaxPyramid::IsSorted() const
+{
+  return m_descent_count == 0;
+}
+
+DecimatedData MinMaxPyramid::GetPoints(double xmin, double xmax, std::size_t pixel_count) const
+{
+  if (m_x.empty() || pixel_count == 0 || !(xmin < xmax))
+  {
+    return {};
+  }
+
+  if (!IsSorted())
+  {
+    return GetRawPoints(0, m_x.size());
+  }
+
+  const auto visible_begin =
+      static_cast<std::size_t>(std::lower_bound(m_x.begin(), m_x.end(), xmin) - m_x.begin());
+  const auto visible_end =
+      static_cast<std::size_t>(std::upper_bound(m_x.begin(), m_x.end(), xmax) - m_x.begin());
+
+  if (visible_end - visible_begin <= pixel_count * kDecimationThresholdFactor)
+  {
+    return GetRawPoints(visible_begin > 0 ? visible_begin - 1 : 0,
+                        std::min(visible_end + 1, m_x.size()));
+  }
+
+  DecimatedData result;
+  const auto capacity = 2 * pixel_count + 4;
+  result.x.reserve(capacity);
+  result.y.reserve(capacity);
+  result.indices.reserve(capacity);
+
+  if (visible_begin > 0)
+  {
+    AppendPoint(visible_begin - 1, result);
+  }
+
+  const double pixel_width = (xmax - xmin) / static_cast<double>(pixel_count);
+  auto pixel_begin = visible_begin;
+  for (std::size_t pixel = 1; pixel <= pixel_count; ++pixel)
+  {
+    auto pixel_end = visible_end;
+    if (pixel < pixel_count)
+    {
+      const double boundary = xmin + pixel_width * static_cast<double>(pixel);
+      pixel_end = static_cast<std::size_t>(
+          std::lower_bound(m_x.begin() + pixel_begin, m_x.begin() + visible_end, boundary)
+          - m_x.begin());
+    }
+
+    if (pixel_begin < pixel_end)
+    {
+      // the first and the last visible points are kept to preserve the extent of the curve
+      const auto [min_index, max_index] = GetMinMax(pixel_begin, pixel_end);
+      std::size_t indices[] = {pixel_begin == visible_begin ? pixel_begin : min_index, min_index,
+                               max_index, pixel_end == visible_end ? pixel_end - 1 : max_index};
+      std::sort(std::begin(indices), std::end(indices));
+      auto last = std::unique(std::begin(indices), std::end(indices));
+      std::for_each(std::begin(indices), last,
+                    [this, &result](auto index) { AppendPoint(index, result); });
+    }
+    pixel_begin = pixel_end;
+  }
+
+  if (visible_end < m_x.size())
+  {
+    AppendPoint(visible_end, result);
+  }
+
+  return result;
+}
+
+DecimatedData MinMaxPyramid::GetPoints(std::size_t pixel_count) const
+{
+  if (m_x.empty() || !IsSorted())
+  {
+    return GetRawPoints(0, m_x.size());
+  }
+  if (m_x.front() == m_x.back())
+  {
+    return GetRawPoints(0, m_x.size());
+  }
+  return GetPoints(m_x.front(), m_x.back(), pixel_count);
+}
+
+void MinMaxPyramid::BuildLevels()
+{
+  m_levels.clear();
+
+  // finest level is built directly from the data, every next level merges pairs of buckets of the
+  // previous level
+  for (auto size = m_y.size() / kBaseBucketSize; size > 0; size /= 2)
+  {
+    m_levels.emplace_back(size);
+    for (std::size_t bucket_index = 0; bucket_index < size; ++bucket_index)
+    {
+      UpdateBucket(m_levels.size() - 1, bucket_index);
+    }
+    if (size == 1)
+    {
+      break;
+    }
+  }
+}
+
+void MinMaxPyramid::UpdateBucket(std::size_t level, std::size_t bucket_index)
+{
+  auto& bucket = m_levels[level][bucket_index];
+  if (level == 0)
+  {
+    const auto begin = bucket_index * kBaseBucketSize;
+    bucket.min_index = static_cast<std::uint32_t>(begin);
+    bucket.max_index = static_cast<std::uint32_t>(begin);
+    for (auto index = begin + 1; index < begin + kBaseBucketSize; ++index)
+    {
+      if (m_y[index] < m_y[bucket.min_index])
+      {
+        bucket.min_index = static_cast<std::uint32_t>(index);
+      }
+      if (m_y[index] > m_y[bucket.max_index])
+      {
+        bucket.max_index = static_cast<std::uint32_t>(index);
+      }
+    }
+    return;
+  }
+
+  const auto& left = m_levels[level - 1][2 * bucket_index];
+  const auto& right = m_levels[level - 1][2 * bucket_index + 1];
+  bucket.min_index = m_y[right.min_index] < m_y[left.min_index] ? right.min_index : left.min_index;
+  bucket.max_index = m_y[right.max_index] > m_y[left.max_index] ? right.max_index : left.max_index;
+}
+
+bool MinMaxPyramid::IsDescent(std::size_t index) const
+{
+  return m_x[index] < m_x[index - 1];
+}
+
+std::size_t MinMaxPyramid::GetBucketSize(std::size_t level) const
+{
+  return kBaseBucketSize << level;
+}
+
+MinMaxPyramid::Bucket MinMaxPyramid::GetMinMax(std::size_t begin, std::size_t end) const
+{
+  Bucket result{static_cast<std::uint32_t>(begin), static_cast<std::uint32_t>(begin)};
+  auto update = [this, &result](std::uint32_t min_index, std::uint32_t max_index)
+  {
+    if (m_y[min_index] < m_y[result.min_index])
+    {
+      result.min_index = min_index;
+    }
+    if (m_y[max_index] > m_y[result.max_index])
+    {
+      result.max_index = max_index;
+    }
+  };
+
+  // greedy walk over the largest aligned buckets fitting into the range
+  auto index = begin;
+  while (index < end)
+  {
+    std::size_t bucket_size{1};
+    const Bucket* bucket{nullptr};
+    for (std::size_t level = 0; level < m_levels.size(); ++level)
+    {
+      const auto size = GetBucketSize(level);
+      if (index % size != 0 || index + size > end)
+      {
+        break;
+      }
+      bucket_size = size;
+      bucket = &m_levels[level][index / size];
+    }
+
+    if (bucket)
+    {
+      update(bucket->min_index, bucket->max_index);
+    }
+    else
+    {
+      update(static_cast<std::uint32_t>(index), static_cast<std::uint32_t>(index));
+    }
+    index += bucket_size;
+  }
+
+  return result;
+}
+
+void MinMaxPyramid::AppendPoint(std::size_t index, DecimatedData& result) const
+{
+  result.x.push_back(m_x[index]);
+  result.y.push_back(m_y[index]);
+  result.indices.push_back(index);
+}
+
+DecimatedData MinMaxPyramid::GetRawPoints(std::size_t begin, std::size_t end) const
+{
+  DecimatedData result;
+  result.x.assign(m_x.begin() + begin, m_x.begin() + end);
+  result.y.assign(m_y.begin() + begin, m_y.begin() + end);
+  result.indices.resize(end - begin);
+  for (std::size_t index = begin; index < end; ++index)
+  {
+    result.indices[index - begin] = index;
+  }
+  return result;
+}
+
+}  // namespace mvvm
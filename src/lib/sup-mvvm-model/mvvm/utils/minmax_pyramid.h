@@ -0,0 +1,143 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_UTILS_MINMAX_PYRAMID_H_
+#define MVVM_UTILS_MINMAX_PYRAMID_H_
+
+#include <mvvm/model_export.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace mvvm
+{
+
+/**
+ * @brief The DecimatedData struct holds points prepared for plotting.
+ *
+ * Indices refer to the positions of points in the original data arrays. They can be used to pick
+ * matching values from auxiliary arrays (i.e. errors).
+ */
+struct MVVM_MODEL_EXPORT DecimatedData
+{
+  std::vector<double> x;
+  std::vector<double> y;
+  std::vector<std::size_t> indices;
+};
+
+/**
+ * @brief The MinMaxPyramid class performs level-of-detail decimation of one-dimensional data for
+ * plotting.
+ *
+ * Data is reduced to per-pixel min/max envelopes of the visible x-range. Envelopes are computed
+ * using a precomputed multi-resolution pyramid, where each level stores indices of minimum and
+ * maximum values for buckets twice as large as the buckets of the previous level. The query cost
+ * depends on the number of pixels, not on the number of points.
+ *
+ * Points in the result are original data points, so peaks are never lost. The first and the last
+ * visible points are always included, as well as their neighbours outside of the visible range, to
+ * let the curve reach the viewport edges. Decimation requires non-decreasing x-coordinates.
+ * Unsorted data is returned as is.
+ */
+class MVVM_MODEL_EXPORT MinMaxPyramid
+{
+public:
+  MinMaxPyramid() = default;
+
+  /**
+   * @brief Main c-tor.
+   *
+   * @param x The x-coordinates of points.
+   * @param y The y-coordinates of points.
+   */
+  MinMaxPyramid(std::vector<double> x, std::vector<double> y);
+
+  /**
+   * @brief Sets new data and rebuilds the pyramid.
+   *
+   * Will throw if arrays have different size.
+   */
+  void SetData(std::vector<double> x, std::vector<double> y);
+
+  /**
+   * @brief Sets new coordinates of the point with the given index.
+   *
+   * Only buckets containing the point are updated, the cost is O(log n). Will throw if index is
+   * out of range.
+   */
+  void SetPoint(std::size_t index, double x, double y);
+
+  /**
+   * @brief Returns the number of original data points.
+   */
+  std::size_t GetSize() const;
+
+  /**
+   * @brief Returns the number of precomputed pyramid levels.
+   */
+  std::size_t GetLevelCount() const;
+
+  /**
+   * @brief Checks if x-coordinates are sorted, and hence the data can be decimated.
+   */
+  bool IsSorted() const;
+
+  /**
+   * @brief Returns points to plot in the given x-range on a viewport of given width.
+   *
+   * If the number of visible points is small enough, they are returned without decimation.
+   * Otherwise, at most two points (minimum and maximum, in the original order) are reported for
+   * every pixel, except the pixels holding the first and the last visible points.
+   *
+   * @param xmin The lower bound of the visible range.
+   * @param xmax The upper bound of the visible range.
+   * @param pixel_count The width of the viewport in pixels.
+   */
+  DecimatedData GetPoints(double xmin, double xmax, std::size_t pixel_count) const;
+
+  /**
+   * @brief Returns points to plot the whole data range on a viewport of given width.
+   */
+  DecimatedData GetPoints(std::size_t pixel_count) const;
+
+private:
+  struct Bucket
+  {
+    std::uint32_t min_index{0};
+    std::uint32_t max_index{0};
+  };
+
+  void BuildLevels();
+  void UpdateBucket(std::size_t level, std::size_t bucket_index);
+  bool IsDescent(std::size_t index) const;
+  std::size_t GetBucketSize(std::size_t level) const;
+  Bucket GetMinMax(std::size_t begin, std::size_t end) const;
+  void AppendPoint(std::size_t index, DecimatedData& result) const;
+  DecimatedData GetRawPoints(std::size_t begin, std::size_t end) const;
+
+  std::vector<double> m_x;
+  std::vector<double> m_y;
+  std::vector<std::vector<Bucket>> m_levels;
+  std::size_t m_descent_count{0};  //!< number of neighbours with decreasing x-coordinates
+};
+
+}  // namespace mvvm
+
+#endif  // MVVM_UTILS_MINMAX_PYRAMID_H_
@@ -0,0 +1,73 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "numeric_array_utils.h"
+
+#include <algorithm>
+
+namespace mvvm::utils
+{
+
+bool IsNumericArray(const variant_t& value)
+{
+  return std::visit([](const auto& alternative)
+                    { return is_numeric_array_v<std::decay_t<decltype(alternative)>>; },
+                    value);
+}
+
+std::size_t GetNumericArraySize(const variant_t& value)
+{
+  std::size_t result{0};
+  VisitNumericArray(value, [&result](const auto* data, std::size_t size)
+                    {
+                      (void)data;
+                      result = size;
+                    });
+  return result;
+}
+
+std::vector<double> ToDoubleVector(const variant_t& value)
+{
+  std::vector<double> result;
+  VisitNumericArray(value, [&result](const auto* data, std::size_t size)
+                    { result.assign(data, data + size); });
+  return result;
+}
+
+DataRange FindNumericArrayRange(const variant_t& value)
+{
+  DataRange result;
+  auto find_range = [&result](const auto* data, std::size_t size)
+  {
+    if constexpr (std::is_same_v<std::decay_t<decltype(*data)>, double>)
+    {
+      result = FindDataRange(data, size);
+    }
+    else
+    {
+      std::for_each(data, data + size,
+                    [&result](auto element) { result.Add(static_cast<double>(element)); });
+    }
+  };
+  VisitNumericArray(value, find_range);
+  return result;
+}
+
+}  // namespace mvvm::utils
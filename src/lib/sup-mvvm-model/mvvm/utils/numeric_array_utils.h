@@ -0,0 +1,131 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_UTILS_NUMERIC_ARRAY_UTILS_H_
+#define MVVM_UTILS_NUMERIC_ARRAY_UTILS_H_
+
+//! @file
+//! Access to arrays of numbers stored in variant_t, whatever the element type.
+
+#include <mvvm/core/mvvm_exceptions.h>
+#include <mvvm/core/variant.h>
+#include <mvvm/utils/data_range.h>
+
+#include <type_traits>
+#include <vector>
+
+namespace mvvm::utils
+{
+
+/**
+ * @brief Checks if the given type is one of the array types of variant_t holding numbers.
+ */
+template <typename T>
+struct is_numeric_array : std::false_type
+{
+};
+
+template <>
+struct is_numeric_array<std::vector<float64>> : std::true_type
+{
+};
+
+template <>
+struct is_numeric_array<std::vector<float32>> : std::true_type
+{
+};
+
+template <>
+struct is_numeric_array<std::vector<int32>> : std::true_type
+{
+};
+
+template <>
+struct is_numeric_array<std::vector<int64>> : std::true_type
+{
+};
+
+template <>
+struct is_numeric_array<std::vector<uint16>> : std::true_type
+{
+};
+
+template <>
+struct is_numeric_array<SharedArray<float64>> : std::true_type
+{
+};
+
+template <typename T>
+inline constexpr bool is_numeric_array_v = is_numeric_array<T>::value;
+
+/**
+ * @brief Calls the function with the pointer to the first element and the number of elements of
+ * the array stored in the variant.
+ *
+ * @details The function should accept a pointer to any of float64, float32, int32, int64 and
+ * uint16. Will throw if the variant doesn't hold an array of numbers.
+ */
+template <typename FuncT>
+void VisitNumericArray(const variant_t& value, FuncT&& func)
+{
+  auto visitor = [&func](const auto& array)
+  {
+    if constexpr (is_numeric_array_v<std::decay_t<decltype(array)>>)
+    {
+      func(array.data(), array.size());
+    }
+    else
+    {
+      throw RuntimeException("Variant doesn't hold an array of numbers");
+    }
+  };
+  std::visit(visitor, value);
+}
+
+/**
+ * @brief Checks if the variant holds an array of numbers.
+ */
+MVVM_MODEL_EXPORT bool IsNumericArray(const variant_t& value);
+
+/**
+ * @brief Returns the number of elements of the array stored in the variant.
+ *
+ * @details Will throw if the variant doesn't hold an array of numbers.
+ */
+MVVM_MODEL_EXPORT std::size_t GetNumericArraySize(const variant_t& value);
+
+/**
+ * @brief Returns the array stored in the variant as a vector of doubles.
+ *
+ * @details Elements are converted in one pass, without intermediate copies. Will throw if the
+ * variant doesn't hold an array of numbers.
+ */
+MVVM_MODEL_EXPORT std::vector<double> ToDoubleVector(const variant_t& value);
+
+/**
+ * @brief Finds the range of the array stored in the variant.
+ *
+ * @details Will throw if the variant doesn't hold an array of numbers.
+ */
+MVVM_MODEL_EXPORT DataRange FindNumericArrayRange(const variant_t& value);
+
+}  // namespace mvvm::utils
+
+#endif  // MVVM_UTILS_NUMERIC_ARRAY_UTILS_H_
@@ -0,0 +1,291 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "numeric_codec.h"
+
+#include <array>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+
+//! Buffer size sufficient for the shortest representation of any double.
+const std::size_t kMaxDoubleLength = 32;
+
+/**
+ * @brief Returns a lookup table marking whitespace characters.
+ */
+constexpr std::array<bool, 256> CreateWhitespaceTable()
+{
+  std::array<bool, 256> result{};
+  for (const char ch : {' ', '\t', '\n', '\r', '\v', '\f'})
+  {
+    result[static_cast<unsigned char>(ch)] = true;
+  }
+  return result;
+}
+
+constexpr std::array<bool, 256> kWhitespaceTable = CreateWhitespaceTable();
+
+inline bool IsWhitespace(char ch)
+{
+  return kWhitespaceTable[static_cast<unsigned char>(ch)];
+}
+
+inline const char* SkipWhitespace(const char* begin, const char* end)
+{
+  while (begin != end && IsWhitespace(*begin))
+  {
+    ++begin;
+  }
+  return begin;
+}
+
+/**
+ * @brief Writes the shortest representation of the value into the buffer and returns the end of
+ * written characters.
+ *
+ * The buffer should have at least kMaxDoubleLength characters. Decimal point is added to the
+ * representation of integral values, so the type of the value is obvious from the text.
+ */
+template <typename T>
+char* WriteFloat(T value, char* begin)
+{
+  auto [end, error] = std::to_chars(begin, begin + kMaxDoubleLength, value);
+  (void)error;  // buffer is always large enough
+
+  // "inf" and "nan" contain 'n' and shouldn't get a decimal point
+  if (std::memchr(begin, '.', end - begin) == nullptr
+      && std::memchr(begin, 'e', end - begin) == nullptr
+      && std::memchr(begin, 'n', end - begin) == nullptr)
+  {
+    *end++ = '.';
+    *end++ = '0';
+  }
+  return end;
+}
+
+/**
+ * @brief Writes the representation of the number into the buffer and returns the end of written
+ * characters.
+ *
+ * Floating point numbers get the shortest exact representation, integers are written as is.
+ */
+template <typename T>
+char* WriteNumber(T value, char* begin)
+{
+  if constexpr (std::is_floating_point_v<T>)
+  {
+    return WriteFloat(value, begin);
+  }
+  else
+  {
+    auto [end, error] = std::to_chars(begin, begin + kMaxDoubleLength, value);
+    (void)error;  // buffer is always large enough
+    return end;
+  }
+}
+
+/**
+ * @brief Parses a number starting from given position, optional leading '+' is allowed.
+ *
+ * @return The end of parsed characters, or nullptr if no number can be parsed.
+ */
+template <typename T>
+inline const char* ReadNumber(const char* begin, const char* end, T& value)
+{
+  if (begin != end && *begin == '+')
+  {
+    ++begin;
+    if (begin != end && *begin == '-')
+    {
+      return nullptr;
+    }
+  }
+
+  auto [ptr, error] = std::from_chars(begin, end, value);
+  return error == std::errc() ? ptr : nullptr;
+}
+
+template <typename T>
+std::string ToSeparatedStringImpl(const T* values, std::size_t size, std::string_view separator)
+{
+  if (size == 0)
+  {
+    return {};
+  }
+
+  // the string is allocated once for the worst case and then shrinked
+  std::string result;
+  result.resize(size * (kMaxDoubleLength + 2 + separator.size()));
+
+  char* begin = result.data();
+  char* pos = begin;
+  for (std::size_t index = 0; index < size; ++index)
+  {
+    if (index > 0)
+    {
+      std::memcpy(pos, separator.data(), separator.size());
+      pos += separator.size();
+    }
+    pos = WriteNumber(values[index], pos);
+  }
+
+  result.resize(static_cast<std::size_t>(pos - begin));
+  return result;
+}
+
+template <typename T>
+bool ParseSeparatedNumbersImpl(std::string_view text, char separator, std::vector<T>& result)
+{
+  const char* end = text.data() + text.size();
+  const char* pos = SkipWhitespace(text.data(), end);
+  if (pos == end)
+  {
+    return true;
+  }
+
+  T value{};
+  while (true)
+  {
+    pos = ReadNumber(SkipWhitespace(pos, end), end, value);
+    if (!pos)
+    {
+      return false;
+    }
+    result.push_back(value);
+
+    pos = SkipWhitespace(pos, end);
+    if (pos == end)
+    {
+      return true;
+    }
+
+    if (*pos != separator)
+    {
+      return false;
+    }
+    ++pos;
+  }
+}
+
+}  // namespace
+
+namespace mvvm::utils
+{
+
+std::string FloatToString(double value)
+{
+  char buffer[kMaxDoubleLength + 2];
+  return {buffer, WriteFloat(value, buffer)};
+}
+
+std::string FloatToString(float value)
+{
+  char buffer[kMaxDoubleLength + 2];
+  return {buffer, WriteFloat(value, buffer)};
+}
+
+std::string ToSeparatedString(const std::vector<double>& values, std::string_view separator)
+{
+  return ToSeparatedString(values.data(), values.size(), separator);
+}
+
+std::string ToSeparatedString(const double* values, std::size_t size, std::string_view separator)
+{
+  return ToSeparatedStringImpl(values, size, separator);
+}
+
+std::string ToSeparatedString(const float* values, std::size_t size, std::string_view separator)
+{
+  return ToSeparatedStringImpl(values, size, separator);
+}
+
+std::string ToSeparatedString(const std::int32_t* values, std::size_t size,
+                              std::string_view separator)
+{
+  return ToSeparatedStringImpl(values, size, separator);
+}
+
+std::string ToSeparatedString(const std::int64_t* values, std::size_t size,
+                              std::string_view separator)
+{
+  return ToSeparatedStringImpl(values, size, separator);
+}
+
+std::string ToSeparatedString(const std::uint16_t* values, std::size_t size,
+                              std::string_view separator)
+{
+  return ToSeparatedStringImpl(values, size, separator);
+}
+
+bool ParseSeparatedDoubles(std::string_view text, char separator, std::vector<double>& result)
+{
+  return ParseSeparatedNumbersImpl(text, separator, result);
+}
+
+bool ParseSeparatedNumbers(std::string_view text, char separator, std::vector<double>& result)
+{
+  return ParseSeparatedNumbersImpl(text, separator, result);
+}
+
+bool ParseSeparatedNumbers(std::string_view text, char separator, std::vector<float>& result)
+{
+  return ParseSeparatedNumbersImpl(text, separator, result);
+}
+
+bool ParseSeparatedNumbers(std::string_view text, char separator, std::vector<std::int32_t>& result)
+{
+  return ParseSeparatedNumbersImpl(text, separator, result);
+}
+
+bool ParseSeparatedNumbers(std::string_view text, char separator, std::vector<std::int64_t>& result)
+{
+  return ParseSeparatedNumbersImpl(text, separator, result);
+}
+
+bool ParseSeparatedNumbers(std::string_view text, char separator,
+                           std::vector<std::uint16_t>& result)
+{
+  return ParseSeparatedNumbersImpl(text, separator, result);
+}
+
+std::size_t ParseWhitespaceSeparatedDoubles(std::string_view text, std::vector<double>& result)
+{
+  const char* end = text.data() + text.size();
+  const char* pos = text.data();
+  const std::size_t initial_size = result.size();
+
+  double value{0.0};
+  while ((pos = SkipWhitespace(pos, end)) != end)
+  {
+    pos = ReadNumber(pos, end, value);
+    if (!pos)
+    {
+      break;
+    }
+    result.push_back(value);
+  }
+
+  return result.size() - initial_size;
+}
+
+}  // namespace mvvm::utils
@@ -0,0 +1,180 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_UTILS_NUMERIC_CODEC_H_
+#define MVVM_UTILS_NUMERIC_CODEC_H_
+
+//! @file
+//! Exact and locale independent conversion of numbers to text and back.
+
+#include <mvvm/model_export.h>
+
+#include <charconv>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace mvvm::utils
+{
+
+/**
+ * @brief Returns the shortest string representation of a double which is parsed back to exactly
+ * the same value.
+ *
+ * @details Doesn't depend on locale. The result always contains a decimal point or an exponent, so
+ * 42.0 becomes "42.0", and 1e-20 becomes "1e-20".
+ */
+MVVM_MODEL_EXPORT std::string FloatToString(double value);
+
+/**
+ * @brief Returns the shortest string representation of a float which is parsed back to exactly
+ * the same value.
+ */
+MVVM_MODEL_EXPORT std::string FloatToString(float value);
+
+/**
+ * @brief Returns string representation of an integer.
+ *
+ * @details Characters are represented by their numeric code, the same way as std::to_string does.
+ */
+template <typename T>
+std::string IntegerToString(T value)
+{
+  static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "Integer type is expected");
+  using value_t = std::conditional_t<std::is_same_v<T, char>, int, T>;
+
+  char buffer[24];
+  auto [end, error] = std::to_chars(buffer, buffer + sizeof(buffer), static_cast<value_t>(value));
+  (void)error;  // buffer is always large enough
+  return {buffer, end};
+}
+
+/**
+ * @brief Parses a number from a string.
+ *
+ * @param text The text containing a number and nothing else, optional leading '+' is allowed.
+ * @return The number, or an empty optional if the text is malformed or the value is out of range.
+ *
+ * @details Doesn't depend on locale. Doubles written by FloatToString are parsed back exactly.
+ */
+template <typename T>
+std::optional<T> ParseNumber(std::string_view text)
+{
+  if (!text.empty() && text.front() == '+')
+  {
+    text.remove_prefix(1);
+    if (!text.empty() && text.front() == '-')
+    {
+      return {};
+    }
+  }
+
+  T value{};
+  const auto end = text.data() + text.size();
+  auto [ptr, error] = std::from_chars(text.data(), end, value);
+  if (text.empty() || error != std::errc() || ptr != end)
+  {
+    return {};
+  }
+  return value;
+}
+
+/**
+ * @brief Returns a string with exact representations of doubles separated by given separator.
+ */
+MVVM_MODEL_EXPORT std::string ToSeparatedString(const std::vector<double>& values,
+                                                std::string_view separator);
+
+/**
+ * @brief Returns a string with exact representations of doubles from the given array separated by
+ * given separator.
+ */
+MVVM_MODEL_EXPORT std::string ToSeparatedString(const double* values, std::size_t size,
+                                                std::string_view separator);
+
+/**
+ * @brief Returns a string with exact representations of floats from the given array separated by
+ * given separator.
+ */
+MVVM_MODEL_EXPORT std::string ToSeparatedString(const float* values, std::size_t size,
+                                                std::string_view separator);
+
+/**
+ * @brief Returns a string with integers from the given array separated by given separator.
+ */
+MVVM_MODEL_EXPORT std::string ToSeparatedString(const std::int32_t* values, std::size_t size,
+                                                std::string_view separator);
+
+MVVM_MODEL_EXPORT std::string ToSeparatedString(const std::int64_t* values, std::size_t size,
+                                                std::string_view separator);
+
+MVVM_MODEL_EXPORT std::string ToSeparatedString(const std::uint16_t* values, std::size_t size,
+                                                std::string_view separator);
+
+/**
+ * @brief Parses a string of doubles separated by given separator and appends them to the result.
+ *
+ * @details Whitespace around numbers is allowed. An empty string, or a string containing
+ * only whitespace, is parsed into nothing.
+ *
+ * @return False if the string is malformed, the result contains numbers parsed so far in this case.
+ */
+MVVM_MODEL_EXPORT bool ParseSeparatedDoubles(std::string_view text, char separator,
+                                             std::vector<double>& result);
+
+/**
+ * @brief Parses a string of numbers separated by given separator and appends them to the result.
+ *
+ * @details Overloads for narrow types parse numbers directly into the element type, so a value
+ * which doesn't fit into the type makes the string malformed. Integers can't have a decimal point.
+ *
+ * @return False if the string is malformed, the result contains numbers parsed so far in this case.
+ */
+MVVM_MODEL_EXPORT bool ParseSeparatedNumbers(std::string_view text, char separator,
+                                             std::vector<double>& result);
+
+MVVM_MODEL_EXPORT bool ParseSeparatedNumbers(std::string_view text, char separator,
+                                             std::vector<float>& result);
+
+MVVM_MODEL_EXPORT bool ParseSeparatedNumbers(std::string_view text, char separator,
+                                             std::vector<std::int32_t>& result);
+
+MVVM_MODEL_EXPORT bool ParseSeparatedNumbers(std::string_view text, char separator,
+                                             std::vector<std::int64_t>& result);
+
+MVVM_MODEL_EXPORT bool ParseSeparatedNumbers(std::string_view text, char separator,
+                                             std::vector<std::uint16_t>& result);
+
+/**
+ * @brief Parses a string of whitespace separated doubles and appends them to the result.
+ *
+ * @details Parsing stops at the first token which is not a number, so "1 2 a 3" gives {1, 2}.
+ *
+ * @return The number of parsed values.
+ */
+MVVM_MODEL_EXPORT std::size_t ParseWhitespaceSeparatedDoubles(std::string_view text,
+                                                              std::vector<double>& result);
+
+}  // namespace mvvm::utils
+
+#endif  // MVVM_UTILS_NUMERIC_CODEC_H_
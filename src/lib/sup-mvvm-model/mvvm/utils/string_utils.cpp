@@ -21,6 +21,7 @@
 #include "string_utils.h"
 
 #include <mvvm/core/mvvm_exceptions.h>
+#include <mvvm/utils/numeric_codec.h>
 
 #include <algorithm>
 #include <cctype>
@@ -117,19 +118,12 @@ std::string FromBool(bool value)
 
 std::optional<double> StringToDouble(const std::string& str)
 {
-  std::istringstream iss(utils::TrimWhitespace(str));
-  iss.imbue(std::locale::classic());
-  double value{0.0};
-  iss >> value;
-  return (!iss.fail() && iss.eof()) ? std::optional<double>(value) : std::optional<double>{};
+  return ParseNumber<double>(utils::TrimWhitespace(str));
 }
 
 std::optional<int> StringToInteger(const std::string& str)
 {
-  std::istringstream iss(utils::TrimWhitespace(str));
-  int value{0};
-  iss >> value;
-  return (!iss.fail() && iss.eof()) ? std::optional<int>(value) : std::optional<int>{};
+  return ParseNumber<int>(utils::TrimWhitespace(str));
 }
 
 std::vector<std::string> SplitString(const std::string& str, const std::string& delimeter)
@@ -166,35 +160,22 @@ std::vector<double> ParseSpaceSeparatedDoubles(const std::string& str)
 
 void ParseSpaceSeparatedDoubles(const std::string& str, std::vector<double>& result)
 {
-  std::istringstream iss(str);
-  iss.imbue(std::locale::classic());
-  std::copy(std::istream_iterator<double>(iss), std::istream_iterator<double>(),
-            back_inserter(result));
+  ParseWhitespaceSeparatedDoubles(str, result);
 }
 
 std::vector<double> ParseCommaSeparatedDoubles(const std::string& str)
 {
-  auto trimmed = TrimWhitespace(str);
   std::vector<double> result;
-  for (const auto& token : SplitString(trimmed, ","))
+  if (!ParseSeparatedDoubles(str, ',', result))
   {
-    auto converted = StringToDouble(token);
-    if (!converted.has_value())
-    {
-      throw RuntimeException("Error while parsing string of comma separated doubles");
-    }
-    result.push_back(converted.value());
+    throw RuntimeException("Error while parsing string of comma separated doubles");
   }
   return result;
 }
 
 std::string ToCommaSeparatedString(const std::vector<double>& vec)
 {
-  auto comma_fold = [](std::string a, double value)
-  { return std::move(a) + ", " + DoubleToString(value); };
-  return vec.empty() ? std::string()
-                     : std::accumulate(std::next(vec.begin()), vec.end(), DoubleToString(vec[0]),
-                                       comma_fold);
+  return ToSeparatedString(vec, ", ");
 }
 
 std::string ToCommaSeparatedString(const std::vector<std::string>& vec)
@@ -132,6 +132,9 @@ MVVM_MODEL_EXPORT std::vector<double> ParseCommaSeparatedDoubles(const std::stri
 
 /**
  * @brief Converts vector of doubles to comma separated string.
+ *
+ * @details Doubles are written in the shortest form which is parsed back to exactly the same
+ * values.
  */
 MVVM_MODEL_EXPORT std::string ToCommaSeparatedString(const std::vector<double>& vec);
 
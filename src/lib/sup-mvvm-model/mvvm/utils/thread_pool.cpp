@@ -0,0 +1,74 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "thread_pool.h"
+
+#include <algorithm>
+
+namespace mvvm
+{
+
+ThreadPool::ThreadPool(std::size_t thread_count)
+{
+  thread_count = std::max(thread_count, std::size_t{1});
+  m_threads.reserve(thread_count);
+  for (std::size_t i = 0; i < thread_count; ++i)
+  {
+    m_threads.emplace_back(&ThreadPool::WaitAndRun, this);
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  m_tasks.stop();  // stops waiting in ThreadPool::WaitAndRun
+  for (auto& thread : m_threads)
+  {
+    thread.join();
+  }
+}
+
+void ThreadPool::Submit(task_t task)
+{
+  m_tasks.push(std::move(task));
+}
+
+std::size_t ThreadPool::GetThreadCount() const
+{
+  return m_threads.size();
+}
+
+void ThreadPool::WaitAndRun()
+{
+  while (true)
+  {
+    std::shared_ptr<task_t> task;
+    try
+    {
+      task = m_tasks.wait_and_pop();
+    }
+    catch (const empty_container_exception&)
+    {
+      return;  // waiting was stopped
+    }
+    (*task)();
+  }
+}
+
+}  // namespace mvvm
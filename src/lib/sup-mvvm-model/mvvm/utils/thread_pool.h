@@ -0,0 +1,78 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_UTILS_THREAD_POOL_H_
+#define MVVM_UTILS_THREAD_POOL_H_
+
+#include <mvvm/model_export.h>
+#include <mvvm/utils/threadsafe_queue.h>
+
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace mvvm
+{
+
+/**
+ * @brief The ThreadPool class executes tasks in a fixed number of worker threads.
+ *
+ * Tasks are started in the order of submission. On destruction, all submitted tasks are completed
+ * before worker threads are joined.
+ */
+class MVVM_MODEL_EXPORT ThreadPool
+{
+public:
+  using task_t = std::function<void()>;
+
+  /**
+   * @brief Main c-tor.
+   *
+   * @param thread_count The number of worker threads, at least one thread is always created.
+   */
+  explicit ThreadPool(std::size_t thread_count);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool& other) = delete;
+  ThreadPool& operator=(const ThreadPool& other) = delete;
+
+  /**
+   * @brief Submits the task for execution in one of the worker threads.
+   */
+  void Submit(task_t task);
+
+  /**
+   * @brief Returns the number of worker threads.
+   */
+  std::size_t GetThreadCount() const;
+
+private:
+  /**
+   * @brief Waits for tasks and executes them. Method is intended for execution in a thread.
+   */
+  void WaitAndRun();
+
+  threadsafe_queue<task_t> m_tasks;
+  std::vector<std::thread> m_threads;
+};
+
+}  // namespace mvvm
+
+#endif  // MVVM_UTILS_THREAD_POOL_H_
@@ -0,0 +1,288 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "tile_pyramid.h"
+
+#include <mvvm/core/mvvm_exceptions.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace mvvm
+{
+
+namespace
+{
+
+/**
+ * @brief Returns the size of the next level for the given size of the previous level.
+ */
+std::size_t GetNextLevelSize(std::size_t size)
+{
+  return (size + 1) / 2;
+}
+
+/**
+ * @brief Returns the number of times the region of the given size can be halved, while still
+ * having at least given number of cells.
+ */
+std::size_t GetReductionCount(std::size_t size, std::size_t pixels)
+{
+  std::size_t result{0};
+  pixels = std::max(pixels, std::size_t{1});
+  while ((size >> (result + 1)) >= pixels)
+  {
+    ++result;
+  }
+  return result;
+}
+
+}  // namespace
+
+TilePyramid::TilePyramid(std::size_t tile_size) : m_tile_size(tile_size)
+{
+  if (m_tile_size == 0)
+  {
+    throw RuntimeException("Tile size should be positive");
+  }
+}
+
+void TilePyramid::SetSize(std::size_t size_x, std::size_t size_y)
+{
+  m_levels.clear();
+  m_levels.push_back({size_x, size_y, 0, 0, {}});
+
+  while (size_x > m_tile_size || size_y > m_tile_size)
+  {
+    size_x = GetNextLevelSize(size_x);
+    size_y = GetNextLevelSize(size_y);
+    Level level{size_x, size_y, (size_x + m_tile_size - 1) / m_tile_size,
+                (size_y + m_tile_size - 1) / m_tile_size, {}};
+    level.tiles.resize(level.tile_count_x * level.tile_count_y);
+    m_levels.push_back(std::move(level));
+  }
+}
+
+void TilePyramid::InvalidateRegion(const DataRegion& region)
+{
+  for (std::size_t level = 1; level < m_levels.size(); ++level)
+  {
+    auto& current = m_levels[level];
+    const auto level_region = ToLevelRegion(region, level);
+    if (level_region.IsEmpty())
+    {
+      continue;
+    }
+    for (auto tile_y = level_region.y_begin / m_tile_size;
+         tile_y <= (level_region.y_end - 1) / m_tile_size; ++tile_y)
+    {
+      for (auto tile_x = level_region.x_begin / m_tile_size;
+           tile_x <= (level_region.x_end - 1) / m_tile_size; ++tile_x)
+      {
+        current.tiles[tile_y * current.tile_count_x + tile_x].is_valid = false;
+      }
+    }
+  }
+}
+
+std::size_t TilePyramid::GetSizeX() const
+{
+  return m_levels.empty() ? 0 : m_levels.front().size_x;
+}
+
+std::size_t TilePyramid::GetSizeY() const
+{
+  return m_levels.empty() ? 0 : m_levels.front().size_y;
+}
+
+std::size_t TilePyramid::GetLevelCount() const
+{
+  return m_levels.size();
+}
+
+DataRegion TilePyramid::GetLevelRegion(std::size_t level) const
+{
+  if (level >= m_levels.size())
+  {
+    return {};
+  }
+  return {0, 0, m_levels[level].size_x, m_levels[level].size_y};
+}
+
+std::size_t TilePyramid::FindLevel(const DataRegion& region, std::size_t pixels_x,
+                                   std::size_t pixels_y) const
+{
+  if (m_levels.empty())
+  {
+    return 0;
+  }
+
+  const auto visible = region.Intersected(GetLevelRegion(0));
+  const auto level = std::min(GetReductionCount(visible.GetWidth(), pixels_x),
+                              GetReductionCount(visible.GetHeight(), pixels_y));
+  return std::min(level, m_levels.size() - 1);
+}
+
+DataRegion TilePyramid::ToLevelRegion(const DataRegion& region, std::size_t level) const
+{
+  const auto scale = std::size_t{1} << level;
+  const DataRegion result{region.x_begin / scale, region.y_begin / scale,
+                          (region.x_end + scale - 1) / scale, (region.y_end + scale - 1) / scale};
+  return result.Intersected(GetLevelRegion(level));
+}
+
+DataRegion TilePyramid::FromLevelRegion(const DataRegion& region, std::size_t level) const
+{
+  const DataRegion result{region.x_begin << level, region.y_begin << level, region.x_end << level,
+                          region.y_end << level};
+  return result.Intersected(GetLevelRegion(0));
+}
+
+std::vector<double> TilePyramid::GetValues(const SharedArray<double>& data, std::size_t level,
+                                           const DataRegion& region)
+{
+  if (data.size() != GetSizeX() * GetSizeY())
+  {
+    throw RuntimeException("Size of the data doesn't match dimensions");
+  }
+  return GetLevelValues(data.data(), level, region);
+}
+
+std::size_t TilePyramid::GetComputedTileCount() const
+{
+  std::size_t result{0};
+  for (const auto& level : m_levels)
+  {
+    result += std::count_if(level.tiles.begin(), level.tiles.end(),
+                            [](const auto& tile) { return tile.is_valid; });
+  }
+  return result;
+}
+
+std::vector<double> TilePyramid::GetLevelValues(const double* data, std::size_t level,
+                                                const DataRegion& region)
+{
+  const auto clipped = region.Intersected(GetLevelRegion(level));
+  if (clipped.IsEmpty())
+  {
+    return {};
+  }
+
+  const auto width = clipped.GetWidth();
+  std::vector<double> result(width * clipped.GetHeight());
+
+  if (level == 0)
+  {
+    const auto size_x = m_levels.front().size_x;
+    for (auto y = clipped.y_begin; y < clipped.y_end; ++y)
+    {
+      const auto* row = data + y * size_x;
+      std::copy(row + clipped.x_begin, row + clipped.x_end,
+                result.begin() + (y - clipped.y_begin) * width);
+    }
+    return result;
+  }
+
+  for (auto tile_y = clipped.y_begin / m_tile_size; tile_y <= (clipped.y_end - 1) / m_tile_size;
+       ++tile_y)
+  {
+    for (auto tile_x = clipped.x_begin / m_tile_size; tile_x <= (clipped.x_end - 1) / m_tile_size;
+         ++tile_x)
+    {
+      const auto tile_region = GetTileRegion(level, tile_x, tile_y);
+      const auto& tile = GetTile(data, level, tile_x, tile_y);
+      const auto common = tile_region.Intersected(clipped);
+      for (auto y = common.y_begin; y < common.y_end; ++y)
+      {
+        const auto* row = tile.values.data() + (y - tile_region.y_begin) * tile_region.GetWidth()
+                          - tile_region.x_begin;
+        const auto offset = (y - clipped.y_begin) * width + (common.x_begin - clipped.x_begin);
+        std::copy(row + common.x_begin, row + common.x_end, result.begin() + offset);
+      }
+    }
+  }
+
+  return result;
+}
+
+DataRegion TilePyramid::GetTileRegion(std::size_t level, std::size_t tile_x,
+                                      std::size_t tile_y) const
+{
+  const DataRegion result{tile_x * m_tile_size, tile_y * m_tile_size, (tile_x + 1) * m_tile_size,
+                          (tile_y + 1) * m_tile_size};
+  return result.Intersected(GetLevelRegion(level));
+}
+
+const TilePyramid::Tile& TilePyramid::GetTile(const double* data, std::size_t level,
+                                              std::size_t tile_x, std::size_t tile_y)
+{
+  auto& tile = m_levels[level].tiles[tile_y * m_levels[level].tile_count_x + tile_x];
+  if (!tile.is_valid)
+  {
+    ComputeTile(data, level, tile_x, tile_y, tile);
+    tile.is_valid = true;
+  }
+  return tile;
+}
+
+void TilePyramid::ComputeTile(const double* data, std::size_t level, std::size_t tile_x,
+                              std::size_t tile_y, Tile& tile)
+{
+  const auto region = GetTileRegion(level, tile_x, tile_y);
+  const DataRegion child_region{region.x_begin * 2, region.y_begin * 2, region.x_end * 2,
+                                region.y_end * 2};
+  const auto clipped_child = child_region.Intersected(GetLevelRegion(level - 1));
+
+  // values of the previous level, computing its tiles if necessary
+  const auto child_values = GetLevelValues(data, level - 1, clipped_child);
+  const auto child_width = clipped_child.GetWidth();
+
+  tile.values.assign(region.GetWidth() * region.GetHeight(),
+                     std::numeric_limits<double>::quiet_NaN());
+
+  for (auto y = region.y_begin; y < region.y_end; ++y)
+  {
+    for (auto x = region.x_begin; x < region.x_end; ++x)
+    {
+      double sum{0.0};
+      int count{0};
+      for (auto child_y = 2 * y; child_y < std::min(2 * y + 2, clipped_child.y_end); ++child_y)
+      {
+        for (auto child_x = 2 * x; child_x < std::min(2 * x + 2, clipped_child.x_end); ++child_x)
+        {
+          const auto value = child_values[(child_y - clipped_child.y_begin) * child_width
+                                          + (child_x - clipped_child.x_begin)];
+          if (!std::isnan(value))
+          {
+            sum += value;
+            ++count;
+          }
+        }
+      }
+      if (count > 0)
+      {
+        tile.values[(y - region.y_begin) * region.GetWidth() + (x - region.x_begin)] = sum / count;
+      }
+    }
+  }
+}
+
+}  // namespace mvvm
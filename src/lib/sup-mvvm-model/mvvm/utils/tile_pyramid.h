@@ -0,0 +1,142 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_UTILS_TILE_PYRAMID_H_
+#define MVVM_UTILS_TILE_PYRAMID_H_
+
+#include <mvvm/core/shared_array.h>
+#include <mvvm/model_export.h>
+#include <mvvm/utils/data_region.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace mvvm
+{
+
+/**
+ * @brief The TilePyramid class performs level-of-detail reduction of two-dimensional data for
+ * plotting.
+ *
+ * Level zero is the original data, each next level has cells twice as large along both axes, the
+ * cell value is the mean of non-NaN values of the four cells of the previous level. Levels are
+ * split into square tiles, which are computed lazily on first access, so pan and zoom touch only
+ * tiles of visible regions. An update of a region of the data invalidates only the tiles covering
+ * this region on each level.
+ *
+ * The pyramid doesn't keep the original data, it is passed to each call of GetValues. This
+ * allows the owner of the data to modify it in place and to invalidate the modified region
+ * afterwards. The data is stored row by row, the index of the cell (x, y) is y * size_x + x.
+ */
+class MVVM_MODEL_EXPORT TilePyramid
+{
+public:
+  static inline const std::size_t kDefaultTileSize = 256;
+
+  explicit TilePyramid(std::size_t tile_size = kDefaultTileSize);
+
+  /**
+   * @brief Sets dimensions of the data and drops all computed tiles.
+   */
+  void SetSize(std::size_t size_x, std::size_t size_y);
+
+  /**
+   * @brief Invalidates tiles covering the given region of the original data, after the data has
+   * been changed in this region.
+   */
+  void InvalidateRegion(const DataRegion& region);
+
+  std::size_t GetSizeX() const;
+
+  std::size_t GetSizeY() const;
+
+  /**
+   * @brief Returns the number of levels, the coarsest level fits into a single tile.
+   */
+  std::size_t GetLevelCount() const;
+
+  /**
+   * @brief Returns the region covering all cells of the given level.
+   */
+  DataRegion GetLevelRegion(std::size_t level) const;
+
+  /**
+   * @brief Returns the coarsest level which still has at least one cell per pixel, when given
+   * region of the original data is shown on the viewport of given size.
+   */
+  std::size_t FindLevel(const DataRegion& region, std::size_t pixels_x,
+                        std::size_t pixels_y) const;
+
+  /**
+   * @brief Converts the region of the original data to the region of cells of the given level,
+   * covering it.
+   */
+  DataRegion ToLevelRegion(const DataRegion& region, std::size_t level) const;
+
+  /**
+   * @brief Converts the region of cells of the given level to the region of the original data.
+   */
+  DataRegion FromLevelRegion(const DataRegion& region, std::size_t level) const;
+
+  /**
+   * @brief Returns values of the given region of cells of the given level, row by row.
+   *
+   * Computes missing tiles of the region from the given original data. Will throw if the size of
+   * the data doesn't match dimensions.
+   */
+  std::vector<double> GetValues(const SharedArray<double>& data, std::size_t level,
+                                const DataRegion& region);
+
+  /**
+   * @brief Returns the number of computed tiles on all levels above zero.
+   */
+  std::size_t GetComputedTileCount() const;
+
+private:
+  struct Tile
+  {
+    std::vector<double> values;  //!< row by row, the width is the width of the tile
+    bool is_valid{false};
+  };
+
+  struct Level
+  {
+    std::size_t size_x{0};
+    std::size_t size_y{0};
+    std::size_t tile_count_x{0};
+    std::size_t tile_count_y{0};
+    std::vector<Tile> tiles;
+  };
+
+  DataRegion GetTileRegion(std::size_t level, std::size_t tile_x, std::size_t tile_y) const;
+  std::vector<double> GetLevelValues(const double* data, std::size_t level,
+                                     const DataRegion& region);
+  const Tile& GetTile(const double* data, std::size_t level, std::size_t tile_x,
+                      std::size_t tile_y);
+  void ComputeTile(const double* data, std::size_t level, std::size_t tile_x, std::size_t tile_y,
+                   Tile& tile);
+
+  std::size_t m_tile_size{kDefaultTileSize};
+  std::vector<Level> m_levels;  //!< all levels, level zero doesn't have tiles
+};
+
+}  // namespace mvvm
+
+#endif  // MVVM_UTILS_TILE_PYRAMID_H_
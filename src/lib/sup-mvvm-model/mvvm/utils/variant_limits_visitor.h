@@ -130,6 +130,16 @@ struct VariantLimitsVisitor
 
   std::pair<LimitsT, LimitsT> operator()(const ExternalProperty& value);
 
+  std::pair<LimitsT, LimitsT> operator()(const SharedArray<double>& value);
+
+  std::pair<LimitsT, LimitsT> operator()(const std::vector<float32>& value);
+
+  std::pair<LimitsT, LimitsT> operator()(const std::vector<int32>& value);
+
+  std::pair<LimitsT, LimitsT> operator()(const std::vector<int64>& value);
+
+  std::pair<LimitsT, LimitsT> operator()(const std::vector<uint16>& value);
+
   variant_t m_lower_bound;
   variant_t m_upper_bound;
 };
@@ -257,6 +267,46 @@ inline std::pair<LimitsT, LimitsT> VariantLimitsVisitor<LimitsT>::operator()(
   throw RuntimeException("Visitor for ExternalProperty is not implemented");
 }
 
+template <typename LimitsT>
+inline std::pair<LimitsT, LimitsT> VariantLimitsVisitor<LimitsT>::operator()(
+    const SharedArray<double>& value)
+{
+  (void)value;
+  throw RuntimeException("Visitor for SharedArray<double> is not implemented");
+}
+
+template <typename LimitsT>
+inline std::pair<LimitsT, LimitsT> VariantLimitsVisitor<LimitsT>::operator()(
+    const std::vector<float32>& value)
+{
+  (void)value;
+  throw RuntimeException("Visitor for vector<float32> is not implemented");
+}
+
+template <typename LimitsT>
+inline std::pair<LimitsT, LimitsT> VariantLimitsVisitor<LimitsT>::operator()(
+    const std::vector<int32>& value)
+{
+  (void)value;
+  throw RuntimeException("Visitor for vector<int32> is not implemented");
+}
+
+template <typename LimitsT>
+inline std::pair<LimitsT, LimitsT> VariantLimitsVisitor<LimitsT>::operator()(
+    const std::vector<int64>& value)
+{
+  (void)value;
+  throw RuntimeException("Visitor for vector<int64> is not implemented");
+}
+
+template <typename LimitsT>
+inline std::pair<LimitsT, LimitsT> VariantLimitsVisitor<LimitsT>::operator()(
+    const std::vector<uint16>& value)
+{
+  (void)value;
+  throw RuntimeException("Visitor for vector<uint16> is not implemented");
+}
+
 }  // namespace mvvm
 
 #endif  // MVVM_UTILS_LIMITED_INTEGER_HELPER_H_
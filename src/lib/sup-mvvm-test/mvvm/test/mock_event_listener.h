@@ -51,6 +51,18 @@ public:
     event_handler->Connect<mvvm::AboutToRemoveItemEvent>(this, &MockEventListener::OnEvent,
                                                          m_slot.get());
     event_handler->Connect<mvvm::ItemRemovedEvent>(this, &MockEventListener::OnEvent, m_slot.get());
+    event_handler->Connect<mvvm::AboutToInsertItemsEvent>(this, &MockEventListener::OnEvent,
+                                                          m_slot.get());
+    event_handler->Connect<mvvm::ItemsInsertedEvent>(this, &MockEventListener::OnEvent,
+                                                     m_slot.get());
+    event_handler->Connect<mvvm::AboutToRemoveItemsEvent>(this, &MockEventListener::OnEvent,
+                                                          m_slot.get());
+    event_handler->Connect<mvvm::ItemsRemovedEvent>(this, &MockEventListener::OnEvent,
+                                                    m_slot.get());
+    event_handler->Connect<mvvm::DataAppendedEvent>(this, &MockEventListener::OnEvent,
+                                                    m_slot.get());
+    event_handler->Connect<mvvm::DataRegionChangedEvent>(this, &MockEventListener::OnEvent,
+                                                         m_slot.get());
 
     event_handler->Connect<mvvm::ModelAboutToBeResetEvent>(this, &MockEventListener::OnEvent,
                                                            m_slot.get());
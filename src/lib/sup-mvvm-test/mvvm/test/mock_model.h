@@ -51,6 +51,15 @@ public:
   MOCK_METHOD(std::unique_ptr<mvvm::SessionItem>, TakeItem,
               (mvvm::SessionItem * parent, const mvvm::TagIndex &tag_index), (override));
 
+  MOCK_METHOD(std::vector<mvvm::SessionItem *>, InsertItems,
+              (std::vector<std::unique_ptr<mvvm::SessionItem>> items, mvvm::SessionItem *parent,
+               const mvvm::TagIndex &tag_index),
+              (override));
+
+  MOCK_METHOD(std::vector<std::unique_ptr<mvvm::SessionItem>>, TakeItems,
+              (mvvm::SessionItem * parent, const mvvm::TagIndex &tag_index, std::size_t count),
+              (override));
+
   MOCK_METHOD(void, RemoveItem, (mvvm::SessionItem * item), (override));
 
   MOCK_METHOD(void, MoveItem,
@@ -32,6 +32,13 @@ MockModelListener::MockModelListener(const mvvm::ISessionModel *model) : ModelLi
   Connect<mvvm::AboutToRemoveItemEvent>(this, &MockModelListener::OnAboutToRemoveItemEvent);
   Connect<mvvm::ItemRemovedEvent>(this, &MockModelListener::OnItemRemovedEvent);
 
+  Connect<mvvm::AboutToInsertItemsEvent>(this, &MockModelListener::OnAboutToInsertItemsEvent);
+  Connect<mvvm::ItemsInsertedEvent>(this, &MockModelListener::OnItemsInsertedEvent);
+  Connect<mvvm::AboutToRemoveItemsEvent>(this, &MockModelListener::OnAboutToRemoveItemsEvent);
+  Connect<mvvm::ItemsRemovedEvent>(this, &MockModelListener::OnItemsRemovedEvent);
+  Connect<mvvm::DataAppendedEvent>(this, &MockModelListener::OnDataAppendedEvent);
+  Connect<mvvm::DataRegionChangedEvent>(this, &MockModelListener::OnDataRegionChangedEvent);
+
   Connect<mvvm::ModelAboutToBeResetEvent>(this, &MockModelListener::OnModelAboutToBeResetEvent);
   Connect<mvvm::ModelResetEvent>(this, &MockModelListener::OnModelResetEvent);
 
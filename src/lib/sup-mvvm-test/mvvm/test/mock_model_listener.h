@@ -45,6 +45,18 @@ public:
 
   MOCK_METHOD(void, OnItemRemoved, (const mvvm::ItemRemovedEvent& event), ());
 
+  MOCK_METHOD(void, OnAboutToInsertItems, (const mvvm::AboutToInsertItemsEvent& event), ());
+
+  MOCK_METHOD(void, OnItemsInserted, (const mvvm::ItemsInsertedEvent& event), ());
+
+  MOCK_METHOD(void, OnAboutToRemoveItems, (const mvvm::AboutToRemoveItemsEvent& event), ());
+
+  MOCK_METHOD(void, OnItemsRemoved, (const mvvm::ItemsRemovedEvent& event), ());
+
+  MOCK_METHOD(void, OnDataAppended, (const mvvm::DataAppendedEvent& event), ());
+
+  MOCK_METHOD(void, OnDataRegionChanged, (const mvvm::DataRegionChangedEvent& event), ());
+
   MOCK_METHOD(void, OnDataChanged, (const mvvm::DataChangedEvent& event), ());
 
   MOCK_METHOD(void, OnModelAboutToBeReset, (const mvvm::ModelAboutToBeResetEvent& event), ());
@@ -71,6 +83,27 @@ public:
 
   void OnItemRemovedEvent(const mvvm::ItemRemovedEvent& event) { OnItemRemoved(event); }
 
+  void OnAboutToInsertItemsEvent(const mvvm::AboutToInsertItemsEvent& event)
+  {
+    OnAboutToInsertItems(event);
+  }
+
+  void OnItemsInsertedEvent(const mvvm::ItemsInsertedEvent& event) { OnItemsInserted(event); }
+
+  void OnAboutToRemoveItemsEvent(const mvvm::AboutToRemoveItemsEvent& event)
+  {
+    OnAboutToRemoveItems(event);
+  }
+
+  void OnItemsRemovedEvent(const mvvm::ItemsRemovedEvent& event) { OnItemsRemoved(event); }
+
+  void OnDataAppendedEvent(const mvvm::DataAppendedEvent& event) { OnDataAppended(event); }
+
+  void OnDataRegionChangedEvent(const mvvm::DataRegionChangedEvent& event)
+  {
+    OnDataRegionChanged(event);
+  }
+
   void OnDataChangedEvent(const mvvm::DataChangedEvent& event) { OnDataChanged(event); }
 
   void OnModelAboutToBeResetEvent(const mvvm::ModelAboutToBeResetEvent& event)
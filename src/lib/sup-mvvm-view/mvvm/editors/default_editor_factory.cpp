@@ -23,6 +23,12 @@
 #include "role_dependent_editor_factory.h"
 #include "variant_dependent_editor_factory.h"
 
+#include <mvvm/model/item_limits_helper.h>
+#include <mvvm/model/session_item.h>
+#include <mvvm/standarditems/editor_constants.h>
+#include <mvvm/viewmodel/custom_variants.h>
+#include <mvvm/viewmodel/viewmodel_utils.h>
+
 #include <QWidget>
 
 namespace mvvm
@@ -50,4 +56,22 @@ editor_t DefaultEditorFactory::CreateEditor(const SessionItem* item) const
   return editor ? std::move(editor) : m_variant_dependent_factory->CreateEditor(item);
 }
 
+std::string DefaultEditorFactory::GetRecyclingKey(const QModelIndex& index) const
+{
+  auto item = utils::ItemFromProxyIndex(index);
+  if (item && !IsLimitless(*item))
+  {
+    return {};  // editor range is defined by item limits
+  }
+
+  const auto editor_type = item ? item->GetEditorType() : std::string();
+  if (editor_type == constants::kScientificSpinboxEditorType)
+  {
+    return {};  // single step is defined by the current value
+  }
+
+  // same fallback order as in CreateEditor
+  return editor_type.empty() ? utils::GetQtVariantName(index.data(Qt::EditRole)) : editor_type;
+}
+
 }  // namespace mvvm
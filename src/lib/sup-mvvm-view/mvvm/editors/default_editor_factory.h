@@ -24,6 +24,7 @@
 #include <mvvm/providers/abstract_editor_factory.h>
 
 #include <memory>
+#include <string>
 
 namespace mvvm
 {
@@ -44,6 +45,15 @@ public:
 
   editor_t CreateEditor(const SessionItem* item) const override;
 
+  /**
+   * @brief Returns the key of the editor which will be created for the given cell.
+   *
+   * Editors with the same non-empty key are interchangeable and can be reused for another cell
+   * after setting new editor data. The key is empty, if the editor configuration depends on the
+   * item (i.e. on its limits).
+   */
+  std::string GetRecyclingKey(const QModelIndex& index) const;
+
 private:
   std::unique_ptr<AbstractEditorFactory> m_role_dependent_factory;
   std::unique_ptr<AbstractEditorFactory> m_variant_dependent_factory;
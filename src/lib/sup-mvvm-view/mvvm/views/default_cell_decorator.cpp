@@ -22,7 +22,9 @@
 
 #include <mvvm/editors/scientific_spinbox.h>
 #include <mvvm/standarditems/editor_constants.h>
+#include <mvvm/utils/numeric_array_utils.h>
 #include <mvvm/viewmodel/custom_variants.h>
+#include <mvvm/viewmodel/variant_converter.h>
 
 #include <QModelIndex>
 #include <QStyleOptionViewItem>
@@ -92,6 +94,18 @@ std::optional<std::string> DefaultCellDecorator::GetCellText(const QModelIndex&
         .toStdString();
   }
 
+  if (utils::IsSharedDoubleVectorVariant(variant))
+  {
+    // shared arrays are meant for large data, so only the size is shown
+    return "[" + std::to_string(variant.value<SharedArray<double>>().size()) + " values]";
+  }
+
+  if (utils::IsNarrowNumericVectorVariant(variant))
+  {
+    const auto size = utils::GetNumericArraySize(GetStdVariant(variant));
+    return "[" + std::to_string(size) + " values]";
+  }
+
   if (IsInt8Special(variant))
   {
     // Default decoration for int8 and uint8 types in Qt cells looks like  some weired ASCII
@@ -24,6 +24,7 @@
 #include <mvvm/model/session_item.h>
 #include <mvvm/utils/container_utils.h>
 #include <mvvm/viewmodel/viewmodel.h>
+#include <mvvm/viewmodelbase/viewmodel_base_utils.h>
 #include <mvvm/views/viewmodel_delegate.h>
 
 #include <QAbstractItemView>
@@ -169,6 +170,28 @@ QList<QModelIndex> ItemViewComponentProvider::GetViewIndexes(const SessionItem *
   return source_indexes;
 }
 
+QItemSelection ItemViewComponentProvider::GetViewSelection(
+    const std::vector<SessionItem *> &items) const
+{
+  const std::vector<const SessionItem *> source_items(items.begin(), items.end());
+  auto source_indexes = GetViewModel()->GetIndexOfSessionItems(source_items);
+  auto selection = utils::CreateMergedSelection(source_indexes);
+
+  auto proxies = GetProxyModelChain();
+  if (proxies.empty())
+  {
+    return selection;
+  }
+
+  for (const auto proxy : proxies)
+  {
+    selection = proxy->mapSelectionFromSource(selection);
+  }
+
+  // proxy models might split ranges into single cells
+  return utils::CreateMergedSelection(selection.indexes());
+}
+
 SessionItem *ItemViewComponentProvider::GetSelectedItem() const
 {
   auto selected = GetSelectedItems();
@@ -183,17 +206,7 @@ void ItemViewComponentProvider::SetSelectedItem(SessionItem *item)
 void ItemViewComponentProvider::SetSelectedItems(std::vector<SessionItem *> items)
 {
   GetSelectionModel()->clearSelection();
-  QItemSelection selection;
-  for (auto item : items)
-  {
-    auto view_indexes = GetViewIndexes(item);
-    if (!view_indexes.empty())
-    {
-      selection.push_back(QItemSelectionRange(view_indexes.front(), view_indexes.back()));
-    }
-  }
-
-  GetSelectionModel()->select(selection, m_selection_flags);
+  GetSelectionModel()->select(GetViewSelection(items), m_selection_flags);
 }
 
 void ItemViewComponentProvider::SetSelectionFlags(QItemSelectionModel::SelectionFlags flags)
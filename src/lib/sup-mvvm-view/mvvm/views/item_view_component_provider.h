@@ -160,6 +160,14 @@ public:
    */
   QList<QModelIndex> GetViewIndexes(const mvvm::SessionItem* item) const;
 
+  /**
+   * @brief Returns view selection covering all cells of given items.
+   *
+   * All items are resolved with a single pass over the viewmodel, the selection is mapped through
+   * the chain of proxy models at once. Selection ranges are merged when cells are contiguous.
+   */
+  QItemSelection GetViewSelection(const std::vector<SessionItem*>& items) const;
+
   /**
    * @brief Returns an item currently selected in a view.
    */
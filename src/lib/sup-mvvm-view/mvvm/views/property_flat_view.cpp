@@ -21,7 +21,6 @@
 #include "property_flat_view.h"
 
 #include <mvvm/views/property_grid_controller.h>
-#include <mvvm/widgets/layout_utils.h>
 
 #include <QAbstractItemModel>
 #include <QGridLayout>
@@ -50,21 +49,89 @@ void PropertyFlatView::SetViewModel(QAbstractItemModel *view_model)
 
   connect(m_grid_controller.get(), &PropertyGridController::GridChanged, this,
           &PropertyFlatView::UpdateGridLayout);
+  connect(m_grid_controller.get(), &PropertyGridController::RowsInserted, this,
+          &PropertyFlatView::OnRowsInserted);
+  connect(m_grid_controller.get(), &PropertyGridController::RowsAboutToBeRemoved, this,
+          &PropertyFlatView::OnRowsAboutToBeRemoved);
 
   UpdateGridLayout();
 }
 
 void PropertyFlatView::UpdateGridLayout()
 {
-  ClearGridLayout(m_grid_layout, true);
+  m_grid_controller->RecycleWidgets(TakeRows(0, static_cast<int>(m_widgets.size()) - 1));
 
   auto widgets = m_grid_controller->CreateWidgetGrid();
 
-  for (int row = 0; row < m_view_model->rowCount(); ++row)
+  for (auto &widget_row : widgets)
   {
-    for (int col = 0; col < m_view_model->columnCount(); ++col)
+    auto &row = m_widgets.emplace_back();
+    for (auto &widget : widget_row)
     {
-      m_grid_layout->addWidget(widgets[row][col].release(), row, col);
+      row.push_back(widget.release());
+    }
+  }
+  UpdateRowPositions(0);
+}
+
+void PropertyFlatView::OnRowsInserted(int first, int last)
+{
+  auto widgets = m_grid_controller->CreateWidgetRows(first, last);
+
+  auto position = std::next(m_widgets.begin(), first);
+  for (auto &widget_row : widgets)
+  {
+    std::vector<QWidget *> row;
+    for (auto &widget : widget_row)
+    {
+      row.push_back(widget.release());
+    }
+    position = std::next(m_widgets.insert(position, std::move(row)));
+  }
+  UpdateRowPositions(first);
+}
+
+void PropertyFlatView::OnRowsAboutToBeRemoved(int first, int last)
+{
+  m_grid_controller->RecycleWidgets(TakeRows(first, last));
+  UpdateRowPositions(first);
+}
+
+std::vector<std::vector<std::unique_ptr<QWidget>>> PropertyFlatView::TakeRows(int first, int last)
+{
+  std::vector<std::vector<std::unique_ptr<QWidget>>> result;
+  if (first < 0 || last < first)
+  {
+    return result;
+  }
+
+  for (int row = first; row <= last; ++row)
+  {
+    auto &widget_row = result.emplace_back();
+    for (auto widget : m_widgets[static_cast<size_t>(row)])
+    {
+      if (widget)
+      {
+        m_grid_layout->removeWidget(widget);
+      }
+      widget_row.emplace_back(widget);
+    }
+  }
+  m_widgets.erase(std::next(m_widgets.begin(), first), std::next(m_widgets.begin(), last + 1));
+  return result;
+}
+
+void PropertyFlatView::UpdateRowPositions(int first)
+{
+  for (size_t row = static_cast<size_t>(first); row < m_widgets.size(); ++row)
+  {
+    for (size_t col = 0; col < m_widgets[row].size(); ++col)
+    {
+      if (auto widget = m_widgets[row][col]; widget)
+      {
+        m_grid_layout->removeWidget(widget);
+        m_grid_layout->addWidget(widget, static_cast<int>(row), static_cast<int>(col));
+      }
     }
   }
 }
@@ -25,6 +25,7 @@
 
 #include <QWidget>
 #include <memory>
+#include <vector>
 
 class QGridLayout;
 class QAbstractItemModel;
@@ -35,7 +36,8 @@ namespace mvvm
 class PropertyGridController;
 
 //! Widget holding grid layout with editors and intended for displaying all properties of given
-//! SessionItem.
+//! SessionItem. The grid is updated row-wise on row insertion/removal, widgets of removed rows are
+//! given back to the controller for reuse.
 
 class MVVM_VIEW_EXPORT PropertyFlatView : public QWidget
 {
@@ -50,9 +52,20 @@ public:
 private:
   void UpdateGridLayout();
 
+  void OnRowsInserted(int first, int last);
+
+  void OnRowsAboutToBeRemoved(int first, int last);
+
+  //! Removes widgets of given rows from the grid layout, ownership is returned to the caller.
+  std::vector<std::vector<std::unique_ptr<QWidget>>> TakeRows(int first, int last);
+
+  //! Places widgets starting from given row in their cells of grid layout.
+  void UpdateRowPositions(int first);
+
   std::unique_ptr<PropertyGridController> m_grid_controller;
   QGridLayout* m_grid_layout{nullptr};
   QAbstractItemModel* m_view_model{nullptr};
+  std::vector<std::vector<QWidget*>> m_widgets;  //!< widgets shown in grid layout
 };
 
 }  // namespace mvvm
@@ -21,19 +21,38 @@
 #include "property_grid_controller.h"
 
 #include <mvvm/core/mvvm_exceptions.h>
+#include <mvvm/editors/default_editor_factory.h>
 #include <mvvm/viewmodel/viewmodel_utils.h>
 #include <mvvm/views/viewmodel_delegate.h>
 
 #include <QAbstractItemModel>
 #include <QDataWidgetMapper>
 #include <QLabel>
+#include <QMetaMethod>
 #include <QStyleOptionViewItem>
 
+namespace
+{
+
+//! Name of the widget's dynamic property holding the key for widget reuse.
+const char *const kRecyclingKeyProperty = "mvvmRecyclingKey";
+
+//! Recycling key for labels.
+const std::string kLabelKey = "QLabel";
+
+//! Maximum number of recycled widgets of the same kind kept for reuse.
+const std::size_t kMaxPoolSize = 256;
+
+}  // namespace
+
 namespace mvvm
 {
 
 PropertyGridController::PropertyGridController(QAbstractItemModel *model, QObject *parent_object)
-    : QObject(parent_object), m_view_model(model)
+    : QObject(parent_object)
+    , m_view_model(model)
+    , m_editor_factory(std::make_unique<DefaultEditorFactory>())
+    , m_delegate(std::make_unique<ViewModelDelegate>())
 {
   if (!m_view_model)
   {
@@ -46,41 +65,70 @@ PropertyGridController::~PropertyGridController() = default;
 
 std::vector<PropertyGridController::widget_row_t> PropertyGridController::CreateWidgetGrid()
 {
-  std::vector<PropertyGridController::widget_row_t> result;
-
   UpdateMappers();
 
-  result.resize(m_view_model->rowCount());
   m_widgets.resize(m_view_model->rowCount());
+  return CreateWidgetRows(0, m_view_model->rowCount() - 1);
+}
 
-  for (int row = 0; row < m_view_model->rowCount(); ++row)
+std::vector<PropertyGridController::widget_row_t> PropertyGridController::CreateWidgetRows(
+    int first, int last)
+{
+  std::vector<PropertyGridController::widget_row_t> result;
+  if (first < 0 || last < first)
+  {
+    return result;
+  }
+
+  if (static_cast<size_t>(last) >= m_widgets.size())
   {
-    auto &mapper = m_widget_mappers.at(static_cast<size_t>(row));
+    throw RuntimeException("Row index is out of grid range");
+  }
 
+  for (int row = first; row <= last; ++row)
+  {
+    auto &widget_row = m_widgets[static_cast<size_t>(row)];
+    widget_row.clear();
+    auto &result_row = result.emplace_back();
     for (int col = 0; col < m_view_model->columnCount(); ++col)
     {
-      const auto index = m_view_model->index(row, col);
+      auto widget = CreateWidget(m_view_model->index(row, col));
+      widget_row.push_back(widget.get());
+      result_row.push_back(std::move(widget));
+    }
+  }
 
-      auto widget = CreateWidget(index);
+  MapRows(first, last);
+  PopulateRows(first, last);
 
-      if (IsLabel(index))
+  return result;
+}
+
+void PropertyGridController::RecycleWidgets(std::vector<widget_row_t> widgets)
+{
+  for (auto &widget_row : widgets)
+  {
+    for (auto &widget : widget_row)
+    {
+      const auto key = widget ? widget->property(kRecyclingKeyProperty).toString().toStdString()
+                              : std::string();
+      if (key.empty())
       {
-        // Workaround for QTBUG-10672
-        // QDataWidgetMapper does not update non-editable fields
-        mapper->addMapping(widget.get(), col, "text");
+        continue;  // widget can't be reused and will be deleted
       }
-      else
+
+      auto &pool = m_widget_pool[key];
+      if (pool.size() < kMaxPoolSize)
       {
-        mapper->addMapping(widget.get(), col);
+        for (auto &mapper : m_widget_mappers)
+        {
+          mapper->removeMapping(widget.get());
+        }
+        widget->setParent(nullptr);
+        pool.push_back(std::move(widget));
       }
-      m_widgets[row].push_back(widget.get());
-      result[row].push_back(std::move(widget));
     }
-
-    mapper->setCurrentIndex(row);
   }
-
-  return result;
 }
 
 bool PropertyGridController::Submit()
@@ -95,13 +143,25 @@ bool PropertyGridController::Submit()
 
 std::unique_ptr<QWidget> PropertyGridController::CreateWidget(const QModelIndex &index)
 {
-  return IsLabel(index) ? CreateLabel(index) : CreateEditor(index);
+  const bool is_label = IsLabel(index);
+  const auto key = is_label ? kLabelKey : m_editor_factory->GetRecyclingKey(index);
+
+  if (auto result = TakeRecycledWidget(key); result)
+  {
+    return result;  // widget data will be set when the row is populated
+  }
+
+  auto result = is_label ? CreateLabel(index) : CreateEditor(index);
+  if (result && !key.empty())
+  {
+    result->setProperty(kRecyclingKeyProperty, QString::fromStdString(key));
+  }
+  return result;
 }
 
 void PropertyGridController::ClearContent()
 {
   m_widget_mappers.clear();
-  m_delegates.clear();
   m_widgets.clear();
 }
 
@@ -119,14 +179,22 @@ std::unique_ptr<QWidget> PropertyGridController::CreateLabel(const QModelIndex &
 
 std::unique_ptr<QWidget> PropertyGridController::CreateEditor(const QModelIndex &index)
 {
-  if (index.row() < 0 || static_cast<size_t>(index.row()) >= m_delegates.size())
+  const QStyleOptionViewItem view_item;
+  auto result = std::unique_ptr<QWidget>(m_delegate->createEditor(nullptr, view_item, index));
+  return result;
+}
+
+std::unique_ptr<QWidget> PropertyGridController::TakeRecycledWidget(const std::string &key)
+{
+  auto iter = key.empty() ? m_widget_pool.end() : m_widget_pool.find(key);
+  if (iter == m_widget_pool.end() || iter->second.empty())
   {
-    throw RuntimeException("Error in delegates");
+    return {};
   }
 
-  auto delegate = m_delegates.at(index.row()).get();
-  const QStyleOptionViewItem view_item;
-  auto result = std::unique_ptr<QWidget>(delegate->createEditor(nullptr, view_item, index));
+  auto result = std::move(iter->second.back());
+  iter->second.pop_back();
+  result->setEnabled(true);
   return result;
 }
 
@@ -137,30 +205,170 @@ void PropertyGridController::OnLayoutChange()
   emit GridChanged();
 }
 
+void PropertyGridController::OnRowsInserted(int first, int last)
+{
+  if (!IsIncrementalUpdateEnabled() || !IsConsistentGrid(last - first + 1))
+  {
+    OnLayoutChange();
+    return;
+  }
+
+  // placeholders for new rows, widgets of following rows are mapped to their new positions
+  m_widgets.insert(std::next(m_widgets.begin(), first), static_cast<size_t>(last - first + 1), {});
+  MapRows(last + 1, static_cast<int>(m_widgets.size()) - 1);
+
+  emit RowsInserted(first, last);
+}
+
+void PropertyGridController::OnRowsAboutToBeRemoved(int first, int last)
+{
+  if (!IsIncrementalUpdateEnabled() || !IsConsistentGrid(0))
+  {
+    return;  // grid will be regenerated when removal is over
+  }
+
+  for (int row = first; row <= last; ++row)
+  {
+    const auto &widget_row = m_widgets[static_cast<size_t>(row)];
+    for (size_t col = 0; col < widget_row.size(); ++col)
+    {
+      m_widget_mappers[col]->removeMapping(widget_row[col]);
+    }
+  }
+
+  emit RowsAboutToBeRemoved(first, last);
+}
+
+void PropertyGridController::OnRowsRemoved(int first, int last)
+{
+  if (!IsIncrementalUpdateEnabled() || !IsConsistentGrid(first - last - 1))
+  {
+    OnLayoutChange();
+    return;
+  }
+
+  m_widgets.erase(std::next(m_widgets.begin(), first), std::next(m_widgets.begin(), last + 1));
+  MapRows(first, static_cast<int>(m_widgets.size()) - 1);
+}
+
+bool PropertyGridController::IsIncrementalUpdateEnabled() const
+{
+  // the user who doesn't fill the grid row-wise gets the grid regenerated
+  static const auto rows_inserted = QMetaMethod::fromSignal(&PropertyGridController::RowsInserted);
+  static const auto rows_about_to_be_removed =
+      QMetaMethod::fromSignal(&PropertyGridController::RowsAboutToBeRemoved);
+  return isSignalConnected(rows_inserted) && isSignalConnected(rows_about_to_be_removed);
+}
+
+bool PropertyGridController::IsConsistentGrid(int row_count_change) const
+{
+  return !m_widget_mappers.empty()
+         && static_cast<int>(m_widget_mappers.size()) == m_view_model->columnCount()
+         && static_cast<int>(m_widgets.size()) + row_count_change == m_view_model->rowCount();
+}
+
 void PropertyGridController::UpdateMappers()
 {
   ClearContent();
 
-  for (int row = 0; row < m_view_model->rowCount(); ++row)
+  // Mappers have vertical orientation: the mapper looks at the model column, and each widget is
+  // mapped to the row.
+  for (int col = 0; col < m_view_model->columnCount(); ++col)
   {
     auto mapper = std::make_unique<QDataWidgetMapper>();
-    auto delegate = std::make_unique<ViewModelDelegate>();
-    mapper->setOrientation(Qt::Horizontal);
+    mapper->setOrientation(Qt::Vertical);
     mapper->setModel(m_view_model);
-    mapper->setItemDelegate(delegate.get());
+    mapper->setItemDelegate(m_delegate.get());
     mapper->setRootIndex(QModelIndex());
+    mapper->setCurrentIndex(col);  // no widgets are mapped yet, so nothing is updated
     m_widget_mappers.emplace_back(std::move(mapper));
-    m_delegates.emplace_back(std::move(delegate));
+  }
+}
+
+void PropertyGridController::MapRows(int first, int last)
+{
+  for (int row = first; row <= last; ++row)
+  {
+    const auto &widget_row = m_widgets[static_cast<size_t>(row)];
+    for (size_t col = 0; col < widget_row.size(); ++col)
+    {
+      auto widget = widget_row[col].data();
+      if (!widget)
+      {
+        continue;
+      }
+
+      auto &mapper = m_widget_mappers.at(col);
+      if (IsLabel(m_view_model->index(row, static_cast<int>(col))))
+      {
+        // Workaround for QTBUG-10672
+        // QDataWidgetMapper does not update non-editable fields
+        mapper->addMapping(widget, row, "text");
+      }
+      else
+      {
+        mapper->addMapping(widget, row);
+      }
+    }
+  }
+}
+
+void PropertyGridController::PopulateRows(int first, int last)
+{
+  // the same as QDataWidgetMapper does on the index change, but for given widgets only
+  for (int row = first; row <= last; ++row)
+  {
+    const auto &widget_row = m_widgets[static_cast<size_t>(row)];
+    for (size_t col = 0; col < widget_row.size(); ++col)
+    {
+      auto widget = widget_row[col].data();
+      if (!widget)
+      {
+        continue;
+      }
+
+      const auto index = m_view_model->index(row, static_cast<int>(col));
+      if (IsLabel(index))
+      {
+        widget->setProperty("text", index.data(Qt::EditRole));
+      }
+      else
+      {
+        m_delegate->setEditorData(widget, index);
+      }
+    }
   }
 }
 
 void PropertyGridController::SetupConnections(QAbstractItemModel *model)
 {
-  auto on_row_inserted = [this](const QModelIndex &, int, int) { OnLayoutChange(); };
-  connect(model, &QAbstractItemModel::rowsInserted, on_row_inserted);
+  // the grid shows only top level rows of the model
+  auto on_row_inserted = [this](const QModelIndex &parent, int first, int last)
+  {
+    if (!parent.isValid())
+    {
+      OnRowsInserted(first, last);
+    }
+  };
+  connect(model, &QAbstractItemModel::rowsInserted, this, on_row_inserted);
+
+  auto on_row_about_to_be_removed = [this](const QModelIndex &parent, int first, int last)
+  {
+    if (!parent.isValid())
+    {
+      OnRowsAboutToBeRemoved(first, last);
+    }
+  };
+  connect(model, &QAbstractItemModel::rowsAboutToBeRemoved, this, on_row_about_to_be_removed);
 
-  auto on_row_removed = [this](const QModelIndex &, int, int) { OnLayoutChange(); };
-  connect(model, &QAbstractItemModel::rowsRemoved, on_row_removed);
+  auto on_row_removed = [this](const QModelIndex &parent, int first, int last)
+  {
+    if (!parent.isValid())
+    {
+      OnRowsRemoved(first, last);
+    }
+  };
+  connect(model, &QAbstractItemModel::rowsRemoved, this, on_row_removed);
 
   connect(model, &QAbstractItemModel::modelReset, this, [this]() { OnLayoutChange(); });
 
@@ -171,15 +379,25 @@ void PropertyGridController::SetupConnections(QAbstractItemModel *model)
       [this](const QModelIndex &index, const QModelIndex &, const QVector<int> &roles)
   {
     QVector<int> expected_roles = {Qt::ForegroundRole};
-    if (roles == expected_roles)
+    if (roles != expected_roles || index.parent().isValid()
+        || static_cast<size_t>(index.row()) >= m_widgets.size())
     {
-      if (auto item = utils::ItemFromIndex(index); item)
-      {
-        m_widgets[index.row()][index.column()]->setEnabled(item->IsEnabled());
-      }
+      return;
+    }
+
+    const auto &widget_row = m_widgets[static_cast<size_t>(index.row())];
+    if (static_cast<size_t>(index.column()) >= widget_row.size())
+    {
+      return;
+    }
+
+    auto item = utils::ItemFromIndex(index);
+    if (auto widget = widget_row[static_cast<size_t>(index.column())].data(); item && widget)
+    {
+      widget->setEnabled(item->IsEnabled());
     }
   };
-  connect(m_view_model, &QAbstractItemModel::dataChanged, on_data_change);
+  connect(m_view_model, &QAbstractItemModel::dataChanged, this, on_data_change);
 }
 
 }  // namespace mvvm
@@ -24,7 +24,10 @@
 #include <mvvm/view_export.h>
 
 #include <QObject>
+#include <QPointer>
+#include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 class QAbstractItemModel;
@@ -33,6 +36,7 @@ class QDataWidgetMapper;
 namespace mvvm
 {
 
+class DefaultEditorFactory;
 class ViewModelDelegate;
 
 /**
@@ -43,8 +47,11 @@ class ViewModelDelegate;
  * each widget is intended for editing/displaying the cell of the model. It is the responsibility of
  * the user to populate the grid layout.
  *
- * Controller also holds a collection of delegates/and mappers to propagate editing activity back to
- * the model.
+ * Controller also holds a delegate and a mapper per column to propagate editing activity back to
+ * the model. Rows inserted/removed in the model are reported with RowsInserted and
+ * RowsAboutToBeRemoved signals, so the user can update the grid incrementally. If the user doesn't
+ * listen to both signals, GridChanged is emitted instead. Widgets which are no longer needed can be
+ * given back to the controller, they will be reused for new cells.
  */
 class MVVM_VIEW_EXPORT PropertyGridController : public QObject
 {
@@ -65,6 +72,21 @@ public:
    */
   std::vector<widget_row_t> CreateWidgetGrid();
 
+  /**
+   * @brief Creates widgets for the given range of rows.
+   *
+   * Intended to be called on RowsInserted signal, for rows which were inserted after the grid
+   * creation.
+   */
+  std::vector<widget_row_t> CreateWidgetRows(int first, int last);
+
+  /**
+   * @brief Takes back widgets which are no longer shown, to reuse them for new cells.
+   *
+   * Editors whose configuration depends on the presented item will be deleted.
+   */
+  void RecycleWidgets(std::vector<widget_row_t> widgets);
+
   /**
    * @brief Submits all changes from mapped widgets back to the model.
    */
@@ -72,12 +94,23 @@ public:
 
 signals:
   /**
-   * @brief The signal is emitted when the model changes its layout, meaning some rows/columns have
-   * been inserted or removed. In the current simplified approach, we must re-populate the grid
-   * layout from scratch.
+   * @brief The signal is emitted when the model was reset, or the number of columns has changed.
+   * The grid layout must be re-populated from scratch.
    */
   void GridChanged();
 
+  /**
+   * @brief The signal is emitted when rows have been inserted in the model. Widgets for new rows
+   * can be obtained with CreateWidgetRows.
+   */
+  void RowsInserted(int first, int last);
+
+  /**
+   * @brief The signal is emitted when rows are about to be removed from the model. Widgets of
+   * these rows are not mapped anymore.
+   */
+  void RowsAboutToBeRemoved(int first, int last);
+
 private:
   /**
    * @brief Create widget for a given model cell.
@@ -85,7 +118,7 @@ private:
   std::unique_ptr<QWidget> CreateWidget(const QModelIndex& index);
 
   /**
-   * @brief Clear all mappers and delegates.
+   * @brief Clear all mappers and widget references.
    */
   void ClearContent();
 
@@ -104,25 +137,69 @@ private:
    */
   std::unique_ptr<QWidget> CreateEditor(const QModelIndex& index);
 
+  /**
+   * @brief Returns a widget from the pool of recycled widgets for the given key, or nullptr.
+   */
+  std::unique_ptr<QWidget> TakeRecycledWidget(const std::string& key);
+
   /**
    * @brief Process model layout change.
    */
   void OnLayoutChange();
 
+  /**
+   * @brief Process rows insertion into the model.
+   */
+  void OnRowsInserted(int first, int last);
+
+  /**
+   * @brief Process the beginning of rows removal from the model.
+   */
+  void OnRowsAboutToBeRemoved(int first, int last);
+
+  /**
+   * @brief Process the end of rows removal from the model.
+   */
+  void OnRowsRemoved(int first, int last);
+
+  /**
+   * @brief Checks if the user updates the grid row-wise, i.e. listens for RowsInserted and
+   * RowsAboutToBeRemoved signals.
+   */
+  bool IsIncrementalUpdateEnabled() const;
+
+  /**
+   * @brief Checks if the grid matches the model after the insertion/removal of given number of
+   * rows.
+   */
+  bool IsConsistentGrid(int row_count_change) const;
+
   /**
    * @brief Regenerates all mappers.
    */
   void UpdateMappers();
 
+  /**
+   * @brief Maps widgets of given rows to model cells.
+   */
+  void MapRows(int first, int last);
+
+  /**
+   * @brief Updates widgets of given rows from model cells.
+   */
+  void PopulateRows(int first, int last);
+
   /**
    * @brief Start listening the model.
    */
   void SetupConnections(QAbstractItemModel* model);
 
   QAbstractItemModel* m_view_model{nullptr};
-  std::vector<std::unique_ptr<ViewModelDelegate>> m_delegates;
-  std::vector<std::unique_ptr<QDataWidgetMapper>> m_widget_mappers;
-  std::vector<std::vector<QWidget*>> m_widgets;
+  std::unique_ptr<DefaultEditorFactory> m_editor_factory;
+  std::unique_ptr<ViewModelDelegate> m_delegate;
+  std::vector<std::unique_ptr<QDataWidgetMapper>> m_widget_mappers;  //!< one mapper per column
+  std::vector<std::vector<QPointer<QWidget>>> m_widgets;
+  std::map<std::string, std::vector<std::unique_ptr<QWidget>>> m_widget_pool;
 };
 
 }  // namespace mvvm
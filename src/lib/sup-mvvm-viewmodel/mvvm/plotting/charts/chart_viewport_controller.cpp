@@ -60,9 +60,17 @@ QChart::AnimationOptions GetAnimationOption(ChartViewportItem *item)
 
 }  // namespace
 
-ChartViewportController::ChartViewportController(QChart *chart) : m_chart(chart) {}
+ChartViewportController::ChartViewportController(QChart *chart)
+    : m_chart(chart)
+    , m_range_connection(std::make_unique<QMetaObject::Connection>())
+    , m_plot_area_connection(std::make_unique<QMetaObject::Connection>())
+{
+}
 
-ChartViewportController::~ChartViewportController() = default;
+ChartViewportController::~ChartViewportController()
+{
+  SetQtDisconnected();
+}
 
 void ChartViewportController::Subscribe()
 {
@@ -71,6 +79,9 @@ void ChartViewportController::Subscribe()
   Listener()->Connect<ItemInsertedEvent>(this, &ChartViewportController::OnItemInsertedEvent);
   Listener()->Connect<AboutToRemoveItemEvent>(this,
                                               &ChartViewportController::OnAboutToRemoveItemEvent);
+  Listener()->Connect<ItemsInsertedEvent>(this, &ChartViewportController::OnItemsInsertedEvent);
+  Listener()->Connect<AboutToRemoveItemsEvent>(
+      this, &ChartViewportController::OnAboutToRemoveItemsEvent);
   Listener()->Connect<PropertyChangedEvent>(this, &ChartViewportController::OnPropertyChangedEvent);
 }
 
@@ -90,6 +101,7 @@ QLineSeries *ChartViewportController::SetupChartForLineSeries(LineSeriesItem *it
   m_chart->addSeries(qt_line_series);  // ownership is taken by Qt
 
   auto controller = std::make_unique<LineSeriesController>(qt_line_series);
+  UpdateVisibleRange(*controller);
   controller->SetItem(item);
   m_line_controllers.push_back(std::move(controller));
 
@@ -126,6 +138,9 @@ void ChartViewportController::SetupAxes()
     m_y_axis_controller = std::make_unique<mvvm::ChartAxisPlotController>(y_axes.at(0));
     m_y_axis_controller->SetItem(GetItem()->GetYAxis());
   }
+
+  SetQtConnected();
+  UpdateVisibleRange();
 }
 
 void ChartViewportController::OnItemInsertedEvent(const ItemInsertedEvent &event)
@@ -170,6 +185,26 @@ void ChartViewportController::OnAboutToRemoveItemEvent(const AboutToRemoveItemEv
   }
 }
 
+void ChartViewportController::OnItemsInsertedEvent(const ItemsInsertedEvent &event)
+{
+  for (std::size_t index = 0; index < event.count; ++index)
+  {
+    const TagIndex tagindex{event.tag_index.GetTag(),
+                            event.tag_index.GetIndex() + static_cast<int>(index)};
+    OnItemInsertedEvent({event.item, tagindex});
+  }
+}
+
+void ChartViewportController::OnAboutToRemoveItemsEvent(const AboutToRemoveItemsEvent &event)
+{
+  for (std::size_t index = 0; index < event.count; ++index)
+  {
+    const TagIndex tagindex{event.tag_index.GetTag(),
+                            event.tag_index.GetIndex() + static_cast<int>(index)};
+    OnAboutToRemoveItemEvent({event.item, tagindex});
+  }
+}
+
 void ChartViewportController::OnPropertyChangedEvent(const PropertyChangedEvent &event)
 {
   if (event.name == ChartViewportItem::kAnimation)
@@ -183,4 +218,41 @@ void ChartViewportController::OnPropertyChangedEvent(const PropertyChangedEvent
   }
 }
 
+void ChartViewportController::SetQtConnected()
+{
+  SetQtDisconnected();
+
+  if (auto value_axis = dynamic_cast<QValueAxis *>(GetXQtAxis()); value_axis)
+  {
+    auto on_axis_range = [this](qreal, qreal) { UpdateVisibleRange(); };
+    *m_range_connection = QObject::connect(value_axis, &QValueAxis::rangeChanged, on_axis_range);
+  }
+
+  auto on_plot_area = [this](const QRectF &) { UpdateVisibleRange(); };
+  *m_plot_area_connection = QObject::connect(m_chart, &QChart::plotAreaChanged, on_plot_area);
+}
+
+void ChartViewportController::SetQtDisconnected()
+{
+  QObject::disconnect(*m_range_connection);
+  QObject::disconnect(*m_plot_area_connection);
+}
+
+void ChartViewportController::UpdateVisibleRange()
+{
+  for (auto &controller : m_line_controllers)
+  {
+    UpdateVisibleRange(*controller);
+  }
+}
+
+void ChartViewportController::UpdateVisibleRange(LineSeriesController &controller)
+{
+  if (auto value_axis = dynamic_cast<QValueAxis *>(GetXQtAxis()); value_axis)
+  {
+    const auto pixel_count = static_cast<int>(m_chart->plotArea().width());
+    controller.SetVisibleRange(value_axis->min(), value_axis->max(), pixel_count);
+  }
+}
+
 }  // namespace mvvm
@@ -24,6 +24,7 @@
 #include <mvvm/plotting/charts/qt_charts_fwd.h>
 #include <mvvm/signals/item_controller.h>
 
+#include <QObject>
 #include <list>
 
 namespace mvvm
@@ -39,7 +40,8 @@ class LineSeriesItem;
  * QChart scene for plotting multiple line series on one canvas.
  *
  * It listens ChartViewportItems and propagates changes into QChart scene. On insertion/removal of
- * LineSeriesItem it will create/remove corresponding QLineSeries object.
+ * LineSeriesItem it will create/remove corresponding QLineSeries object. Visible x-range and the
+ * width of the plot area are propagated to line series controllers for level-of-detail decimation.
  */
 class ChartViewportController : public ItemController<ChartViewportItem>
 {
@@ -85,15 +87,47 @@ private:
    */
   void OnAboutToRemoveItemEvent(const AboutToRemoveItemEvent& event);
 
+  /**
+   * @brief Process event when a range of LineSeriesItems is added to viewport.
+   */
+  void OnItemsInsertedEvent(const ItemsInsertedEvent& event);
+
+  /**
+   * @brief Process event when a range of LineSeriesItems is removed from viewport.
+   */
+  void OnAboutToRemoveItemsEvent(const AboutToRemoveItemsEvent& event);
+
   /**
    * @brief Process event when one of properties has changed.
    */
   void OnPropertyChangedEvent(const PropertyChangedEvent& event);
 
+  /**
+   * @brief Connects to Qt x-axis and chart to get notified about visible range changes.
+   */
+  void SetQtConnected();
+
+  /**
+   * @brief Disconnects from Qt x-axis and chart.
+   */
+  void SetQtDisconnected();
+
+  /**
+   * @brief Propagates visible x-range and plot area width to all line series controllers.
+   */
+  void UpdateVisibleRange();
+
+  /**
+   * @brief Propagates visible x-range and plot area width to given controller.
+   */
+  void UpdateVisibleRange(LineSeriesController& controller);
+
   QChart* m_chart{nullptr};
   std::list<std::unique_ptr<LineSeriesController>> m_line_controllers;
   std::unique_ptr<ChartAxisPlotController> m_x_axis_controller;
   std::unique_ptr<ChartAxisPlotController> m_y_axis_controller;
+  std::unique_ptr<QMetaObject::Connection> m_range_connection;
+  std::unique_ptr<QMetaObject::Connection> m_plot_area_connection;
 };
 
 }  // namespace mvvm
@@ -60,6 +60,11 @@ QLineSeries *LineSeriesController::GetQtLineSeries() const
   return m_data_controller->GetQtLineSeries();
 }
 
+void LineSeriesController::SetVisibleRange(double xmin, double xmax, int pixel_count)
+{
+  m_data_controller->SetVisibleRange(xmin, xmax, pixel_count);
+}
+
 void LineSeriesController::OnPropertyChanged(const PropertyChangedEvent &event)
 {
   if (event.name == constants::kLink)
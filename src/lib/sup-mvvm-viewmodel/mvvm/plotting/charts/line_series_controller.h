@@ -60,6 +60,12 @@ public:
    */
   QLineSeries* GetQtLineSeries() const;
 
+  /**
+   * @brief Sets the visible x-range and the width of the viewport in pixels for level-of-detail
+   * decimation of the data.
+   */
+  void SetVisibleRange(double xmin, double xmax, int pixel_count);
+
 private:
   /**
    * @brief Processes the change of linked data item.
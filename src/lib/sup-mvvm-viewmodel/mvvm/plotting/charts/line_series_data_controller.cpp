@@ -20,6 +20,7 @@
 
 #include "line_series_data_controller.h"
 
+#include "line_series_decimator.h"
 #include "qt_charts.h"
 
 #include <mvvm/model/item_utils.h>
@@ -28,11 +29,26 @@
 #include <mvvm/standarditems/line_series_data_item.h>
 #include <mvvm/utils/container_utils.h>
 
+#include <QObject>
+
 namespace mvvm
 {
 
+namespace
+{
+
+//! Line series with more points per pixel are decimated.
+const int kMaxPointsPerPixel = 2;
+
+//! Line series with this number of points and more are decimated in the background thread.
+const int kDefaultBackgroundThreshold = 100000;
+
+}  // namespace
+
 LineSeriesDataController::LineSeriesDataController(QLineSeries *line_series)
     : m_qt_line_series(line_series)
+    , m_background_threshold(kDefaultBackgroundThreshold)
+    , m_receiver(std::make_unique<QObject>())
 {
   if (!line_series)
   {
@@ -74,21 +90,79 @@ void LineSeriesDataController::OnModelEvent(const ItemInsertedEvent &event)
 
   if (parent == m_data_item)
   {
+    if (UpdateDecimationMode())
+    {
+      return;
+    }
+    if (m_is_decimated)
+    {
+      ScheduleDecimatedDataUpdate();
+      return;
+    }
+
     auto index = tag_index.GetIndex();
     auto [new_x, new_y] = m_data_item->GetPointCoordinates(index);
-    m_qt_line_series->insert(index, {new_x, new_y});
+    m_qt_line_series->insert(index, {new_x + m_series_x_offset, new_y});
   }
 }
 
 void LineSeriesDataController::OnModelEvent(const AboutToRemoveItemEvent &event)
 {
-  if (event.item == m_data_item)
+  if (event.item == m_data_item && !m_is_decimated)
   {
     auto index = event.tag_index.GetIndex();
     m_qt_line_series->remove(index);
   }
 }
 
+void LineSeriesDataController::OnModelEvent(const ItemsInsertedEvent &event)
+{
+  if (event.item == m_data_item)
+  {
+    if (UpdateDecimationMode())
+    {
+      return;
+    }
+    if (m_is_decimated)
+    {
+      ScheduleDecimatedDataUpdate();
+      return;
+    }
+
+    auto first = event.tag_index.GetIndex();
+    for (int index = first; index < first + static_cast<int>(event.count); ++index)
+    {
+      auto [new_x, new_y] = m_data_item->GetPointCoordinates(index);
+      m_qt_line_series->insert(index, {new_x + m_series_x_offset, new_y});
+    }
+  }
+}
+
+void LineSeriesDataController::OnModelEvent(const AboutToRemoveItemsEvent &event)
+{
+  if (event.item == m_data_item && !m_is_decimated)
+  {
+    m_qt_line_series->removePoints(event.tag_index.GetIndex(), static_cast<int>(event.count));
+  }
+}
+
+void LineSeriesDataController::OnModelEvent(const ItemRemovedEvent &event)
+{
+  // in decimated mode the series is rebuilt after the removal
+  if (event.item == m_data_item && m_is_decimated && !UpdateDecimationMode())
+  {
+    ScheduleDecimatedDataUpdate();
+  }
+}
+
+void LineSeriesDataController::OnModelEvent(const ItemsRemovedEvent &event)
+{
+  if (event.item == m_data_item && m_is_decimated && !UpdateDecimationMode())
+  {
+    ScheduleDecimatedDataUpdate();
+  }
+}
+
 void LineSeriesDataController::OnModelEvent(const DataChangedEvent &event)
 {
   // We are here becase the data of either x-item, or y-item was changed.
@@ -106,7 +180,28 @@ void LineSeriesDataController::OnModelEvent(const DataChangedEvent &event)
     auto index = point_item->GetTagIndex().GetIndex();
 
     auto [new_x, new_y] = m_data_item->GetPointCoordinates(index);
-    m_qt_line_series->replace(index, new_x + m_x_offset, new_y);
+
+    if (m_is_decimated)
+    {
+      if (m_is_decimated_data_pending)
+      {
+        return;  // the pyramid doesn't match the points yet, it is rebuilt soon
+      }
+
+      // only the path of the point in the pyramid is updated
+      if (m_decimator)
+      {
+        m_decimator->SetPoint(static_cast<std::size_t>(index), new_x, new_y);
+      }
+      else
+      {
+        m_pyramid.SetPoint(static_cast<std::size_t>(index), new_x, new_y);
+      }
+      UpdateVisiblePoints();
+      return;
+    }
+
+    m_qt_line_series->replace(index, new_x + m_series_x_offset, new_y);
   }
 }
 
@@ -129,19 +224,84 @@ void LineSeriesDataController::SetXOffset(double value)
 
   m_x_offset = value;
 
-  if (m_data_item)
+  if (!m_data_item)
   {
-    QList<QPointF> new_values;
-    for (auto [x, y] : m_data_item->GetWaveform())
-    {
-      new_values.append({x + m_x_offset, y});
-    }
+    return;
+  }
 
-    if (!new_values.empty())
-    {
-      GetQtLineSeries()->replace(new_values);
-    }
+  if (m_is_decimated)
+  {
+    // the pyramid holds original coordinates, only the visible range is shifted
+    UpdateVisiblePoints();
+    return;
+  }
+
+  if (!IsBackgroundDecimationRequired())
+  {
+    ShiftToXOffset();
+    return;
+  }
+
+  // consecutive offset changes of a large series are merged into a single shift
+  if (!m_is_x_offset_pending)
+  {
+    m_is_x_offset_pending = true;
+    QMetaObject::invokeMethod(
+        m_receiver.get(), [this]() { ShiftToXOffset(); }, Qt::QueuedConnection);
+  }
+}
+
+void LineSeriesDataController::SetVisibleRange(double xmin, double xmax, int pixel_count)
+{
+  if (xmin == m_xmin && xmax == m_xmax && pixel_count == m_pixel_count)
+  {
+    return;
+  }
+
+  m_xmin = xmin;
+  m_xmax = xmax;
+  m_pixel_count = pixel_count;
+
+  if (m_data_item && !UpdateDecimationMode() && m_is_decimated)
+  {
+    UpdateVisiblePoints();
+  }
+}
+
+bool LineSeriesDataController::IsDecimated() const
+{
+  return m_is_decimated;
+}
+
+void LineSeriesDataController::SetBackgroundThreshold(int point_count)
+{
+  if (point_count == m_background_threshold)
+  {
+    return;
   }
+
+  m_background_threshold = point_count;
+
+  if (m_data_item && m_is_decimated)
+  {
+    UpdateDecimatedData();
+  }
+
+  // the deferred shift is applied at once if the series isn't considered large anymore
+  if (m_data_item && m_is_x_offset_pending && !IsBackgroundDecimationRequired())
+  {
+    ShiftToXOffset();
+  }
+}
+
+bool LineSeriesDataController::IsDecimationPending() const
+{
+  return m_is_decimated_data_pending || (m_decimator && m_decimator->IsPending());
+}
+
+bool LineSeriesDataController::IsXOffsetPending() const
+{
+  return m_is_x_offset_pending;
 }
 
 void LineSeriesDataController::Subscribe()
@@ -153,21 +313,172 @@ void LineSeriesDataController::Subscribe()
   m_listener->Connect<mvvm::DataChangedEvent>(this, &LineSeriesDataController::OnModelEvent);
   m_listener->Connect<mvvm::ItemInsertedEvent>(this, &LineSeriesDataController::OnModelEvent);
   m_listener->Connect<mvvm::AboutToRemoveItemEvent>(this, &LineSeriesDataController::OnModelEvent);
+  m_listener->Connect<mvvm::ItemsInsertedEvent>(this, &LineSeriesDataController::OnModelEvent);
+  m_listener->Connect<mvvm::AboutToRemoveItemsEvent>(this,
+                                                     &LineSeriesDataController::OnModelEvent);
+  m_listener->Connect<mvvm::ItemRemovedEvent>(this, &LineSeriesDataController::OnModelEvent);
+  m_listener->Connect<mvvm::ItemsRemovedEvent>(this, &LineSeriesDataController::OnModelEvent);
 }
 
 void LineSeriesDataController::Unsubscribe()
 {
   m_data_item = nullptr;
   m_listener.reset();
+  m_is_decimated = false;
+  m_is_decimated_data_pending = false;
+  m_pyramid.SetData({}, {});
+  m_decimator.reset();
   m_qt_line_series->clear();
 }
 
 void LineSeriesDataController::InitLineSeriesData()
 {
+  m_is_decimated = IsDecimationRequired();
+  if (m_is_decimated)
+  {
+    UpdateDecimatedData();
+    return;
+  }
+
+  m_is_decimated_data_pending = false;
+  m_pyramid.SetData({}, {});
+  m_decimator.reset();
+  QList<QPointF> points;
   for (auto [x, y] : m_data_item->GetWaveform())
   {
-    m_qt_line_series->append(x + m_x_offset, y);
+    points.append({x + m_x_offset, y});
+  }
+  m_series_x_offset = m_x_offset;
+  m_qt_line_series->replace(points);
+}
+
+bool LineSeriesDataController::IsDecimationRequired() const
+{
+  return m_pixel_count > 0 && m_data_item->GetPointCount() > kMaxPointsPerPixel * m_pixel_count;
+}
+
+bool LineSeriesDataController::UpdateDecimationMode()
+{
+  if (IsDecimationRequired() == m_is_decimated)
+  {
+    return false;
+  }
+
+  InitLineSeriesData();
+  return true;
+}
+
+void LineSeriesDataController::ScheduleDecimatedDataUpdate()
+{
+  if (m_is_decimated_data_pending)
+  {
+    return;
+  }
+
+  m_is_decimated_data_pending = true;
+  QMetaObject::invokeMethod(
+      m_receiver.get(),
+      [this]()
+      {
+        // the update might be already done, or not needed anymore
+        if (m_is_decimated_data_pending && m_data_item && m_is_decimated)
+        {
+          UpdateDecimatedData();
+        }
+        m_is_decimated_data_pending = false;
+      },
+      Qt::QueuedConnection);
+}
+
+void LineSeriesDataController::UpdateDecimatedData()
+{
+  m_is_decimated_data_pending = false;
+
+  std::vector<double> x_values;
+  std::vector<double> y_values;
+  const auto point_count = static_cast<std::size_t>(m_data_item->GetPointCount());
+  x_values.reserve(point_count);
+  y_values.reserve(point_count);
+  for (auto [x, y] : m_data_item->GetWaveform())
+  {
+    x_values.push_back(x);
+    y_values.push_back(y);
+  }
+
+  if (IsBackgroundDecimationRequired())
+  {
+    if (!m_decimator)
+    {
+      auto on_points = [this](const DecimatedData &data) { SetVisiblePoints(data); };
+      m_decimator = std::make_unique<LineSeriesDecimator>(on_points);
+    }
+    m_pyramid.SetData({}, {});
+    m_decimator->SetData(std::move(x_values), std::move(y_values));
+  }
+  else
+  {
+    // dropping the decimator also drops results which weren't delivered yet
+    m_decimator.reset();
+    m_pyramid.SetData(std::move(x_values), std::move(y_values));
+  }
+
+  UpdateVisiblePoints();
+}
+
+void LineSeriesDataController::UpdateVisiblePoints()
+{
+  const auto xmin = m_xmin - m_x_offset;
+  const auto xmax = m_xmax - m_x_offset;
+  const auto pixel_count = static_cast<std::size_t>(m_pixel_count);
+
+  if (m_decimator)
+  {
+    m_decimator->RequestPoints(xmin, xmax, pixel_count);
+    return;
+  }
+
+  SetVisiblePoints(m_pyramid.GetPoints(xmin, xmax, pixel_count));
+}
+
+void LineSeriesDataController::SetVisiblePoints(const DecimatedData &data)
+{
+  QList<QPointF> points;
+  points.reserve(static_cast<int>(data.x.size()));
+  for (std::size_t index = 0; index < data.x.size(); ++index)
+  {
+    points.append({data.x[index] + m_x_offset, data.y[index]});
+  }
+  m_qt_line_series->replace(points);
+}
+
+bool LineSeriesDataController::IsBackgroundDecimationRequired() const
+{
+  return m_background_threshold > 0 && m_data_item->GetPointCount() >= m_background_threshold;
+}
+
+void LineSeriesDataController::ShiftToXOffset()
+{
+  m_is_x_offset_pending = false;
+
+  // in decimated mode points are shifted when they are set
+  if (!m_data_item || m_is_decimated || m_series_x_offset == m_x_offset)
+  {
+    return;
+  }
+
+  const double shift = m_x_offset - m_series_x_offset;
+  m_series_x_offset = m_x_offset;
+
+  auto points = m_qt_line_series->points();
+  if (points.empty())
+  {
+    return;
+  }
+  for (auto &point : points)
+  {
+    point.rx() += shift;
   }
+  m_qt_line_series->replace(std::move(points));
 }
 
 }  // namespace mvvm
@@ -23,13 +23,17 @@
 
 #include <mvvm/plotting/charts/qt_charts_fwd.h>
 #include <mvvm/signals/event_types.h>
+#include <mvvm/utils/minmax_pyramid.h>
 
 #include <memory>
 
+class QObject;
+
 namespace mvvm
 {
 
 class LineSeriesDataItem;
+class LineSeriesDecimator;
 class ModelListener;
 
 /**
@@ -39,6 +43,19 @@ class ModelListener;
  * For the moment it is one way communication from LineSeriesDataItem toward QLineSeries. Any
  * change in LineSeriesDataItem (adding, removing data points, changing x,y values) will be
  * propagated to QLineSeries.
+ *
+ * When the visible range is set and the number of points exceeds the number of pixels
+ * considerably, the controller switches to the decimated mode. In this mode QLineSeries gets only
+ * per-pixel min/max envelope of visible points, which is recomputed from the level-of-detail
+ * pyramid on every range change. The pyramid is rebuilt on the next event loop iteration after
+ * points are inserted or removed, once for all of them, and updated in place when the coordinates
+ * of a single point change. For large series the
+ * pyramid is built and the envelope is computed in the background thread; QLineSeries gets
+ * the result in a single replace, when it is ready.
+ *
+ * The x-axis offset is applied as a shift of points already passed to QLineSeries, the data is not
+ * rebuilt from the item. For large series in full mode the shift is deferred to the event loop, so
+ * the offset change is cheap and consecutive changes (i.e. dragging) shift the series only once.
  */
 class LineSeriesDataController
 {
@@ -57,6 +74,14 @@ public:
 
   void OnModelEvent(const AboutToRemoveItemEvent& event);
 
+  void OnModelEvent(const ItemsInsertedEvent& event);
+
+  void OnModelEvent(const AboutToRemoveItemsEvent& event);
+
+  void OnModelEvent(const ItemRemovedEvent& event);
+
+  void OnModelEvent(const ItemsRemovedEvent& event);
+
   /**
    * @brief Propagates change of (x,y) values to QtCharts.
    */
@@ -72,10 +97,43 @@ public:
   /**
    * @brief Sets the value of x-axis offset.
    *
-   * This number will be added to x-coordinates of all points.
+   * This number will be added to x-coordinates of all points. The series in full mode with the
+   * number of points above the background threshold is shifted on the next event loop iteration.
    */
   void SetXOffset(double value);
 
+  /**
+   * @brief Sets the visible x-range and the width of the viewport in pixels.
+   *
+   * Enables decimation of line series with the number of points much larger than the number of
+   * pixels. Zero pixel count disables decimation.
+   */
+  void SetVisibleRange(double xmin, double xmax, int pixel_count);
+
+  /**
+   * @brief Checks if QLineSeries holds decimated data.
+   */
+  bool IsDecimated() const;
+
+  /**
+   * @brief Sets the number of points starting from which decimation is performed in the
+   * background thread, and the x-offset shift is deferred. Zero disables both.
+   */
+  void SetBackgroundThreshold(int point_count);
+
+  /**
+   * @brief Checks if decimated points were requested from the background thread, but weren't
+   * delivered to QLineSeries yet, or points inserted or removed in decimated mode weren't
+   * decimated yet.
+   */
+  bool IsDecimationPending() const;
+
+  /**
+   * @brief Checks if the shift of the series to the current x-offset was deferred, but wasn't
+   * applied to QLineSeries yet.
+   */
+  bool IsXOffsetPending() const;
+
 private:
   void Subscribe();
   void Unsubscribe();
@@ -85,10 +143,65 @@ private:
    */
   void InitLineSeriesData();
 
+  /**
+   * @brief Checks if the current number of points requires decimation.
+   */
+  bool IsDecimationRequired() const;
+
+  /**
+   * @brief Switches between decimated and full mode if necessary and repopulates the series.
+   *
+   * Returns true if the series was repopulated.
+   */
+  bool UpdateDecimationMode();
+
+  /**
+   * @brief Schedules UpdateDecimatedData() on the next event loop iteration.
+   *
+   * Points inserted or removed one by one lead to a single rebuild of the pyramid.
+   */
+  void ScheduleDecimatedDataUpdate();
+
+  /**
+   * @brief Rebuilds level-of-detail pyramid from the data item and repopulates the series.
+   */
+  void UpdateDecimatedData();
+
+  /**
+   * @brief Populates the series with decimated points of the visible range.
+   */
+  void UpdateVisiblePoints();
+
+  /**
+   * @brief Replaces points of the series with given decimated points, shifted by x-offset.
+   */
+  void SetVisiblePoints(const DecimatedData& data);
+
+  /**
+   * @brief Checks if the current number of points requires background decimation.
+   */
+  bool IsBackgroundDecimationRequired() const;
+
+  /**
+   * @brief Shifts points of the series in full mode to the current x-offset.
+   */
+  void ShiftToXOffset();
+
   QLineSeries* m_qt_line_series{nullptr};
   const LineSeriesDataItem* m_data_item{nullptr};
   std::unique_ptr<ModelListener> m_listener;
   double m_x_offset{0.0};
+  double m_series_x_offset{0.0};  //!< offset of points passed to QLineSeries in full mode
+  bool m_is_x_offset_pending{false};
+  double m_xmin{0.0};
+  double m_xmax{0.0};
+  int m_pixel_count{0};
+  bool m_is_decimated{false};
+  bool m_is_decimated_data_pending{false};  //!< the pyramid is rebuilt on the next iteration
+  int m_background_threshold{0};
+  MinMaxPyramid m_pyramid;  //!< pyramid of original coordinates for decimation in this thread
+  std::unique_ptr<LineSeriesDecimator> m_decimator;  //!< exists during background decimation
+  std::unique_ptr<QObject> m_receiver;  //!< context of deferred calls, lives in caller thread
 };
 
 }  // namespace mvvm
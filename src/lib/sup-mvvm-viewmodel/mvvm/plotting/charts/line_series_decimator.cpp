@@ -0,0 +1,179 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "line_series_decimator.h"
+
+#include <mvvm/utils/thread_pool.h>
+
+#include <QObject>
+
+#include <algorithm>
+#include <thread>
+
+namespace
+{
+
+const std::size_t kMaxDecimationThreadCount = 4;
+
+/**
+ * @brief Returns the thread pool shared by all decimators.
+ */
+mvvm::ThreadPool& GetDecimationThreadPool()
+{
+  static mvvm::ThreadPool pool(
+      std::min(static_cast<std::size_t>(std::thread::hardware_concurrency()),
+               kMaxDecimationThreadCount));
+  return pool;
+}
+
+}  // namespace
+
+namespace mvvm
+{
+
+LineSeriesDecimator::LineSeriesDecimator(callback_t callback)
+    : m_callback(std::move(callback))
+    , m_receiver(std::make_unique<QObject>())
+    , m_context(std::make_shared<Context>())
+{
+  m_context->decimator = this;
+}
+
+LineSeriesDecimator::~LineSeriesDecimator()
+{
+  {
+    // the task which is still queued or running will not deliver results anymore
+    const std::lock_guard<std::mutex> lock(m_context->mutex);
+    m_context->decimator = nullptr;
+    m_context->request.reset();
+  }
+  m_receiver.reset();  // drops results which weren't delivered yet
+}
+
+void LineSeriesDecimator::SetData(std::vector<double> x, std::vector<double> y)
+{
+  m_waveform = std::make_shared<const Waveform>(
+      Waveform{std::move(x), std::move(y), ++m_last_waveform_id});
+}
+
+void LineSeriesDecimator::SetPoint(std::size_t index, double x, double y)
+{
+  if (!m_waveform)
+  {
+    return;
+  }
+
+  const std::lock_guard<std::mutex> lock(m_context->mutex);
+  m_context->point_updates.push_back({m_waveform->id, index, x, y});
+}
+
+void LineSeriesDecimator::RequestPoints(double xmin, double xmax, std::size_t pixel_count)
+{
+  if (!m_waveform)
+  {
+    return;
+  }
+
+  const std::lock_guard<std::mutex> lock(m_context->mutex);
+
+  // the request which wasn't started yet is replaced
+  m_context->request = Request{m_waveform, xmin, xmax, pixel_count, ++m_last_request_id};
+
+  // the task already in the pool will pick up the request
+  if (!m_context->is_scheduled)
+  {
+    m_context->is_scheduled = true;
+    GetDecimationThreadPool().Submit([context = m_context]() { ProcessRequests(context); });
+  }
+}
+
+bool LineSeriesDecimator::IsPending() const
+{
+  return m_delivered_request_id != m_last_request_id;
+}
+
+void LineSeriesDecimator::ProcessRequests(const std::shared_ptr<Context>& context)
+{
+  while (true)
+  {
+    Request request;
+    {
+      const std::lock_guard<std::mutex> lock(context->mutex);
+      if (!context->decimator || !context->request.has_value())
+      {
+        context->is_scheduled = false;
+        return;
+      }
+      request = std::move(context->request.value());
+      context->request.reset();
+    }
+
+    if (request.waveform->id != context->waveform_id)
+    {
+      context->waveform_id = request.waveform->id;
+      context->pyramid.SetData(request.waveform->x, request.waveform->y);
+    }
+    ApplyPointUpdates(*context);
+
+    auto result = std::make_shared<DecimatedData>(
+        context->pyramid.GetPoints(request.xmin, request.xmax, request.pixel_count));
+
+    const std::lock_guard<std::mutex> lock(context->mutex);
+    if (auto decimator = context->decimator; decimator)
+    {
+      auto on_result = [decimator, id = request.id, result]() { decimator->OnResult(id, *result); };
+      QMetaObject::invokeMethod(decimator->m_receiver.get(), on_result, Qt::QueuedConnection);
+    }
+  }
+}
+
+void LineSeriesDecimator::ApplyPointUpdates(Context& context)
+{
+  const auto waveform_id = context.waveform_id;
+
+  const std::lock_guard<std::mutex> lock(context.mutex);
+  for (const auto& update : context.point_updates)
+  {
+    if (update.waveform_id == waveform_id)
+    {
+      context.pyramid.SetPoint(update.index, update.x, update.y);
+    }
+  }
+
+  auto is_processed = [waveform_id](const auto& update)
+  { return update.waveform_id <= waveform_id; };
+  context.point_updates.erase(
+      std::remove_if(context.point_updates.begin(), context.point_updates.end(), is_processed),
+      context.point_updates.end());
+}
+
+void LineSeriesDecimator::OnResult(std::uint64_t id, const DecimatedData& data)
+{
+  // results of outdated requests are dropped
+  if (id != m_last_request_id)
+  {
+    return;
+  }
+
+  m_delivered_request_id = id;
+  m_callback(data);
+}
+
+}  // namespace mvvm
@@ -0,0 +1,152 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_PLOTTING_CHARTS_LINE_SERIES_DECIMATOR_H_
+#define MVVM_PLOTTING_CHARTS_LINE_SERIES_DECIMATOR_H_
+
+#include <mvvm/utils/minmax_pyramid.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+class QObject;
+
+namespace mvvm
+{
+
+/**
+ * @brief The LineSeriesDecimator class performs decimation of a large waveform in a background
+ * thread.
+ *
+ * The level-of-detail pyramid is built, and the per-pixel min/max envelope of the requested range
+ * is computed in a thread of the pool shared by all decimators. Requests of one decimator are
+ * processed one at a time. The result is delivered to the callback in the thread where the
+ * decimator was created, via Qt event loop. Only the latest request matters: requests which
+ * weren't started yet are replaced by newer ones, and outdated results are dropped.
+ */
+class LineSeriesDecimator
+{
+public:
+  using callback_t = std::function<void(const DecimatedData&)>;
+
+  /**
+   * @brief Main constructor.
+   *
+   * @param callback The callback to receive decimated points, called from the event loop.
+   */
+  explicit LineSeriesDecimator(callback_t callback);
+  ~LineSeriesDecimator();
+
+  LineSeriesDecimator(const LineSeriesDecimator& other) = delete;
+  LineSeriesDecimator& operator=(const LineSeriesDecimator& other) = delete;
+
+  /**
+   * @brief Sets the waveform, the pyramid will be rebuilt on the next request.
+   */
+  void SetData(std::vector<double> x, std::vector<double> y);
+
+  /**
+   * @brief Sets new coordinates of the point of the current waveform.
+   *
+   * The pyramid in the worker thread is updated in place on the next request.
+   */
+  void SetPoint(std::size_t index, double x, double y);
+
+  /**
+   * @brief Requests decimated points of the given range.
+   */
+  void RequestPoints(double xmin, double xmax, std::size_t pixel_count);
+
+  /**
+   * @brief Checks if the result of the latest request wasn't delivered yet.
+   */
+  bool IsPending() const;
+
+private:
+  struct Waveform
+  {
+    std::vector<double> x;
+    std::vector<double> y;
+    std::uint64_t id{0};
+  };
+
+  struct PointUpdate
+  {
+    std::uint64_t waveform_id{0};
+    std::size_t index{0};
+    double x{0.0};
+    double y{0.0};
+  };
+
+  struct Request
+  {
+    std::shared_ptr<const Waveform> waveform;
+    double xmin{0.0};
+    double xmax{0.0};
+    std::size_t pixel_count{0};
+    std::uint64_t id{0};
+  };
+
+  /**
+   * @brief The Context struct holds the state shared with tasks running in the pool.
+   *
+   * The context outlives the decimator while its task is queued or running in the pool.
+   */
+  struct Context
+  {
+    std::mutex mutex;  //!< guards all members except the pyramid
+    std::optional<Request> request;          //!< the latest request which wasn't started yet
+    std::vector<PointUpdate> point_updates;  //!< updates not yet applied to the pyramid
+    LineSeriesDecimator* decimator{nullptr};  //!< reset when the decimator is destroyed
+    bool is_scheduled{false};                 //!< the task is queued or running
+
+    std::uint64_t waveform_id{0};  //!< id of the waveform in the pyramid
+    MinMaxPyramid pyramid;         //!< accessed by the running task only
+  };
+
+  /**
+   * @brief Processes requests of the given context until none is left. Method is intended for
+   * execution in a thread of the pool.
+   */
+  static void ProcessRequests(const std::shared_ptr<Context>& context);
+
+  /**
+   * @brief Applies point updates of the waveform in the pyramid. Updates of older waveforms
+   * are dropped, updates of newer ones are kept until their waveform is processed.
+   */
+  static void ApplyPointUpdates(Context& context);
+
+  void OnResult(std::uint64_t id, const DecimatedData& data);
+
+  callback_t m_callback;
+  std::unique_ptr<QObject> m_receiver;  //!< context of delivered results, lives in caller thread
+  std::shared_ptr<const Waveform> m_waveform;
+  std::uint64_t m_last_waveform_id{0};
+  std::uint64_t m_last_request_id{0};
+  std::uint64_t m_delivered_request_id{0};
+  std::shared_ptr<Context> m_context;
+};
+
+}  // namespace mvvm
+
+#endif  // MVVM_PLOTTING_CHARTS_LINE_SERIES_DECIMATOR_H_
@@ -20,6 +20,8 @@
 
 #include "axis_title_controller.h"
 
+#include "custom_plot_utils.h"
+
 #include <mvvm/standarditems/plottable_items.h>
 
 #include <qcustomplot.h>
@@ -47,7 +49,7 @@ struct AxisTitleController::AxisTitleControllerImpl
     m_axis->setLabel(QString::fromStdString(item->GetText()));
     m_axis->setLabelFont(font);
 
-    m_axis->parentPlot()->replot();
+    utils::ScheduleReplot(m_axis->parentPlot());
   }
 };
 
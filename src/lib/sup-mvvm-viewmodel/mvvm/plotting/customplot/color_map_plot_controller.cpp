@@ -0,0 +1,351 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "color_map_plot_controller.h"
+
+#include "custom_plot_utils.h"
+
+#include <mvvm/core/mvvm_exceptions.h>
+#include <mvvm/signals/item_listener.h>
+#include <mvvm/standarditems/axis_items.h>
+#include <mvvm/standarditems/data2d_item.h>
+#include <mvvm/utils/tile_pyramid.h>
+
+#include <qcustomplot.h>
+
+#include <QObject>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+
+//! The number of pixels along each axis used to choose the level while the plot is not laid out.
+const int kDefaultPixelCount = 1000;
+
+//! Returns the range of bin indices [begin, end) covering given coordinate range.
+std::pair<std::size_t, std::size_t> FindBinRange(const QCPRange& range, double origin,
+                                                 double bin_width, std::size_t bin_count)
+{
+  if (bin_width <= 0.0)
+  {
+    return {0, bin_count};
+  }
+
+  auto to_index = [bin_count](double value)
+  { return static_cast<std::size_t>(std::clamp(value, 0.0, static_cast<double>(bin_count))); };
+
+  return {to_index(std::floor((range.lower - origin) / bin_width)),
+          to_index(std::ceil((range.upper - origin) / bin_width))};
+}
+
+}  // namespace
+
+using namespace mvvm;
+
+struct ColorMapPlotController::ColorMapPlotControllerImpl
+{
+  //! Equidistant binning of one axis.
+  struct Binning
+  {
+    double origin{0.0};
+    double bin_width{0.0};
+    std::size_t bin_count{0};
+  };
+
+  QCPColorMap* m_color_map{nullptr};
+  Data2DItem* m_item{nullptr};
+  std::vector<std::unique_ptr<ItemListener>> m_axis_listeners;
+  TilePyramid m_pyramid;
+  Binning m_x_binning;
+  Binning m_y_binning;
+  std::size_t m_level{0};
+  DataRegion m_displayed_region;  //!< region of cells of the current level shown on color map
+  std::unique_ptr<QMetaObject::Connection> m_key_range_connection;
+  std::unique_ptr<QMetaObject::Connection> m_value_range_connection;
+  std::unique_ptr<QMetaObject::Connection> m_layout_connection;
+
+  explicit ColorMapPlotControllerImpl(QCPColorMap* color_map)
+      : m_color_map(color_map)
+      , m_key_range_connection(std::make_unique<QMetaObject::Connection>())
+      , m_value_range_connection(std::make_unique<QMetaObject::Connection>())
+      , m_layout_connection(std::make_unique<QMetaObject::Connection>())
+  {
+    if (!m_color_map)
+    {
+      throw RuntimeException("Error in ColorMapPlotController: uninitialised color map");
+    }
+  }
+
+  ~ColorMapPlotControllerImpl() { SetDisconnected(); }
+
+  //! Connects to axes and the plot layout to update visible cells on range and size changes.
+  void SetConnected()
+  {
+    using range_signal_t = void (QCPAxis::*)(const QCPRange&);
+    auto on_range_changed = [this](const QCPRange&) { UpdateVisibleCells(); };
+    *m_key_range_connection = QObject::connect(
+        m_color_map->keyAxis(), static_cast<range_signal_t>(&QCPAxis::rangeChanged),
+        on_range_changed);
+    *m_value_range_connection = QObject::connect(
+        m_color_map->valueAxis(), static_cast<range_signal_t>(&QCPAxis::rangeChanged),
+        on_range_changed);
+
+    // layout is updated during replot, before drawing, so new cells are drawn immediately
+    auto on_layout = [this]() { UpdateVisibleCells(); };
+    *m_layout_connection = QObject::connect(GetCustomPlot(), &QCustomPlot::afterLayout, on_layout);
+  }
+
+  void SetDisconnected()
+  {
+    QObject::disconnect(*m_key_range_connection);
+    QObject::disconnect(*m_value_range_connection);
+    QObject::disconnect(*m_layout_connection);
+  }
+
+  void InitColorMapFromItem(Data2DItem* item)
+  {
+    assert(item);
+    m_item = item;
+    SetConnected();
+    SetAxesConnected();
+    UpdateColorMapFromItem();
+  }
+
+  //! Listens to changes of both axes, since they define the binning and the size of the data.
+  void SetAxesConnected()
+  {
+    m_axis_listeners.clear();
+    auto on_axis_change = [this](const event_variant_t&) { UpdateColorMapFromItem(); };
+    for (auto axis : {m_item->GetXAxis(), m_item->GetYAxis()})
+    {
+      if (axis)
+      {
+        auto listener = std::make_unique<ItemListener>(axis);
+        listener->Connect<DataChangedEvent>(on_axis_change);
+        listener->Connect<PropertyChangedEvent>(on_axis_change);
+        m_axis_listeners.push_back(std::move(listener));
+      }
+    }
+  }
+
+  //! Rebuilds the pyramid from item's data and axes. While the size of the data doesn't match
+  //! axes, the color map is empty.
+  void UpdateColorMapFromItem()
+  {
+    m_x_binning = GetBinning(m_item->GetXAxis());
+    m_y_binning = GetBinning(m_item->GetYAxis());
+    if (IsConsistent())
+    {
+      m_pyramid.SetSize(m_item->GetXSize(), m_item->GetYSize());
+    }
+    else
+    {
+      m_pyramid.SetSize(0, 0);
+    }
+    UpdateVisibleCells(/*force*/ true);
+    UpdateDataRange();
+  }
+
+  //! Updates tiles and cells of the region changed in place.
+  void UpdateColorMapRegion(const DataRegion& region)
+  {
+    if (!IsConsistent() || m_pyramid.GetSizeX() != m_item->GetXSize()
+        || m_pyramid.GetSizeY() != m_item->GetYSize())
+    {
+      UpdateColorMapFromItem();
+      return;
+    }
+
+    m_pyramid.InvalidateRegion(region);
+    UpdateCells(m_pyramid.ToLevelRegion(region, m_level).Intersected(m_displayed_region));
+    UpdateDataRange();
+  }
+
+  //! Checks if the size of item's data matches axes.
+  bool IsConsistent() const
+  {
+    return m_item->GetValuesArray().size() == m_item->GetXSize() * m_item->GetYSize();
+  }
+
+  void UpdateDataRange()
+  {
+    const auto range = m_item->GetValuesRange();
+    if (!range.IsEmpty())
+    {
+      m_color_map->setDataRange(QCPRange(range.min, range.max));
+    }
+    utils::ScheduleReplot(GetCustomPlot());
+  }
+
+  //! Passes to the color map cells of the visible region, taken from the level matching the
+  //! number of pixels. Nothing is done if neither the region nor the level has changed.
+  void UpdateVisibleCells(bool force = false)
+  {
+    const auto [x_begin, x_end] =
+        FindBinRange(m_color_map->keyAxis()->range(), m_x_binning.origin, m_x_binning.bin_width,
+                     m_x_binning.bin_count);
+    const auto [y_begin, y_end] =
+        FindBinRange(m_color_map->valueAxis()->range(), m_y_binning.origin,
+                     m_y_binning.bin_width, m_y_binning.bin_count);
+    const DataRegion visible{x_begin, y_begin, x_end, y_end};
+
+    const auto level = m_pyramid.FindLevel(visible, GetPixelCount(m_color_map->keyAxis()),
+                                           GetPixelCount(m_color_map->valueAxis()));
+    const auto level_region = m_pyramid.ToLevelRegion(visible, level);
+    if (!force && level == m_level && level_region == m_displayed_region)
+    {
+      return;
+    }
+
+    m_level = level;
+    m_displayed_region = level_region;
+
+    auto data = m_color_map->data();
+    data->setSize(static_cast<int>(level_region.GetWidth()),
+                  static_cast<int>(level_region.GetHeight()));
+    data->setRange(GetCellCentersRange(m_x_binning, level_region.x_begin, level_region.x_end),
+                   GetCellCentersRange(m_y_binning, level_region.y_begin, level_region.y_end));
+    UpdateCells(level_region);
+  }
+
+  //! Copies values of the given region of cells of the current level to the color map.
+  void UpdateCells(const DataRegion& region)
+  {
+    if (region.IsEmpty())
+    {
+      return;
+    }
+
+    const auto values = m_pyramid.GetValues(m_item->GetValuesArray(), m_level, region);
+    auto data = m_color_map->data();
+    auto value = values.begin();
+    for (auto y = region.y_begin; y < region.y_end; ++y)
+    {
+      for (auto x = region.x_begin; x < region.x_end; ++x)
+      {
+        data->setCell(static_cast<int>(x - m_displayed_region.x_begin),
+                      static_cast<int>(y - m_displayed_region.y_begin), *value++);
+      }
+    }
+  }
+
+  //! Returns the range of centers of cells [begin, end) of the current level.
+  QCPRange GetCellCentersRange(const Binning& binning, std::size_t begin, std::size_t end) const
+  {
+    const double cell_width = binning.bin_width * static_cast<double>(std::size_t{1} << m_level);
+    return {binning.origin + (static_cast<double>(begin) + 0.5) * cell_width,
+            binning.origin + (static_cast<double>(end) - 0.5) * cell_width};
+  }
+
+  void ResetColorMap()
+  {
+    SetDisconnected();
+    m_axis_listeners.clear();
+    m_item = nullptr;
+    m_pyramid.SetSize(0, 0);
+    m_level = 0;
+    m_displayed_region = {};
+    m_color_map->data()->clear();
+    utils::ScheduleReplot(GetCustomPlot());
+  }
+
+  //! Returns the binning of the axis. Bins are centered at bin centers of the axis, the width is
+  //! the distance between neighbouring centers, so it is valid for pointwise axes too.
+  static Binning GetBinning(const BinnedAxisItem* axis)
+  {
+    if (!axis || axis->GetSize() <= 0)
+    {
+      return {};
+    }
+    const auto count = static_cast<std::size_t>(axis->GetSize());
+    const auto centers = axis->GetBinCentersRange();
+    double bin_width =
+        count > 1 ? (centers.max - centers.min) / static_cast<double>(count - 1) : 0.0;
+    if (!(bin_width > 0.0))
+    {
+      // a single bin takes the whole axis range, or the unit width around a single point
+      const auto [min, max] = axis->GetRange();
+      bin_width = max > min ? max - min : 1.0;
+    }
+    return {centers.min - bin_width / 2.0, bin_width, count};
+  }
+
+  static std::size_t GetPixelCount(const QCPAxis* axis)
+  {
+    const int size = axis->orientation() == Qt::Horizontal ? axis->axisRect()->width()
+                                                           : axis->axisRect()->height();
+    return static_cast<std::size_t>(size > 0 ? size : kDefaultPixelCount);
+  }
+
+  QCustomPlot* GetCustomPlot()
+  {
+    assert(m_color_map);
+    return m_color_map->parentPlot();
+  }
+};
+
+ColorMapPlotController::ColorMapPlotController(QCPColorMap* color_map)
+    : p_impl(std::make_unique<ColorMapPlotControllerImpl>(color_map))
+{
+}
+
+ColorMapPlotController::~ColorMapPlotController() = default;
+
+std::size_t ColorMapPlotController::GetDisplayedLevel() const
+{
+  return p_impl->m_level;
+}
+
+void ColorMapPlotController::Subscribe()
+{
+  auto on_property_change = [this](const event_variant_t& event)
+  {
+    auto concrete_event = std::get<PropertyChangedEvent>(event);
+    if (concrete_event.name == Data2DItem::kValues)
+    {
+      p_impl->UpdateColorMapFromItem();
+    }
+  };
+  Listener()->Connect<PropertyChangedEvent>(on_property_change);
+
+  auto on_region_change = [this](const DataRegionChangedEvent& event)
+  { p_impl->UpdateColorMapRegion(event.region); };
+  Listener()->Connect<DataRegionChangedEvent>(on_region_change);
+
+  // axes can be inserted after the item was set, or removed on undo
+  auto on_axes_change = [this](const event_variant_t&)
+  {
+    p_impl->SetAxesConnected();
+    p_impl->UpdateColorMapFromItem();
+  };
+  Listener()->Connect<ItemInsertedEvent>(on_axes_change);
+  Listener()->Connect<ItemRemovedEvent>(on_axes_change);
+  Listener()->Connect<ItemsInsertedEvent>(on_axes_change);
+  Listener()->Connect<ItemsRemovedEvent>(on_axes_change);
+
+  p_impl->InitColorMapFromItem(GetItem());
+}
+
+void ColorMapPlotController::Unsubscribe()
+{
+  p_impl->ResetColorMap();
+}
@@ -0,0 +1,63 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_PLOTTING_CUSTOMPLOT_COLOR_MAP_PLOT_CONTROLLER_H_
+#define MVVM_PLOTTING_CUSTOMPLOT_COLOR_MAP_PLOT_CONTROLLER_H_
+
+#include <mvvm/signals/item_controller.h>
+#include <mvvm/view_export.h>
+
+#include <memory>
+
+class QCPColorMap;
+
+namespace mvvm
+{
+
+class Data2DItem;
+
+//! Establishes communication between QCPColorMap and Data2DItem.
+//! Only cells of the visible axes range are passed to the color map. They are taken from the
+//! multi-resolution pyramid of tiles at the level matching the size of the axis rectangle, so pan
+//! and zoom compute only visible tiles. Region updates of the item are applied to the cells of the
+//! region only, changes of axes rebuild the color map. Bins of both axes are assumed to be
+//! equidistant, bins of pointwise axes are centered at their points.
+
+class MVVM_VIEW_EXPORT ColorMapPlotController : public ItemController<Data2DItem>
+{
+public:
+  explicit ColorMapPlotController(QCPColorMap* color_map);
+  ~ColorMapPlotController() override;
+
+  //! Returns the level of the pyramid currently shown, 0 corresponds to the original data.
+  std::size_t GetDisplayedLevel() const;
+
+protected:
+  void Subscribe() override;
+  void Unsubscribe() override;
+
+private:
+  struct ColorMapPlotControllerImpl;
+  std::unique_ptr<ColorMapPlotControllerImpl> p_impl;
+};
+
+}  // namespace mvvm
+
+#endif  // MVVM_PLOTTING_CUSTOMPLOT_COLOR_MAP_PLOT_CONTROLLER_H_
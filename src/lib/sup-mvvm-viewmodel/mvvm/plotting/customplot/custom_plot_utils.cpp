@@ -20,6 +20,8 @@
 
 #include "custom_plot_utils.h"
 
+#include "replot_scheduler.h"
+
 #include <qcustomplot.h>
 
 namespace mvvm::utils
@@ -59,4 +61,9 @@ void SetLogarithmicScale(QCPAxis* axis, bool is_log_scale)
   }
 }
 
+void ScheduleReplot(QCustomPlot* custom_plot)
+{
+  ReplotScheduler::GetScheduler(custom_plot)->ScheduleReplot();
+}
+
 }  // namespace mvvm::utils
@@ -25,6 +25,7 @@
 
 class QCPColorScale;
 class QCPAxis;
+class QCustomPlot;
 
 namespace mvvm::utils
 {
@@ -35,6 +36,9 @@ MVVM_VIEW_EXPORT void SetLogarithmicScale(QCPColorScale* axis, bool is_log_scale
 //! Switch axis to logarithmic scale mode.
 MVVM_VIEW_EXPORT void SetLogarithmicScale(QCPAxis* axis, bool is_log_scale);
 
+//! Requests replot of the canvas on the next frame. Requests of all controllers are coalesced.
+MVVM_VIEW_EXPORT void ScheduleReplot(QCustomPlot* custom_plot);
+
 }  // namespace mvvm::utils
 
 #endif  // MVVM_PLOTTING_CUSTOMPLOT_CUSTOM_PLOT_UTILS_H_
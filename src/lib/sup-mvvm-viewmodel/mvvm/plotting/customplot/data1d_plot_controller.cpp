@@ -20,10 +20,15 @@
 
 #include "data1d_plot_controller.h"
 
+#include "custom_plot_utils.h"
+
 #include <mvvm/standarditems/data1d_item.h>
+#include <mvvm/utils/minmax_pyramid.h>
 
 #include <qcustomplot.h>
 
+#include <QObject>
+
 namespace
 {
 template <typename T>
@@ -35,6 +40,13 @@ QVector<T> fromStdVector(const std::vector<T>& vec)
   return QVector<T>::fromStdVector(vec);
 #endif
 }
+
+//! The number of pixels used for decimation while the plot is not laid out yet.
+const int kDefaultPixelCount = 2000;
+
+//! Data with fewer points per pixel is passed to the graph without decimation.
+const std::size_t kMaxPointsPerPixel = 2;
+
 }  // namespace
 
 using namespace mvvm;
@@ -43,8 +55,17 @@ struct Data1DPlotController::Data1DPlotControllerImpl
 {
   QCPGraph* m_graph{nullptr};
   QCPErrorBars* m_error_bars{nullptr};
-
-  explicit Data1DPlotControllerImpl(QCPGraph* graph) : m_graph(graph)
+  MinMaxPyramid m_pyramid;
+  std::vector<double> m_errors;
+  std::vector<std::size_t> m_visible_indices;  //!< indices of original points shown on graph
+  int m_pixel_count{0};
+  std::unique_ptr<QMetaObject::Connection> m_range_connection;
+  std::unique_ptr<QMetaObject::Connection> m_layout_connection;
+
+  explicit Data1DPlotControllerImpl(QCPGraph* graph)
+      : m_graph(graph)
+      , m_range_connection(std::make_unique<QMetaObject::Connection>())
+      , m_layout_connection(std::make_unique<QMetaObject::Connection>())
   {
     if (!m_graph)
     {
@@ -52,24 +73,71 @@ struct Data1DPlotController::Data1DPlotControllerImpl
     }
   }
 
+  ~Data1DPlotControllerImpl() { SetDisconnected(); }
+
+  //! Connects to the key axis and the plot layout to recompute visible points on range and size
+  //! changes. Key axis range is kept in sync with ViewportAxisItem by ViewportAxisPlotController.
+  void SetConnected()
+  {
+    auto on_range_changed = [this](const QCPRange&) { UpdateVisiblePoints(); };
+    *m_range_connection = QObject::connect(
+        m_graph->keyAxis(),
+        static_cast<void (QCPAxis::*)(const QCPRange&)>(&QCPAxis::rangeChanged), on_range_changed);
+
+    // layout is updated during replot, before drawing, so new points are drawn immediately
+    auto on_layout = [this]()
+    {
+      if (GetPixelCount() != m_pixel_count)
+      {
+        UpdateVisiblePoints();
+      }
+    };
+    *m_layout_connection = QObject::connect(GetCustomPlot(), &QCustomPlot::afterLayout, on_layout);
+  }
+
+  void SetDisconnected()
+  {
+    QObject::disconnect(*m_range_connection);
+    QObject::disconnect(*m_layout_connection);
+  }
+
   void InitGraphFromItem(Data1DItem* item)
   {
     assert(item);
+    SetConnected();
     UpdateGraphPointsFromItem(item);
     UpdateErrorBarsFromItem(item);
   }
 
+  //! Rebuilds level-of-detail pyramid from item's data. Values stored in a narrow numeric type
+  //! are widened by the item in one pass, straight into the vector owned by the pyramid.
   void UpdateGraphPointsFromItem(Data1DItem* item)
   {
-    m_graph->setData(fromStdVector<double>(item->GetBinCenters()),
-                     fromStdVector<double>(item->GetValues()));
-    GetCustomPlot()->replot();
+    m_pyramid.SetData(item->GetBinCenters(), item->GetValues());
+    UpdateVisiblePoints();
+    utils::ScheduleReplot(GetCustomPlot());
+  }
+
+  //! Passes to the graph only points visible in the current axis range, decimated to the
+  //! per-pixel min/max envelope. Small data sets are passed as is.
+  void UpdateVisiblePoints()
+  {
+    m_pixel_count = GetPixelCount();
+    const auto pixel_count = static_cast<std::size_t>(m_pixel_count);
+    auto range = m_graph->keyAxis()->range();
+    auto data = m_pyramid.GetSize() <= kMaxPointsPerPixel * pixel_count
+                    ? m_pyramid.GetPoints(pixel_count)
+                    : m_pyramid.GetPoints(range.lower, range.upper, pixel_count);
+    m_graph->setData(fromStdVector<double>(data.x), fromStdVector<double>(data.y),
+                     m_pyramid.IsSorted());
+    m_visible_indices = std::move(data.indices);
+    UpdateErrorBarsData();
   }
 
   void UpdateErrorBarsFromItem(Data1DItem* item)
   {
-    auto errors = item->GetErrors();
-    if (errors.empty())
+    m_errors = item->GetErrors();
+    if (m_errors.empty())
     {
       ResetErrorBars();
       return;
@@ -80,22 +148,55 @@ struct Data1DPlotController::Data1DPlotControllerImpl
       m_error_bars = new QCPErrorBars(GetCustomPlot()->xAxis, GetCustomPlot()->yAxis);
     }
 
-    m_error_bars->setData(fromStdVector<double>(errors));
+    UpdateErrorBarsData();
     m_error_bars->setDataPlottable(m_graph);
   }
 
+  //! Error bars are indexed by graph points, so only errors of visible points are passed.
+  void UpdateErrorBarsData()
+  {
+    if (!m_error_bars)
+    {
+      return;
+    }
+
+    QVector<double> errors;
+    errors.reserve(static_cast<int>(m_visible_indices.size()));
+    for (auto index : m_visible_indices)
+    {
+      errors.push_back(index < m_errors.size() ? m_errors[index] : 0.0);
+    }
+    m_error_bars->setData(errors);
+  }
+
   void ResetGraph()
   {
+    SetDisconnected();
+    m_pyramid.SetData({}, {});
+    m_visible_indices.clear();
+    m_errors.clear();
+    ResetErrorBars();
     m_graph->setData(QVector<double>{}, QVector<double>{});
-    GetCustomPlot()->replot();
+    utils::ScheduleReplot(GetCustomPlot());
   }
 
+  //! Removes error bars from the plot. Graph may be reused by another controller, so error bars
+  //! shouldn't outlive the item.
   void ResetErrorBars()
   {
-    delete m_error_bars;
+    if (m_error_bars)
+    {
+      GetCustomPlot()->removePlottable(m_error_bars);
+    }
     m_error_bars = nullptr;
   }
 
+  int GetPixelCount() const
+  {
+    const int width = m_graph->keyAxis()->axisRect()->width();
+    return width > 0 ? width : kDefaultPixelCount;
+  }
+
   QCustomPlot* GetCustomPlot()
   {
     assert(m_graph);
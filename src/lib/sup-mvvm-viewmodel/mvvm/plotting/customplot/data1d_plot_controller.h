@@ -34,7 +34,8 @@ namespace mvvm
 class Data1DItem;
 
 //! Establishes communication between QCPGraph and Data1DItem.
-//! Provides update of data points on QCPGraph when Graph1DItem is changed.
+//! Provides update of data points on QCPGraph when Graph1DItem is changed. Only points of the
+//! visible key axis range are passed to the graph, decimated to per-pixel min/max envelope.
 
 class MVVM_VIEW_EXPORT Data1DPlotController : public ItemController<Data1DItem>
 {
@@ -20,12 +20,16 @@
 
 #include "graph_plot_controller.h"
 
+#include "custom_plot_utils.h"
 #include "data1d_plot_controller.h"
+#include "graph_pool.h"
 #include "pen_controller.h"
+#include "stream_data1d_plot_controller.h"
 
 #include <mvvm/standarditems/data1d_item.h>
 #include <mvvm/standarditems/graph_item.h>
 #include <mvvm/standarditems/plottable_items.h>
+#include <mvvm/standarditems/stream_data1d_item.h>
 
 #include <qcustomplot.h>
 
@@ -36,12 +40,14 @@ struct GraphPlotController::GraphItemControllerImpl
 {
   GraphPlotController* m_self{nullptr};
   QCustomPlot* m_custom_plot{nullptr};
+  GraphPool* m_graph_pool{nullptr};
   QCPGraph* m_graph{nullptr};
   std::unique_ptr<Data1DPlotController> m_data_controller;
+  std::unique_ptr<StreamData1DPlotController> m_stream_data_controller;
   std::unique_ptr<PenController> m_pen_controller;
 
-  GraphItemControllerImpl(GraphPlotController* master, QCustomPlot* plot)
-      : m_self(master), m_custom_plot(plot)
+  GraphItemControllerImpl(GraphPlotController* master, QCustomPlot* plot, GraphPool* graph_pool)
+      : m_self(master), m_custom_plot(plot), m_graph_pool(graph_pool)
   {
   }
 
@@ -49,8 +55,9 @@ struct GraphPlotController::GraphItemControllerImpl
 
   void InitGraph()
   {
-    m_graph = m_custom_plot->addGraph();
+    m_graph = m_graph_pool ? m_graph_pool->Acquire() : m_custom_plot->addGraph();
     m_data_controller = std::make_unique<Data1DPlotController>(m_graph);
+    m_stream_data_controller = std::make_unique<StreamData1DPlotController>(m_graph);
     m_pen_controller = std::make_unique<PenController>(m_graph);
 
     UpdateDataController();
@@ -62,13 +69,33 @@ struct GraphPlotController::GraphItemControllerImpl
   {
     if (m_graph)
     {
-      m_custom_plot->removePlottable(m_graph);
+      // a graph going to the pool shouldn't keep anything of the previous item
+      if (m_graph_pool)
+      {
+        ResetComponents();
+      }
+      ReleaseGraph();
     }
   }
 
   GraphItem* GetGraphItem() { return m_self->GetItem(); }
 
-  void UpdateDataController() { m_data_controller->SetItem(GetGraphItem()->GetDataItem()); }
+  //! Passes linked data item to the controller serving its type.
+  void UpdateDataController()
+  {
+    auto data_item = GetGraphItem()->GetDataItem();
+    if (auto stream_data_item = dynamic_cast<StreamData1DItem*>(data_item); stream_data_item)
+    {
+      // the controller losing its item clears the graph, so it goes first
+      m_data_controller->SetItem(nullptr);
+      m_stream_data_controller->SetItem(stream_data_item);
+    }
+    else
+    {
+      m_stream_data_controller->SetItem(nullptr);
+      m_data_controller->SetItem(data_item);
+    }
+  }
 
   //! Updates graph pen from GraphItem.
 
@@ -78,16 +105,35 @@ struct GraphPlotController::GraphItemControllerImpl
   void UpdateVisibility()
   {
     m_graph->setVisible(GetGraphItem()->Property<bool>(GraphItem::kDisplayed));
-    m_custom_plot->replot();
+    utils::ScheduleReplot(m_custom_plot);
   }
 
   void ResetGraph()
+  {
+    ResetComponents();
+    ReleaseGraph();
+    utils::ScheduleReplot(m_custom_plot);
+  }
+
+  void ResetComponents()
   {
     m_data_controller->SetItem(nullptr);
+    m_stream_data_controller->SetItem(nullptr);
     m_pen_controller->SetItem(nullptr);
-    m_custom_plot->removePlottable(m_graph);
+  }
+
+  //! Returns the graph to the pool, if any, or removes it from the plot.
+  void ReleaseGraph()
+  {
+    if (m_graph_pool)
+    {
+      m_graph_pool->Release(m_graph);
+    }
+    else
+    {
+      m_custom_plot->removePlottable(m_graph);
+    }
     m_graph = nullptr;
-    m_custom_plot->replot();
   }
 
   void OnPropertyChanged(const PropertyChangedEvent& event)
@@ -104,8 +150,8 @@ struct GraphPlotController::GraphItemControllerImpl
   }
 };
 
-GraphPlotController::GraphPlotController(QCustomPlot* custom_plot)
-    : p_impl(std::make_unique<GraphItemControllerImpl>(this, custom_plot))
+GraphPlotController::GraphPlotController(QCustomPlot* custom_plot, GraphPool* graph_pool)
+    : p_impl(std::make_unique<GraphItemControllerImpl>(this, custom_plot, graph_pool))
 {
 }
 
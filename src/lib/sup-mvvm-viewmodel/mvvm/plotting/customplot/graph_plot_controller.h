@@ -32,16 +32,18 @@ namespace mvvm
 {
 
 class GraphItem;
+class GraphPool;
 
 //! Establish communication between QCPGraph and GraphItem.
 //! Provides update on QCPGraph (data points, line style, color, etc) when GraphItem is changed.
 //! QCPGraph is added to QCustomPlot plottables, when controller is created, and removed from
-//! plottables when controller is destroyed.
+//! plottables when controller is destroyed. If the pool of graphs is given, QCPGraph is taken from
+//! the pool, and returned to it instead of removal.
 
 class MVVM_VIEW_EXPORT GraphPlotController : public ItemController<GraphItem>
 {
 public:
-  explicit GraphPlotController(QCustomPlot* plot);
+  explicit GraphPlotController(QCustomPlot* plot, GraphPool* graph_pool = nullptr);
   ~GraphPlotController() override;
 
 protected:
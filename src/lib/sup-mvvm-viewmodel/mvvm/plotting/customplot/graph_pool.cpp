@@ -0,0 +1,120 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "graph_pool.h"
+
+#include <mvvm/core/mvvm_exceptions.h>
+
+#include <qcustomplot.h>
+
+namespace mvvm
+{
+
+GraphPool::GraphPool(QCustomPlot* custom_plot, std::size_t capacity)
+    : m_custom_plot(custom_plot), m_capacity(capacity)
+{
+  if (!m_custom_plot)
+  {
+    throw RuntimeException("Error in GraphPool: uninitialised custom plot");
+  }
+}
+
+GraphPool::~GraphPool()
+{
+  Clear();
+}
+
+QCPGraph* GraphPool::Acquire()
+{
+  if (m_idle_graphs.empty())
+  {
+    return m_custom_plot->addGraph();
+  }
+
+  auto result = m_idle_graphs.back();
+  m_idle_graphs.pop_back();
+  result->setVisible(true);
+  // z-order of the graph is the order of addition to the layer
+  result->setLayer(m_custom_plot->currentLayer());
+  if (m_custom_plot->autoAddPlottableToLegend())
+  {
+    result->addToLegend();
+  }
+  return result;
+}
+
+void GraphPool::Release(QCPGraph* graph)
+{
+  if (!graph)
+  {
+    return;
+  }
+
+  if (m_idle_graphs.size() >= m_capacity)
+  {
+    m_custom_plot->removePlottable(graph);
+    return;
+  }
+
+  graph->data()->clear();
+  graph->setName(QString());
+  graph->setSelection(QCPDataSelection());
+  graph->setVisible(false);
+  graph->removeFromLegend();
+  m_idle_graphs.push_back(graph);
+}
+
+std::size_t GraphPool::GetIdleCount() const
+{
+  return m_idle_graphs.size();
+}
+
+std::size_t GraphPool::GetCapacity() const
+{
+  return m_capacity;
+}
+
+void GraphPool::SetCapacity(std::size_t capacity)
+{
+  m_capacity = capacity;
+  if (m_idle_graphs.size() > m_capacity)
+  {
+    RemoveIdleGraphs(m_idle_graphs.size() - m_capacity);
+  }
+}
+
+void GraphPool::Clear()
+{
+  RemoveIdleGraphs(m_idle_graphs.size());
+}
+
+//! Removes given number of graphs, released first.
+void GraphPool::RemoveIdleGraphs(std::size_t count)
+{
+  const auto begin = m_idle_graphs.begin();
+  const auto end = begin + static_cast<std::ptrdiff_t>(count);
+  for (auto it = begin; it != end; ++it)
+  {
+    m_custom_plot->removePlottable(*it);
+  }
+  m_idle_graphs.erase(begin, end);
+}
+
+}  // namespace mvvm
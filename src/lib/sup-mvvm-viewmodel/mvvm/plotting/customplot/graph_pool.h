@@ -0,0 +1,84 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_PLOTTING_CUSTOMPLOT_GRAPH_POOL_H_
+#define MVVM_PLOTTING_CUSTOMPLOT_GRAPH_POOL_H_
+
+#include <mvvm/view_export.h>
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+class QCustomPlot;
+class QCPGraph;
+
+namespace mvvm
+{
+
+//! Keeps QCPGraph objects released by graph controllers for reuse.
+//! QCustomPlot deletes graphs on removal, and the removal is linear in the number of plottables.
+//! Released graphs are cleared and hidden instead, and are handed out again on next request. Idle
+//! graphs stay in the plot, and are counted by QCustomPlot::graphCount(), until the pool is
+//! cleared or destroyed. The number of idle graphs is limited by the capacity, graphs released
+//! above it are removed from the plot.
+
+class MVVM_VIEW_EXPORT GraphPool
+{
+public:
+  static inline const std::size_t kUnlimitedCapacity = std::numeric_limits<std::size_t>::max();
+
+  explicit GraphPool(QCustomPlot* custom_plot, std::size_t capacity = kUnlimitedCapacity);
+  ~GraphPool();
+
+  GraphPool(const GraphPool& other) = delete;
+  GraphPool& operator=(const GraphPool& other) = delete;
+
+  //! Returns idle graph if there is one, creates new graph otherwise. Reused graph is placed on
+  //! top of the current layer and at the end of the legend, as a new graph would be.
+  QCPGraph* Acquire();
+
+  //! Clears and hides the graph, and keeps it for reuse. If the pool is full, removes the graph
+  //! from the plot.
+  void Release(QCPGraph* graph);
+
+  //! Returns the maximum number of graphs waiting for reuse.
+  std::size_t GetCapacity() const;
+
+  //! Sets the maximum number of graphs waiting for reuse, extra idle graphs are removed.
+  void SetCapacity(std::size_t capacity);
+
+  //! Returns the number of graphs waiting for reuse.
+  std::size_t GetIdleCount() const;
+
+  //! Removes idle graphs from the plot.
+  void Clear();
+
+private:
+  void RemoveIdleGraphs(std::size_t count);
+
+  QCustomPlot* m_custom_plot{nullptr};
+  std::size_t m_capacity{kUnlimitedCapacity};
+  std::vector<QCPGraph*> m_idle_graphs;
+};
+
+}  // namespace mvvm
+
+#endif  // MVVM_PLOTTING_CUSTOMPLOT_GRAPH_POOL_H_
@@ -20,7 +20,9 @@
 
 #include "graph_viewport_plot_controller.h"
 
+#include "custom_plot_utils.h"
 #include "graph_plot_controller.h"
+#include "graph_pool.h"
 #include "viewport_axis_plot_controller.h"
 
 #include <mvvm/standarditems/axis_items.h>
@@ -29,7 +31,7 @@
 
 #include <qcustomplot.h>
 
-#include <list>
+#include <unordered_map>
 
 namespace mvvm
 {
@@ -38,12 +40,13 @@ struct GraphViewportPlotController::GraphViewportPlotControllerImpl
 {
   GraphViewportPlotController* m_self{nullptr};
   QCustomPlot* m_custom_plot{nullptr};
-  std::list<std::unique_ptr<GraphPlotController>> m_graph_controllers;
+  GraphPool m_graph_pool;  //!< declared before controllers, which return graphs to it on deletion
+  std::unordered_map<const SessionItem*, std::unique_ptr<GraphPlotController>> m_graph_controllers;
   std::unique_ptr<ViewportAxisPlotController> m_xaxis_controller;
   std::unique_ptr<ViewportAxisPlotController> m_yaxis_controller;
 
   GraphViewportPlotControllerImpl(GraphViewportPlotController* master, QCustomPlot* plot)
-      : m_self(master), m_custom_plot(plot)
+      : m_self(master), m_custom_plot(plot), m_graph_pool(plot, 0)
   {
   }
 
@@ -75,35 +78,56 @@ struct GraphViewportPlotController::GraphViewportPlotControllerImpl
   {
     m_graph_controllers.clear();
     auto viewport = GetViewportItem();
-    for (auto graph_item : viewport->GetGraphItems())
+    const auto graph_items = viewport->GetGraphItems();
+    m_graph_controllers.reserve(graph_items.size());
+    for (auto graph_item : graph_items)
     {
-      auto controller = std::make_unique<GraphPlotController>(m_custom_plot);
-      controller->SetItem(graph_item);
-      m_graph_controllers.push_back(std::move(controller));
+      AddControllerForItem(graph_item);
     }
     viewport->SetViewportToContent();
   }
 
+  //! Removes graph controllers together with graphs kept for reuse.
+  void ResetGraphControllers()
+  {
+    m_graph_controllers.clear();
+    m_graph_pool.Clear();
+    utils::ScheduleReplot(m_custom_plot);
+  }
+
   //! Adds controller for item.
   void AddController(const ItemInsertedEvent& event)
   {
     const auto [parent, tagindex] = event;
 
-    auto added_child = dynamic_cast<GraphItem*>(parent->GetItem(tagindex));
+    AddControllerForItem(dynamic_cast<GraphItem*>(parent->GetItem(tagindex)));
+    utils::ScheduleReplot(m_custom_plot);
+  }
+
+  //! Adds controllers for a range of inserted items, replots once.
+  void AddControllers(const ItemsInsertedEvent& event)
+  {
+    m_graph_controllers.reserve(m_graph_controllers.size() + event.count);
+    for (std::size_t index = 0; index < event.count; ++index)
+    {
+      const TagIndex tagindex{event.tag_index.GetTag(),
+                              event.tag_index.GetIndex() + static_cast<int>(index)};
+      AddControllerForItem(dynamic_cast<GraphItem*>(event.item->GetItem(tagindex)));
+    }
+    utils::ScheduleReplot(m_custom_plot);
+  }
 
-    for (auto& controller : m_graph_controllers)
+  void AddControllerForItem(GraphItem* added_child)
+  {
+    auto [iter, is_inserted] = m_graph_controllers.try_emplace(added_child);
+    if (!is_inserted)
     {
-      if (controller->GetItem() == added_child)
-      {
-        throw RuntimeException(
-            "Error in GraphViewportPlotController: attempt to create second controller");
-      }
+      throw RuntimeException(
+          "Error in GraphViewportPlotController: attempt to create second controller");
     }
 
-    auto controller = std::make_unique<GraphPlotController>(m_custom_plot);
-    controller->SetItem(added_child);
-    m_graph_controllers.push_back(std::move(controller));
-    m_custom_plot->replot();
+    iter->second = std::make_unique<GraphPlotController>(m_custom_plot, &m_graph_pool);
+    iter->second->SetItem(added_child);
   }
 
   //! Remove GraphPlotController corresponding to GraphItem.
@@ -112,11 +136,21 @@ struct GraphViewportPlotController::GraphViewportPlotControllerImpl
   {
     const auto [parent, tagindex] = event;
 
-    auto child_about_to_be_removed = parent->GetItem(tagindex);
-    auto if_func = [&](const std::unique_ptr<GraphPlotController>& cntrl) -> bool
-    { return cntrl->GetItem() == child_about_to_be_removed; };
-    m_graph_controllers.remove_if(if_func);
-    m_custom_plot->replot();
+    m_graph_controllers.erase(parent->GetItem(tagindex));
+    utils::ScheduleReplot(m_custom_plot);
+  }
+
+  //! Remove GraphPlotControllers corresponding to a range of GraphItems, replots once.
+
+  void RemoveControllers(const AboutToRemoveItemsEvent& event)
+  {
+    for (std::size_t index = 0; index < event.count; ++index)
+    {
+      const TagIndex tagindex{event.tag_index.GetTag(),
+                              event.tag_index.GetIndex() + static_cast<int>(index)};
+      m_graph_controllers.erase(event.item->GetItem(tagindex));
+    }
+    utils::ScheduleReplot(m_custom_plot);
   }
 };
 
@@ -131,9 +165,23 @@ void GraphViewportPlotController::Subscribe()
                                          &GraphViewportPlotControllerImpl::AddController);
   Listener()->Connect<AboutToRemoveItemEvent>(p_impl.get(),
                                               &GraphViewportPlotControllerImpl::RemoveController);
+  Listener()->Connect<ItemsInsertedEvent>(p_impl.get(),
+                                          &GraphViewportPlotControllerImpl::AddControllers);
+  Listener()->Connect<AboutToRemoveItemsEvent>(p_impl.get(),
+                                               &GraphViewportPlotControllerImpl::RemoveControllers);
   p_impl->SetupComponents();
 }
 
+void GraphViewportPlotController::Unsubscribe()
+{
+  p_impl->ResetGraphControllers();
+}
+
 GraphViewportPlotController::~GraphViewportPlotController() = default;
 
+void GraphViewportPlotController::SetGraphPoolCapacity(std::size_t capacity)
+{
+  p_impl->m_graph_pool.SetCapacity(capacity);
+}
+
 }  // namespace mvvm
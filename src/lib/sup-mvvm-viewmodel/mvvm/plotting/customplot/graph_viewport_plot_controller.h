@@ -24,6 +24,7 @@
 #include <mvvm/signals/item_controller.h>
 #include <mvvm/view_export.h>
 
+#include <cstddef>
 #include <memory>
 
 class QCustomPlot;
@@ -34,7 +35,8 @@ namespace mvvm
 class GraphViewportItem;
 
 //! Establishes communications and mutual updates for GraphViewportItem and QCutomPlot.
-//! Populates custom plot with all graphs found in GraphViewportItem.
+//! Populates custom plot with all graphs found in GraphViewportItem. Graphs of removed GraphItems
+//! are removed from the plot, unless the graph pool capacity is set.
 
 class MVVM_VIEW_EXPORT GraphViewportPlotController : public ItemController<GraphViewportItem>
 {
@@ -42,8 +44,13 @@ public:
   explicit GraphViewportPlotController(QCustomPlot* plot);
   ~GraphViewportPlotController() override;
 
+  //! Sets the number of graphs of removed GraphItems kept hidden for reuse by graphs added later,
+  //! e.g. on undo. Hidden graphs are counted by QCustomPlot::graphCount(). Zero by default.
+  void SetGraphPoolCapacity(std::size_t capacity);
+
 protected:
   void Subscribe() override;
+  void Unsubscribe() override;
 
 private:
   struct GraphViewportPlotControllerImpl;
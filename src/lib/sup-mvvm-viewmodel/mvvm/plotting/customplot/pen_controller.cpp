@@ -20,6 +20,8 @@
 
 #include "pen_controller.h"
 
+#include "custom_plot_utils.h"
+
 #include <mvvm/model/combo_property.h>
 #include <mvvm/plotting/plot_helper.h>
 #include <mvvm/standarditems/plottable_items.h>
@@ -50,7 +52,7 @@ struct PenController::PenControllerImpl
     pen.setWidth(item->GetWidth());
     m_graph->setPen(pen);
 
-    m_graph->parentPlot()->replot();
+    utils::ScheduleReplot(m_graph->parentPlot());
   }
 };
 
@@ -0,0 +1,135 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "replot_scheduler.h"
+
+#include <mvvm/core/mvvm_exceptions.h>
+
+#include <qcustomplot.h>
+
+#include <QTimer>
+#include <algorithm>
+
+namespace mvvm
+{
+
+ReplotScheduler::ReplotScheduler(QCustomPlot* custom_plot)
+    : QObject(custom_plot), m_custom_plot(custom_plot), m_timer(new QTimer(this))
+{
+  if (!m_custom_plot)
+  {
+    throw RuntimeException("ReplotScheduler: uninitialised custom plot");
+  }
+
+  m_timer->setSingleShot(true);
+  connect(m_timer, &QTimer::timeout, this, &ReplotScheduler::PerformReplot);
+  connect(m_custom_plot, &QCustomPlot::afterReplot, this, &ReplotScheduler::OnAfterReplot);
+  m_last_replot_timer.start();
+}
+
+ReplotScheduler::~ReplotScheduler() = default;
+
+ReplotScheduler* ReplotScheduler::GetScheduler(QCustomPlot* custom_plot)
+{
+  if (auto result = custom_plot->findChild<ReplotScheduler*>(QString(), Qt::FindDirectChildrenOnly);
+      result)
+  {
+    return result;
+  }
+  return new ReplotScheduler(custom_plot);  // ownership is taken by the canvas
+}
+
+void ReplotScheduler::ScheduleReplot()
+{
+  ++m_requested_replot_count;
+
+  if (m_timer->isActive())
+  {
+    return;  // already scheduled for the next frame
+  }
+
+  const auto elapsed = static_cast<int>(m_last_replot_timer.elapsed());
+  m_timer->start(std::max(0, GetFrameInterval() - elapsed));
+}
+
+void ReplotScheduler::Flush()
+{
+  if (m_timer->isActive())
+  {
+    PerformReplot();
+  }
+}
+
+bool ReplotScheduler::IsReplotPending() const
+{
+  return m_timer->isActive();
+}
+
+void ReplotScheduler::SetMaxFrameRate(int value)
+{
+  if (value < 0)
+  {
+    throw RuntimeException("ReplotScheduler: negative frame rate");
+  }
+  m_max_frame_rate = value;
+}
+
+int ReplotScheduler::GetMaxFrameRate() const
+{
+  return m_max_frame_rate;
+}
+
+std::size_t ReplotScheduler::GetRequestedReplotCount() const
+{
+  return m_requested_replot_count;
+}
+
+std::size_t ReplotScheduler::GetPerformedReplotCount() const
+{
+  return m_performed_replot_count;
+}
+
+void ReplotScheduler::ResetCounters()
+{
+  m_requested_replot_count = 0;
+  m_performed_replot_count = 0;
+}
+
+void ReplotScheduler::PerformReplot()
+{
+  m_timer->stop();
+  ++m_performed_replot_count;
+  m_custom_plot->replot();
+}
+
+void ReplotScheduler::OnAfterReplot()
+{
+  // any replot, including the one triggered by QCustomPlot itself, draws all pending changes
+  m_timer->stop();
+  m_last_replot_timer.restart();
+}
+
+int ReplotScheduler::GetFrameInterval() const
+{
+  const int msec_in_sec = 1000;
+  return m_max_frame_rate > 0 ? msec_in_sec / m_max_frame_rate : 0;
+}
+
+}  // namespace mvvm
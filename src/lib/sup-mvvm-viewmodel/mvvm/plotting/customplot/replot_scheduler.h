@@ -0,0 +1,113 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_PLOTTING_CUSTOMPLOT_REPLOT_SCHEDULER_H_
+#define MVVM_PLOTTING_CUSTOMPLOT_REPLOT_SCHEDULER_H_
+
+#include <mvvm/view_export.h>
+
+#include <QElapsedTimer>
+#include <QObject>
+
+class QCustomPlot;
+class QTimer;
+
+namespace mvvm
+{
+
+/**
+ * @brief The ReplotScheduler class coalesces replot requests of all controllers serving the same
+ * QCustomPlot canvas.
+ *
+ * Controllers mark the canvas as dirty, and the scheduler performs a single replot at most once
+ * per frame interval, defined by the maximum frame rate. A replot performed by somebody else
+ * (i.e. by QCustomPlot itself on user interaction) satisfies pending requests too. The scheduler
+ * counts requested and performed replots for diagnostics.
+ *
+ * There is one scheduler per canvas, it is created on first request and owned by the canvas.
+ */
+class MVVM_VIEW_EXPORT ReplotScheduler : public QObject
+{
+  Q_OBJECT
+
+public:
+  static inline const int kDefaultMaxFrameRate = 60;
+
+  explicit ReplotScheduler(QCustomPlot* custom_plot);
+  ~ReplotScheduler() override;
+
+  /**
+   * @brief Returns scheduler of the given canvas, creates one if necessary.
+   */
+  static ReplotScheduler* GetScheduler(QCustomPlot* custom_plot);
+
+  /**
+   * @brief Marks the canvas as dirty. The replot will happen on the next frame.
+   */
+  void ScheduleReplot();
+
+  /**
+   * @brief Performs pending replot immediately.
+   */
+  void Flush();
+
+  /**
+   * @brief Checks if there is a replot waiting for the next frame.
+   */
+  bool IsReplotPending() const;
+
+  /**
+   * @brief Sets maximum number of replots per second.
+   *
+   * Zero value removes the limit, requests are still coalesced until the next iteration of the
+   * event loop.
+   */
+  void SetMaxFrameRate(int value);
+
+  int GetMaxFrameRate() const;
+
+  /**
+   * @brief Returns number of replot requests since the last counter reset.
+   */
+  std::size_t GetRequestedReplotCount() const;
+
+  /**
+   * @brief Returns number of replots performed by the scheduler since the last counter reset.
+   */
+  std::size_t GetPerformedReplotCount() const;
+
+  void ResetCounters();
+
+private:
+  void PerformReplot();
+  void OnAfterReplot();
+  int GetFrameInterval() const;
+
+  QCustomPlot* m_custom_plot{nullptr};
+  QTimer* m_timer{nullptr};
+  QElapsedTimer m_last_replot_timer;
+  int m_max_frame_rate{kDefaultMaxFrameRate};
+  std::size_t m_requested_replot_count{0};
+  std::size_t m_performed_replot_count{0};
+};
+
+}  // namespace mvvm
+
+#endif  // MVVM_PLOTTING_CUSTOMPLOT_REPLOT_SCHEDULER_H_
@@ -0,0 +1,148 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "stream_data1d_plot_controller.h"
+
+#include "custom_plot_utils.h"
+
+#include <mvvm/standarditems/stream_data1d_item.h>
+
+#include <qcustomplot.h>
+
+#include <algorithm>
+
+using namespace mvvm;
+
+struct StreamData1DPlotController::StreamData1DPlotControllerImpl
+{
+  QCPGraph* m_graph{nullptr};
+  bool m_is_sorted{true};  //!< x-coordinates of the stream are non-decreasing
+
+  explicit StreamData1DPlotControllerImpl(QCPGraph* graph) : m_graph(graph)
+  {
+    if (!m_graph)
+    {
+      throw RuntimeException("Error in StreamData1DPlotController: uninitialised graph");
+    }
+  }
+
+  //! Sets all points of the stream to the graph.
+  void UpdateGraphFromItem(StreamData1DItem* item)
+  {
+    auto x_values = item->GetBinCenters();
+    auto y_values = item->GetValues();
+    m_is_sorted = std::is_sorted(x_values.begin(), x_values.end());
+    m_graph->setData(QVector<double>(x_values.begin(), x_values.end()),
+                     QVector<double>(y_values.begin(), y_values.end()), m_is_sorted);
+    utils::ScheduleReplot(m_graph->parentPlot());
+  }
+
+  //! Removes dropped points from the beginning of the graph and adds new points to its end.
+  void OnDataAppended(StreamData1DItem* item, const DataAppendedEvent& event)
+  {
+    const auto point_count = item->GetPointCount();
+    if (!m_is_sorted || event.appended_count > point_count)
+    {
+      UpdateGraphFromItem(item);
+      return;
+    }
+
+    auto data = m_graph->data();
+    if (event.removed_count > 0)
+    {
+      if (point_count == 0)
+      {
+        data->clear();
+      }
+      else
+      {
+        data->removeBefore(item->GetPoint(0).first);
+      }
+    }
+
+    if (event.appended_count > 0)
+    {
+      QVector<double> keys;
+      QVector<double> values;
+      keys.reserve(static_cast<int>(event.appended_count));
+      values.reserve(static_cast<int>(event.appended_count));
+      for (auto index = point_count - event.appended_count; index < point_count; ++index)
+      {
+        auto [x, y] = item->GetPoint(index);
+        keys.push_back(x);
+        values.push_back(y);
+      }
+
+      const bool is_continuation = data->isEmpty() || (data->constEnd() - 1)->key <= keys.front();
+      if (!is_continuation || !std::is_sorted(keys.begin(), keys.end()))
+      {
+        UpdateGraphFromItem(item);
+        return;
+      }
+      m_graph->addData(keys, values, true);
+    }
+
+    // duplicated keys at the beginning can survive removal by key
+    if (static_cast<std::size_t>(data->size()) != point_count)
+    {
+      UpdateGraphFromItem(item);
+      return;
+    }
+
+    utils::ScheduleReplot(m_graph->parentPlot());
+  }
+
+  void ResetGraph()
+  {
+    m_graph->setData(QVector<double>{}, QVector<double>{});
+    utils::ScheduleReplot(m_graph->parentPlot());
+  }
+};
+
+StreamData1DPlotController::StreamData1DPlotController(QCPGraph* graph)
+    : p_impl(std::make_unique<StreamData1DPlotControllerImpl>(graph))
+{
+}
+
+StreamData1DPlotController::~StreamData1DPlotController() = default;
+
+void StreamData1DPlotController::Subscribe()
+{
+  auto on_data_appended = [this](const event_variant_t& event)
+  { p_impl->OnDataAppended(GetItem(), std::get<DataAppendedEvent>(event)); };
+  Listener()->Connect<DataAppendedEvent>(on_data_appended);
+
+  // clearing of the buffer, or dropping samples by the new capacity
+  auto on_data_change = [this](const event_variant_t& event)
+  {
+    if (std::get<DataChangedEvent>(event).data_role == DataRole::kData)
+    {
+      p_impl->UpdateGraphFromItem(GetItem());
+    }
+  };
+  Listener()->Connect<DataChangedEvent>(on_data_change);
+
+  p_impl->UpdateGraphFromItem(GetItem());
+}
+
+void StreamData1DPlotController::Unsubscribe()
+{
+  p_impl->ResetGraph();
+}
@@ -0,0 +1,58 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_PLOTTING_CUSTOMPLOT_STREAM_DATA1D_PLOT_CONTROLLER_H_
+#define MVVM_PLOTTING_CUSTOMPLOT_STREAM_DATA1D_PLOT_CONTROLLER_H_
+
+#include <mvvm/signals/item_controller.h>
+#include <mvvm/view_export.h>
+
+#include <memory>
+
+class QCPGraph;
+
+namespace mvvm
+{
+
+class StreamData1DItem;
+
+//! Establishes communication between QCPGraph and StreamData1DItem.
+//! Appended samples are added to the end of the graph, and dropped samples are removed from its
+//! beginning, so the cost of the update doesn't depend on the number of points in the graph.
+//! Streams with decreasing x-coordinates fall back to the full update of the graph.
+
+class MVVM_VIEW_EXPORT StreamData1DPlotController : public ItemController<StreamData1DItem>
+{
+public:
+  explicit StreamData1DPlotController(QCPGraph* graph);
+  ~StreamData1DPlotController() override;
+
+protected:
+  void Subscribe() override;
+  void Unsubscribe() override;
+
+private:
+  struct StreamData1DPlotControllerImpl;
+  std::unique_ptr<StreamData1DPlotControllerImpl> p_impl;
+};
+
+}  // namespace mvvm
+
+#endif  // MVVM_PLOTTING_CUSTOMPLOT_STREAM_DATA1D_PLOT_CONTROLLER_H_
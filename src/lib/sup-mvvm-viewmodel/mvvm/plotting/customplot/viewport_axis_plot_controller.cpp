@@ -146,7 +146,7 @@ void ViewportAxisPlotController::Subscribe()
       p_impl->SetAxisLogScaleFromItem();
     }
 
-    p_impl->m_axis->parentPlot()->replot();
+    utils::ScheduleReplot(p_impl->m_axis->parentPlot());
   };
   Listener()->Connect<PropertyChangedEvent>(on_property_change);
 
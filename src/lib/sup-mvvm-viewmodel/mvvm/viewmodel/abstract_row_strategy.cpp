@@ -62,7 +62,7 @@ std::vector<std::unique_ptr<ViewItem>> AbstractRowStrategy::ConstructRow(Session
     throw RuntimeException(ostr.str());
   }
 
-  return ConstructRowImpl(item);
+  return result;
 }
 
 std::vector<std::unique_ptr<ViewItem>> AbstractRowStrategy::CreatePlaceholderRow(
@@ -38,7 +38,7 @@ void AbstractViewModelController::SetModel(ISessionModel *model)
 
 const ISessionModel *AbstractViewModelController::GetModel() const
 {
-  return m_listener ? m_listener->GetModel() : nullptr;
+  return m_model;
 }
 
 void AbstractViewModelController::OnModelEvent(const AboutToInsertItemEvent &event)
@@ -61,6 +61,26 @@ void AbstractViewModelController::OnModelEvent(const ItemRemovedEvent &event)
   (void)event;
 }
 
+void AbstractViewModelController::OnModelEvent(const AboutToInsertItemsEvent &event)
+{
+  (void)event;
+}
+
+void AbstractViewModelController::OnModelEvent(const ItemsInsertedEvent &event)
+{
+  (void)event;
+}
+
+void AbstractViewModelController::OnModelEvent(const AboutToRemoveItemsEvent &event)
+{
+  (void)event;
+}
+
+void AbstractViewModelController::OnModelEvent(const ItemsRemovedEvent &event)
+{
+  (void)event;
+}
+
 void AbstractViewModelController::OnModelEvent(const DataChangedEvent &event)
 {
   (void)event;
@@ -121,6 +141,12 @@ QStringList AbstractViewModelController::GetHorizontalHeaderLabels() const
   return {};
 }
 
+std::vector<const ViewItem *> AbstractViewModelController::FindViews(const SessionItem *item) const
+{
+  (void)item;
+  return {};
+}
+
 void AbstractViewModelController::SubscribeAll(ISessionModel *model)
 {
   m_listener = std::make_unique<mvvm::ModelListener>(model);
@@ -134,6 +160,13 @@ void AbstractViewModelController::SubscribeAll(ISessionModel *model)
                                                     &AbstractViewModelController::OnModelEvent);
   m_listener->Connect<mvvm::ItemRemovedEvent>(this, &AbstractViewModelController::OnModelEvent);
 
+  m_listener->Connect<mvvm::AboutToInsertItemsEvent>(this,
+                                                     &AbstractViewModelController::OnModelEvent);
+  m_listener->Connect<mvvm::ItemsInsertedEvent>(this, &AbstractViewModelController::OnModelEvent);
+  m_listener->Connect<mvvm::AboutToRemoveItemsEvent>(this,
+                                                     &AbstractViewModelController::OnModelEvent);
+  m_listener->Connect<mvvm::ItemsRemovedEvent>(this, &AbstractViewModelController::OnModelEvent);
+
   m_listener->Connect<mvvm::ModelAboutToBeResetEvent>(this,
                                                       &AbstractViewModelController::OnModelEvent);
   m_listener->Connect<mvvm::ModelResetEvent>(this, &AbstractViewModelController::OnModelEvent);
@@ -144,6 +177,7 @@ void AbstractViewModelController::SubscribeAll(ISessionModel *model)
 
 void AbstractViewModelController::Subscribe(ISessionModel *model)
 {
+  m_model = model;
   SubscribeImpl(model);
 }
 
@@ -154,10 +188,11 @@ void AbstractViewModelController::SubscribeImpl(ISessionModel *model)
 
 void AbstractViewModelController::Unsubscribe()
 {
-  if (m_listener)
+  if (m_model)
   {
     UnsubscribeImpl();
     m_listener.reset();
+    m_model = nullptr;
   }
 }
 
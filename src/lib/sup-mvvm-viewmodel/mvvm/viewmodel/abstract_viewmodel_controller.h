@@ -58,6 +58,14 @@ public:
 
   void OnModelEvent(const ItemRemovedEvent& event) override;
 
+  void OnModelEvent(const AboutToInsertItemsEvent& event) override;
+
+  void OnModelEvent(const ItemsInsertedEvent& event) override;
+
+  void OnModelEvent(const AboutToRemoveItemsEvent& event) override;
+
+  void OnModelEvent(const ItemsRemovedEvent& event) override;
+
   void OnModelEvent(const DataChangedEvent& event) override;
 
   void OnModelEvent(const ModelAboutToBeResetEvent& event) override;
@@ -72,6 +80,11 @@ public:
 
   QStringList GetHorizontalHeaderLabels() const override;
 
+  /**
+   * @brief Returns an empty vector, controllers keeping track of views have to reimplement it.
+   */
+  std::vector<const ViewItem*> FindViews(const SessionItem* item) const override;
+
 protected:
   /**
    * @brief Convenience method that subscribes to all signals.
@@ -105,6 +118,7 @@ private:
    */
   virtual void UnsubscribeImpl();
 
+  ISessionModel* m_model{nullptr};
   std::unique_ptr<ModelListener> m_listener;
 };
 
@@ -93,4 +93,19 @@ bool IsExternalPropertyVariant(const QVariant& variant)
   return variant.typeName() == constants::kExternalPropertyQtTypeName;
 }
 
+bool IsSharedDoubleVectorVariant(const QVariant& variant)
+{
+  return variant.typeName() == constants::kSharedVectorDoubleQtTypeName;
+}
+
+bool IsNarrowNumericVectorVariant(const QVariant& variant)
+{
+  // type names depend on the platform (i.e. int64 is long or long long), ids do not
+  const int type_id = variant.userType();
+  return type_id == qMetaTypeId<std::vector<float32>>()
+         || type_id == qMetaTypeId<std::vector<int32>>()
+         || type_id == qMetaTypeId<std::vector<int64>>()
+         || type_id == qMetaTypeId<std::vector<uint16>>();
+}
+
 }  // namespace mvvm::utils
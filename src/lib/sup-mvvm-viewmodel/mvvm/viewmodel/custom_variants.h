@@ -25,6 +25,7 @@
 //! Custom Qt variants registrations and utility functions.
 
 #include <mvvm/core/basic_scalar_types.h>
+#include <mvvm/core/shared_array.h>
 #include <mvvm/model/combo_property.h>
 #include <mvvm/model/external_property.h>
 #include <mvvm/viewmodel_export.h>
@@ -54,6 +55,7 @@ const std::string kFloat64QtTypeName = "double";
 const std::string kStdVectorDoubleQtTypeName = "std::vector<double>";
 const std::string kComboPropertyQtTypeName = "mvvm::ComboProperty";
 const std::string kExternalPropertyQtTypeName = "mvvm::ExternalProperty";
+const std::string kSharedVectorDoubleQtTypeName = "mvvm::SharedArray<double>";
 const std::string kLongLongQtTypeName = "qlonglong";
 const std::string kStringQtTypeName = "QString";
 }  // namespace constants
@@ -84,6 +86,12 @@ MVVM_VIEWMODEL_EXPORT bool IsComboPropertyVariant(const QVariant& variant);
 //! Returns true if variant is based on ExternalProperty.
 MVVM_VIEWMODEL_EXPORT bool IsExternalPropertyVariant(const QVariant& variant);
 
+//! Returns true if variant is based on SharedArray<double>.
+MVVM_VIEWMODEL_EXPORT bool IsSharedDoubleVectorVariant(const QVariant& variant);
+
+//! Returns true if variant is based on std::vector of float32, int32, int64 or uint16.
+MVVM_VIEWMODEL_EXPORT bool IsNarrowNumericVectorVariant(const QVariant& variant);
+
 }  // namespace utils
 
 }  // namespace mvvm
@@ -92,5 +100,10 @@ Q_DECLARE_METATYPE(std::string)
 Q_DECLARE_METATYPE(std::vector<double>)
 Q_DECLARE_METATYPE(mvvm::ComboProperty)
 Q_DECLARE_METATYPE(mvvm::ExternalProperty)
+Q_DECLARE_METATYPE(mvvm::SharedArray<double>)
+Q_DECLARE_METATYPE(std::vector<mvvm::float32>)
+Q_DECLARE_METATYPE(std::vector<mvvm::int32>)
+Q_DECLARE_METATYPE(std::vector<mvvm::int64>)
+Q_DECLARE_METATYPE(std::vector<mvvm::uint16>)
 
 #endif  // MVVM_VIEWMODEL_CUSTOM_VARIANTS_H_
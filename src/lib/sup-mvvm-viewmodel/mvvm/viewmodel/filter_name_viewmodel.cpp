@@ -20,31 +20,566 @@
 
 #include "filter_name_viewmodel.h"
 
+#include <QPointer>
+#include <QVector>
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+//! Length of name substrings held in the index.
+const int kTrigramLength = 3;
+
+//! Returns the key of the trigram starting at the given position of the string.
+quint64 GetTrigramKey(const QString &str, int pos)
+{
+  return (static_cast<quint64>(str.at(pos).unicode()) << 32)
+         | (static_cast<quint64>(str.at(pos + 1).unicode()) << 16)
+         | static_cast<quint64>(str.at(pos + 2).unicode());
+}
+
+}  // namespace
+
 namespace mvvm
 {
 
+struct FilterNameViewModel::FilterNameViewModelImpl
+{
+  //! Node of the tree mirroring rows of the source model.
+  struct Node
+  {
+    int id{-1};  //!< index of the name in the name table
+    bool is_accepted{false};
+    bool was_accepted{false};
+    Node *parent{nullptr};
+    std::vector<std::unique_ptr<Node>> children;
+  };
+
+  FilterNameViewModel *m_self{nullptr};
+  QPointer<QAbstractItemModel> m_source;
+  std::vector<QMetaObject::Connection> m_connections;
+  QString m_pattern;
+  bool m_is_built{false};
+  bool m_invalidate_pending{false};  //!< source change has altered acceptance of existing rows
+
+  Node m_root;
+  std::vector<Node *> m_nodes;   //!< node of every name, nullptr for names of removed rows
+  std::vector<QString> m_names;  //!< lowercase names
+  int m_outdated_count{0};       //!< number of removed and renamed names
+  std::unordered_map<quint64, std::vector<int>> m_trigrams;  //!< name ids for every trigram
+  std::vector<int> m_matches;                                //!< ids of names with the pattern
+  std::vector<int> m_accepted;  //!< ids of matching nodes and of their ancestors
+
+  explicit FilterNameViewModelImpl(FilterNameViewModel *self) : m_self(self) {}
+
+  void SetSourceModel(QAbstractItemModel *source)
+  {
+    for (const auto &connection : m_connections)
+    {
+      QObject::disconnect(connection);
+    }
+    m_connections.clear();
+    m_source = source;
+    Reset();
+
+    if (!m_source)
+    {
+      return;
+    }
+
+    auto on_rows_inserted = [this](const QModelIndex &parent, int first, int last)
+    { OnRowsInserted(parent, first, last); };
+    m_connections.push_back(QObject::connect(m_source, &QAbstractItemModel::rowsInserted, m_self,
+                                             on_rows_inserted));
+
+    auto on_rows_removed = [this](const QModelIndex &parent, int first, int last)
+    { OnRowsRemoved(parent, first, last); };
+    m_connections.push_back(
+        QObject::connect(m_source, &QAbstractItemModel::rowsRemoved, m_self, on_rows_removed));
+
+    auto on_data_changed = [this](const QModelIndex &top_left, const QModelIndex &bottom_right,
+                                  const QVector<int> &roles)
+    { OnDataChanged(top_left, bottom_right, roles); };
+    m_connections.push_back(
+        QObject::connect(m_source, &QAbstractItemModel::dataChanged, m_self, on_data_changed));
+
+    // the base class filters rows again after these changes, the index is rebuilt on demand
+    auto on_reset = [this]() { Reset(); };
+    m_connections.push_back(
+        QObject::connect(m_source, &QAbstractItemModel::modelReset, m_self, on_reset));
+    m_connections.push_back(
+        QObject::connect(m_source, &QAbstractItemModel::layoutChanged, m_self, on_reset));
+
+    // changes which the base class doesn't refilter
+    auto on_structure_changed = [this]()
+    {
+      Reset();
+      m_invalidate_pending = !m_pattern.isEmpty();
+    };
+    m_connections.push_back(QObject::connect(m_source, &QAbstractItemModel::rowsMoved, m_self,
+                                             on_structure_changed));
+    m_connections.push_back(QObject::connect(m_source, &QAbstractItemModel::columnsInserted,
+                                             m_self, on_structure_changed));
+    m_connections.push_back(QObject::connect(m_source, &QAbstractItemModel::columnsRemoved, m_self,
+                                             on_structure_changed));
+    m_connections.push_back(QObject::connect(m_source, &QAbstractItemModel::columnsMoved, m_self,
+                                             on_structure_changed));
+  }
+
+  /**
+   * @brief Connects handlers which should run after the base class has processed source changes.
+   */
+  void ConnectPostHandlers()
+  {
+    if (!m_source)
+    {
+      return;
+    }
+
+    auto on_processed = [this]() { OnChangeProcessed(); };
+    m_connections.push_back(
+        QObject::connect(m_source, &QAbstractItemModel::rowsInserted, m_self, on_processed));
+    m_connections.push_back(
+        QObject::connect(m_source, &QAbstractItemModel::rowsRemoved, m_self, on_processed));
+    m_connections.push_back(
+        QObject::connect(m_source, &QAbstractItemModel::dataChanged, m_self, on_processed));
+    m_connections.push_back(
+        QObject::connect(m_source, &QAbstractItemModel::rowsMoved, m_self, on_processed));
+    m_connections.push_back(
+        QObject::connect(m_source, &QAbstractItemModel::columnsInserted, m_self, on_processed));
+    m_connections.push_back(
+        QObject::connect(m_source, &QAbstractItemModel::columnsRemoved, m_self, on_processed));
+    m_connections.push_back(
+        QObject::connect(m_source, &QAbstractItemModel::columnsMoved, m_self, on_processed));
+  }
+
+  /**
+   * @brief Sets the lowercase pattern and finds matching names. Returns true if pattern has
+   * changed.
+   */
+  bool SetPattern(const QString &pattern)
+  {
+    if (pattern == m_pattern)
+    {
+      return false;
+    }
+
+    if (m_is_built && 2 * m_outdated_count > static_cast<int>(m_names.size()))
+    {
+      Reset();  // too many outdated names, the index will be rebuilt
+    }
+
+    if (m_is_built)
+    {
+      // names containing the extended pattern are among names containing the previous one
+      const bool is_extended = !m_pattern.isEmpty() && pattern.contains(m_pattern);
+      m_matches = FindMatches(pattern, is_extended ? &m_matches : nullptr);
+      m_pattern = pattern;
+      UpdateAccepted(static_cast<int>(m_names.size()));
+    }
+    else
+    {
+      m_pattern = pattern;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Builds the index from the source model, if necessary.
+   */
+  void EnsureBuilt()
+  {
+    if (m_is_built || !m_source)
+    {
+      return;
+    }
+
+    Reset();
+    InsertChildren(m_root, QModelIndex(), 0, m_source->rowCount() - 1);
+    m_is_built = true;
+    m_matches = FindMatches(m_pattern, nullptr);
+    UpdateAccepted(static_cast<int>(m_names.size()));
+  }
+
+  void Reset()
+  {
+    m_is_built = false;
+    m_root.children.clear();
+    m_nodes.clear();
+    m_names.clear();
+    m_outdated_count = 0;
+    m_trigrams.clear();
+    m_matches.clear();
+    m_accepted.clear();
+  }
+
+  /**
+   * @brief Returns the node corresponding to the given index of the source model.
+   */
+  Node *FindNode(const QModelIndex &index)
+  {
+    if (!index.isValid())
+    {
+      return &m_root;
+    }
+
+    auto parent = FindNode(index.parent());
+    if (!parent || index.row() < 0 || index.row() >= static_cast<int>(parent->children.size()))
+    {
+      return nullptr;
+    }
+    return parent->children[index.row()].get();
+  }
+
+  /**
+   * @brief Inserts nodes for the given rows of the source model, together with their children.
+   * Returns false if the index is out of sync with the source model.
+   */
+  bool InsertChildren(Node &parent, const QModelIndex &parent_index, int first, int last)
+  {
+    if (first < 0 || first > static_cast<int>(parent.children.size()))
+    {
+      return false;
+    }
+
+    std::vector<std::unique_ptr<Node>> nodes;
+    for (int row = first; row <= last; ++row)
+    {
+      auto node = std::make_unique<Node>();
+      node->parent = &parent;
+      const auto index = m_source->index(row, 0, parent_index);
+      AddName(*node, index.data().toString().toLower());
+      InsertChildren(*node, index, 0, m_source->rowCount(index) - 1);
+      nodes.push_back(std::move(node));
+    }
+    parent.children.insert(parent.children.begin() + first, std::make_move_iterator(nodes.begin()),
+                           std::make_move_iterator(nodes.end()));
+    return true;
+  }
+
+  void AddName(Node &node, const QString &name)
+  {
+    node.id = static_cast<int>(m_names.size());
+    m_names.push_back(name);
+    m_nodes.push_back(&node);
+    AddTrigrams(node.id, name, {});
+  }
+
+  /**
+   * @brief Adds the name to lists of its trigrams, skipping trigrams of the previous name.
+   */
+  void AddTrigrams(int id, const QString &name, const QString &previous_name)
+  {
+    for (int pos = 0; pos + kTrigramLength <= name.size(); ++pos)
+    {
+      if (previous_name.contains(QStringView(name).mid(pos, kTrigramLength)))
+      {
+        continue;  // the list holds the id already
+      }
+      auto &ids = m_trigrams[GetTrigramKey(name, pos)];
+      if (ids.empty() || ids.back() != id)
+      {
+        ids.push_back(id);
+      }
+    }
+  }
+
+  void RemoveNode(Node &node)
+  {
+    for (auto &child : node.children)
+    {
+      RemoveNode(*child);
+    }
+    m_nodes[node.id] = nullptr;
+    m_names[node.id].clear();
+    ++m_outdated_count;
+  }
+
+  bool IsMatching(int id, const QString &pattern) const
+  {
+    return m_nodes[id] && m_names[id].contains(pattern);
+  }
+
+  /**
+   * @brief Returns ids of names containing the pattern.
+   *
+   * @param pattern Lowercase pattern.
+   * @param candidates Ids of names where to look for, or nullptr to look through all names.
+   */
+  std::vector<int> FindMatches(const QString &pattern, const std::vector<int> *candidates) const
+  {
+    std::vector<int> result;
+    if (pattern.isEmpty())
+    {
+      return result;
+    }
+
+    // all matching names are in the shortest list of pattern trigrams
+    std::vector<int> trigram_candidates;
+    if (pattern.size() >= kTrigramLength)
+    {
+      const std::vector<int> *shortest{nullptr};
+      for (int pos = 0; pos + kTrigramLength <= pattern.size(); ++pos)
+      {
+        auto iter = m_trigrams.find(GetTrigramKey(pattern, pos));
+        if (iter == m_trigrams.end())
+        {
+          return result;
+        }
+        if (!shortest || iter->second.size() < shortest->size())
+        {
+          shortest = &iter->second;
+        }
+      }
+
+      if (!candidates || shortest->size() < candidates->size())
+      {
+        // renamed items can be listed twice
+        trigram_candidates = *shortest;
+        std::sort(trigram_candidates.begin(), trigram_candidates.end());
+        trigram_candidates.erase(std::unique(trigram_candidates.begin(), trigram_candidates.end()),
+                                 trigram_candidates.end());
+        candidates = &trigram_candidates;
+      }
+    }
+
+    if (candidates)
+    {
+      std::copy_if(candidates->begin(), candidates->end(), std::back_inserter(result),
+                   [this, &pattern](int id) { return IsMatching(id, pattern); });
+      return result;
+    }
+
+    for (int id = 0; id < static_cast<int>(m_names.size()); ++id)
+    {
+      if (IsMatching(id, pattern))
+      {
+        result.push_back(id);
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief Marks matching nodes and their ancestors as accepted.
+   *
+   * @param first_new_id Ids starting from this one belong to rows just inserted.
+   * @return True if acceptance of previously existing rows has changed.
+   */
+  bool UpdateAccepted(int first_new_id)
+  {
+    for (auto id : m_accepted)
+    {
+      if (auto node = m_nodes[id]; node)
+      {
+        node->was_accepted = true;
+        node->is_accepted = false;
+      }
+    }
+
+    std::vector<int> accepted;
+    for (auto id : m_matches)
+    {
+      for (auto node = m_nodes[id]; node && node != &m_root && !node->is_accepted;
+           node = node->parent)
+      {
+        node->is_accepted = true;
+        accepted.push_back(node->id);
+      }
+    }
+
+    bool is_changed{false};
+    for (auto id : accepted)
+    {
+      is_changed |= !m_nodes[id]->was_accepted && id < first_new_id;
+    }
+    for (auto id : m_accepted)
+    {
+      if (auto node = m_nodes[id]; node)
+      {
+        is_changed |= !node->is_accepted;
+        node->was_accepted = false;
+      }
+    }
+
+    m_accepted = std::move(accepted);
+    return is_changed;
+  }
+
+  void OnRowsInserted(const QModelIndex &parent, int first, int last)
+  {
+    if (!m_is_built)
+    {
+      return;
+    }
+
+    const auto first_new_id = static_cast<int>(m_names.size());
+    auto node = FindNode(parent);
+    if (!node || !InsertChildren(*node, parent, first, last))
+    {
+      OnIndexOutOfSync();
+      return;
+    }
+
+    if (m_pattern.isEmpty())
+    {
+      return;
+    }
+
+    for (auto id = first_new_id; id < static_cast<int>(m_names.size()); ++id)
+    {
+      if (IsMatching(id, m_pattern))
+      {
+        m_matches.push_back(id);
+      }
+    }
+    m_invalidate_pending |= UpdateAccepted(first_new_id);
+  }
+
+  void OnRowsRemoved(const QModelIndex &parent, int first, int last)
+  {
+    if (!m_is_built)
+    {
+      return;
+    }
+
+    auto node = FindNode(parent);
+    if (!node || first < 0 || last >= static_cast<int>(node->children.size()))
+    {
+      OnIndexOutOfSync();
+      return;
+    }
+
+    for (int row = first; row <= last; ++row)
+    {
+      RemoveNode(*node->children[row]);
+    }
+    node->children.erase(node->children.begin() + first, node->children.begin() + last + 1);
+
+    if (m_pattern.isEmpty())
+    {
+      return;
+    }
+
+    auto is_removed = [this](int id) { return m_nodes[id] == nullptr; };
+    m_matches.erase(std::remove_if(m_matches.begin(), m_matches.end(), is_removed),
+                    m_matches.end());
+    m_invalidate_pending |= UpdateAccepted(static_cast<int>(m_names.size()));
+  }
+
+  void OnDataChanged(const QModelIndex &top_left, const QModelIndex &bottom_right,
+                     const QVector<int> &roles)
+  {
+    if (!m_is_built || top_left.column() > 0
+        || (!roles.isEmpty() && !roles.contains(Qt::DisplayRole)))
+    {
+      return;
+    }
+
+    const auto parent_index = top_left.parent();
+    auto parent = FindNode(parent_index);
+    if (!parent || bottom_right.row() >= static_cast<int>(parent->children.size()))
+    {
+      OnIndexOutOfSync();
+      return;
+    }
+
+    bool is_renamed{false};
+    for (int row = top_left.row(); row <= bottom_right.row(); ++row)
+    {
+      const auto id = parent->children[row]->id;
+      auto name = m_source->index(row, 0, parent_index).data().toString().toLower();
+      if (name == m_names[id])
+      {
+        continue;
+      }
+
+      AddTrigrams(id, name, m_names[id]);
+      m_names[id] = std::move(name);
+      ++m_outdated_count;  // lists of old trigrams keep the id
+      is_renamed = true;
+
+      m_matches.erase(std::remove(m_matches.begin(), m_matches.end(), id), m_matches.end());
+      if (!m_pattern.isEmpty() && IsMatching(id, m_pattern))
+      {
+        m_matches.push_back(id);
+      }
+    }
+
+    if (is_renamed && !m_pattern.isEmpty())
+    {
+      m_invalidate_pending |= UpdateAccepted(static_cast<int>(m_names.size()));
+    }
+  }
+
+  void OnIndexOutOfSync()
+  {
+    Reset();
+    m_invalidate_pending = !m_pattern.isEmpty();
+  }
+
+  void OnChangeProcessed()
+  {
+    if (m_invalidate_pending)
+    {
+      m_invalidate_pending = false;
+      m_self->invalidateFilter();
+    }
+  }
+};
+
 FilterNameViewModel::FilterNameViewModel(QObject *parent_object)
     : QSortFilterProxyModel(parent_object)
+    , p_impl(std::make_unique<FilterNameViewModelImpl>(this))
 {
-  setRecursiveFilteringEnabled(true);
+  // ancestors of matching rows are accepted by the index, the recursive filtering of the base
+  // class would visit all children of rejected rows
+  setRecursiveFilteringEnabled(false);
 }
 
+FilterNameViewModel::~FilterNameViewModel() = default;
+
 void FilterNameViewModel::SetPattern(const QString &pattern)
 {
-  m_pattern = pattern.toLower();
-  invalidateFilter();
+  if (p_impl->SetPattern(pattern.toLower()))
+  {
+    invalidateFilter();
+  }
+}
+
+void FilterNameViewModel::setSourceModel(QAbstractItemModel *source_model)
+{
+  if (source_model == sourceModel())
+  {
+    return;
+  }
+
+  // handlers updating the index are connected before the base class connects to the source
+  p_impl->SetSourceModel(source_model);
+  QSortFilterProxyModel::setSourceModel(source_model);
+  p_impl->ConnectPostHandlers();
 }
 
 bool FilterNameViewModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
 {
-  if (m_pattern.isEmpty())
+  if (p_impl->m_pattern.isEmpty())
   {
     return true;
   }
 
-  const QModelIndex index0 = sourceModel()->index(sourceRow, 0, sourceParent);
+  p_impl->EnsureBuilt();
+  if (auto parent = p_impl->FindNode(sourceParent);
+      parent && sourceRow < static_cast<int>(parent->children.size()))
+  {
+    return parent->children[sourceRow]->is_accepted;
+  }
 
-  return sourceModel()->data(index0).toString().toLower().contains(m_pattern);
+  // the index is out of sync with the source model
+  const QModelIndex index0 = sourceModel()->index(sourceRow, 0, sourceParent);
+  return sourceModel()->data(index0).toString().toLower().contains(p_impl->m_pattern);
 }
 
 }  // namespace mvvm
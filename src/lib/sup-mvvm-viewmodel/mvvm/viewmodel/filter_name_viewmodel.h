@@ -23,12 +23,20 @@
 
 #include <QSortFilterProxyModel>
 
+#include <memory>
+
 namespace mvvm
 {
 
 /**
  * @brief The FilterNameViewModel class is a simple proxy model which provides fuzzy filtering on
  * display name of the first column.
+ *
+ * Rows whose name contains the pattern are accepted together with all their ancestors. Lowercase
+ * names are held in the index mirroring the tree of the source model. The index is built on the
+ * first use and then updated from source model signals, so filtering doesn't access the data of
+ * the source model. Extension of the pattern refines previous matches, other patterns are looked
+ * up via trigrams of names.
  */
 class FilterNameViewModel : public QSortFilterProxyModel
 {
@@ -36,13 +44,17 @@ class FilterNameViewModel : public QSortFilterProxyModel
 
 public:
   explicit FilterNameViewModel(QObject* parent_object = nullptr);
+  ~FilterNameViewModel() override;
 
   void SetPattern(const QString& pattern);
 
+  void setSourceModel(QAbstractItemModel* source_model) override;
+
   bool filterAcceptsRow(int sourceRow, const QModelIndex& sourceParent) const override;
 
 private:
-  QString m_pattern;
+  struct FilterNameViewModelImpl;
+  std::unique_ptr<FilterNameViewModelImpl> p_impl;
 };
 
 }  // namespace mvvm
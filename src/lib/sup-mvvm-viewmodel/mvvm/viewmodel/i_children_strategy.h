@@ -23,6 +23,7 @@
 
 #include <mvvm/viewmodel_export.h>
 
+#include <string>
 #include <vector>
 
 namespace mvvm
@@ -48,6 +49,34 @@ public:
    * Thanks to this strategy ViewModel decides which items to visit.
    */
   virtual std::vector<SessionItem*> GetChildren(const SessionItem* item) const = 0;
+
+  /**
+   * @brief Returns a key under which results of the strategy can be shared between viewmodels.
+   *
+   * Strategies reporting the same non-empty key must report the same children for any item. An
+   * empty key (the default) means that results are never shared.
+   */
+  virtual std::string GetCacheKey() const { return {}; }
+
+  /**
+   * @brief Checks if the strategy reports actual children of the item, in the order of
+   * SessionItem::GetAllItems, filtered by IsReportedChild.
+   *
+   * The position of a child among reported children can be found then without building the list
+   * of all reported children, and updated incrementally when new children are inserted.
+   */
+  virtual bool IsChildFilter() const { return false; }
+
+  /**
+   * @brief Checks if the given child is reported among children of its parent.
+   *
+   * Makes sense only for strategies which are child filters.
+   */
+  virtual bool IsReportedChild(const SessionItem& child) const
+  {
+    (void)child;
+    return false;
+  }
 };
 
 }  // namespace mvvm
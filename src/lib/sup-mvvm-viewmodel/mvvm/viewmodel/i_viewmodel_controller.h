@@ -26,10 +26,14 @@
 
 #include <QStringList>
 
+#include <vector>
+
 namespace mvvm
 {
 
 class ISessionModel;
+class SessionItem;
+class ViewItem;
 
 /**
  * @brief The IViewModelController class is a base class for all ViewModel controllers.
@@ -68,6 +72,26 @@ public:
    */
   virtual void OnModelEvent(const ItemRemovedEvent& event) = 0;
 
+  /**
+   * @brief Lets the controller know that a range of children is about to be inserted.
+   */
+  virtual void OnModelEvent(const AboutToInsertItemsEvent& event) = 0;
+
+  /**
+   * @brief Lets the controller know that a range of children has been inserted.
+   */
+  virtual void OnModelEvent(const ItemsInsertedEvent& event) = 0;
+
+  /**
+   * @brief Lets the controller know that a range of children is about to be removed.
+   */
+  virtual void OnModelEvent(const AboutToRemoveItemsEvent& event) = 0;
+
+  /**
+   * @brief Lets the controller know that a range of children has been removed.
+   */
+  virtual void OnModelEvent(const ItemsRemovedEvent& event) = 0;
+
   /**
    * @brief Lets the controller know thatitem's data has been changed.
    */
@@ -107,6 +131,13 @@ public:
    * @brief Returns list representing horizontal labels.
    */
   virtual QStringList GetHorizontalHeaderLabels() const = 0;
+
+  /**
+   * @brief Returns all views presenting given item, found without the search over the viewmodel.
+   *
+   * Only views attached to the viewmodel are reported.
+   */
+  virtual std::vector<const ViewItem*> FindViews(const SessionItem* item) const = 0;
 };
 
 }  // namespace mvvm
@@ -0,0 +1,468 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "model_view_hub.h"
+
+#include <mvvm/core/mvvm_exceptions.h>
+#include <mvvm/model/i_session_model.h>
+#include <mvvm/model/item_utils.h>
+#include <mvvm/model/mvvm_types.h>
+#include <mvvm/model/session_item.h>
+#include <mvvm/model/session_item_container.h>
+#include <mvvm/model/tagged_items.h>
+#include <mvvm/signals/model_listener.h>
+#include <mvvm/utils/container_utils.h>
+#include <mvvm/viewmodel/i_children_strategy.h>
+#include <mvvm/viewmodel/i_viewmodel_controller.h>
+
+#include <algorithm>
+#include <iterator>
+
+namespace
+{
+
+/**
+ * @brief Returns registry of hubs of all models.
+ */
+std::map<const mvvm::ISessionModel*, std::weak_ptr<mvvm::ModelViewHub>>& GetHubRegistry()
+{
+  static std::map<const mvvm::ISessionModel*, std::weak_ptr<mvvm::ModelViewHub>> registry;
+  return registry;
+}
+
+/**
+ * @brief Returns the index of the container with the given tag among containers of the item.
+ *
+ * Returns std::nullopt if there is no such container.
+ */
+std::optional<std::size_t> FindContainerIndex(const mvvm::SessionItem& item, const std::string& tag)
+{
+  const auto tagged_items = item.GetTaggedItems();
+  auto container = tagged_items->FindContainer(tag);
+  auto iter = std::find_if(tagged_items->begin(), tagged_items->end(),
+                           [container](const auto& element) { return element.get() == container; });
+  if (!container || iter == tagged_items->end())
+  {
+    return {};
+  }
+  return static_cast<std::size_t>(std::distance(tagged_items->begin(), iter));
+}
+
+/**
+ * @brief Returns container with the given index.
+ */
+const mvvm::SessionItemContainer& GetContainerAt(const mvvm::TaggedItems& tagged_items,
+                                                 std::size_t index)
+{
+  return **std::next(tagged_items.begin(), index);
+}
+
+/**
+ * @brief Erases map entries with keys satisfying the predicate.
+ */
+template <typename MapT, typename PredicateT>
+void EraseKeysIf(MapT& map, PredicateT predicate)
+{
+  for (auto iter = map.begin(); iter != map.end();)
+  {
+    if (predicate(iter->first))
+    {
+      iter = map.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+}
+
+/**
+ * @brief Returns numbers of reported children among first children of the container.
+ */
+std::vector<int> CreatePrefixCounts(const mvvm::IChildrenStrategy& strategy,
+                                    const mvvm::SessionItemContainer& container)
+{
+  std::vector<int> result;
+  result.reserve(container.GetItemCount() + 1);
+  result.push_back(0);
+  for (const auto& child : container)
+  {
+    result.push_back(result.back() + (strategy.IsReportedChild(*child) ? 1 : 0));
+  }
+  return result;
+}
+
+}  // namespace
+
+namespace mvvm
+{
+
+ModelViewHub::ModelViewHub(ISessionModel* model)
+    : m_model(model), m_listener(std::make_unique<ModelListener>(model))
+{
+  m_listener->Connect<DataChangedEvent>(this, &ModelViewHub::OnModelEvent);
+
+  m_listener->Connect<AboutToInsertItemEvent>(this, &ModelViewHub::OnModelEvent);
+  m_listener->Connect<ItemInsertedEvent>(this, &ModelViewHub::OnModelEvent);
+  m_listener->Connect<AboutToRemoveItemEvent>(this, &ModelViewHub::OnModelEvent);
+  m_listener->Connect<ItemRemovedEvent>(this, &ModelViewHub::OnModelEvent);
+
+  m_listener->Connect<AboutToInsertItemsEvent>(this, &ModelViewHub::OnModelEvent);
+  m_listener->Connect<ItemsInsertedEvent>(this, &ModelViewHub::OnModelEvent);
+  m_listener->Connect<AboutToRemoveItemsEvent>(this, &ModelViewHub::OnModelEvent);
+  m_listener->Connect<ItemsRemovedEvent>(this, &ModelViewHub::OnModelEvent);
+
+  m_listener->Connect<ModelAboutToBeResetEvent>(this, &ModelViewHub::OnModelEvent);
+  m_listener->Connect<ModelResetEvent>(this, &ModelViewHub::OnModelEvent);
+
+  m_listener->Connect<ModelAboutToBeDestroyedEvent>(this, &ModelViewHub::OnModelEvent);
+}
+
+ModelViewHub::~ModelViewHub()
+{
+  // the entry might already belong to a new hub, if the model was destroyed and another one was
+  // created at the same address
+  auto& registry = GetHubRegistry();
+  if (auto iter = registry.find(m_model); iter != registry.end() && iter->second.expired())
+  {
+    registry.erase(iter);
+  }
+}
+
+std::shared_ptr<ModelViewHub> ModelViewHub::Acquire(ISessionModel* model)
+{
+  if (!model)
+  {
+    throw RuntimeException("ModelViewHub: model is not defined");
+  }
+
+  auto& registry = GetHubRegistry();
+  if (auto iter = registry.find(model); iter != registry.end())
+  {
+    if (auto result = iter->second.lock(); result)
+    {
+      return result;
+    }
+  }
+
+  std::shared_ptr<ModelViewHub> result(new ModelViewHub(model));
+  registry[model] = result;
+  return result;
+}
+
+const ISessionModel* ModelViewHub::GetModel() const
+{
+  return m_model;
+}
+
+void ModelViewHub::AddController(IViewModelController* controller)
+{
+  if (std::find(m_controllers.begin(), m_controllers.end(), controller) == m_controllers.end())
+  {
+    m_controllers.push_back(controller);
+  }
+}
+
+void ModelViewHub::RemoveController(IViewModelController* controller)
+{
+  m_controllers.erase(std::remove(m_controllers.begin(), m_controllers.end(), controller),
+                      m_controllers.end());
+}
+
+int ModelViewHub::GetControllerCount() const
+{
+  return static_cast<int>(m_controllers.size());
+}
+
+int ModelViewHub::GetChildIndex(const IChildrenStrategy& strategy, const SessionItem* parent,
+                                const SessionItem* child)
+{
+  auto cache_key = strategy.GetCacheKey();
+  if (cache_key.empty())
+  {
+    return utils::IndexOfItem(strategy.GetChildren(parent), child);
+  }
+
+  auto& entries = m_children_cache[parent];
+  auto iter = entries.find(cache_key);
+  if (iter == entries.end())
+  {
+    ChildrenEntry entry;
+    entry.children = strategy.GetChildren(parent);
+    entry.positions.reserve(entry.children.size());
+    for (std::size_t index = 0; index < entry.children.size(); ++index)
+    {
+      entry.positions.emplace(entry.children[index], static_cast<int>(index));
+    }
+    iter = entries.emplace(std::move(cache_key), std::move(entry)).first;
+  }
+
+  const auto& positions = iter->second.positions;
+  auto position_iter = positions.find(child);
+  return position_iter == positions.end() ? -1 : position_iter->second;
+}
+
+int ModelViewHub::GetChildIndex(const IChildrenStrategy& strategy, const SessionItem* parent,
+                                const TagIndex& tag_index)
+{
+  auto cache_key = strategy.GetCacheKey();
+  auto container_index = FindContainerIndex(*parent, tag_index.GetTag());
+  if (cache_key.empty() || !strategy.IsChildFilter() || !container_index.has_value()
+      || tag_index.GetIndex() < 0)
+  {
+    return GetChildIndex(strategy, parent, parent->GetItem(tag_index));
+  }
+
+  const auto& container = GetContainerAt(*parent->GetTaggedItems(), container_index.value());
+  auto child = container.ItemAt(static_cast<std::size_t>(tag_index.GetIndex()));
+  if (!child || !strategy.IsReportedChild(*child))
+  {
+    return -1;
+  }
+
+  const auto& prefix_counts = GetPrefixCountEntry(strategy, parent, cache_key).prefix_counts;
+  int result = prefix_counts[container_index.value()][tag_index.GetIndex()];
+  for (std::size_t index = 0; index < container_index.value(); ++index)
+  {
+    result += prefix_counts[index].back();
+  }
+  return result;
+}
+
+int ModelViewHub::GetCacheSize() const
+{
+  int result{0};
+  for (const auto& [parent, entries] : m_children_cache)
+  {
+    result += static_cast<int>(entries.size());
+  }
+  for (const auto& [parent, entries] : m_prefix_count_cache)
+  {
+    result += static_cast<int>(entries.size());
+  }
+  return result;
+}
+
+template <typename EventT>
+void ModelViewHub::Forward(const EventT& event)
+{
+  // The hub is kept alive, and controllers removed during the notification are skipped, since a
+  // controller might be deleted as a reaction on the event.
+  const auto self = shared_from_this();
+  const auto controllers = m_controllers;
+  for (auto controller : controllers)
+  {
+    if (std::find(m_controllers.begin(), m_controllers.end(), controller) != m_controllers.end())
+    {
+      controller->OnModelEvent(event);
+    }
+  }
+}
+
+void ModelViewHub::OnModelEvent(const AboutToInsertItemEvent& event)
+{
+  Forward(event);
+}
+
+void ModelViewHub::OnModelEvent(const ItemInsertedEvent& event)
+{
+  m_children_cache.erase(event.item);
+  RegisterInsertion(event.item, event.tag_index, 1);
+  Forward(event);
+}
+
+void ModelViewHub::OnModelEvent(const AboutToRemoveItemEvent& event)
+{
+  Forward(event);
+  InvalidateBranch(event.item->GetItem(event.tag_index));
+}
+
+void ModelViewHub::OnModelEvent(const ItemRemovedEvent& event)
+{
+  m_children_cache.erase(event.item);
+  m_prefix_count_cache.erase(event.item);
+  Forward(event);
+}
+
+void ModelViewHub::OnModelEvent(const AboutToInsertItemsEvent& event)
+{
+  Forward(event);
+}
+
+void ModelViewHub::OnModelEvent(const ItemsInsertedEvent& event)
+{
+  m_children_cache.erase(event.item);
+  RegisterInsertion(event.item, event.tag_index, event.count);
+  Forward(event);
+}
+
+void ModelViewHub::OnModelEvent(const AboutToRemoveItemsEvent& event)
+{
+  Forward(event);
+  for (std::size_t index = 0; index < event.count; ++index)
+  {
+    const TagIndex tag_index{event.tag_index.GetTag(),
+                             event.tag_index.GetIndex() + static_cast<int>(index)};
+    InvalidateBranch(event.item->GetItem(tag_index));
+  }
+}
+
+void ModelViewHub::OnModelEvent(const ItemsRemovedEvent& event)
+{
+  m_children_cache.erase(event.item);
+  m_prefix_count_cache.erase(event.item);
+  Forward(event);
+}
+
+void ModelViewHub::OnModelEvent(const DataChangedEvent& event)
+{
+  // visibility and property flags of children define what strategies report
+  if (event.data_role == DataRole::kAppearance && event.item)
+  {
+    m_children_cache.erase(event.item->GetParent());
+    m_prefix_count_cache.erase(event.item->GetParent());
+  }
+  Forward(event);
+}
+
+void ModelViewHub::OnModelEvent(const ModelAboutToBeResetEvent& event)
+{
+  m_children_cache.clear();
+  m_prefix_count_cache.clear();
+  Forward(event);
+}
+
+void ModelViewHub::OnModelEvent(const ModelResetEvent& event)
+{
+  m_children_cache.clear();
+  m_prefix_count_cache.clear();
+  Forward(event);
+}
+
+void ModelViewHub::OnModelEvent(const ModelAboutToBeDestroyedEvent& event)
+{
+  m_children_cache.clear();
+  m_prefix_count_cache.clear();
+  Forward(event);
+
+  // the address of the model can be reused by another model
+  auto& registry = GetHubRegistry();
+  auto iter = registry.find(m_model);
+  if (iter != registry.end() && iter->second.lock().get() == this)
+  {
+    registry.erase(iter);
+  }
+}
+
+void ModelViewHub::InvalidateBranch(const SessionItem* item)
+{
+  if (!item)
+  {
+    return;
+  }
+
+  // the cache holds only parents of recent insertions, it is cheaper to check them all than to
+  // visit the whole branch
+  auto is_in_branch = [item](const SessionItem* parent)
+  { return parent == item || utils::IsItemAncestor(parent, item); };
+  EraseKeysIf(m_children_cache, is_in_branch);
+  EraseKeysIf(m_prefix_count_cache, is_in_branch);
+}
+
+void ModelViewHub::RegisterInsertion(const SessionItem* parent, const TagIndex& tag_index,
+                                     std::size_t count)
+{
+  auto entries_iter = m_prefix_count_cache.find(parent);
+  if (entries_iter == m_prefix_count_cache.end())
+  {
+    return;
+  }
+
+  auto container_index = FindContainerIndex(*parent, tag_index.GetTag());
+  auto& entries = entries_iter->second;
+  for (auto iter = entries.begin(); iter != entries.end();)
+  {
+    auto& entry = iter->second;
+    if (!container_index.has_value() || tag_index.GetIndex() < 0
+        || entry.pending_insertion.has_value())
+    {
+      iter = entries.erase(iter);  // nobody asked for counts since the last insertion
+      continue;
+    }
+
+    entry.pending_insertion = InsertedRange{container_index.value(),
+                                            static_cast<std::size_t>(tag_index.GetIndex()), count};
+    ++iter;
+  }
+}
+
+const ModelViewHub::PrefixCountEntry& ModelViewHub::GetPrefixCountEntry(
+    const IChildrenStrategy& strategy, const SessionItem* parent, std::string cache_key)
+{
+  const auto tagged_items = parent->GetTaggedItems();
+  auto& entry = m_prefix_count_cache[parent][std::move(cache_key)];
+
+  if (entry.pending_insertion.has_value())
+  {
+    const auto [container_index, index, count] = entry.pending_insertion.value();
+    entry.pending_insertion.reset();
+
+    // counts after the insertion point grow by the number of reported inserted children
+    if (container_index < entry.prefix_counts.size()
+        && index < entry.prefix_counts[container_index].size())
+    {
+      const auto& container = GetContainerAt(*tagged_items, container_index);
+      auto& prefix_counts = entry.prefix_counts[container_index];
+      std::vector<int> inserted_counts;
+      inserted_counts.reserve(count);
+      int reported_count{0};
+      for (std::size_t offset = 0; offset < count; ++offset)
+      {
+        auto child = container.ItemAt(index + offset);
+        reported_count += child && strategy.IsReportedChild(*child) ? 1 : 0;
+        inserted_counts.push_back(prefix_counts[index] + reported_count);
+      }
+      auto iter = prefix_counts.insert(std::next(prefix_counts.begin(), index + 1),
+                                       inserted_counts.begin(), inserted_counts.end());
+      std::for_each(std::next(iter, count), prefix_counts.end(),
+                    [reported_count](int& value) { value += reported_count; });
+    }
+  }
+
+  // counts are rebuilt if they don't match the layout of the parent
+  auto is_valid = entry.prefix_counts.size() == tagged_items->GetTagCount();
+  for (std::size_t index = 0; is_valid && index < entry.prefix_counts.size(); ++index)
+  {
+    is_valid = entry.prefix_counts[index].size()
+               == GetContainerAt(*tagged_items, index).GetItemCount() + 1;
+  }
+  if (!is_valid)
+  {
+    entry.prefix_counts.clear();
+    for (const auto& container : *tagged_items)
+    {
+      entry.prefix_counts.push_back(CreatePrefixCounts(strategy, *container));
+    }
+  }
+
+  return entry;
+}
+
+}  // namespace mvvm
@@ -0,0 +1,205 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_VIEWMODEL_MODEL_VIEW_HUB_H_
+#define MVVM_VIEWMODEL_MODEL_VIEW_HUB_H_
+
+#include <mvvm/signals/event_types.h>
+#include <mvvm/viewmodel_export.h>
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mvvm
+{
+
+class ISessionModel;
+class SessionItem;
+class IChildrenStrategy;
+class IViewModelController;
+class ModelListener;
+
+/**
+ * @brief The ModelViewHub class is a view infrastructure shared by all viewmodels looking at the
+ * same model.
+ *
+ * The hub holds the only subscription to model notifications and forwards them to registered
+ * controllers. Before forwarding, it updates the cache of children reported by children
+ * strategies, and the position of every child among them. Viewmodels with the same strategy
+ * (see IChildrenStrategy::GetCacheKey) share these results, so the search for the insert
+ * position of a new child is done once per event, and not once per viewmodel.
+ *
+ * There is at most one hub per model, it lives while at least one controller holds it.
+ */
+class MVVM_VIEWMODEL_EXPORT ModelViewHub : public std::enable_shared_from_this<ModelViewHub>
+{
+public:
+  ~ModelViewHub();
+
+  ModelViewHub(const ModelViewHub& other) = delete;
+  ModelViewHub& operator=(const ModelViewHub& other) = delete;
+  ModelViewHub(ModelViewHub&& other) = delete;
+  ModelViewHub& operator=(ModelViewHub&& other) = delete;
+
+  /**
+   * @brief Returns the hub of the given model, creates it if necessary.
+   */
+  static std::shared_ptr<ModelViewHub> Acquire(ISessionModel* model);
+
+  /**
+   * @brief Returns the model served by this hub.
+   */
+  const ISessionModel* GetModel() const;
+
+  /**
+   * @brief Registers the controller to receive model notifications.
+   *
+   * Controllers are notified in the order of registration.
+   */
+  void AddController(IViewModelController* controller);
+
+  /**
+   * @brief Stops forwarding model notifications to the controller.
+   */
+  void RemoveController(IViewModelController* controller);
+
+  /**
+   * @brief Returns number of registered controllers.
+   */
+  int GetControllerCount() const;
+
+  /**
+   * @brief Returns position of the child among children reported by the strategy for the parent.
+   *
+   * Returns -1 if the strategy doesn't report the child.
+   */
+  int GetChildIndex(const IChildrenStrategy& strategy, const SessionItem* parent,
+                    const SessionItem* child);
+
+  /**
+   * @brief Returns position of the child at the given tag index among children reported by the
+   * strategy for the parent.
+   *
+   * For strategies which are child filters (see IChildrenStrategy::IsChildFilter), the number of
+   * reported children preceding every child is cached per parent. The cache is updated
+   * incrementally when new children are inserted, so appending children one by one doesn't cost
+   * more than the number of appended children.
+   *
+   * Returns -1 if the strategy doesn't report the child.
+   */
+  int GetChildIndex(const IChildrenStrategy& strategy, const SessionItem* parent,
+                    const TagIndex& tag_index);
+
+  /**
+   * @brief Returns number of cached children lists.
+   */
+  int GetCacheSize() const;
+
+private:
+  /**
+   * @brief The ChildrenEntry struct holds children reported by a strategy for a certain parent.
+   */
+  struct ChildrenEntry
+  {
+    std::vector<SessionItem*> children;
+    std::unordered_map<const SessionItem*, int> positions;
+  };
+
+  /**
+   * @brief The InsertedRange struct describes children inserted into a single container of the
+   * parent.
+   */
+  struct InsertedRange
+  {
+    std::size_t container_index{0};
+    std::size_t index{0};
+    std::size_t count{0};
+  };
+
+  /**
+   * @brief The PrefixCountEntry struct holds numbers of children reported by a child filter for a
+   * certain parent.
+   */
+  struct PrefixCountEntry
+  {
+    //! Vector for every container of the parent. The element i is the number of reported children
+    //! among first i children of the container, the last element is the total number.
+    std::vector<std::vector<int>> prefix_counts;
+
+    //! Insertion which isn't yet taken into account.
+    std::optional<InsertedRange> pending_insertion;
+  };
+
+  explicit ModelViewHub(ISessionModel* model);
+
+  template <typename EventT>
+  void Forward(const EventT& event);
+
+  void OnModelEvent(const AboutToInsertItemEvent& event);
+  void OnModelEvent(const ItemInsertedEvent& event);
+  void OnModelEvent(const AboutToRemoveItemEvent& event);
+  void OnModelEvent(const ItemRemovedEvent& event);
+  void OnModelEvent(const AboutToInsertItemsEvent& event);
+  void OnModelEvent(const ItemsInsertedEvent& event);
+  void OnModelEvent(const AboutToRemoveItemsEvent& event);
+  void OnModelEvent(const ItemsRemovedEvent& event);
+  void OnModelEvent(const DataChangedEvent& event);
+  void OnModelEvent(const ModelAboutToBeResetEvent& event);
+  void OnModelEvent(const ModelResetEvent& event);
+  void OnModelEvent(const ModelAboutToBeDestroyedEvent& event);
+
+  /**
+   * @brief Removes cached children of the given item and of all its descendants.
+   */
+  void InvalidateBranch(const SessionItem* item);
+
+  /**
+   * @brief Remembers the insertion of children for prefix counts of the parent.
+   *
+   * Counts are updated on the next request. If the previous insertion wasn't taken into account
+   * yet, counts are dropped.
+   */
+  void RegisterInsertion(const SessionItem* parent, const TagIndex& tag_index, std::size_t count);
+
+  /**
+   * @brief Returns prefix counts for the parent, reported by the child filter.
+   */
+  const PrefixCountEntry& GetPrefixCountEntry(const IChildrenStrategy& strategy,
+                                              const SessionItem* parent, std::string cache_key);
+
+  ISessionModel* m_model{nullptr};
+  std::unique_ptr<ModelListener> m_listener;
+  std::vector<IViewModelController*> m_controllers;
+
+  //! parent -> (cache key of the strategy -> children)
+  std::unordered_map<const SessionItem*, std::map<std::string, ChildrenEntry>> m_children_cache;
+
+  //! parent -> (cache key of the child filter -> prefix counts)
+  std::unordered_map<const SessionItem*, std::map<std::string, PrefixCountEntry>>
+      m_prefix_count_cache;
+};
+
+}  // namespace mvvm
+
+#endif  // MVVM_VIEWMODEL_MODEL_VIEW_HUB_H_
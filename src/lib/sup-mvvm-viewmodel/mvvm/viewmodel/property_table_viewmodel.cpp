@@ -35,14 +35,14 @@ PropertyTableViewModel::PropertyTableViewModel(ISessionModel* model, QObject* pa
   SetController(factory::CreateController<TopItemsStrategy, PropertiesRowStrategy>(model, this));
 }
 
-void PropertyTableViewModel::insertRow(ViewItem* parent, int row,
-                                       std::vector<std::unique_ptr<ViewItem>> items)
+void PropertyTableViewModel::insertRows(ViewItem* parent, int row,
+                                        std::vector<std::vector<std::unique_ptr<ViewItem>>> rows)
 {
   // The code below is used to inform QTableView about layout change if the number
-  // of columns before the insertion doesn't coincide with the length of `items` vector to insert.
+  // of columns before the insertion doesn't coincide with the length of rows to insert.
   // This happens when PropertyTableViewModel is looking on empty SessionModel.
   int prev_column_count = parent->GetColumnCount();
-  ViewModel::insertRow(parent, row, std::move(items));
+  ViewModel::insertRows(parent, row, std::move(rows));
   if (parent->GetColumnCount() != prev_column_count)
   {
     emit layoutChanged();
@@ -39,7 +39,8 @@ class MVVM_VIEWMODEL_EXPORT PropertyTableViewModel : public ViewModel
 public:
   explicit PropertyTableViewModel(ISessionModel* model, QObject* parent_object = nullptr);
 
-  void insertRow(ViewItem* parent, int row, std::vector<std::unique_ptr<ViewItem>> items) override;
+  void insertRows(ViewItem* parent, int row,
+                  std::vector<std::vector<std::unique_ptr<ViewItem>>> rows) override;
 };
 
 }  // namespace mvvm
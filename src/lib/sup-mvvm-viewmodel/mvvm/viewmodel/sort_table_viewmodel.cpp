@@ -0,0 +1,718 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "sort_table_viewmodel.h"
+
+#include "viewmodel.h"
+
+#include <mvvm/core/variant.h>
+#include <mvvm/model/session_item.h>
+#include <mvvm/viewmodelbase/viewitem.h>
+
+#include <QPointer>
+#include <QVector>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <variant>
+
+namespace
+{
+
+//! Typed sort key of a cell. Keys of different kinds are ordered by the kind, empty key first.
+using sort_key_t = std::variant<std::monostate, std::int64_t, std::uint64_t, double, std::string>;
+
+//! Returns sort key for the data of SessionItem.
+sort_key_t GetSortKey(const mvvm::variant_t &value)
+{
+  auto to_key = [](const auto &arg) -> sort_key_t
+  {
+    using T = std::decay_t<decltype(arg)>;
+    if constexpr (std::is_same_v<T, std::string>)
+    {
+      return arg;
+    }
+    else if constexpr (std::is_same_v<T, mvvm::ComboProperty>)
+    {
+      return arg.GetValue();
+    }
+    else if constexpr (std::is_same_v<T, mvvm::ExternalProperty>)
+    {
+      return arg.GetText();
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+      // NaN would break the ordering of keys
+      return std::isnan(arg) ? sort_key_t{} : sort_key_t{static_cast<double>(arg)};
+    }
+    else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+    {
+      return static_cast<std::int64_t>(arg);
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+      return static_cast<std::uint64_t>(arg);
+    }
+    else
+    {
+      return {};  // arrays aren't sortable
+    }
+  };
+  return std::visit(to_key, value);
+}
+
+//! Returns sort key for display data of a cell of arbitrary model.
+sort_key_t GetSortKey(const QVariant &value)
+{
+  switch (value.userType())
+  {
+  case QMetaType::UnknownType:
+    return {};
+  case QMetaType::Bool:
+  case QMetaType::Char:
+  case QMetaType::SChar:
+  case QMetaType::Short:
+  case QMetaType::Int:
+  case QMetaType::Long:
+  case QMetaType::LongLong:
+    return static_cast<std::int64_t>(value.toLongLong());
+  case QMetaType::UChar:
+  case QMetaType::UShort:
+  case QMetaType::UInt:
+  case QMetaType::ULong:
+  case QMetaType::ULongLong:
+    return static_cast<std::uint64_t>(value.toULongLong());
+  case QMetaType::Float:
+  case QMetaType::Double:
+    return std::isnan(value.toDouble()) ? sort_key_t{} : sort_key_t{value.toDouble()};
+  default:
+    return value.toString().toStdString();
+  }
+}
+
+}  // namespace
+
+namespace mvvm
+{
+
+struct SortTableViewModel::SortTableViewModelImpl
+{
+  SortTableViewModel *m_self{nullptr};
+  QPointer<QAbstractItemModel> m_source;
+  const ViewModel *m_source_view_model{nullptr};  //!< source as ViewModel, if it is the one
+  std::vector<QMetaObject::Connection> m_connections;
+  std::vector<SortColumn> m_sort_columns;
+  bool m_sort_by_display_data{false};  //!< ViewModel rows are sorted by display data of views
+
+  std::vector<int> m_proxy_to_source;  //!< source row of every proxy row
+  mutable std::vector<int> m_source_to_proxy;  //!< proxy row of every source row, built on demand
+  mutable bool m_is_source_map_valid{false};
+
+  //! Keys of all sort columns for every source row, row after row.
+  std::vector<sort_key_t> m_keys;
+
+  //! Source indexes of persistent proxy indexes while the source layout is changing.
+  QModelIndexList m_layout_proxy_indexes;
+  QList<QPersistentModelIndex> m_layout_source_indexes;
+
+  explicit SortTableViewModelImpl(SortTableViewModel *self) : m_self(self) {}
+
+  void SetSourceModel(QAbstractItemModel *source)
+  {
+    for (const auto &connection : m_connections)
+    {
+      QObject::disconnect(connection);
+    }
+    m_connections.clear();
+    m_source = source;
+    m_source_view_model = qobject_cast<const ViewModel *>(source);
+
+    if (!m_source)
+    {
+      return;
+    }
+
+    auto on_rows_inserted = [this](const QModelIndex &parent, int first, int last)
+    { OnRowsInserted(parent, first, last); };
+    m_connections.push_back(QObject::connect(m_source, &QAbstractItemModel::rowsInserted, m_self,
+                                             on_rows_inserted));
+
+    auto on_rows_about_to_be_removed = [this](const QModelIndex &parent, int first, int last)
+    { OnRowsAboutToBeRemoved(parent, first, last); };
+    m_connections.push_back(QObject::connect(m_source,
+                                             &QAbstractItemModel::rowsAboutToBeRemoved, m_self,
+                                             on_rows_about_to_be_removed));
+
+    auto on_rows_removed = [this](const QModelIndex &parent, int first, int last)
+    { OnRowsRemoved(parent, first, last); };
+    m_connections.push_back(
+        QObject::connect(m_source, &QAbstractItemModel::rowsRemoved, m_self, on_rows_removed));
+
+    auto on_data_changed = [this](const QModelIndex &top_left, const QModelIndex &bottom_right,
+                                  const QVector<int> &roles)
+    { OnDataChanged(top_left, bottom_right, roles); };
+    m_connections.push_back(
+        QObject::connect(m_source, &QAbstractItemModel::dataChanged, m_self, on_data_changed));
+
+    auto on_header_data_changed = [this](Qt::Orientation orientation, int first, int last)
+    {
+      if (orientation == Qt::Horizontal)
+      {
+        emit m_self->headerDataChanged(orientation, first, last);
+      }
+    };
+    m_connections.push_back(QObject::connect(m_source, &QAbstractItemModel::headerDataChanged,
+                                             m_self, on_header_data_changed));
+
+    auto on_layout_about_to_be_changed = [this]() { OnLayoutAboutToBeChanged(); };
+    m_connections.push_back(QObject::connect(m_source,
+                                             &QAbstractItemModel::layoutAboutToBeChanged, m_self,
+                                             on_layout_about_to_be_changed));
+
+    auto on_layout_changed = [this]() { OnLayoutChanged(); };
+    m_connections.push_back(QObject::connect(m_source, &QAbstractItemModel::layoutChanged, m_self,
+                                             on_layout_changed));
+
+    auto on_destroyed = [this]()
+    {
+      m_self->beginResetModel();
+      m_source_view_model = nullptr;
+      Rebuild();
+      m_self->endResetModel();
+    };
+    m_connections.push_back(
+        QObject::connect(m_source, &QObject::destroyed, m_self, on_destroyed));
+
+    // other structural changes of the source are rare, the proxy is reset
+    auto on_about_to_be_reset = [this]() { m_self->beginResetModel(); };
+    auto on_reset = [this]()
+    {
+      Rebuild();
+      m_self->endResetModel();
+    };
+    m_connections.push_back(QObject::connect(m_source, &QAbstractItemModel::modelAboutToBeReset,
+                                             m_self, on_about_to_be_reset));
+    m_connections.push_back(
+        QObject::connect(m_source, &QAbstractItemModel::modelReset, m_self, on_reset));
+    m_connections.push_back(QObject::connect(m_source, &QAbstractItemModel::rowsAboutToBeMoved,
+                                             m_self, on_about_to_be_reset));
+    m_connections.push_back(
+        QObject::connect(m_source, &QAbstractItemModel::rowsMoved, m_self, on_reset));
+    m_connections.push_back(QObject::connect(
+        m_source, &QAbstractItemModel::columnsAboutToBeInserted, m_self, on_about_to_be_reset));
+    m_connections.push_back(
+        QObject::connect(m_source, &QAbstractItemModel::columnsInserted, m_self, on_reset));
+    m_connections.push_back(QObject::connect(
+        m_source, &QAbstractItemModel::columnsAboutToBeRemoved, m_self, on_about_to_be_reset));
+    m_connections.push_back(
+        QObject::connect(m_source, &QAbstractItemModel::columnsRemoved, m_self, on_reset));
+    m_connections.push_back(QObject::connect(
+        m_source, &QAbstractItemModel::columnsAboutToBeMoved, m_self, on_about_to_be_reset));
+    m_connections.push_back(
+        QObject::connect(m_source, &QAbstractItemModel::columnsMoved, m_self, on_reset));
+  }
+
+  int GetSourceRowCount() const { return m_source ? m_source->rowCount() : 0; }
+
+  std::size_t GetKeyCount() const { return m_sort_columns.size(); }
+
+  /**
+   * @brief Returns the sort key of the cell of the source model.
+   */
+  sort_key_t ExtractKey(int source_row, int column) const
+  {
+    const auto index = m_source->index(source_row, column);
+    if (!index.isValid())
+    {
+      return {};
+    }
+
+    if (!m_source_view_model)
+    {
+      return GetSortKey(index.data(Qt::DisplayRole));
+    }
+
+    if (m_sort_by_display_data)
+    {
+      // views of ViewModel provide display data without the lookup through the source model
+      auto view = m_source_view_model->GetViewItemFromIndex(index);
+      return view ? GetSortKey(view->Data(Qt::DisplayRole)) : sort_key_t{};
+    }
+
+    auto item = m_source_view_model->GetSessionItemFromIndex(index);
+    if (!item)
+    {
+      return {};
+    }
+    // items without data, e.g. in the label column, are sorted by their names
+    const auto data = item->Data();
+    return std::holds_alternative<std::monostate>(data) ? sort_key_t{item->GetDisplayName()}
+                                                        : GetSortKey(data);
+  }
+
+  /**
+   * @brief Extracts keys of all sort columns of the source row into the key table.
+   *
+   * Returns true if keys have changed.
+   */
+  bool UpdateKeys(int source_row)
+  {
+    bool is_changed{false};
+    const auto offset = static_cast<std::size_t>(source_row) * GetKeyCount();
+    for (std::size_t key_index = 0; key_index < GetKeyCount(); ++key_index)
+    {
+      auto key = ExtractKey(source_row, m_sort_columns[key_index].column);
+      if (key != m_keys[offset + key_index])
+      {
+        m_keys[offset + key_index] = std::move(key);
+        is_changed = true;
+      }
+    }
+    return is_changed;
+  }
+
+  /**
+   * @brief Checks if the source row is shown before the other source row.
+   *
+   * Rows are compared by keys of sort columns one after another, rows with equal keys are in the
+   * order of the source. The ordering is strict, so no two rows are equivalent.
+   */
+  bool IsLess(int source_row, int other_source_row) const
+  {
+    const auto offset = static_cast<std::size_t>(source_row) * GetKeyCount();
+    const auto other_offset = static_cast<std::size_t>(other_source_row) * GetKeyCount();
+    for (std::size_t key_index = 0; key_index < GetKeyCount(); ++key_index)
+    {
+      const auto &key = m_keys[offset + key_index];
+      const auto &other_key = m_keys[other_offset + key_index];
+      if (key == other_key)
+      {
+        continue;
+      }
+      return m_sort_columns[key_index].order == Qt::AscendingOrder ? key < other_key
+                                                                   : other_key < key;
+    }
+    return source_row < other_source_row;
+  }
+
+  /**
+   * @brief Returns the proxy row where the source row should be inserted.
+   */
+  int FindInsertRow(int source_row) const
+  {
+    auto is_less = [this](int row, int other_row) { return IsLess(row, other_row); };
+    auto pos = std::lower_bound(m_proxy_to_source.begin(), m_proxy_to_source.end(), source_row,
+                                is_less);
+    return static_cast<int>(std::distance(m_proxy_to_source.begin(), pos));
+  }
+
+  int GetProxyRow(int source_row) const
+  {
+    if (!m_is_source_map_valid)
+    {
+      // the source might have more rows than the proxy while rows are being inserted
+      const auto source_row_count = static_cast<std::size_t>(GetSourceRowCount());
+      m_source_to_proxy.assign(std::max(source_row_count, m_proxy_to_source.size()), -1);
+      for (std::size_t proxy_row = 0; proxy_row < m_proxy_to_source.size(); ++proxy_row)
+      {
+        const auto mapped_row = static_cast<std::size_t>(m_proxy_to_source[proxy_row]);
+        if (mapped_row < m_source_to_proxy.size())
+        {
+          m_source_to_proxy[mapped_row] = static_cast<int>(proxy_row);
+        }
+      }
+      m_is_source_map_valid = true;
+    }
+    return source_row >= 0 && source_row < static_cast<int>(m_source_to_proxy.size())
+               ? m_source_to_proxy[source_row]
+               : -1;
+  }
+
+  /**
+   * @brief Extracts keys of all rows of the source model and sorts them.
+   */
+  void Rebuild()
+  {
+    const int row_count = GetSourceRowCount();
+    m_keys.assign(static_cast<std::size_t>(row_count) * GetKeyCount(), {});
+    for (int source_row = 0; source_row < row_count; ++source_row)
+    {
+      UpdateKeys(source_row);
+    }
+    m_proxy_to_source.resize(row_count);
+    std::iota(m_proxy_to_source.begin(), m_proxy_to_source.end(), 0);
+    Sort();
+  }
+
+  void Sort()
+  {
+    if (GetKeyCount() > 0)
+    {
+      auto is_less = [this](int row, int other_row) { return IsLess(row, other_row); };
+      std::sort(m_proxy_to_source.begin(), m_proxy_to_source.end(), is_less);
+    }
+    m_is_source_map_valid = false;
+  }
+
+  /**
+   * @brief Sorts rows again after the change of sort columns, updating persistent indexes.
+   */
+  void Resort()
+  {
+    emit m_self->layoutAboutToBeChanged({}, QAbstractItemModel::VerticalSortHint);
+    const auto proxy_indexes = m_self->persistentIndexList();
+    std::vector<std::pair<int, int>> source_cells;  // source row and column of every index
+    source_cells.reserve(proxy_indexes.size());
+    for (const auto &index : proxy_indexes)
+    {
+      source_cells.emplace_back(m_proxy_to_source[index.row()], index.column());
+    }
+
+    Rebuild();
+
+    QModelIndexList new_indexes;
+    new_indexes.reserve(proxy_indexes.size());
+    for (const auto &[source_row, column] : source_cells)
+    {
+      new_indexes.push_back(m_self->index(GetProxyRow(source_row), column));
+    }
+    m_self->changePersistentIndexList(proxy_indexes, new_indexes);
+    emit m_self->layoutChanged({}, QAbstractItemModel::VerticalSortHint);
+  }
+
+  void OnRowsInserted(const QModelIndex &parent, int first, int last)
+  {
+    if (parent.isValid())
+    {
+      return;
+    }
+
+    const int count = last - first + 1;
+    for (auto &source_row : m_proxy_to_source)
+    {
+      if (source_row >= first)
+      {
+        source_row += count;
+      }
+    }
+    m_keys.insert(m_keys.begin() + static_cast<std::ptrdiff_t>(first * GetKeyCount()),
+                  static_cast<std::size_t>(count) * GetKeyCount(), sort_key_t{});
+    m_is_source_map_valid = false;
+
+    for (int source_row = first; source_row <= last; ++source_row)
+    {
+      UpdateKeys(source_row);
+      const int proxy_row = FindInsertRow(source_row);
+      m_self->beginInsertRows(QModelIndex(), proxy_row, proxy_row);
+      m_proxy_to_source.insert(m_proxy_to_source.begin() + proxy_row, source_row);
+      m_is_source_map_valid = false;
+      m_self->endInsertRows();
+    }
+  }
+
+  void OnRowsAboutToBeRemoved(const QModelIndex &parent, int first, int last)
+  {
+    if (parent.isValid())
+    {
+      return;
+    }
+
+    std::vector<int> proxy_rows;
+    for (int source_row = first; source_row <= last; ++source_row)
+    {
+      proxy_rows.push_back(GetProxyRow(source_row));
+    }
+    std::sort(proxy_rows.begin(), proxy_rows.end());
+
+    // removing ranges of adjacent proxy rows, starting from the end
+    int range_end = static_cast<int>(proxy_rows.size()) - 1;
+    while (range_end >= 0)
+    {
+      int range_begin = range_end;
+      while (range_begin > 0 && proxy_rows[range_begin - 1] + 1 == proxy_rows[range_begin])
+      {
+        --range_begin;
+      }
+      m_self->beginRemoveRows(QModelIndex(), proxy_rows[range_begin], proxy_rows[range_end]);
+      m_proxy_to_source.erase(m_proxy_to_source.begin() + proxy_rows[range_begin],
+                              m_proxy_to_source.begin() + proxy_rows[range_end] + 1);
+      m_is_source_map_valid = false;
+      m_self->endRemoveRows();
+      range_end = range_begin - 1;
+    }
+  }
+
+  void OnRowsRemoved(const QModelIndex &parent, int first, int last)
+  {
+    if (parent.isValid())
+    {
+      return;
+    }
+
+    const int count = last - first + 1;
+    for (auto &source_row : m_proxy_to_source)
+    {
+      if (source_row > last)
+      {
+        source_row -= count;
+      }
+    }
+    m_keys.erase(m_keys.begin() + static_cast<std::ptrdiff_t>(first * GetKeyCount()),
+                 m_keys.begin() + static_cast<std::ptrdiff_t>((last + 1) * GetKeyCount()));
+    m_is_source_map_valid = false;
+  }
+
+  /**
+   * @brief Moves the source row with the changed key to its new proxy position.
+   */
+  void Reposition(int source_row)
+  {
+    const int proxy_row = GetProxyRow(source_row);
+    const int row_count = static_cast<int>(m_proxy_to_source.size());
+    auto is_less = [this](int row, int other_row) { return IsLess(row, other_row); };
+    auto begin = m_proxy_to_source.begin();
+
+    int destination{proxy_row};  // destination row in coordinates before the move
+    if (proxy_row > 0 && IsLess(source_row, m_proxy_to_source[proxy_row - 1]))
+    {
+      auto pos = std::lower_bound(begin, begin + proxy_row, source_row, is_less);
+      destination = static_cast<int>(std::distance(begin, pos));
+    }
+    else if (proxy_row + 1 < row_count && IsLess(m_proxy_to_source[proxy_row + 1], source_row))
+    {
+      auto pos = std::lower_bound(begin + proxy_row + 1, m_proxy_to_source.end(), source_row,
+                                  is_less);
+      destination = static_cast<int>(std::distance(begin, pos));
+    }
+
+    if (destination == proxy_row)
+    {
+      return;  // the row is still in order with its neighbours
+    }
+
+    m_self->beginMoveRows(QModelIndex(), proxy_row, proxy_row, QModelIndex(), destination);
+    int first{0};
+    int last{0};
+    if (destination < proxy_row)
+    {
+      std::rotate(begin + destination, begin + proxy_row, begin + proxy_row + 1);
+      first = destination;
+      last = proxy_row;
+    }
+    else
+    {
+      std::rotate(begin + proxy_row, begin + proxy_row + 1, begin + destination);
+      first = proxy_row;
+      last = destination - 1;
+    }
+    for (int row = first; row <= last; ++row)
+    {
+      m_source_to_proxy[m_proxy_to_source[row]] = row;
+    }
+    m_self->endMoveRows();
+  }
+
+  void OnDataChanged(const QModelIndex &top_left, const QModelIndex &bottom_right,
+                     const QVector<int> &roles)
+  {
+    if (!top_left.isValid() || top_left.parent().isValid())
+    {
+      return;
+    }
+
+    auto is_sort_column = [&top_left, &bottom_right](const SortColumn &sort_column)
+    {
+      return sort_column.column >= top_left.column() && sort_column.column <= bottom_right.column();
+    };
+    const bool is_key_changed =
+        std::any_of(m_sort_columns.begin(), m_sort_columns.end(), is_sort_column);
+
+    for (int source_row = top_left.row(); source_row <= bottom_right.row(); ++source_row)
+    {
+      if (is_key_changed && UpdateKeys(source_row))
+      {
+        Reposition(source_row);
+      }
+      if (const int proxy_row = GetProxyRow(source_row); proxy_row >= 0)
+      {
+        emit m_self->dataChanged(m_self->index(proxy_row, top_left.column()),
+                                 m_self->index(proxy_row, bottom_right.column()), roles);
+      }
+    }
+  }
+
+  void OnLayoutAboutToBeChanged()
+  {
+    emit m_self->layoutAboutToBeChanged();
+    m_layout_proxy_indexes = m_self->persistentIndexList();
+    m_layout_source_indexes.clear();
+    for (const auto &index : m_layout_proxy_indexes)
+    {
+      m_layout_source_indexes.push_back(m_self->mapToSource(index));
+    }
+  }
+
+  void OnLayoutChanged()
+  {
+    Rebuild();
+
+    QModelIndexList new_indexes;
+    for (const auto &source_index : m_layout_source_indexes)
+    {
+      new_indexes.push_back(m_self->mapFromSource(source_index));
+    }
+    m_self->changePersistentIndexList(m_layout_proxy_indexes, new_indexes);
+    m_layout_proxy_indexes.clear();
+    m_layout_source_indexes.clear();
+    emit m_self->layoutChanged();
+  }
+};
+
+SortTableViewModel::SortTableViewModel(QObject *parent_object)
+    : QAbstractProxyModel(parent_object), p_impl(std::make_unique<SortTableViewModelImpl>(this))
+{
+}
+
+SortTableViewModel::~SortTableViewModel() = default;
+
+void SortTableViewModel::SetSortColumns(const std::vector<SortColumn> &sort_columns)
+{
+  p_impl->m_sort_columns = sort_columns;
+  p_impl->Resort();
+}
+
+std::vector<SortTableViewModel::SortColumn> SortTableViewModel::GetSortColumns() const
+{
+  return p_impl->m_sort_columns;
+}
+
+void SortTableViewModel::SetSortByDisplayData(bool value)
+{
+  if (p_impl->m_sort_by_display_data != value)
+  {
+    p_impl->m_sort_by_display_data = value;
+    p_impl->Resort();
+  }
+}
+
+bool SortTableViewModel::IsSortByDisplayData() const
+{
+  return p_impl->m_sort_by_display_data;
+}
+
+void SortTableViewModel::sort(int column, Qt::SortOrder order)
+{
+  if (column < 0)
+  {
+    SetSortColumns({});
+    return;
+  }
+
+  // previous sort columns keep their order as secondary ones, as after a stable sort
+  std::vector<SortColumn> sort_columns({{column, order}});
+  for (const auto &sort_column : p_impl->m_sort_columns)
+  {
+    if (sort_column.column != column)
+    {
+      sort_columns.push_back(sort_column);
+    }
+  }
+  SetSortColumns(sort_columns);
+}
+
+void SortTableViewModel::setSourceModel(QAbstractItemModel *source_model)
+{
+  if (source_model == sourceModel())
+  {
+    return;
+  }
+
+  beginResetModel();
+  p_impl->SetSourceModel(source_model);
+  QAbstractProxyModel::setSourceModel(source_model);
+  p_impl->Rebuild();
+  endResetModel();
+}
+
+QModelIndex SortTableViewModel::mapToSource(const QModelIndex &proxy_index) const
+{
+  if (!p_impl->m_source || !proxy_index.isValid() || proxy_index.model() != this)
+  {
+    return {};
+  }
+  return p_impl->m_source->index(p_impl->m_proxy_to_source[proxy_index.row()],
+                                 proxy_index.column());
+}
+
+QModelIndex SortTableViewModel::mapFromSource(const QModelIndex &source_index) const
+{
+  if (!p_impl->m_source || !source_index.isValid() || source_index.model() != p_impl->m_source
+      || source_index.parent().isValid())
+  {
+    return {};
+  }
+  return index(p_impl->GetProxyRow(source_index.row()), source_index.column());
+}
+
+QModelIndex SortTableViewModel::index(int row, int column, const QModelIndex &parent) const
+{
+  return hasIndex(row, column, parent) ? createIndex(row, column) : QModelIndex();
+}
+
+QModelIndex SortTableViewModel::parent(const QModelIndex &child) const
+{
+  (void)child;
+  return {};
+}
+
+int SortTableViewModel::rowCount(const QModelIndex &parent) const
+{
+  return parent.isValid() ? 0 : static_cast<int>(p_impl->m_proxy_to_source.size());
+}
+
+int SortTableViewModel::columnCount(const QModelIndex &parent) const
+{
+  return parent.isValid() || !p_impl->m_source ? 0 : p_impl->m_source->columnCount();
+}
+
+bool SortTableViewModel::hasChildren(const QModelIndex &parent) const
+{
+  return rowCount(parent) > 0;
+}
+
+QVariant SortTableViewModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+  if (!p_impl->m_source)
+  {
+    return {};
+  }
+
+  // columns are the same as in the source, rows show their source numbers
+  if (orientation == Qt::Vertical && section >= 0 && section < rowCount())
+  {
+    section = p_impl->m_proxy_to_source[section];
+  }
+  return p_impl->m_source->headerData(section, orientation, role);
+}
+
+}  // namespace mvvm
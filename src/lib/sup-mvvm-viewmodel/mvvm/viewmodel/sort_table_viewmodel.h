@@ -0,0 +1,126 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_VIEWMODEL_SORT_TABLE_VIEWMODEL_H_
+#define MVVM_VIEWMODEL_SORT_TABLE_VIEWMODEL_H_
+
+#include <mvvm/viewmodel_export.h>
+
+#include <QAbstractProxyModel>
+
+#include <memory>
+#include <vector>
+
+namespace mvvm
+{
+
+/**
+ * @brief The SortTableViewModel class is a proxy model which sorts rows of a flat table, like the
+ * one of PropertyTableViewModel, by values of one or more columns.
+ *
+ * Sort keys are extracted once per row from data of SessionItem of sort columns, and are compared
+ * as numbers or strings without conversion to QVariant. If the source model isn't a ViewModel,
+ * keys are extracted from display data of cells. Rows with equal keys keep the order of the source
+ * model, so the sorting is stable. Rows of ViewModel can be sorted by what is shown instead, see
+ * SetSortByDisplayData().
+ *
+ * The order is maintained when the source model changes: new rows are inserted at their sorted
+ * position, a row whose sort key has changed is moved to its new position using the binary search.
+ * The whole table is sorted again only when sort columns change.
+ *
+ * Only top level rows of the source model are shown, their children are ignored.
+ */
+class MVVM_VIEWMODEL_EXPORT SortTableViewModel : public QAbstractProxyModel
+{
+  Q_OBJECT
+
+public:
+  /**
+   * @brief The SortColumn struct defines a column to sort by, and the sort order.
+   */
+  struct SortColumn
+  {
+    int column{0};
+    Qt::SortOrder order{Qt::AscendingOrder};
+  };
+
+  explicit SortTableViewModel(QObject* parent_object = nullptr);
+  ~SortTableViewModel() override;
+
+  /**
+   * @brief Sets columns to sort by, the first column is the primary one.
+   *
+   * An empty list restores the order of the source model.
+   */
+  void SetSortColumns(const std::vector<SortColumn>& sort_columns);
+
+  /**
+   * @brief Returns columns to sort by.
+   */
+  std::vector<SortColumn> GetSortColumns() const;
+
+  /**
+   * @brief Sets whether rows of ViewModel are sorted by display data of views, instead of data of
+   * SessionItem.
+   *
+   * Display data is converted to keys through QVariant, cells of custom types (e.g. ComboProperty)
+   * are sorted by their display text only if their views provide one. Off by default.
+   */
+  void SetSortByDisplayData(bool value);
+
+  /**
+   * @brief Checks if rows of ViewModel are sorted by display data of views.
+   */
+  bool IsSortByDisplayData() const;
+
+  /**
+   * @brief Makes the given column the primary sort column, previous sort columns become secondary.
+   *
+   * This is what the view calls on a click on the header. A negative column resets sorting.
+   */
+  void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) override;
+
+  void setSourceModel(QAbstractItemModel* source_model) override;
+
+  QModelIndex mapToSource(const QModelIndex& proxy_index) const override;
+
+  QModelIndex mapFromSource(const QModelIndex& source_index) const override;
+
+  QModelIndex index(int row, int column, const QModelIndex& parent = QModelIndex()) const override;
+
+  QModelIndex parent(const QModelIndex& child) const override;
+
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+  int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+
+  bool hasChildren(const QModelIndex& parent = QModelIndex()) const override;
+
+  QVariant headerData(int section, Qt::Orientation orientation,
+                      int role = Qt::DisplayRole) const override;
+
+private:
+  struct SortTableViewModelImpl;
+  std::unique_ptr<SortTableViewModelImpl> p_impl;
+};
+
+}  // namespace mvvm
+
+#endif  // MVVM_VIEWMODEL_SORT_TABLE_VIEWMODEL_H_
@@ -25,6 +25,34 @@
 #include <mvvm/utils/container_utils.h>
 
 #include <algorithm>
+#include <typeinfo>
+
+namespace
+{
+
+/**
+ * @brief Returns given cache key if the strategy is exactly of type T.
+ *
+ * Derived strategies might report other children, their results are not shared.
+ */
+template <typename T>
+std::string GetCacheKeyOfExactType(const T& strategy, std::string key)
+{
+  return typeid(strategy) == typeid(T) ? key : std::string();
+}
+
+/**
+ * @brief Checks if the strategy is exactly of type T.
+ *
+ * Derived strategies might report children differently, they are not treated as child filters.
+ */
+template <typename T>
+bool IsOfExactType(const T& strategy)
+{
+  return typeid(strategy) == typeid(T);
+}
+
+}  // namespace
 
 namespace mvvm
 {
@@ -35,6 +63,22 @@ std::vector<SessionItem*> AllChildrenStrategy::GetChildren(const SessionItem* it
   return item ? item->GetAllItems() : std::vector<SessionItem*>();
 }
 
+std::string AllChildrenStrategy::GetCacheKey() const
+{
+  return GetCacheKeyOfExactType(*this, "AllChildrenStrategy");
+}
+
+bool AllChildrenStrategy::IsChildFilter() const
+{
+  return IsOfExactType(*this);
+}
+
+bool AllChildrenStrategy::IsReportedChild(const SessionItem& child) const
+{
+  (void)child;
+  return true;
+}
+
 std::vector<SessionItem*> AllVisibleChildrenStrategy::GetChildren(const SessionItem* item) const
 {
   if (!item)
@@ -49,16 +93,61 @@ std::vector<SessionItem*> AllVisibleChildrenStrategy::GetChildren(const SessionI
   return result;
 }
 
+std::string AllVisibleChildrenStrategy::GetCacheKey() const
+{
+  return GetCacheKeyOfExactType(*this, "AllVisibleChildrenStrategy");
+}
+
+bool AllVisibleChildrenStrategy::IsChildFilter() const
+{
+  return IsOfExactType(*this);
+}
+
+bool AllVisibleChildrenStrategy::IsReportedChild(const SessionItem& child) const
+{
+  return child.IsVisible();
+}
+
 std::vector<SessionItem*> TopItemsStrategy::GetChildren(const SessionItem* item) const
 {
   return item ? utils::TopLevelItems(*item) : std::vector<SessionItem*>();
 }
 
+std::string TopItemsStrategy::GetCacheKey() const
+{
+  return GetCacheKeyOfExactType(*this, "TopItemsStrategy");
+}
+
+bool TopItemsStrategy::IsChildFilter() const
+{
+  return IsOfExactType(*this);
+}
+
+bool TopItemsStrategy::IsReportedChild(const SessionItem& child) const
+{
+  return child.IsVisible() && !utils::HasAppearanceFlag(child, kProperty);
+}
+
 std::vector<SessionItem*> PropertyItemsStrategy::GetChildren(const SessionItem* item) const
 {
   return item ? utils::SinglePropertyItems(*item) : std::vector<SessionItem*>();
 }
 
+std::string PropertyItemsStrategy::GetCacheKey() const
+{
+  return GetCacheKeyOfExactType(*this, "PropertyItemsStrategy");
+}
+
+bool PropertyItemsStrategy::IsChildFilter() const
+{
+  return IsOfExactType(*this);
+}
+
+bool PropertyItemsStrategy::IsReportedChild(const SessionItem& child) const
+{
+  return child.IsVisible() && utils::HasAppearanceFlag(child, kProperty);
+}
+
 FixedItemTypeStrategy::FixedItemTypeStrategy(std::vector<std::string> item_types)
     : m_item_types(std::move(item_types))
 {
@@ -82,4 +171,24 @@ std::vector<SessionItem*> FixedItemTypeStrategy::GetChildren(const SessionItem*
   return result;
 }
 
+std::string FixedItemTypeStrategy::GetCacheKey() const
+{
+  std::string result("FixedItemTypeStrategy");
+  for (const auto& item_type : m_item_types)
+  {
+    result += ";" + item_type;
+  }
+  return GetCacheKeyOfExactType(*this, result);
+}
+
+bool FixedItemTypeStrategy::IsChildFilter() const
+{
+  return IsOfExactType(*this);
+}
+
+bool FixedItemTypeStrategy::IsReportedChild(const SessionItem& child) const
+{
+  return utils::Contains(m_item_types, child.GetType());
+}
+
 }  // namespace mvvm
@@ -43,6 +43,12 @@ class MVVM_VIEWMODEL_EXPORT AllChildrenStrategy : public IChildrenStrategy
 {
 public:
   std::vector<SessionItem*> GetChildren(const SessionItem* item) const override;
+
+  std::string GetCacheKey() const override;
+
+  bool IsChildFilter() const override;
+
+  bool IsReportedChild(const SessionItem& child) const override;
 };
 
 /**
@@ -52,6 +58,12 @@ class MVVM_VIEWMODEL_EXPORT AllVisibleChildrenStrategy : public IChildrenStrateg
 {
 public:
   std::vector<SessionItem*> GetChildren(const SessionItem* item) const override;
+
+  std::string GetCacheKey() const override;
+
+  bool IsChildFilter() const override;
+
+  bool IsReportedChild(const SessionItem& child) const override;
 };
 
 /**
@@ -64,6 +76,12 @@ class MVVM_VIEWMODEL_EXPORT TopItemsStrategy : public IChildrenStrategy
 {
 public:
   std::vector<SessionItem*> GetChildren(const SessionItem* item) const override;
+
+  std::string GetCacheKey() const override;
+
+  bool IsChildFilter() const override;
+
+  bool IsReportedChild(const SessionItem& child) const override;
 };
 
 /**
@@ -75,6 +93,12 @@ class MVVM_VIEWMODEL_EXPORT PropertyItemsStrategy : public IChildrenStrategy
 {
 public:
   std::vector<SessionItem*> GetChildren(const SessionItem* item) const override;
+
+  std::string GetCacheKey() const override;
+
+  bool IsChildFilter() const override;
+
+  bool IsReportedChild(const SessionItem& child) const override;
 };
 
 /**
@@ -87,6 +111,12 @@ public:
 
   std::vector<SessionItem*> GetChildren(const SessionItem* item) const override;
 
+  std::string GetCacheKey() const override;
+
+  bool IsChildFilter() const override;
+
+  bool IsReportedChild(const SessionItem& child) const override;
+
 private:
   std::vector<std::string> m_item_types;
 };
@@ -160,6 +160,11 @@ bool DataPresentationItem::SetData(const QVariant &data, int qt_role)
   return qt_role == Qt::EditRole ? GetItem()->SetData(GetStdVariant(data), GetDataRole()) : false;
 }
 
+bool DataPresentationItem::IsCacheable() const
+{
+  return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 // DisplayNamePresentationItem
 // ------------------------------------------------------------------------------------------------
@@ -218,6 +223,11 @@ QVariant EditableDisplayNamePresentationItem::Data(int qt_role) const
   return DataPresentationItem::Data(qt_role);
 }
 
+bool EditableDisplayNamePresentationItem::IsCacheable() const
+{
+  return false;
+}
+
 // ------------------------------------------------------------------------------------------------
 // FixedDataPresentationItem
 // ------------------------------------------------------------------------------------------------
@@ -112,6 +112,11 @@ public:
   QVariant Data(int qt_role) const override;
 
   bool SetData(const QVariant& data, int qt_role) override;
+
+  /**
+   * @brief Returns true, since display and edit data change only with the data of the item.
+   */
+  bool IsCacheable() const override;
 };
 
 /**
@@ -137,6 +142,11 @@ public:
   explicit EditableDisplayNamePresentationItem(SessionItem* item);
 
   QVariant Data(int qt_role) const override;
+
+  /**
+   * @brief Returns false, since the display name might depend on the position of the item.
+   */
+  bool IsCacheable() const override;
 };
 
 /**
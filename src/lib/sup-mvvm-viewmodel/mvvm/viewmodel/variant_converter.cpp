@@ -25,70 +25,22 @@
 #include <mvvm/core/mvvm_exceptions.h>
 
 #include <QMetaType>
-#include <functional>
-#include <map>
+#include <optional>
+#include <type_traits>
 
 namespace
 {
-using converter_func_t = std::function<mvvm::variant_t(const QVariant& variant)>;
-std::map<std::string, converter_func_t> CreateConverterMap()
-{
-  std::map<std::string, converter_func_t> result = {
-      {mvvm::constants::kEmptyQtTypeName,
-       [](const QVariant& /*variant*/) { return mvvm::variant_t(); }},
-
-      {mvvm::constants::kBooleanQtTypeName,
-       [](const QVariant& variant) { return mvvm::variant_t(variant.toBool()); }},
-
-      {mvvm::constants::kChar8QtTypeName,
-       [](const QVariant& variant) { return mvvm::variant_t(variant.value<mvvm::char8>()); }},
-
-      {mvvm::constants::kInt8QtTypeName,
-       [](const QVariant& variant) { return mvvm::variant_t(variant.value<mvvm::int8>()); }},
-
-      {mvvm::constants::kUInt8QtTypeName,
-       [](const QVariant& variant) { return mvvm::variant_t(variant.value<mvvm::uint8>()); }},
-
-      {mvvm::constants::kInt16QtTypeName,
-       [](const QVariant& variant) { return mvvm::variant_t(variant.value<mvvm::int16>()); }},
-
-      {mvvm::constants::kUInt16QtTypeName,
-       [](const QVariant& variant) { return mvvm::variant_t(variant.value<mvvm::uint16>()); }},
-
-      {mvvm::constants::kInt32QtTypeName,
-       [](const QVariant& variant) { return mvvm::variant_t(variant.toInt()); }},
-
-      {mvvm::constants::kUInt32QtTypeName,
-       [](const QVariant& variant) { return mvvm::variant_t(variant.toUInt()); }},
-
-      {mvvm::constants::kInt64QtTypeName,
-       [](const QVariant& variant) { return mvvm::variant_t(variant.value<mvvm::int64>()); }},
-
-      {mvvm::constants::kUInt64QtTypeName,
-       [](const QVariant& variant) { return mvvm::variant_t(variant.value<mvvm::uint64>()); }},
-
-      {mvvm::constants::kLongLongQtTypeName,
-       [](const QVariant& variant) { return mvvm::variant_t(variant.value<mvvm::int64>()); }},
-
-      {mvvm::constants::kFloat32QtTypeName,
-       [](const QVariant& variant) { return mvvm::variant_t(variant.toFloat()); }},
-
-      {mvvm::constants::kFloat64QtTypeName,
-       [](const QVariant& variant) { return mvvm::variant_t(variant.toDouble()); }},
-
-      {mvvm::constants::kStringQtTypeName,
-       [](const QVariant& variant) { return mvvm::variant_t(variant.toString().toStdString()); }},
-
-      {mvvm::constants::kStdVectorDoubleQtTypeName, [](const QVariant& variant)
-       { return mvvm::variant_t(variant.value<std::vector<double>>()); }},
 
-      {mvvm::constants::kComboPropertyQtTypeName, [](const QVariant& variant)
-       { return mvvm::variant_t(variant.value<mvvm::ComboProperty>()); }},
-
-      {mvvm::constants::kExternalPropertyQtTypeName, [](const QVariant& variant)
-       { return mvvm::variant_t(variant.value<mvvm::ExternalProperty>()); }}
-
-  };
+/**
+ * @brief Returns variant_t constructed from QVariant holding one of given custom types.
+ *
+ * Types are checked in turn against the metatype id of QVariant, ids are registered once.
+ */
+template <typename... Ts>
+std::optional<mvvm::variant_t> GetCustomStdVariant(const QVariant& variant, int type_id)
+{
+  std::optional<mvvm::variant_t> result;
+  (void)((type_id == qMetaTypeId<Ts>() && (result = variant.value<Ts>(), true)) || ...);
   return result;
 }
 
@@ -98,30 +50,76 @@ namespace mvvm
 {
 QVariant GetQtVariant(const variant_t& variant)
 {
-  if (utils::TypeName(variant) == constants::kVectorDoubleTypeName)
+  auto to_qt_variant = [](const auto& value) -> QVariant
   {
-    // shall we convert to supported QVector<double> instead?
-    return QVariant::fromValue(std::get<std::vector<double>>(variant));
-  }
+    using value_t = std::decay_t<decltype(value)>;
+    if constexpr (std::is_same_v<value_t, std::monostate>)
+    {
+      return {};
+    }
+    else if constexpr (std::is_same_v<value_t, std::string>)
+    {
+      //  converting std::string to QString
+      return QString::fromStdString(value);
+    }
+    else
+    {
+      return QVariant::fromValue(value);
+    }
+  };
+  return std::visit(to_qt_variant, variant);
+}
 
-  if (utils::TypeName(variant) == constants::kStringTypeName)
+variant_t GetStdVariant(const QVariant& variant)
+{
+  if (!variant.isValid())
   {
-    //  converting std::string to QString
-    return QVariant::fromValue(QString::fromStdString(std::get<std::string>(variant)));
+    return {};
   }
 
-  return QVariant::fromStdVariant(variant);
-}
+  const int type_id = variant.userType();
+  switch (type_id)
+  {
+  case QMetaType::Bool:
+    return variant_t(variant.toBool());
+  case QMetaType::Char:
+    return variant_t(variant.value<char8>());
+  case QMetaType::SChar:
+    return variant_t(variant.value<int8>());
+  case QMetaType::UChar:
+    return variant_t(variant.value<uint8>());
+  case QMetaType::Short:
+    return variant_t(variant.value<int16>());
+  case QMetaType::UShort:
+    return variant_t(variant.value<uint16>());
+  case QMetaType::Int:
+    return variant_t(variant.toInt());
+  case QMetaType::UInt:
+    return variant_t(variant.toUInt());
+  case QMetaType::Long:
+  case QMetaType::LongLong:
+    return variant_t(variant.value<int64>());
+  case QMetaType::ULong:
+    return variant_t(variant.value<uint64>());
+  case QMetaType::Float:
+    return variant_t(variant.toFloat());
+  case QMetaType::Double:
+    return variant_t(variant.toDouble());
+  case QMetaType::QString:
+    return variant_t(variant.toString().toStdString());
+  default:
+    break;
+  }
 
-variant_t GetStdVariant(const QVariant& variant)
-{
-  const static auto converter_map = CreateConverterMap();
-  auto iter = converter_map.find(utils::GetQtVariantName(variant));
-  if (iter == converter_map.end())
+  auto result =
+      GetCustomStdVariant<std::vector<double>, ComboProperty, ExternalProperty, SharedArray<double>,
+                          std::vector<float32>, std::vector<int32>, std::vector<int64>,
+                          std::vector<uint16>>(variant, type_id);
+  if (!result.has_value())
   {
     throw RuntimeException("Unsupported Qt variant");
   }
-  return iter->second(variant);
+  return std::move(result.value());
 }
 
 }  // namespace mvvm
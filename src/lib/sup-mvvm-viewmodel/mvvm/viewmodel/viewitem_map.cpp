@@ -43,6 +43,17 @@ ViewItem *ViewItemMap::FindView(const SessionItem *const item) const
   return iter == m_item_to_view.end() ? nullptr : iter->second;
 }
 
+void ViewItemMap::AddView(const SessionItem *const item, ViewItem *const view_item)
+{
+  m_item_to_all_views[item].push_back(view_item);
+}
+
+std::vector<ViewItem *> ViewItemMap::FindAllViews(const SessionItem *const item) const
+{
+  const auto iter = m_item_to_all_views.find(item);
+  return iter == m_item_to_all_views.end() ? std::vector<ViewItem *>() : iter->second;
+}
+
 void ViewItemMap::Remove(const SessionItem *const item)
 {
   const auto iter = m_item_to_view.find(item);
@@ -64,6 +75,7 @@ void ViewItemMap::OnItemRemove(const SessionItem *const item)
     {
       m_item_to_view.erase(iter);
     }
+    m_item_to_all_views.erase(item);
     return true;
   };
   utils::iterate_if(item, on_item);
@@ -72,6 +84,7 @@ void ViewItemMap::OnItemRemove(const SessionItem *const item)
 void ViewItemMap::Clear()
 {
   m_item_to_view.clear();
+  m_item_to_all_views.clear();
 }
 
 int ViewItemMap::GetSize() const
@@ -24,6 +24,8 @@
 #include <mvvm/viewmodel_export.h>
 
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 namespace mvvm
 {
@@ -50,6 +52,19 @@ public:
    */
   ViewItem* FindView(const SessionItem* item) const;
 
+  /**
+   * @brief Registers one of the views presenting the given item.
+   *
+   * Unlike Insert, the item can have many views, i.e. all cells of its row, or cells in rows of
+   * other items.
+   */
+  void AddView(const SessionItem* item, ViewItem* view_item);
+
+  /**
+   * @brief Returns all views presenting given item.
+   */
+  std::vector<ViewItem*> FindAllViews(const SessionItem* item) const;
+
   /**
    * @brief Removes view corresponding to given item.
    */
@@ -57,6 +72,8 @@ public:
 
   /**
    * @brief Remove item, all its children and their corresponsding views from the map.
+   *
+   * All views presenting removed items are forgotten too.
    */
   void OnItemRemove(const SessionItem* item);
 
@@ -72,6 +89,7 @@ public:
 
 private:
   std::map<const SessionItem*, ViewItem*> m_item_to_view;
+  std::unordered_map<const SessionItem*, std::vector<ViewItem*>> m_item_to_all_views;
 };
 
 }  // namespace mvvm
@@ -26,6 +26,8 @@
 #include <mvvm/model/i_session_model.h>
 #include <mvvm/model/session_item.h>
 
+#include <unordered_set>
+
 namespace mvvm
 {
 ViewModel::ViewModel(QObject* parent_object) : ViewModelBase(parent_object) {}
@@ -137,6 +139,36 @@ QModelIndexList ViewModel::GetIndexOfSessionItem(const SessionItem* item) const
   return result;
 }
 
+QModelIndexList ViewModel::GetIndexOfSessionItems(
+    const std::vector<const SessionItem*>& items) const
+{
+  QModelIndexList result;
+  if (!m_controller)
+  {
+    return result;
+  }
+
+  std::unordered_set<const SessionItem*> visited_items;
+  for (auto item : items)
+  {
+    if (!item || !visited_items.insert(item).second)
+    {
+      continue;
+    }
+
+    // views are resolved through the map of the controller, without the traversal of the tree
+    for (auto view : m_controller->FindViews(item))
+    {
+      if (auto index = indexFromItem(view); index.isValid())
+      {
+        result.push_back(index);
+      }
+    }
+  }
+
+  return result;
+}
+
 void ViewModel::SetController(std::unique_ptr<AbstractViewModelController> controller)
 {
   m_controller = std::move(controller);
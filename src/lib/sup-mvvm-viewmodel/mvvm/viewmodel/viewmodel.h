@@ -87,7 +87,7 @@ public:
   /**
    * @brief Returns SessionItem corresponding to the given index (const version).
    */
-  const SessionItem* GetSessionItemFromIndex(const QModelIndex& index) const;
+  virtual const SessionItem* GetSessionItemFromIndex(const QModelIndex& index) const;
 
   /**
    * @brief Returns SessionItem corresponding to the given index (non-const version).
@@ -116,7 +116,17 @@ public:
    *
    * Expensive call.
    */
-  QModelIndexList GetIndexOfSessionItem(const SessionItem* item) const;
+  virtual QModelIndexList GetIndexOfSessionItem(const SessionItem* item) const;
+
+  /**
+   * @brief Returns index list for all cells presenting given items.
+   *
+   * Views of items are resolved through the controller without the traversal of the view model,
+   * so the cost is proportional to the number of items. Indexes are grouped by items in the order
+   * of given items, duplicates are ignored.
+   */
+  virtual QModelIndexList GetIndexOfSessionItems(
+      const std::vector<const SessionItem*>& items) const;
 
   /**
    * @brief Returns internal SessionModel controller.
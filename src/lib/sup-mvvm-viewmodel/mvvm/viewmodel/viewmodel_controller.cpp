@@ -21,6 +21,7 @@
 #include "viewmodel_controller.h"
 
 #include <mvvm/core/mvvm_exceptions.h>
+#include <mvvm/viewmodel/model_view_hub.h>
 
 namespace mvvm
 {
@@ -34,7 +35,13 @@ ViewModelController::ViewModelController(std::unique_ptr<IViewModelController> i
   }
 }
 
-ViewModelController::~ViewModelController() = default;
+ViewModelController::~ViewModelController()
+{
+  if (m_hub)
+  {
+    m_hub->RemoveController(this);
+  }
+}
 
 void ViewModelController::OnModelEvent(const ItemInsertedEvent &event)
 {
@@ -46,6 +53,16 @@ void ViewModelController::OnModelEvent(const AboutToRemoveItemEvent &event)
   p_impl->OnModelEvent(event);
 }
 
+void ViewModelController::OnModelEvent(const ItemsInsertedEvent &event)
+{
+  p_impl->OnModelEvent(event);
+}
+
+void ViewModelController::OnModelEvent(const AboutToRemoveItemsEvent &event)
+{
+  p_impl->OnModelEvent(event);
+}
+
 void ViewModelController::OnModelEvent(const DataChangedEvent &event)
 {
   p_impl->OnModelEvent(event);
@@ -81,9 +98,26 @@ QStringList ViewModelController::GetHorizontalHeaderLabels() const
   return p_impl->GetHorizontalHeaderLabels();
 }
 
+std::vector<const ViewItem *> ViewModelController::FindViews(const SessionItem *item) const
+{
+  return p_impl->FindViews(item);
+}
+
 void ViewModelController::SetRootItemImpl(SessionItem *root_item)
 {
   p_impl->SetRootItem(root_item);
 }
 
+void ViewModelController::SubscribeImpl(ISessionModel *model)
+{
+  m_hub = ModelViewHub::Acquire(model);
+  m_hub->AddController(this);
+}
+
+void ViewModelController::UnsubscribeImpl()
+{
+  m_hub->RemoveController(this);
+  m_hub.reset();
+}
+
 }  // namespace mvvm
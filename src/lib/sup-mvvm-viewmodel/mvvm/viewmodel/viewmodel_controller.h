@@ -28,8 +28,13 @@
 namespace mvvm
 {
 
+class ModelViewHub;
+
 /**
  * @brief The ViewModelController class propagates changes from SessionModel to ViewModel.
+ *
+ * Model notifications are received through the ModelViewHub shared with all other controllers
+ * looking at the same model.
  */
 class MVVM_VIEWMODEL_EXPORT ViewModelController : public AbstractViewModelController
 {
@@ -42,6 +47,10 @@ public:
 
   void OnModelEvent(const AboutToRemoveItemEvent& event) override;
 
+  void OnModelEvent(const ItemsInsertedEvent& event) override;
+
+  void OnModelEvent(const AboutToRemoveItemsEvent& event) override;
+
   void OnModelEvent(const DataChangedEvent& event) override;
 
   void OnModelEvent(const ModelAboutToBeResetEvent& event) override;
@@ -56,10 +65,17 @@ public:
 
   QStringList GetHorizontalHeaderLabels() const override;
 
+  std::vector<const ViewItem*> FindViews(const SessionItem* item) const override;
+
 private:
   void SetRootItemImpl(SessionItem* root_item) override;
 
+  void SubscribeImpl(ISessionModel* model) override;
+
+  void UnsubscribeImpl() override;
+
   std::unique_ptr<IViewModelController> p_impl;
+  std::shared_ptr<ModelViewHub> m_hub;
 };
 
 }  // namespace mvvm
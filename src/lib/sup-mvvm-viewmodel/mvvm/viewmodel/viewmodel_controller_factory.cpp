@@ -35,6 +35,11 @@ std::unique_ptr<AbstractViewModelController> CreateViewModelController(
 
   auto impl = std::make_unique<ViewModelControllerImpl>(
       context.view_model, std::move(context.children_strategy), std::move(context.row_strategy));
+  if (context.background_build_step > 0)
+  {
+    impl->SetBackgroundBuild(context.background_build_step, context.progress_handler);
+  }
+  impl->SetReconcileOnReset(context.reconcile_on_reset);
   result = std::make_unique<ViewModelController>(std::move(impl));
 
   if (context.model)
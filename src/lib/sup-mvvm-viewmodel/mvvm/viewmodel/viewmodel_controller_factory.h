@@ -33,6 +33,7 @@ class IChildrenStrategy;
 class IRowStrategy;
 class AbstractViewModelController;
 class ISessionModel;
+class ProgressHandler;
 class ViewModelBase;
 
 namespace factory
@@ -44,6 +45,15 @@ struct ViewModelControllerFactoryContext
   std::unique_ptr<IRowStrategy> row_strategy;
   ISessionModel* model{nullptr};
   ViewModelBase* view_model{nullptr};
+
+  //! Number of items processed per event loop iteration while building large trees, zero means
+  //! that the tree is always built at once (see ViewModelControllerImpl::SetBackgroundBuild).
+  std::size_t background_build_step{0};
+  ProgressHandler* progress_handler{nullptr};
+
+  //! Reuse views of unchanged items on model reset instead of resetting the viewmodel
+  //! (see ViewModelControllerImpl::SetReconcileOnReset).
+  bool reconcile_on_reset{false};
 };
 
 /**
@@ -25,16 +25,108 @@
 
 #include <mvvm/core/mvvm_exceptions.h>
 #include <mvvm/model/i_session_model.h>
+#include <mvvm/model/item_utils.h>
 #include <mvvm/model/model_utils.h>
 #include <mvvm/model/session_item.h>
+#include <mvvm/utils/progress_handler.h>
 #include <mvvm/viewmodel/i_children_strategy.h>
 #include <mvvm/viewmodel/i_row_strategy.h>
+#include <mvvm/viewmodel/model_view_hub.h>
+#include <mvvm/viewmodelbase/viewitem_data.h>
 
-#include <stack>
+#include <QObject>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+
+namespace
+{
+
+/**
+ * @brief Returns number of items in the branch, including the item itself.
+ */
+std::size_t GetBranchItemCount(const mvvm::SessionItem &item)
+{
+  std::size_t result{0};
+  mvvm::utils::iterate(&item, [&result](const mvvm::SessionItem *) { ++result; });
+  return result;
+}
+
+/**
+ * @brief Returns Qt roles of views preserved while the model is being reset.
+ */
+const std::vector<int> &GetFrozenRoles()
+{
+  static const std::vector<int> result = {Qt::DisplayRole,    Qt::EditRole,
+                                          Qt::DecorationRole, Qt::ToolTipRole,
+                                          Qt::ForegroundRole, Qt::BackgroundRole,
+                                          Qt::CheckStateRole};
+  return result;
+}
+
+/**
+ * @brief The ViewState struct holds data of the view for all preserved roles, and its flags.
+ */
+struct ViewState
+{
+  std::vector<QVariant> data;
+  Qt::ItemFlags flags;
+
+  bool operator==(const ViewState &other) const
+  {
+    return data == other.data && flags == other.flags;
+  }
+  bool operator!=(const ViewState &other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Returns the current state of the view, as seen by Qt views.
+ */
+ViewState GetViewState(const mvvm::ViewItem &view)
+{
+  ViewState result;
+  for (auto role : GetFrozenRoles())
+  {
+    result.data.push_back(view.Data(role));
+  }
+  result.flags = view.Flags();
+  return result;
+}
+
+/**
+ * @brief Creates read-only data item holding a copy of the current data of the view.
+ */
+std::unique_ptr<mvvm::ViewItemData> CreateFrozenData(const mvvm::ViewItem &view)
+{
+  auto result = std::make_unique<mvvm::ViewItemData>();
+  for (auto role : GetFrozenRoles())
+  {
+    result->SetData(view.Data(role), role);
+  }
+  result->SetEnabled(view.GetItemData() ? view.GetItemData()->IsEnabled() : true);
+  result->SetEditable(false);
+  return result;
+}
+
+}  // namespace
 
 namespace mvvm
 {
 
+/**
+ * @brief The BackgroundBuild struct holds the state of the view tree under construction.
+ */
+struct ViewModelControllerImpl::BackgroundBuild
+{
+  SessionItem *root_item{nullptr};
+  std::size_t item_count{0};     //!< expected number of items, zero if not yet known
+  std::size_t visited_count{0};  //!< number of items visited so far
+  std::unique_ptr<ViewItem> root_view;
+  ViewItemMap view_item_map;
+  std::stack<TreeNode> stack;
+};
+
 ViewModelControllerImpl::ViewModelControllerImpl(
     ViewModelBase *viewmodel, std::unique_ptr<IChildrenStrategy> children_strategy,
     std::unique_ptr<IRowStrategy> row_strategy)
@@ -56,13 +148,28 @@ void ViewModelControllerImpl::OnModelEvent(const ItemInsertedEvent &event)
 {
   auto [parent, tag_index] = event;
 
-  auto new_child = parent->GetItem(tag_index);
+  if (m_build)
+  {
+    InsertRowsDuringBuild(parent, tag_index, 1);
+    return;
+  }
+
+  if (m_interrupted_root)
+  {
+    RestartBackgroundBuild();
+    return;
+  }
 
-  const int insert_view_index = GetInsertViewIndexOfChild(parent, new_child);
   auto parent_view = m_view_item_map.FindView(parent);
+  if (!parent_view)
+  {
+    return;
+  }
 
-  if (insert_view_index != -1 && parent_view)
+  if (const int insert_view_index = GetInsertViewIndexOfChild(parent, tag_index);
+      insert_view_index != -1)
   {
+    auto new_child = parent->GetItem(tag_index);
     m_view_model->insertRow(parent_view, insert_view_index, CreateTreeOfRows(*new_child));
   }
 }
@@ -81,11 +188,25 @@ void ViewModelControllerImpl::OnModelEvent(const AboutToRemoveItemEvent &event)
   {
     // special case when user removes SessionItem which is one of ancestors of our root item
     // or root item itself
+    m_build.reset();
+    m_interrupted_root = nullptr;
     m_view_item_map.Clear();
     m_view_model->ResetRootViewItem(CreateRootViewItem(nullptr));
     return;
   }
 
+  if (m_build)
+  {
+    RemoveRowsDuringBuild(event.item, {item_to_remove});
+    return;
+  }
+
+  if (m_interrupted_root)
+  {
+    RestartBackgroundBuild();
+    return;
+  }
+
   if (auto view = m_view_item_map.FindView(item_to_remove); view)
   {
     m_view_model->removeRow(view->GetParent(), view->Row());
@@ -93,16 +214,147 @@ void ViewModelControllerImpl::OnModelEvent(const AboutToRemoveItemEvent &event)
   }
 }
 
+void ViewModelControllerImpl::OnModelEvent(const AboutToInsertItemsEvent &event)
+{
+  (void)event;
+  // nothing to do
+}
+
+void ViewModelControllerImpl::OnModelEvent(const ItemsInsertedEvent &event)
+{
+  if (m_build)
+  {
+    InsertRowsDuringBuild(event.item, event.tag_index, event.count);
+    return;
+  }
+
+  if (m_interrupted_root)
+  {
+    RestartBackgroundBuild();
+    return;
+  }
+
+  auto parent_view = m_view_item_map.FindView(event.item);
+  if (!parent_view)
+  {
+    return;
+  }
+
+  // Inserted items which get their views form a contiguous range among children. We collect their
+  // rows and insert them into the view model with a single notification.
+  int insert_view_index{-1};
+  std::vector<std::vector<std::unique_ptr<ViewItem>>> rows;
+  for (std::size_t index = 0; index < event.count; ++index)
+  {
+    const TagIndex tag_index{event.tag_index.GetTag(),
+                             event.tag_index.GetIndex() + static_cast<int>(index)};
+    const int view_index = GetInsertViewIndexOfChild(event.item, tag_index);
+    if (view_index == -1)
+    {
+      continue;
+    }
+    auto new_child = event.item->GetItem(tag_index);
+
+    if (insert_view_index == -1)
+    {
+      insert_view_index = view_index;
+    }
+    rows.push_back(CreateTreeOfRows(*new_child));
+  }
+
+  if (insert_view_index != -1)
+  {
+    m_view_model->insertRows(parent_view, insert_view_index, std::move(rows));
+  }
+}
+
+void ViewModelControllerImpl::OnModelEvent(const AboutToRemoveItemsEvent &event)
+{
+  std::vector<SessionItem *> items_to_remove;
+  for (std::size_t index = 0; index < event.count; ++index)
+  {
+    const TagIndex tag_index{event.tag_index.GetTag(),
+                             event.tag_index.GetIndex() + static_cast<int>(index)};
+    auto item_to_remove = event.item->GetItem(tag_index);
+
+    if (item_to_remove == GetRootItem() || utils::IsItemAncestor(GetRootItem(), item_to_remove))
+    {
+      // special case when user removes SessionItem which is one of ancestors of our root item
+      // or root item itself
+      m_build.reset();
+      m_interrupted_root = nullptr;
+      m_view_item_map.Clear();
+      m_view_model->ResetRootViewItem(CreateRootViewItem(nullptr));
+      return;
+    }
+    items_to_remove.push_back(item_to_remove);
+  }
+
+  if (m_build)
+  {
+    RemoveRowsDuringBuild(event.item, items_to_remove);
+    return;
+  }
+
+  if (m_interrupted_root)
+  {
+    RestartBackgroundBuild();
+    return;
+  }
+
+  // views of removed items form a contiguous range of rows of the same parent view
+  ViewItem *parent_view{nullptr};
+  int first_row{-1};
+  int row_count{0};
+  for (auto item_to_remove : items_to_remove)
+  {
+    if (auto view = m_view_item_map.FindView(item_to_remove); view)
+    {
+      if (!parent_view)
+      {
+        parent_view = view->GetParent();
+        first_row = view->Row();
+      }
+      ++row_count;
+    }
+  }
+
+  if (parent_view)
+  {
+    m_view_model->removeRows(parent_view, first_row, row_count);
+    for (auto item_to_remove : items_to_remove)
+    {
+      m_view_item_map.OnItemRemove(item_to_remove);
+    }
+  }
+}
+
+void ViewModelControllerImpl::OnModelEvent(const ItemsRemovedEvent &event)
+{
+  (void)event;
+  // nothing to do
+}
+
 void ViewModelControllerImpl::OnModelEvent(const DataChangedEvent &event)
 {
-  for (auto view : utils::FindViewsForItem(m_view_model, event.item))
+  for (auto view : m_view_item_map.FindAllViews(event.item))
   {
+    view->ResetDataCache();
     if (auto roles = utils::GetQtRoles(view, event.data_role); !roles.empty())
     {
       auto index = m_view_model->indexFromItem(view);
       emit m_view_model->dataChanged(index, index, roles);
     }
   }
+
+  if (m_build)
+  {
+    // views of the tree under construction are not visible yet, it is enough to drop their data
+    for (auto view : m_build->view_item_map.FindAllViews(event.item))
+    {
+      view->ResetDataCache();
+    }
+  }
 }
 
 void ViewModelControllerImpl::OnModelEvent(const ModelAboutToBeResetEvent &event)
@@ -112,16 +364,27 @@ void ViewModelControllerImpl::OnModelEvent(const ModelAboutToBeResetEvent &event
   // To let all views looking at ViewModelBase to perform necessary bookkeeping we have to
   // emit internal QAbstractViewModel::beginResetModel already now, while `model` content is still
   // alive.
+  const bool can_reconcile = m_reconcile_on_reset && !IsTreeIncomplete();
+  m_build.reset();
+  m_interrupted_root = nullptr;
+  if (can_reconcile)
+  {
+    // instead of the reset, the tree is detached from items and updated after the reset
+    FreezeViewTree();
+    return;
+  }
   m_view_model->BeginResetModelNotify();
 }
 
 void ViewModelControllerImpl::OnModelEvent(const ModelResetEvent &event)
 {
-  SessionItem *root_item = event.model->GetRootItem();
+  if (m_is_tree_frozen)
+  {
+    ReconcileViewTree(*event.model->GetRootItem());
+    return;
+  }
 
-  m_view_item_map.Clear();
-  auto root_view_item = std::move(CreateTreeOfRows(*root_item, true).at(0));
-  m_view_model->ResetRootViewItem(std::move(root_view_item), /*notify*/ false);
+  ResetTree(*event.model->GetRootItem(), /*notify*/ false);
 
   m_view_model->EndResetModelNotify();  //  BeginResetModel was already called
 }
@@ -129,7 +392,11 @@ void ViewModelControllerImpl::OnModelEvent(const ModelResetEvent &event)
 void ViewModelControllerImpl::OnModelEvent(const ModelAboutToBeDestroyedEvent &event)
 {
   (void)event;
+  m_build.reset();
+  m_interrupted_root = nullptr;
+  m_view_item_map.Clear();
   m_view_model->ResetRootViewItem(CreateRootViewItem(nullptr));
+  m_hub.reset();
 }
 
 const SessionItem *ViewModelControllerImpl::GetRootItem() const
@@ -141,14 +408,19 @@ void ViewModelControllerImpl::SetRootItem(SessionItem *root_item)
 {
   CheckInitialState();
 
+  // the hub is shared with controllers of other viewmodels, models without notifications have none
+  auto model = root_item ? root_item->GetModel() : nullptr;
+  m_hub = model && model->GetEventHandler() ? ModelViewHub::Acquire(model)
+                                            : std::shared_ptr<ModelViewHub>();
+
   if (root_item)
   {
-    m_view_item_map.Clear();
-    auto root_view_item = std::move(CreateTreeOfRows(*root_item, true).at(0));
-    m_view_model->ResetRootViewItem(std::move(root_view_item));
+    ResetTree(*root_item, /*notify*/ true);
   }
   else
   {
+    m_build.reset();
+    m_interrupted_root = nullptr;
     m_view_item_map.Clear();
     m_view_model->ResetRootViewItem(CreateRootViewItem(nullptr));
   }
@@ -164,6 +436,13 @@ QStringList ViewModelControllerImpl::GetHorizontalHeaderLabels() const
   return m_row_strategy->GetHorizontalHeaderLabels();
 }
 
+std::vector<const ViewItem *> ViewModelControllerImpl::FindViews(const SessionItem *item) const
+{
+  // views of the tree under construction are kept in the map of the build, they aren't attached
+  const auto views = m_view_item_map.FindAllViews(item);
+  return {views.begin(), views.end()};
+}
+
 void ViewModelControllerImpl::CheckInitialState() const
 {
   if (!m_view_model)
@@ -182,15 +461,52 @@ void ViewModelControllerImpl::CheckInitialState() const
   }
 }
 
+void ViewModelControllerImpl::SetBackgroundBuild(std::size_t items_per_step,
+                                                 ProgressHandler *progress_handler)
+{
+  m_items_per_step = items_per_step;
+  m_progress_handler = progress_handler;
+  if (m_items_per_step > 0 && !m_receiver)
+  {
+    m_receiver = std::make_unique<QObject>();
+  }
+}
+
+bool ViewModelControllerImpl::IsBuildPending() const
+{
+  return static_cast<bool>(m_build);
+}
+
+void ViewModelControllerImpl::SetReconcileOnReset(bool value)
+{
+  m_reconcile_on_reset = value;
+}
+
 int ViewModelControllerImpl::GetInsertViewIndexOfChild(const SessionItem *parent,
                                                        const SessionItem *child)
 {
+  if (m_hub)
+  {
+    return m_hub->GetChildIndex(*m_children_strategy, parent, child);
+  }
+
   // children that should get their views
   auto children = m_children_strategy->GetChildren(parent);
 
   return utils::IndexOfItem(children, child);
 }
 
+int ViewModelControllerImpl::GetInsertViewIndexOfChild(const SessionItem *parent,
+                                                       const TagIndex &tag_index)
+{
+  if (m_hub)
+  {
+    return m_hub->GetChildIndex(*m_children_strategy, parent, tag_index);
+  }
+
+  return GetInsertViewIndexOfChild(parent, parent->GetItem(tag_index));
+}
+
 std::vector<std::unique_ptr<ViewItem> > ViewModelControllerImpl::CreateTreeOfRows(SessionItem &item,
                                                                                   bool is_root)
 {
@@ -198,14 +514,7 @@ std::vector<std::unique_ptr<ViewItem> > ViewModelControllerImpl::CreateTreeOfRow
   // vector plays the role of parent view for SessionItem's children. So it might contain another
   // ViewItem vectors.
 
-  // A helper structure to visit SessionItem hierarchy in non recursive manner.
-  struct Node
-  {
-    SessionItem *item{nullptr};    // a SessionItem being visited
-    ViewItem *view_item{nullptr};  // first ViewItem in a row of item's views
-  };
-
-  std::stack<Node> stack;
+  std::stack<TreeNode> stack;
 
   std::vector<std::unique_ptr<ViewItem> > row_of_views;
   if (is_root)
@@ -219,19 +528,43 @@ std::vector<std::unique_ptr<ViewItem> > ViewModelControllerImpl::CreateTreeOfRow
     row_of_views = m_row_strategy->ConstructRow(&item);
   }
 
+  AddViews(row_of_views, m_view_item_map);
+
   if (!row_of_views.empty())
   {
     auto *view_item = row_of_views.at(0).get();  // a parent for the following row of views
     stack.push({&item, view_item});
   }
 
-  while (!stack.empty())
+  PopulateRows(stack, m_view_item_map, std::numeric_limits<std::size_t>::max());
+
+  // Do not allow to generate empty rows.
+  if (row_of_views.empty())
+  {
+    throw RuntimeException("ViewModelControllerImpl: empty row was generated by the strategy");
+  }
+
+  return row_of_views;
+}
+
+ViewItemMap &ViewModelControllerImpl::GetViewItemMap()
+{
+  return m_view_item_map;
+}
+
+std::size_t ViewModelControllerImpl::PopulateRows(std::stack<TreeNode> &stack,
+                                                  ViewItemMap &view_item_map,
+                                                  std::size_t max_count)
+{
+  std::size_t visited_count{0};
+  while (!stack.empty() && visited_count < max_count)
   {
     auto *current_parent = stack.top().item;
     auto *current_parent_view = stack.top().view_item;
     stack.pop();
+    ++visited_count;
 
-    m_view_item_map.Insert(current_parent, current_parent_view);
+    view_item_map.Insert(current_parent, current_parent_view);
 
     auto children = m_children_strategy->GetChildren(current_parent);
 
@@ -242,6 +575,7 @@ std::vector<std::unique_ptr<ViewItem> > ViewModelControllerImpl::CreateTreeOfRow
 
       if (!row.empty())
       {
+        AddViews(row, view_item_map);
         auto *next_parent_view = row.at(0).get();
 
         // Inserting row of views into their parent. We always insert at index 0 to compensate
@@ -252,19 +586,417 @@ std::vector<std::unique_ptr<ViewItem> > ViewModelControllerImpl::CreateTreeOfRow
       }
     }
   }
+  return visited_count;
+}
 
-  // Do not allow to generate empty rows.
-  if (row_of_views.empty())
+void ViewModelControllerImpl::AddViews(const std::vector<std::unique_ptr<ViewItem>> &row,
+                                       ViewItemMap &view_item_map)
+{
+  for (const auto &view : row)
   {
-    throw RuntimeException("ViewModelControllerImpl: empty row was generated by the strategy");
+    if (auto item = utils::GetItemFromView<SessionItem>(view.get()); item)
+    {
+      view_item_map.AddView(item, view.get());
+    }
   }
+}
 
-  return row_of_views;
+void ViewModelControllerImpl::ResetTree(SessionItem &root_item, bool notify)
+{
+  m_build.reset();
+  m_interrupted_root = nullptr;
+  m_is_tree_frozen = false;
+  m_frozen_keys.clear();
+  m_view_item_map.Clear();
+
+  if (m_items_per_step > 0)
+  {
+    // small trees are built at once
+    if (auto item_count = GetBranchItemCount(root_item); item_count > m_items_per_step)
+    {
+      StartBackgroundBuild(root_item, item_count, notify);
+      return;
+    }
+  }
+
+  auto root_view_item = std::move(CreateTreeOfRows(root_item, true).at(0));
+  m_view_model->ResetRootViewItem(std::move(root_view_item), notify);
 }
 
-ViewItemMap &ViewModelControllerImpl::GetViewItemMap()
+void ViewModelControllerImpl::StartBackgroundBuild(SessionItem &root_item,
+                                                   std::size_t item_count, bool notify)
 {
-  return m_view_item_map;
+  // the viewmodel shows the empty root item until the tree is ready
+  auto root_view_item = CreateRootViewItem(&root_item);
+  m_view_item_map.Insert(&root_item, root_view_item.get());
+  m_view_item_map.AddView(&root_item, root_view_item.get());
+  m_view_model->ResetRootViewItem(std::move(root_view_item), notify);
+
+  m_build = std::make_unique<BackgroundBuild>();
+  m_build->root_item = &root_item;
+  m_build->item_count = item_count;
+  ScheduleBuildStep();
+}
+
+bool ViewModelControllerImpl::IsTreeIncomplete() const
+{
+  return m_build || m_interrupted_root;
+}
+
+void ViewModelControllerImpl::RestartBackgroundBuild()
+{
+  // The model is being changed, the step will start from scratch when the change is complete.
+  m_build = std::make_unique<BackgroundBuild>();
+  m_build->root_item = m_interrupted_root;
+  m_interrupted_root = nullptr;
+  ScheduleBuildStep();
+}
+
+void ViewModelControllerImpl::InsertRowsDuringBuild(SessionItem *parent, const TagIndex &tag_index,
+                                                    std::size_t count)
+{
+  auto &build = *m_build;
+
+  // The parent is registered when rows of its children are built. Parents which are not visited
+  // yet will find new children themselves.
+  auto parent_view = build.view_item_map.FindView(parent);
+  if (!parent_view)
+  {
+    return;
+  }
+
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    const TagIndex child_tag_index{tag_index.GetTag(),
+                                   tag_index.GetIndex() + static_cast<int>(index)};
+    const int view_index = GetInsertViewIndexOfChild(parent, child_tag_index);
+    if (view_index == -1)
+    {
+      continue;
+    }
+
+    auto child = parent->GetItem(child_tag_index);
+    auto row = m_row_strategy->ConstructRow(child);
+    if (row.empty())
+    {
+      continue;
+    }
+
+    AddViews(row, build.view_item_map);
+    auto child_view = row.at(0).get();
+    parent_view->InsertRow(view_index, std::move(row));
+
+    // children of the new item are built by next steps
+    build.stack.push({child, child_view});
+    build.item_count += GetBranchItemCount(*child);
+  }
+}
+
+void ViewModelControllerImpl::RemoveRowsDuringBuild(SessionItem *parent,
+                                                    const std::vector<SessionItem *> &items)
+{
+  auto &build = *m_build;
+
+  auto parent_view = build.view_item_map.FindView(parent);
+  if (!parent_view)
+  {
+    return;  // rows of children are not built yet
+  }
+
+  // items are still in the model, positions of all rows are found before the removal
+  std::vector<int> view_indexes;
+  for (auto item : items)
+  {
+    if (const int view_index = GetInsertViewIndexOfChild(parent, item); view_index != -1)
+    {
+      view_indexes.push_back(view_index);
+      build.view_item_map.OnItemRemove(item);
+    }
+  }
+  std::sort(view_indexes.begin(), view_indexes.end());
+  for (auto it = view_indexes.rbegin(); it != view_indexes.rend(); ++it)
+  {
+    parent_view->RemoveRow(*it);
+  }
+
+  // removed items and their children, which are waiting for the visit, are forgotten
+  auto is_removed = [&items](const SessionItem *item)
+  {
+    return std::any_of(items.begin(), items.end(), [item](auto removed)
+                       { return item == removed || utils::IsItemAncestor(item, removed); });
+  };
+  std::vector<TreeNode> nodes;
+  while (!build.stack.empty())
+  {
+    if (!is_removed(build.stack.top().item))
+    {
+      nodes.push_back(build.stack.top());
+    }
+    build.stack.pop();
+  }
+  for (auto it = nodes.rbegin(); it != nodes.rend(); ++it)
+  {
+    build.stack.push(*it);
+  }
+}
+
+void ViewModelControllerImpl::ScheduleBuildStep()
+{
+  if (m_is_step_scheduled)
+  {
+    return;
+  }
+
+  m_is_step_scheduled = true;
+  QMetaObject::invokeMethod(
+      m_receiver.get(), [this]() { RunBuildStep(); }, Qt::QueuedConnection);
+}
+
+void ViewModelControllerImpl::RunBuildStep()
+{
+  m_is_step_scheduled = false;
+  if (!m_build)
+  {
+    return;  // the build was cancelled
+  }
+
+  auto &build = *m_build;
+  if (!build.root_view)
+  {
+    if (build.item_count == 0)
+    {
+      build.item_count = GetBranchItemCount(*build.root_item);
+    }
+    if (m_progress_handler)
+    {
+      m_progress_handler->SetMaxTicksCount(build.item_count);
+    }
+
+    build.root_view = CreateRootViewItem(build.root_item);
+    build.view_item_map.AddView(build.root_item, build.root_view.get());
+    build.stack.push({build.root_item, build.root_view.get()});
+  }
+
+  auto visited_count = PopulateRows(build.stack, build.view_item_map, m_items_per_step);
+
+  if (m_progress_handler)
+  {
+    // items skipped by the children strategy are not visited, the last step completes progress
+    auto ticks = visited_count;
+    if (build.stack.empty())
+    {
+      ticks = std::max(build.item_count, build.visited_count + visited_count) - build.visited_count;
+    }
+    m_progress_handler->SetCompletedTicks(ticks);
+    if (m_progress_handler->HasInterruptRequest())
+    {
+      // the viewmodel keeps showing the empty root item until the next change of the model
+      m_interrupted_root = m_build->root_item;
+      m_build.reset();
+      return;
+    }
+  }
+  build.visited_count += visited_count;
+
+  if (!build.stack.empty())
+  {
+    ScheduleBuildStep();
+    return;
+  }
+
+  auto finished_build = std::move(m_build);
+  m_view_item_map = std::move(finished_build->view_item_map);
+  m_view_model->ResetRootViewItem(std::move(finished_build->root_view));
+}
+
+void ViewModelControllerImpl::FreezeViewTree()
+{
+  m_frozen_keys.clear();
+  m_view_item_map.Clear();
+
+  auto root_view = m_view_model->rootItem();
+  std::stack<ViewItem *> stack;
+  stack.push(root_view);
+  while (!stack.empty())
+  {
+    auto parent_view = stack.top();
+    stack.pop();
+
+    for (int row = 0; row < parent_view->GetRowCount(); ++row)
+    {
+      auto first_view = parent_view->GetChild(row, 0);
+      if (auto item = utils::GetItemFromView<SessionItem>(first_view); item)
+      {
+        m_frozen_keys[first_view] = {item->GetType(), item->GetIdentifier()};
+      }
+
+      // Qt views might look at the data while items are being destroyed
+      for (int column = 0; column < parent_view->GetColumnCount(); ++column)
+      {
+        auto view = parent_view->GetChild(row, column);
+        view->SetItemData(CreateFrozenData(*view));
+      }
+
+      stack.push(first_view);
+    }
+  }
+  root_view->SetItemData(CreateFrozenData(*root_view));
+
+  m_is_tree_frozen = true;
+}
+
+void ViewModelControllerImpl::ReconcileViewTree(SessionItem &root_item)
+{
+  auto root_view = m_view_model->rootItem();
+  root_view->SetItemData(CreateRootViewItem(&root_item)->TakeItemData());
+  m_view_item_map.Insert(&root_item, root_view);
+  m_view_item_map.AddView(&root_item, root_view);
+
+  std::stack<TreeNode> stack;
+  stack.push({&root_item, root_view});
+  while (!stack.empty())
+  {
+    auto node = stack.top();
+    stack.pop();
+
+    for (const auto &reused_node : ReconcileChildren(*node.item, *node.view_item))
+    {
+      stack.push(reused_node);
+    }
+  }
+
+  m_frozen_keys.clear();
+  m_is_tree_frozen = false;
+}
+
+std::vector<ViewModelControllerImpl::TreeNode> ViewModelControllerImpl::ReconcileChildren(
+    SessionItem &parent, ViewItem &parent_view)
+{
+  std::vector<TreeNode> result;
+
+  // positions of frozen rows presenting certain item, the first position is at the back
+  const int frozen_row_count = parent_view.GetRowCount();
+  std::map<std::pair<std::string, std::string>, std::vector<int>> frozen_rows;
+  for (int row = frozen_row_count - 1; row >= 0; --row)
+  {
+    if (auto iter = m_frozen_keys.find(parent_view.GetChild(row, 0)); iter != m_frozen_keys.end())
+    {
+      frozen_rows[iter->second].push_back(row);
+    }
+  }
+
+  int frozen_row{0};  // first frozen row which is neither reused nor removed yet
+  int view_row{0};    // the current position of this row in the parent view
+  std::vector<std::vector<std::unique_ptr<ViewItem>>> new_rows;  // rows to insert at view_row
+
+  auto insert_new_rows = [this, &parent_view, &view_row, &new_rows]()
+  {
+    const auto count = static_cast<int>(new_rows.size());
+    m_view_model->insertRows(&parent_view, view_row, std::move(new_rows));
+    new_rows.clear();
+    view_row += count;
+  };
+
+  auto remove_frozen_rows = [this, &parent_view, &view_row, &frozen_row](int count)
+  {
+    m_view_model->removeRows(&parent_view, view_row, count);
+    frozen_row += count;
+  };
+
+  // contiguous range of reused rows which look different now, reported with a single dataChanged
+  int changed_first{-1};
+  int changed_last{-1};
+  auto report_changed_rows = [this, &parent_view, &changed_first, &changed_last]()
+  {
+    if (changed_first >= 0)
+    {
+      emit m_view_model->dataChanged(
+          m_view_model->indexFromItem(parent_view.GetChild(changed_first, 0)),
+          m_view_model->indexFromItem(
+              parent_view.GetChild(changed_last, parent_view.GetColumnCount() - 1)));
+    }
+    changed_first = -1;
+    changed_last = -1;
+  };
+
+  for (auto child : m_children_strategy->GetChildren(&parent))
+  {
+    int matching_row{-1};
+    if (auto iter = frozen_rows.find({child->GetType(), child->GetIdentifier()});
+        iter != frozen_rows.end())
+    {
+      auto &rows = iter->second;
+      while (!rows.empty() && rows.back() < frozen_row)
+      {
+        rows.pop_back();  // rows which were already removed
+      }
+      if (!rows.empty())
+      {
+        matching_row = rows.back();
+        rows.pop_back();
+      }
+    }
+
+    if (matching_row < 0)
+    {
+      new_rows.push_back(CreateTreeOfRows(*child));
+      continue;
+    }
+
+    insert_new_rows();
+    remove_frozen_rows(matching_row - frozen_row);  // items which are gone
+    if (bool is_changed{false}; ReuseRow(parent_view, view_row, *child, is_changed))
+    {
+      if (is_changed && (changed_first < 0 || changed_last + 1 != view_row))
+      {
+        report_changed_rows();
+        changed_first = view_row;
+      }
+      changed_last = is_changed ? view_row : changed_last;
+      result.push_back({child, parent_view.GetChild(view_row, 0)});
+      ++view_row;
+      ++frozen_row;
+    }
+    else
+    {
+      remove_frozen_rows(1);
+      new_rows.push_back(CreateTreeOfRows(*child));
+    }
+  }
+
+  insert_new_rows();
+  remove_frozen_rows(frozen_row_count - frozen_row);
+  report_changed_rows();
+
+  return result;
+}
+
+bool ViewModelControllerImpl::ReuseRow(ViewItem &parent_view, int row, SessionItem &item,
+                                       bool &is_changed)
+{
+  auto new_row = m_row_strategy->ConstructRow(&item);
+  const int column_count = parent_view.GetColumnCount();
+  if (static_cast<int>(new_row.size()) != column_count)
+  {
+    return false;
+  }
+
+  for (int column = 0; column < column_count; ++column)
+  {
+    auto view = parent_view.GetChild(row, column);
+    const auto frozen_state = GetViewState(*view);
+    view->SetItemData(new_row.at(column)->TakeItemData());
+    // frozen views are read-only, so flags of the reused view usually differ
+    is_changed |= frozen_state != GetViewState(*view);
+
+    if (auto presented_item = utils::GetItemFromView<SessionItem>(view); presented_item)
+    {
+      m_view_item_map.AddView(presented_item, view);
+    }
+  }
+  m_view_item_map.Insert(&item, parent_view.GetChild(row, 0));
+
+  return true;
 }
 
 }  // namespace mvvm
@@ -27,6 +27,11 @@
 
 #include <QStringList>
 #include <memory>
+#include <stack>
+#include <string>
+#include <unordered_map>
+
+class QObject;
 
 namespace mvvm
 {
@@ -35,6 +40,8 @@ class ISessionModel;
 class ViewModelBase;
 class IChildrenStrategy;
 class IRowStrategy;
+class ModelViewHub;
+class ProgressHandler;
 
 /**
  * @brief The ViewModelControllerImpl class contains implementation details for ViewModelController.
@@ -56,6 +63,14 @@ public:
 
   void OnModelEvent(const AboutToRemoveItemEvent &event) override;
 
+  void OnModelEvent(const AboutToInsertItemsEvent &event) override;
+
+  void OnModelEvent(const ItemsInsertedEvent &event) override;
+
+  void OnModelEvent(const AboutToRemoveItemsEvent &event) override;
+
+  void OnModelEvent(const ItemsRemovedEvent &event) override;
+
   void OnModelEvent(const DataChangedEvent &event) override;
 
   void OnModelEvent(const ModelResetEvent &event) override;
@@ -72,16 +87,57 @@ public:
 
   QStringList GetHorizontalHeaderLabels() const override;
 
+  std::vector<const ViewItem *> FindViews(const SessionItem *item) const override;
+
   void CheckInitialState() const;
 
+  /**
+   * @brief Enables construction of large view trees in steps, between which the event loop runs.
+   *
+   * When the root item is set, or the model is reset, the viewmodel shows the empty root item
+   * first. The tree is built detached from the viewmodel, step by step, and swapped in at the
+   * end. Structural changes of the model arriving meanwhile are applied to the part of the tree
+   * which is already built, the rest of the tree is built from the current state of the model.
+   * Structural changes restart the construction interrupted via the progress handler.
+   *
+   * @param items_per_step Number of items visited in one step, zero disables the feature.
+   * @param progress_handler Optional handler to report progress and to request interruption.
+   */
+  void SetBackgroundBuild(std::size_t items_per_step, ProgressHandler *progress_handler = nullptr);
+
+  /**
+   * @brief Checks if the construction of the view tree is still in progress.
+   */
+  bool IsBuildPending() const;
+
+  /**
+   * @brief Enables reconciliation of the view tree on model reset.
+   *
+   * When enabled, the model reset doesn't lead to the reset of the viewmodel. Instead, views of
+   * items with the same type and identifier as before the reset are reused. Views of remaining
+   * items are inserted and removed with usual row notifications, reused rows with changed data
+   * or flags are reported via dataChanged, contiguous rows of the same parent at once. Qt views
+   * keep their expansion and selection state this way.
+   */
+  void SetReconcileOnReset(bool value);
+
   /**
    * @brief Returns an insert index for a view representing a child.
    *
    * Since number of views might not coincide with number of items (some items are marked) as
-   * hidden, we have to recalculate a view index.
+   * hidden, we have to recalculate a view index. The index is taken from the children cache of
+   * the model's ModelViewHub, when available.
    */
   int GetInsertViewIndexOfChild(const SessionItem *parent, const SessionItem *child);
 
+  /**
+   * @brief Returns an insert index for a view representing a child at the given tag index.
+   *
+   * Doesn't require the list of all children, when the children strategy is a child filter and
+   * the model's ModelViewHub is available.
+   */
+  int GetInsertViewIndexOfChild(const SessionItem *parent, const TagIndex &tag_index);
+
   /**
    * @brief Creates tree of rows with ViewItems representing given SessionItem and all its children.
    *
@@ -97,10 +153,113 @@ public:
   ViewItemMap &GetViewItemMap();
 
 private:
+  /**
+   * @brief The TreeNode struct is a helper to visit SessionItem hierarchy in non recursive manner.
+   */
+  struct TreeNode
+  {
+    SessionItem *item{nullptr};    //!< a SessionItem being visited
+    ViewItem *view_item{nullptr};  //!< first ViewItem in a row of item's views
+  };
+
+  struct BackgroundBuild;
+
+  /**
+   * @brief Visits items from the stack and appends rows of their children to their views.
+   *
+   * @return Number of visited items, it doesn't exceed max_count.
+   */
+  std::size_t PopulateRows(std::stack<TreeNode> &stack, ViewItemMap &view_item_map,
+                           std::size_t max_count);
+
+  /**
+   * @brief Registers all views of the row in the map of views presenting items.
+   */
+  static void AddViews(const std::vector<std::unique_ptr<ViewItem>> &row,
+                       ViewItemMap &view_item_map);
+
+  /**
+   * @brief Replaces the tree of views with the tree representing given root item.
+   */
+  void ResetTree(SessionItem &root_item, bool notify);
+
+  void StartBackgroundBuild(SessionItem &root_item, std::size_t item_count, bool notify);
+
+  /**
+   * @brief Checks if the tree of views doesn't represent the model yet, because the build is
+   * still in progress or was interrupted.
+   */
+  bool IsTreeIncomplete() const;
+
+  /**
+   * @brief Starts the interrupted build from scratch on the next step.
+   *
+   * The empty tree shown after the interruption would be out of sync with the model otherwise.
+   */
+  void RestartBackgroundBuild();
+
+  /**
+   * @brief Inserts rows of new children to the tree under construction.
+   *
+   * Only parents with already built children get new rows, children of new items are built by
+   * next steps.
+   */
+  void InsertRowsDuringBuild(SessionItem *parent, const TagIndex &tag_index, std::size_t count);
+
+  /**
+   * @brief Removes rows of given children of the parent from the tree under construction.
+   */
+  void RemoveRowsDuringBuild(SessionItem *parent, const std::vector<SessionItem *> &items);
+
+  void ScheduleBuildStep();
+
+  void RunBuildStep();
+
+  /**
+   * @brief Remembers identity of items presented by the current tree of views and detaches
+   * views from items which are about to be destroyed.
+   */
+  void FreezeViewTree();
+
+  /**
+   * @brief Updates the frozen tree of views to represent the given root item.
+   */
+  void ReconcileViewTree(SessionItem &root_item);
+
+  /**
+   * @brief Updates rows of the parent view to represent children of the parent item.
+   *
+   * @return Children whose rows were reused, together with their views.
+   */
+  std::vector<TreeNode> ReconcileChildren(SessionItem &parent, ViewItem &parent_view);
+
+  /**
+   * @brief Makes the existing row of views to represent the given item.
+   *
+   * Sets is_changed if data or flags of any view of the row have changed. The change isn't
+   * reported, the caller reports ranges of changed rows.
+   *
+   * @return False if the row of the item has another layout, the row stays unchanged then.
+   */
+  bool ReuseRow(ViewItem &parent_view, int row, SessionItem &item, bool &is_changed);
+
   ViewModelBase *m_view_model{nullptr};
   ViewItemMap m_view_item_map;
   std::unique_ptr<IChildrenStrategy> m_children_strategy;
   std::unique_ptr<IRowStrategy> m_row_strategy;
+  std::shared_ptr<ModelViewHub> m_hub;
+
+  std::size_t m_items_per_step{0};
+  ProgressHandler *m_progress_handler{nullptr};
+  std::unique_ptr<QObject> m_receiver;  //!< context of scheduled build steps
+  std::unique_ptr<BackgroundBuild> m_build;
+  SessionItem *m_interrupted_root{nullptr};  //!< root item of the interrupted build, if any
+  bool m_is_step_scheduled{false};
+
+  bool m_reconcile_on_reset{false};
+  bool m_is_tree_frozen{false};
+  //! type and identifier of items presented by rows of the frozen tree, by first view of the row
+  std::unordered_map<const ViewItem *, std::pair<std::string, std::string>> m_frozen_keys;
 };
 
 }  // namespace mvvm
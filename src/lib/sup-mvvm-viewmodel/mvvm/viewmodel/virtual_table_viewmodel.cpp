@@ -0,0 +1,511 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "virtual_table_viewmodel.h"
+
+#include "abstract_viewmodel_controller.h"
+#include "standard_presentation_items.h"
+
+#include <mvvm/model/i_session_model.h>
+#include <mvvm/model/item_utils.h>
+#include <mvvm/model/session_item.h>
+#include <mvvm/model/tagged_items.h>
+#include <mvvm/signals/event_types.h>
+#include <mvvm/utils/container_utils.h>
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace mvvm
+{
+
+namespace
+{
+
+/**
+ * @brief Checks if the item should be shown as a table row.
+ *
+ * Uses the same criteria as utils::TopLevelItems.
+ */
+bool IsRowItem(const SessionItem& item)
+{
+  return item.IsVisible() && !utils::HasAppearanceFlag(item, kProperty);
+}
+
+/**
+ * @brief Calls the function with the temporary presentation of the cell item.
+ *
+ * The presentation is the same as the one used by PropertiesRowStrategy: items with data are
+ * presented by their data, others by their display name.
+ */
+template <typename Func>
+auto ApplyPresentation(SessionItem* item, Func func)
+{
+  if (item->HasData())
+  {
+    DataPresentationItem presentation(item);
+    return func(presentation);
+  }
+  DisplayNamePresentationItem presentation(item);
+  return func(presentation);
+}
+
+}  // namespace
+
+/**
+ * @brief The VirtualTableController class holds the list of row items and the list of column
+ * tags, and updates them on SessionModel notifications.
+ */
+class VirtualTableViewModel::VirtualTableController : public AbstractViewModelController
+{
+public:
+  using AbstractViewModelController::OnModelEvent;
+
+  explicit VirtualTableController(VirtualTableViewModel *view_model) : m_view_model(view_model) {}
+
+  const SessionItem *GetRootItem() const override { return m_root_item; }
+
+  int GetColumnCount() const override { return static_cast<int>(m_column_tags.size()); }
+
+  QStringList GetHorizontalHeaderLabels() const override { return m_labels; }
+
+  int GetRowCount() const { return static_cast<int>(m_rows.size()); }
+
+  /**
+   * @brief Returns the item presented in the given cell, or nullptr.
+   */
+  SessionItem *GetCellItem(int row, int column) const
+  {
+    if (row < 0 || row >= GetRowCount() || column < 0 || column >= GetColumnCount())
+    {
+      return nullptr;
+    }
+
+    auto row_item = m_rows[static_cast<std::size_t>(row)];
+    const auto &tag = m_column_tags[static_cast<std::size_t>(column)];
+    return row_item->GetTaggedItems()->HasTag(tag) ? row_item->GetItem(TagIndex{tag, 0}) : nullptr;
+  }
+
+  /**
+   * @brief Returns the row of the given row item, or -1.
+   */
+  int FindRow(const SessionItem *item) const
+  {
+    if (!m_row_index_valid)
+    {
+      m_row_index.clear();
+      for (std::size_t row = 0; row < m_rows.size(); ++row)
+      {
+        m_row_index.emplace(m_rows[row], static_cast<int>(row));
+      }
+      m_row_index_valid = true;
+    }
+
+    auto iter = m_row_index.find(item);
+    return iter == m_row_index.end() ? -1 : iter->second;
+  }
+
+  /**
+   * @brief Returns the (row, column) of the cell presenting the given item, or (-1, -1).
+   */
+  std::pair<int, int> FindCell(const SessionItem *item) const
+  {
+    if (!item || !item->GetParent())
+    {
+      return {-1, -1};
+    }
+
+    const int row = FindRow(item->GetParent());
+    const int column = utils::IndexOfItem(m_column_tags, item->GetTagIndex().GetTag());
+    if (row == -1 || column == -1 || GetCellItem(row, column) != item)
+    {
+      return {-1, -1};
+    }
+    return {row, column};
+  }
+
+  void OnModelEvent(const ItemInsertedEvent &event) override
+  {
+    OnItemsInserted(event.item, event.tag_index, 1);
+  }
+
+  void OnModelEvent(const ItemsInsertedEvent &event) override
+  {
+    OnItemsInserted(event.item, event.tag_index, static_cast<int>(event.count));
+  }
+
+  void OnModelEvent(const AboutToRemoveItemEvent &event) override
+  {
+    OnItemsAboutToBeRemoved(event.item, event.tag_index, 1);
+  }
+
+  void OnModelEvent(const ItemRemovedEvent &event) override { OnItemsRemoved(event.item); }
+
+  void OnModelEvent(const AboutToRemoveItemsEvent &event) override
+  {
+    OnItemsAboutToBeRemoved(event.item, event.tag_index, static_cast<int>(event.count));
+  }
+
+  void OnModelEvent(const ItemsRemovedEvent &event) override { OnItemsRemoved(event.item); }
+
+  void OnModelEvent(const DataChangedEvent &event) override
+  {
+    auto [row, column] = FindCell(event.item);
+    if (row == -1)
+    {
+      return;
+    }
+
+    auto roles = ApplyPresentation(event.item, [&event](SessionItemPresentation &presentation)
+                                   { return presentation.GetQtRoles(event.data_role); });
+    if (!roles.empty())
+    {
+      auto index = m_view_model->createIndex(row, column);
+      emit m_view_model->dataChanged(index, index, roles);
+    }
+  }
+
+  void OnModelEvent(const ModelAboutToBeResetEvent &event) override
+  {
+    (void)event;
+    // the content of the model will be destroyed soon, views should stop looking at it
+    m_view_model->BeginResetModelNotify();
+    UpdateRows(nullptr);
+  }
+
+  void OnModelEvent(const ModelResetEvent &event) override
+  {
+    UpdateRows(event.model->GetRootItem());
+    m_view_model->EndResetModelNotify();  // BeginResetModel was already called
+  }
+
+  void OnModelEvent(const ModelAboutToBeDestroyedEvent &event) override
+  {
+    (void)event;
+    ResetRows(nullptr);
+  }
+
+private:
+  void SetRootItemImpl(SessionItem *root_item) override { ResetRows(root_item); }
+
+  /**
+   * @brief Regenerates rows and columns for the given root item with model reset notification.
+   */
+  void ResetRows(SessionItem *root_item)
+  {
+    m_view_model->BeginResetModelNotify();
+    UpdateRows(root_item);
+    m_view_model->EndResetModelNotify();
+  }
+
+  /**
+   * @brief Regenerates rows and columns for the given root item without notifications.
+   */
+  void UpdateRows(SessionItem *root_item)
+  {
+    m_root_item = root_item;
+    m_rows = m_root_item ? utils::TopLevelItems(*m_root_item) : std::vector<SessionItem *>{};
+    m_row_index_valid = false;
+
+    m_column_tags.clear();
+    m_labels.clear();
+    if (!m_rows.empty())
+    {
+      for (auto property : utils::SinglePropertyItems(*m_rows.front()))
+      {
+        m_column_tags.push_back(property->GetTagIndex().GetTag());
+        m_labels.push_back(QString::fromStdString(property->GetDisplayName()));
+      }
+    }
+  }
+
+  void OnItemsInserted(SessionItem *parent, const TagIndex &tag_index, int count)
+  {
+    if (!m_root_item)
+    {
+      return;
+    }
+
+    if (parent == m_root_item)
+    {
+      InsertRows(tag_index, count);
+    }
+    else if (auto row = FindRow(parent); row != -1)
+    {
+      NotifyRowChanged(row);  // one of the properties might be replaced
+    }
+  }
+
+  /**
+   * @brief Inserts rows for the range of new children of the root item.
+   */
+  void InsertRows(const TagIndex &tag_index, int count)
+  {
+    std::vector<SessionItem *> new_rows;
+    for (int index = 0; index < count; ++index)
+    {
+      auto child = m_root_item->GetItem(TagIndex{tag_index.GetTag(), tag_index.GetIndex() + index});
+      if (child && IsRowItem(*child))
+      {
+        new_rows.push_back(child);
+      }
+    }
+
+    if (new_rows.empty())
+    {
+      return;
+    }
+
+    if (m_column_tags.empty())
+    {
+      ResetRows(m_root_item);  // first rows define columns
+      return;
+    }
+
+    // Inserted rows form a contiguous range. Appending after the last row is the common case, it
+    // doesn't require a search.
+    int position = GetRowCount();
+    auto previous = tag_index.GetIndex() > 0 ? m_root_item->GetItem(tag_index.Prev()) : nullptr;
+    if (!m_rows.empty() && previous != m_rows.back())
+    {
+      position = utils::IndexOfItem(utils::TopLevelItems(*m_root_item), new_rows.front());
+    }
+
+    const int last = position + static_cast<int>(new_rows.size()) - 1;
+    m_view_model->beginInsertRows(QModelIndex(), position, last);
+    const bool is_append = position == GetRowCount();
+    m_rows.insert(std::next(m_rows.begin(), position), new_rows.begin(), new_rows.end());
+    if (is_append && m_row_index_valid)
+    {
+      for (int row = position; row <= last; ++row)
+      {
+        m_row_index.emplace(m_rows[static_cast<std::size_t>(row)], row);
+      }
+    }
+    else
+    {
+      m_row_index_valid = false;
+    }
+    m_view_model->endInsertRows();
+  }
+
+  void OnItemsAboutToBeRemoved(SessionItem *parent, const TagIndex &tag_index, int count)
+  {
+    if (!m_root_item)
+    {
+      return;
+    }
+
+    std::vector<int> rows_to_remove;
+    for (int index = 0; index < count; ++index)
+    {
+      auto child = parent->GetItem(TagIndex{tag_index.GetTag(), tag_index.GetIndex() + index});
+      if (child == m_root_item || utils::IsItemAncestor(m_root_item, child))
+      {
+        // special case when user removes our root item, or one of its ancestors
+        ResetRows(nullptr);
+        return;
+      }
+
+      if (parent == m_root_item)
+      {
+        if (auto row = FindRow(child); row != -1)
+        {
+          rows_to_remove.push_back(row);
+        }
+      }
+    }
+
+    // Removed rows form a contiguous range, if not, it is handled by the reset.
+    if (rows_to_remove.empty())
+    {
+      return;
+    }
+
+    std::sort(rows_to_remove.begin(), rows_to_remove.end());
+    const int first = rows_to_remove.front();
+    const int last = rows_to_remove.back();
+    if (last - first + 1 != static_cast<int>(rows_to_remove.size()))
+    {
+      m_view_model->BeginResetModelNotify();
+      for (auto iter = rows_to_remove.rbegin(); iter != rows_to_remove.rend(); ++iter)
+      {
+        m_rows.erase(std::next(m_rows.begin(), *iter));
+      }
+      m_row_index_valid = false;
+      m_view_model->EndResetModelNotify();
+      return;
+    }
+
+    m_view_model->beginRemoveRows(QModelIndex(), first, last);
+    m_rows.erase(std::next(m_rows.begin(), first), std::next(m_rows.begin(), last + 1));
+    m_row_index_valid = false;
+    m_view_model->endRemoveRows();
+  }
+
+  void OnItemsRemoved(SessionItem *parent)
+  {
+    if (auto row = FindRow(parent); row != -1)
+    {
+      NotifyRowChanged(row);  // one of the properties might be gone
+    }
+  }
+
+  void NotifyRowChanged(int row)
+  {
+    if (GetColumnCount() > 0)
+    {
+      emit m_view_model->dataChanged(m_view_model->createIndex(row, 0),
+                                     m_view_model->createIndex(row, GetColumnCount() - 1));
+    }
+  }
+
+  VirtualTableViewModel *m_view_model{nullptr};
+  SessionItem *m_root_item{nullptr};
+  std::vector<SessionItem *> m_rows;
+  std::vector<std::string> m_column_tags;
+  QStringList m_labels;
+  mutable std::unordered_map<const SessionItem *, int> m_row_index;
+  mutable bool m_row_index_valid{false};
+};
+
+VirtualTableViewModel::VirtualTableViewModel(ISessionModel *model, QObject *parent_object)
+    : ViewModel(parent_object)
+{
+  auto controller = std::make_unique<VirtualTableController>(this);
+  m_table_controller = controller.get();
+  SetController(std::move(controller));
+  if (model)
+  {
+    SetModel(model);
+  }
+}
+
+VirtualTableViewModel::~VirtualTableViewModel() = default;
+
+QModelIndex VirtualTableViewModel::index(int row, int column, const QModelIndex &parent) const
+{
+  if (parent.isValid() || row < 0 || row >= m_table_controller->GetRowCount() || column < 0
+      || column >= m_table_controller->GetColumnCount())
+  {
+    return {};
+  }
+  return createIndex(row, column);
+}
+
+QModelIndex VirtualTableViewModel::parent(const QModelIndex &child) const
+{
+  (void)child;
+  return {};
+}
+
+int VirtualTableViewModel::rowCount(const QModelIndex &parent) const
+{
+  return parent.isValid() ? 0 : m_table_controller->GetRowCount();
+}
+
+bool VirtualTableViewModel::hasChildren(const QModelIndex &parent) const
+{
+  return rowCount(parent) > 0;
+}
+
+QVariant VirtualTableViewModel::data(const QModelIndex &index, int role) const
+{
+  auto item = m_table_controller->GetCellItem(index.row(), index.column());
+  if (!index.isValid() || !item)
+  {
+    return {};
+  }
+
+  return ApplyPresentation(item, [role](SessionItemPresentation &presentation)
+                           { return presentation.Data(role); });
+}
+
+bool VirtualTableViewModel::setData(const QModelIndex &index, const QVariant &value, int role)
+{
+  auto item = m_table_controller->GetCellItem(index.row(), index.column());
+  if (!index.isValid() || !item)
+  {
+    return false;
+  }
+
+  // no explicit notification, the controller will do it after the change on SessionModel side
+  return ApplyPresentation(item, [&value, role](SessionItemPresentation &presentation)
+                           { return presentation.SetData(value, role); });
+}
+
+Qt::ItemFlags VirtualTableViewModel::flags(const QModelIndex &index) const
+{
+  Qt::ItemFlags result = QAbstractItemModel::flags(index);
+  auto item = m_table_controller->GetCellItem(index.row(), index.column());
+  if (!index.isValid() || !item)
+  {
+    return result;
+  }
+
+  result |= Qt::ItemIsSelectable | Qt::ItemIsEnabled;
+  if (ApplyPresentation(item, [](SessionItemPresentation &presentation)
+                        { return presentation.IsEditable(); }))
+  {
+    result |= Qt::ItemIsEditable;
+  }
+  return result;
+}
+
+const SessionItem *VirtualTableViewModel::GetSessionItemFromIndex(const QModelIndex &index) const
+{
+  return index.isValid() ? m_table_controller->GetCellItem(index.row(), index.column())
+                         : GetRootSessionItem();
+}
+
+QModelIndexList VirtualTableViewModel::GetIndexOfSessionItem(const SessionItem *item) const
+{
+  QModelIndexList result;
+
+  // row item is presented by all cells of its row
+  if (auto row = m_table_controller->FindRow(item); row != -1)
+  {
+    for (int column = 0; column < m_table_controller->GetColumnCount(); ++column)
+    {
+      result.push_back(createIndex(row, column));
+    }
+    return result;
+  }
+
+  if (auto [row, column] = m_table_controller->FindCell(item); row != -1)
+  {
+    result.push_back(createIndex(row, column));
+  }
+  return result;
+}
+
+QModelIndexList VirtualTableViewModel::GetIndexOfSessionItems(
+    const std::vector<const SessionItem *> &items) const
+{
+  // the lookup of every item is cheap here, no need to traverse the model
+  QModelIndexList result;
+  for (auto item : items)
+  {
+    result.append(GetIndexOfSessionItem(item));
+  }
+  return result;
+}
+
+}  // namespace mvvm
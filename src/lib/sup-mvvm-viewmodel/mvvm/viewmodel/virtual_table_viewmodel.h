@@ -0,0 +1,81 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef MVVM_VIEWMODEL_VIRTUAL_TABLE_VIEWMODEL_H_
+#define MVVM_VIEWMODEL_VIRTUAL_TABLE_VIEWMODEL_H_
+
+#include <mvvm/viewmodel/viewmodel.h>
+
+namespace mvvm
+{
+
+class ISessionModel;
+
+/**
+ * @brief The VirtualTableViewModel class shows top level items of SessionModel as a flat table,
+ * where each row is an item, and each column is one of its properties.
+ *
+ * It shows the same content as PropertyTableViewModel, but intended for large tables of
+ * same-typed items. No ViewItem or presentation objects are created for cells: the cell at
+ * (row, column) is the property of the row item with the column's tag, its data are computed on
+ * demand. Columns are defined by properties of the first row item.
+ *
+ * The model is flat, methods to access SessionItem from the index and back work as in other
+ * ViewModels. Methods returning ViewItem return nullptr.
+ */
+class MVVM_VIEWMODEL_EXPORT VirtualTableViewModel : public ViewModel
+{
+  Q_OBJECT
+
+public:
+  explicit VirtualTableViewModel(ISessionModel* model, QObject* parent_object = nullptr);
+  ~VirtualTableViewModel() override;
+
+  QModelIndex index(int row, int column, const QModelIndex& parent = QModelIndex()) const override;
+
+  QModelIndex parent(const QModelIndex& child) const override;
+
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+  bool hasChildren(const QModelIndex& parent = QModelIndex()) const override;
+
+  QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+  bool setData(const QModelIndex& index, const QVariant& value, int role) override;
+
+  Qt::ItemFlags flags(const QModelIndex& index) const override;
+
+  using ViewModel::GetSessionItemFromIndex;
+
+  const SessionItem* GetSessionItemFromIndex(const QModelIndex& index) const override;
+
+  QModelIndexList GetIndexOfSessionItem(const SessionItem* item) const override;
+
+  QModelIndexList GetIndexOfSessionItems(
+      const std::vector<const SessionItem*>& items) const override;
+
+private:
+  class VirtualTableController;
+  VirtualTableController* m_table_controller{nullptr};  //!< owned by the base
+};
+
+}  // namespace mvvm
+
+#endif  // MVVM_VIEWMODEL_VIRTUAL_TABLE_VIEWMODEL_H_
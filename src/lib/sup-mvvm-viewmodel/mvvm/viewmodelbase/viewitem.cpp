@@ -25,6 +25,8 @@
 #include <mvvm/core/mvvm_exceptions.h>
 #include <mvvm/utils/container_utils.h>
 
+#include <iterator>
+#include <optional>
 #include <vector>
 
 namespace mvvm
@@ -42,6 +44,8 @@ struct ViewItem::ViewItemImpl
   int m_my_col{-1};
   std::unique_ptr<ViewItemDataInterface> m_view_item_data;
   ViewItem* m_parent{nullptr};
+  mutable std::optional<QVariant> m_display_data;  //! cached data of Qt::DisplayRole
+  mutable std::optional<QVariant> m_edit_data;     //! cached data of Qt::EditRole
 
   explicit ViewItemImpl(std::unique_ptr<ViewItemDataInterface> view_item_data)
       : m_view_item_data(std::move(view_item_data))
@@ -80,6 +84,46 @@ struct ViewItem::ViewItemImpl
     UpdateChildrenCache();
   }
 
+  void InsertRows(int row, std::vector<std::vector<std::unique_ptr<ViewItem>>> rows)
+  {
+    if (row < 0 || row > m_rows)
+    {
+      throw RuntimeException("ViewItem: invalid row index");
+    }
+
+    if (rows.empty())
+    {
+      return;
+    }
+
+    const auto columns = m_columns > 0 ? static_cast<size_t>(m_columns) : rows.front().size();
+    std::vector<std::unique_ptr<ViewItem>> buffer;
+    buffer.reserve(rows.size() * columns);
+    for (auto& items : rows)
+    {
+      if (items.empty())
+      {
+        throw RuntimeException("ViewItem: attempt to insert empty row");
+      }
+
+      if (items.size() != columns)
+      {
+        throw RuntimeException("ViewItem: wrong number of columns");
+      }
+
+      std::move(items.begin(), items.end(), std::back_inserter(buffer));
+    }
+
+    m_children.insert(std::next(m_children.begin(), row * static_cast<int>(columns)),
+                      std::make_move_iterator(buffer.begin()),
+                      std::make_move_iterator(buffer.end()));
+
+    m_columns = static_cast<int>(columns);
+    m_rows += static_cast<int>(rows.size());
+
+    UpdateChildrenCache();
+  }
+
   void RemoveRow(int row)
   {
     if (row < 0 || row >= m_rows)
@@ -98,6 +142,24 @@ struct ViewItem::ViewItemImpl
     UpdateChildrenCache();
   }
 
+  void RemoveRows(int row, int count)
+  {
+    if (row < 0 || count < 0 || row + count > m_rows)
+    {
+      throw RuntimeException("Error in ViewItem: invalid row index.");
+    }
+
+    auto begin = std::next(m_children.begin(), row * m_columns);
+    m_children.erase(begin, std::next(begin, count * m_columns));
+    m_rows -= count;
+    if (m_rows == 0)
+    {
+      m_columns = 0;
+    }
+
+    UpdateChildrenCache();
+  }
+
   ViewItem* GetChild(int row, int column) const
   {
     if (row < 0 || row >= m_rows)
@@ -179,11 +241,28 @@ void ViewItem::InsertRow(int row, std::vector<std::unique_ptr<ViewItem>> items)
   p_impl->InsertRow(row, std::move(items));
 }
 
+void ViewItem::InsertRows(int row, std::vector<std::vector<std::unique_ptr<ViewItem>>> rows)
+{
+  for (auto& items : rows)
+  {
+    for (auto& x : items)
+    {
+      x->SetParent(this);
+    }
+  }
+  p_impl->InsertRows(row, std::move(rows));
+}
+
 void ViewItem::RemoveRow(int row)
 {
   p_impl->RemoveRow(row);
 }
 
+void ViewItem::RemoveRows(int row, int count)
+{
+  p_impl->RemoveRows(row, count);
+}
+
 void ViewItem::Clear()
 {
   p_impl->m_children.clear();
@@ -211,6 +290,18 @@ const ViewItemDataInterface* ViewItem::GetItemData() const
   return p_impl->m_view_item_data.get();
 }
 
+void ViewItem::SetItemData(std::unique_ptr<ViewItemDataInterface> view_item_data)
+{
+  p_impl->m_view_item_data = std::move(view_item_data);
+  ResetDataCache();
+}
+
+std::unique_ptr<ViewItemDataInterface> ViewItem::TakeItemData()
+{
+  ResetDataCache();
+  return std::move(p_impl->m_view_item_data);
+}
+
 int ViewItem::Row() const
 {
   return p_impl->m_my_row;
@@ -223,12 +314,48 @@ int ViewItem::Column() const
 
 QVariant ViewItem::Data(int qt_role) const
 {
-  return GetItemData() ? GetItemData()->Data(qt_role) : QVariant();
+  auto item_data = GetItemData();
+  if (!item_data)
+  {
+    return {};
+  }
+
+  std::optional<QVariant>* cache{nullptr};
+  if (qt_role == Qt::DisplayRole)
+  {
+    cache = &p_impl->m_display_data;
+  }
+  else if (qt_role == Qt::EditRole)
+  {
+    cache = &p_impl->m_edit_data;
+  }
+
+  if (!cache || !item_data->IsCacheable())
+  {
+    return item_data->Data(qt_role);
+  }
+
+  if (!cache->has_value())
+  {
+    *cache = item_data->Data(qt_role);
+  }
+  return cache->value();
 }
 
 bool ViewItem::SetData(const QVariant& value, int qt_role)
 {
-  return GetItemData() ? GetItemData()->SetData(value, qt_role) : false;
+  const bool result = GetItemData() ? GetItemData()->SetData(value, qt_role) : false;
+  if (result)
+  {
+    ResetDataCache();
+  }
+  return result;
+}
+
+void ViewItem::ResetDataCache() const
+{
+  p_impl->m_display_data.reset();
+  p_impl->m_edit_data.reset();
 }
 
 Qt::ItemFlags ViewItem::Flags() const
@@ -73,6 +73,16 @@ public:
    */
   void InsertRow(int row, std::vector<std::unique_ptr<ViewItem>> items);
 
+  /**
+   * @brief Inserts several rows of items starting from given position.
+   *
+   * All rows should have the same number of items. Children position cache is updated once.
+   *
+   * @param row Row index of the first inserted row.
+   * @param rows Rows of items to insert.
+   */
+  void InsertRows(int row, std::vector<std::vector<std::unique_ptr<ViewItem>>> rows);
+
   /**
    * @brief Removes row of items at given position.
    * Items will be deleted.
@@ -81,6 +91,15 @@ public:
    */
   void RemoveRow(int row);
 
+  /**
+   * @brief Removes several rows of items starting from given position.
+   * Items will be deleted.
+   *
+   * @param row Row index of the first row to remove.
+   * @param count The number of rows to remove.
+   */
+  void RemoveRows(int row, int count);
+
   /**
    * @brief Clears all children.
    */
@@ -111,6 +130,19 @@ public:
    */
   const ViewItemDataInterface* GetItemData() const;
 
+  /**
+   * @brief Sets new underlying data item, previous data item will be deleted.
+   *
+   * Allows to present another entity without recreating the view, and thus without
+   * notifying Qt views about removal and insertion of rows.
+   */
+  void SetItemData(std::unique_ptr<ViewItemDataInterface> view_item_data);
+
+  /**
+   * @brief Releases underlying data item, the view will carry no data after that.
+   */
+  std::unique_ptr<ViewItemDataInterface> TakeItemData();
+
   /**
    * @brief Returns the Row where the item is located in its parent's child table, or -1 if the item
    * has no parent.
@@ -139,6 +171,15 @@ public:
    */
   virtual bool SetData(const QVariant& value, int qt_role);
 
+  /**
+   * @brief Resets cached display and edit role data.
+   *
+   * Should be called when the data of the underlying presentation has changed. The data is
+   * cached only if the presentation reports it as cacheable. The cache isn't a part of the
+   * observable state, so it can be reset through a const item.
+   */
+  void ResetDataCache() const;
+
   /**
    * @brief Returns Qt's item Flags.
    *
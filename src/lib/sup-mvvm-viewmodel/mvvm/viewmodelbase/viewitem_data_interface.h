@@ -44,6 +44,14 @@ public:
   virtual bool IsEnabled() const = 0;
 
   virtual bool IsEditable() const = 0;
+
+  /**
+   * @brief Checks if display and edit role data can be cached by ViewItem.
+   *
+   * Data can be cached if it changes only together with notifications which reset the cache of
+   * the view item.
+   */
+  virtual bool IsCacheable() const { return false; }
 };
 
 }  // namespace mvvm
@@ -153,6 +153,23 @@ void ViewModelBase::removeRow(ViewItem* parent, int row)
   endRemoveRows();
 }
 
+void ViewModelBase::removeRows(ViewItem* parent, int row, int count)
+{
+  if (!p_impl->IsItemBelongsToModel(parent))
+  {
+    throw RuntimeException("Error in ViewModelBase: attempt to use parent from another model");
+  }
+
+  if (count <= 0)
+  {
+    return;
+  }
+
+  beginRemoveRows(indexFromItem(parent), row, row + count - 1);
+  parent->RemoveRows(row, count);
+  endRemoveRows();
+}
+
 void ViewModelBase::clearRows(ViewItem* parent)
 {
   if (!p_impl->IsItemBelongsToModel(parent))
@@ -172,14 +189,27 @@ void ViewModelBase::clearRows(ViewItem* parent)
 
 void ViewModelBase::insertRow(ViewItem* parent, int row,
                               std::vector<std::unique_ptr<ViewItem>> items)
+{
+  std::vector<std::vector<std::unique_ptr<ViewItem>>> rows;
+  rows.push_back(std::move(items));
+  insertRows(parent, row, std::move(rows));
+}
+
+void ViewModelBase::insertRows(ViewItem* parent, int row,
+                               std::vector<std::vector<std::unique_ptr<ViewItem>>> rows)
 {
   if (!p_impl->IsItemBelongsToModel(parent))
   {
     throw RuntimeException("Error in ViewModelBase: attempt to use parent from another model");
   }
 
-  beginInsertRows(indexFromItem(parent), row, row);
-  parent->InsertRow(row, std::move(items));
+  if (rows.empty())
+  {
+    return;
+  }
+
+  beginInsertRows(indexFromItem(parent), row, row + static_cast<int>(rows.size()) - 1);
+  parent->InsertRows(row, std::move(rows));
   endInsertRows();
 }
 
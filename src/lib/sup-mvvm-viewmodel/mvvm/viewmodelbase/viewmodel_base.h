@@ -104,6 +104,14 @@ public:
    */
   void removeRow(ViewItem* parent, int row);
 
+  /**
+   * @brief Removes several rows of items starting from given position with a single notification.
+   *
+   * @param row Row index of the first row to remove.
+   * @param count The number of rows to remove.
+   */
+  void removeRows(ViewItem* parent, int row, int count);
+
   /**
    * @brief Clears all children fof given parent.
    */
@@ -111,9 +119,19 @@ public:
 
   /**
    * @brief Inserts a row of items at index 'row' to given parent.
+   *
+   * The default implementation inserts a single row via insertRows.
    */
   virtual void insertRow(ViewItem* parent, int row, std::vector<std::unique_ptr<ViewItem>> items);
 
+  /**
+   * @brief Inserts several rows of items starting from index 'row' to given parent.
+   *
+   * Views are notified with a single beginInsertRows/endInsertRows pair.
+   */
+  virtual void insertRows(ViewItem* parent, int row,
+                          std::vector<std::vector<std::unique_ptr<ViewItem>>> rows);
+
   /**
    * @brief Appends a row of items at the end of vector of rows.
    */
@@ -20,6 +20,10 @@
 
 #include "viewmodel_base_utils.h"
 
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
 namespace mvvm::utils
 {
 void iterate_model(const QAbstractItemModel* model, const QModelIndex& parent,
@@ -48,4 +52,71 @@ void iterate_model(const QAbstractItemModel* model, const QModelIndex& parent,
   }
 }
 
+QItemSelection CreateMergedSelection(const QModelIndexList& indexes)
+{
+  // cells sorted by parent, row and column, parent is computed once per cell
+  std::vector<std::pair<QModelIndex, QModelIndex>> cells;
+  cells.reserve(static_cast<std::size_t>(indexes.size()));
+  for (const auto& index : indexes)
+  {
+    if (index.isValid())
+    {
+      cells.emplace_back(index.parent(), index);
+    }
+  }
+  auto less = [](const auto& lhs, const auto& rhs)
+  {
+    return std::make_tuple(lhs.first, lhs.second.row(), lhs.second.column())
+           < std::make_tuple(rhs.first, rhs.second.row(), rhs.second.column());
+  };
+  std::sort(cells.begin(), cells.end(), less);
+
+  QItemSelection result;
+  QModelIndex range_parent;
+  QModelIndex top_left;
+  QModelIndex bottom_right;
+  auto flush = [&result, &top_left, &bottom_right]()
+  {
+    if (top_left.isValid())
+    {
+      result.append(QItemSelectionRange(top_left, bottom_right));
+    }
+  };
+
+  std::size_t pos = 0;
+  while (pos < cells.size())
+  {
+    // the span is defined by the first and last cell of the contiguous run of columns
+    const auto& [parent, first_cell] = cells[pos];
+    auto end = pos + 1;
+    while (end < cells.size() && cells[end].first == parent
+           && cells[end].second.row() == first_cell.row()
+           && cells[end].second.column() <= cells[end - 1].second.column() + 1)
+    {
+      ++end;
+    }
+    const auto& last_cell = cells[end - 1].second;
+
+    const bool is_adjacent_row = top_left.isValid() && range_parent == parent
+                                 && bottom_right.row() + 1 == first_cell.row()
+                                 && top_left.column() == first_cell.column()
+                                 && bottom_right.column() == last_cell.column();
+    if (is_adjacent_row)
+    {
+      bottom_right = last_cell;
+    }
+    else
+    {
+      flush();
+      range_parent = parent;
+      top_left = first_cell;
+      bottom_right = last_cell;
+    }
+    pos = end;
+  }
+  flush();
+
+  return result;
+}
+
 }  // namespace mvvm::utils
@@ -25,6 +25,7 @@
 #include <mvvm/viewmodelbase/viewmodel_base.h>
 
 #include <QAbstractItemModel>
+#include <QItemSelection>
 #include <functional>
 
 namespace mvvm
@@ -38,6 +39,11 @@ namespace mvvm::utils
 MVVM_VIEWMODEL_EXPORT void iterate_model(const QAbstractItemModel* model, const QModelIndex& parent,
                                          const std::function<void(const QModelIndex& child)>& fun);
 
+//! Creates a selection covering given indexes. Contiguous cells of the same row are merged into a
+//! single range, adjacent rows with the same column span are merged together. Duplicates and
+//! invalid indexes are ignored.
+MVVM_VIEWMODEL_EXPORT QItemSelection CreateMergedSelection(const QModelIndexList& indexes);
+
 }  // namespace mvvm::utils
 
 #endif  // MVVM_VIEWMODELBASE_VIEWMODEL_BASE_UTILS_H_
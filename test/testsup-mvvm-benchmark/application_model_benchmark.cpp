@@ -27,6 +27,9 @@
 
 #include <benchmark/benchmark.h>
 
+#include <memory>
+#include <vector>
+
 using namespace mvvm;
 
 //! Testing performance of basic operations with ApplicationModel.
@@ -143,3 +146,44 @@ BENCHMARK_F(ApplicationModelBenchmark, InsertAndTake)(benchmark::State &state)
     model.TakeItem(parent, tag_index);
   }
 }
+
+//! Populating a container with 1000 children using single insertions.
+BENCHMARK_F(ApplicationModelBenchmark, PopulateWithInsertItem)(benchmark::State &state)
+{
+  const int item_count{1000};
+  mvvm::ApplicationModel model;
+
+  for (auto dummy : state)
+  {
+    auto parent = model.GetRootItem();  // root item is recreated on every model clear
+    for (int index = 0; index < item_count; ++index)
+    {
+      model.InsertItem<PropertyItem>(parent, TagIndex::Append());
+    }
+    state.PauseTiming();
+    model.Clear();
+    state.ResumeTiming();
+  }
+}
+
+//! Populating a container with 1000 children using bulk insertion.
+BENCHMARK_F(ApplicationModelBenchmark, PopulateWithInsertItems)(benchmark::State &state)
+{
+  const int item_count{1000};
+  mvvm::ApplicationModel model;
+
+  for (auto dummy : state)
+  {
+    auto parent = model.GetRootItem();  // root item is recreated on every model clear
+    std::vector<std::unique_ptr<SessionItem>> items;
+    items.reserve(item_count);
+    for (int index = 0; index < item_count; ++index)
+    {
+      items.push_back(std::make_unique<PropertyItem>());
+    }
+    model.InsertItems(std::move(items), parent, TagIndex::Append());
+    state.PauseTiming();
+    model.Clear();
+    state.ResumeTiming();
+  }
+}
@@ -0,0 +1,171 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/model/item_arena.h"
+
+#include <mvvm/model/item_utils.h>
+#include <mvvm/model/property_item.h>
+#include <mvvm/model/session_model.h>
+#include <mvvm/standarditems/container_item.h>
+
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+using namespace mvvm;
+
+namespace
+{
+
+const std::size_t kContainerCount = 10000;
+const std::size_t kItemsPerContainer = 100;
+const std::size_t kItemCount = kContainerCount * kItemsPerContainer;
+
+/**
+ * @brief Returns resident set size of the current process in bytes (Linux only).
+ */
+double GetResidentSetSize()
+{
+#if defined(__linux__)
+  std::ifstream statm("/proc/self/statm");
+  std::size_t total_pages{0};
+  std::size_t resident_pages{0};
+  statm >> total_pages >> resident_pages;
+  return static_cast<double>(resident_pages) * static_cast<double>(sysconf(_SC_PAGESIZE));
+#else
+  return 0.0;
+#endif
+}
+
+/**
+ * @brief Populates a model with containers holding property items, kItemCount items in total.
+ *
+ * If the model has an arena, it is used for item internals.
+ */
+void PopulateModel(SessionModel& model)
+{
+  const ItemMemoryScope scope(model.GetItemArena());
+  for (std::size_t container_index = 0; container_index < kContainerCount; ++container_index)
+  {
+    auto container = model.InsertItem<ContainerItem>();
+    for (std::size_t index = 0; index < kItemsPerContainer; ++index)
+    {
+      model.InsertItem<PropertyItem>(container, TagIndex::Append());
+    }
+  }
+}
+
+}  // namespace
+
+//! Testing performance of SessionItem allocation in model-scoped arena. Benchmark argument
+//! defines if the arena is used (1) or not (0). Resident set size is reported after the model
+//! population, run variants separately with --benchmark_filter to compare it.
+
+class ItemArenaBenchmark : public benchmark::Fixture
+{
+};
+
+//! Construction of a model with 1M items.
+
+BENCHMARK_DEFINE_F(ItemArenaBenchmark, Construction)(benchmark::State& state)
+{
+  const bool use_arena = state.range(0) != 0;
+
+  double rss{0.0};
+  for (auto dummy : state)
+  {
+    state.PauseTiming();
+    SessionModel model;
+    if (use_arena)
+    {
+      model.SetItemArena(std::make_unique<ItemArena>());
+    }
+    state.ResumeTiming();
+
+    PopulateModel(model);
+
+    state.PauseTiming();
+    rss = GetResidentSetSize();
+    model.Clear();
+    state.ResumeTiming();
+  }
+
+  state.counters["rss_bytes"] = rss;
+  state.counters["items"] = static_cast<double>(kItemCount);
+}
+
+BENCHMARK_REGISTER_F(ItemArenaBenchmark, Construction)
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(3);
+
+//! Clearing of a model with 1M items.
+
+BENCHMARK_DEFINE_F(ItemArenaBenchmark, Clear)(benchmark::State& state)
+{
+  const bool use_arena = state.range(0) != 0;
+
+  for (auto dummy : state)
+  {
+    state.PauseTiming();
+    SessionModel model;
+    if (use_arena)
+    {
+      model.SetItemArena(std::make_unique<ItemArena>());
+    }
+    PopulateModel(model);
+    state.ResumeTiming();
+
+    model.Clear();
+  }
+}
+
+BENCHMARK_REGISTER_F(ItemArenaBenchmark, Clear)
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(3);
+
+//! Traversal of a model with 1M items using utils::iterate.
+
+BENCHMARK_DEFINE_F(ItemArenaBenchmark, Iterate)(benchmark::State& state)
+{
+  SessionModel model;
+  if (state.range(0) != 0)
+  {
+    model.SetItemArena(std::make_unique<ItemArena>());
+  }
+  PopulateModel(model);
+
+  std::size_t count{0};
+  for (auto dummy : state)
+  {
+    utils::iterate(model.GetRootItem(), [&count](const SessionItem* item)
+                   { count += item->GetTotalItemCount(); });
+  }
+  benchmark::DoNotOptimize(count);
+}
+
+BENCHMARK_REGISTER_F(ItemArenaBenchmark, Iterate)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
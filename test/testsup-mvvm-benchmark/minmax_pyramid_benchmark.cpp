@@ -0,0 +1,112 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/utils/minmax_pyramid.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+using namespace mvvm;
+
+namespace
+{
+
+const std::size_t kPixelCount = 2000;
+
+//! Returns x-coordinates and y-values of a noisy trace.
+std::pair<std::vector<double>, std::vector<double>> CreateTrace(std::size_t size)
+{
+  std::mt19937 generator(42);
+  std::normal_distribution<double> distribution(0.0, 1.0);
+  std::vector<double> x(size);
+  std::vector<double> y(size);
+  for (std::size_t index = 0; index < size; ++index)
+  {
+    x[index] = static_cast<double>(index);
+    y[index] = distribution(generator);
+  }
+  return {x, y};
+}
+
+}  // namespace
+
+//! Testing performance of level-of-detail decimation of large traces for a 2000 pixel wide
+//! viewport.
+
+class MinMaxPyramidBenchmark : public benchmark::Fixture
+{
+};
+
+//! Building of the pyramid.
+
+BENCHMARK_DEFINE_F(MinMaxPyramidBenchmark, Build)(benchmark::State& state)
+{
+  auto [x, y] = CreateTrace(static_cast<std::size_t>(state.range(0)));
+  for (auto dummy : state)
+  {
+    const MinMaxPyramid pyramid(x, y);
+    benchmark::DoNotOptimize(pyramid.GetLevelCount());
+  }
+}
+
+BENCHMARK_REGISTER_F(MinMaxPyramidBenchmark, Build)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond);
+
+//! Decimation of the whole range, happens on every zoom or pan.
+
+BENCHMARK_DEFINE_F(MinMaxPyramidBenchmark, FullRange)(benchmark::State& state)
+{
+  auto [x, y] = CreateTrace(static_cast<std::size_t>(state.range(0)));
+  const MinMaxPyramid pyramid(x, y);
+  std::size_t count{0};
+  for (auto dummy : state)
+  {
+    count = pyramid.GetPoints(kPixelCount).x.size();
+  }
+  state.counters["points"] = static_cast<double>(count);
+}
+
+BENCHMARK_REGISTER_F(MinMaxPyramidBenchmark, FullRange)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMicrosecond);
+
+//! Decimation of the middle half of the range.
+
+BENCHMARK_DEFINE_F(MinMaxPyramidBenchmark, Zoomed)(benchmark::State& state)
+{
+  const auto size = static_cast<std::size_t>(state.range(0));
+  auto [x, y] = CreateTrace(size);
+  const MinMaxPyramid pyramid(x, y);
+  const double xmin = static_cast<double>(size) * 0.25;
+  const double xmax = static_cast<double>(size) * 0.75;
+  for (auto dummy : state)
+  {
+    benchmark::DoNotOptimize(pyramid.GetPoints(xmin, xmax, kPixelCount));
+  }
+}
+
+BENCHMARK_REGISTER_F(MinMaxPyramidBenchmark, Zoomed)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMicrosecond);
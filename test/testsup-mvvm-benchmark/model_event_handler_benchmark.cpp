@@ -26,6 +26,9 @@
 
 #include <benchmark/benchmark.h>
 
+#include <memory>
+#include <vector>
+
 using namespace mvvm;
 
 //! Testing performance of ModelEventHandler.
@@ -132,3 +135,92 @@ BENCHMARK_F(ModelEventHandlerBenchmark, TwoEventsTwoListeners)(benchmark::State
     m_event_handler.Notify<ItemInsertedEvent>(&item, tag_index);
   }
 }
+
+//! Single notification with the given number of listeners.
+
+BENCHMARK_DEFINE_F(ModelEventHandlerBenchmark, SingleEventManyListeners)(benchmark::State &state)
+{
+  ModelEventHandler m_event_handler;
+  std::vector<TestListener> listeners(static_cast<std::size_t>(state.range(0)));
+
+  mvvm::SessionItem item;
+  mvvm::TagIndex tag_index{"tag", 0};
+  AboutToInsertItemEvent event{&item, tag_index};
+
+  for (auto &listener : listeners)
+  {
+    m_event_handler.Connect<AboutToInsertItemEvent>(&listener, &TestListener::OnEvent);
+  }
+
+  for (auto dummy : state)
+  {
+    m_event_handler.Notify(event);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_REGISTER_F(ModelEventHandlerBenchmark, SingleEventManyListeners)
+    ->Arg(1)
+    ->Arg(100)
+    ->Arg(10000);
+
+//! Connection and disconnection of the given number of listeners with slots.
+
+BENCHMARK_DEFINE_F(ModelEventHandlerBenchmark, ConnectDisconnectManyListeners)
+(benchmark::State &state)
+{
+  ModelEventHandler m_event_handler;
+  const auto count = static_cast<std::size_t>(state.range(0));
+
+  for (auto dummy : state)
+  {
+    std::vector<std::unique_ptr<Slot>> slots;
+    slots.reserve(count);
+    TestListener listener;
+    for (std::size_t index = 0; index < count; ++index)
+    {
+      slots.push_back(std::make_unique<Slot>());
+      m_event_handler.Connect<AboutToInsertItemEvent>(&listener, &TestListener::OnEvent,
+                                                      slots.back().get());
+    }
+    slots.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_REGISTER_F(ModelEventHandlerBenchmark, ConnectDisconnectManyListeners)
+    ->Arg(1)
+    ->Arg(100)
+    ->Arg(10000);
+
+//! Single notification with the given number of listeners, where every listener disconnects
+//! itself during the notification and connects again afterwards.
+
+BENCHMARK_DEFINE_F(ModelEventHandlerBenchmark, DisconnectDuringNotification)
+(benchmark::State &state)
+{
+  ModelEventHandler m_event_handler;
+  const auto count = static_cast<std::size_t>(state.range(0));
+
+  mvvm::SessionItem item;
+  mvvm::TagIndex tag_index{"tag", 0};
+  AboutToInsertItemEvent event{&item, tag_index};
+
+  std::vector<std::unique_ptr<Slot>> slots(count);
+  for (auto dummy : state)
+  {
+    for (auto &slot : slots)
+    {
+      slot = std::make_unique<Slot>();
+      m_event_handler.Connect<AboutToInsertItemEvent>([&slot](const event_variant_t &)
+                                                      { slot.reset(); }, slot.get());
+    }
+    m_event_handler.Notify(event);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_REGISTER_F(ModelEventHandlerBenchmark, DisconnectDuringNotification)
+    ->Arg(1)
+    ->Arg(100)
+    ->Arg(10000);
@@ -0,0 +1,157 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/utils/numeric_codec.h"
+
+#include <mvvm/utils/string_utils.h>
+
+#include <benchmark/benchmark.h>
+
+#include <iomanip>
+#include <iterator>
+#include <random>
+#include <sstream>
+
+using namespace mvvm;
+
+namespace
+{
+
+const std::size_t kArraySize = 10000000;
+
+//! Returns vector of random doubles.
+std::vector<double> CreateValues(std::size_t size)
+{
+  std::mt19937_64 generator(42);
+  std::uniform_real_distribution<double> distribution(-1e6, 1e6);
+  std::vector<double> result(size);
+  for (auto& value : result)
+  {
+    value = distribution(generator);
+  }
+  return result;
+}
+
+//! Stream based conversion to string used before the codec, for comparison.
+std::string LegacyToString(const std::vector<double>& values)
+{
+  std::ostringstream ostr;
+  ostr.imbue(std::locale::classic());
+  ostr << std::setprecision(12);
+  for (auto value : values)
+  {
+    ostr << value << " ";
+  }
+  return ostr.str();
+}
+
+//! Stream based parsing used before the codec, for comparison.
+std::vector<double> LegacyParse(const std::string& text)
+{
+  std::vector<double> result;
+  std::istringstream iss(text);
+  iss.imbue(std::locale::classic());
+  std::copy(std::istream_iterator<double>(iss), std::istream_iterator<double>(),
+            std::back_inserter(result));
+  return result;
+}
+
+}  // namespace
+
+//! Testing throughput of numeric text codec on large arrays. Legacy stream based conversions are
+//! given for comparison.
+
+class NumericCodecBenchmark : public benchmark::Fixture
+{
+};
+
+BENCHMARK_DEFINE_F(NumericCodecBenchmark, LegacyToString)(benchmark::State& state)
+{
+  const auto values = CreateValues(static_cast<std::size_t>(state.range(0)));
+  for (auto dummy : state)
+  {
+    benchmark::DoNotOptimize(LegacyToString(values));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_REGISTER_F(NumericCodecBenchmark, LegacyToString)
+    ->Arg(kArraySize)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(NumericCodecBenchmark, ToString)(benchmark::State& state)
+{
+  const auto values = CreateValues(static_cast<std::size_t>(state.range(0)));
+  for (auto dummy : state)
+  {
+    benchmark::DoNotOptimize(utils::ToSeparatedString(values, " "));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_REGISTER_F(NumericCodecBenchmark, ToString)
+    ->Arg(kArraySize)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(NumericCodecBenchmark, LegacyParse)(benchmark::State& state)
+{
+  const auto text = LegacyToString(CreateValues(static_cast<std::size_t>(state.range(0))));
+  for (auto dummy : state)
+  {
+    benchmark::DoNotOptimize(LegacyParse(text));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_REGISTER_F(NumericCodecBenchmark, LegacyParse)
+    ->Arg(kArraySize)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(NumericCodecBenchmark, Parse)(benchmark::State& state)
+{
+  const auto text = utils::ToSeparatedString(CreateValues(static_cast<std::size_t>(state.range(0))),
+                                             " ");
+  for (auto dummy : state)
+  {
+    std::vector<double> result;
+    utils::ParseWhitespaceSeparatedDoubles(text, result);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_REGISTER_F(NumericCodecBenchmark, Parse)->Arg(kArraySize)->Unit(benchmark::kMillisecond);
+
+//! Round trip of a large vector through the comma separated text used by serialization.
+
+BENCHMARK_DEFINE_F(NumericCodecBenchmark, CommaSeparatedRoundTrip)(benchmark::State& state)
+{
+  const auto values = CreateValues(static_cast<std::size_t>(state.range(0)));
+  for (auto dummy : state)
+  {
+    const auto text = utils::ToCommaSeparatedString(values);
+    benchmark::DoNotOptimize(utils::ParseCommaSeparatedDoubles(text));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_REGISTER_F(NumericCodecBenchmark, CommaSeparatedRoundTrip)
+    ->Arg(kArraySize)
+    ->Unit(benchmark::kMillisecond);
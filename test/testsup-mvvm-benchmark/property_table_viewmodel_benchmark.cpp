@@ -0,0 +1,121 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/viewmodel/property_table_viewmodel.h"
+
+#include <mvvm/model/application_model.h>
+#include <mvvm/standarditems/vector_item.h>
+#include <mvvm/viewmodel/variant_converter.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace mvvm;
+
+namespace
+{
+
+const int kRowCount = 100000;
+const int kVisibleRowCount = 50;
+
+//! Requests display data of all cells of visible rows, as the view does on painting.
+void PaintRows(const QAbstractItemModel& view_model, int first_row)
+{
+  for (int row = first_row; row < first_row + kVisibleRowCount; ++row)
+  {
+    for (int column = 0; column < view_model.columnCount(); ++column)
+    {
+      benchmark::DoNotOptimize(view_model.data(view_model.index(row, column), Qt::DisplayRole));
+    }
+  }
+}
+
+//! Returns model with VectorItem in every row, each item gives three columns in a table.
+std::unique_ptr<ApplicationModel> CreateModel()
+{
+  auto result = std::make_unique<ApplicationModel>();
+  for (int index = 0; index < kRowCount; ++index)
+  {
+    result->InsertItem<VectorItem>();
+  }
+  return result;
+}
+
+}  // namespace
+
+//! Testing performance of data access in PropertyTableViewModel with 100k rows.
+
+class PropertyTableViewModelBenchmark : public benchmark::Fixture
+{
+};
+
+//! Scrolling through the whole table page by page, every cell is painted once.
+
+BENCHMARK_DEFINE_F(PropertyTableViewModelBenchmark, Scroll)(benchmark::State& state)
+{
+  auto model = CreateModel();
+
+  for (auto dummy : state)
+  {
+    state.PauseTiming();
+    auto view_model = std::make_unique<PropertyTableViewModel>(model.get());
+    state.ResumeTiming();
+
+    for (int row = 0; row + kVisibleRowCount <= kRowCount; row += kVisibleRowCount)
+    {
+      PaintRows(*view_model, row);
+    }
+
+    state.PauseTiming();
+    view_model.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * kRowCount);
+}
+
+BENCHMARK_REGISTER_F(PropertyTableViewModelBenchmark, Scroll)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(3);
+
+//! Repeated painting of the same visible rows, e.g. on hover, data of cells is cached.
+
+BENCHMARK_DEFINE_F(PropertyTableViewModelBenchmark, Repaint)(benchmark::State& state)
+{
+  auto model = CreateModel();
+  const PropertyTableViewModel view_model(model.get());
+
+  for (auto dummy : state)
+  {
+    PaintRows(view_model, kRowCount / 2);
+  }
+  state.SetItemsProcessed(state.iterations() * kVisibleRowCount);
+}
+
+BENCHMARK_REGISTER_F(PropertyTableViewModelBenchmark, Repaint)->Unit(benchmark::kMicrosecond);
+
+//! Conversion of cell data on editing.
+
+BENCHMARK_F(PropertyTableViewModelBenchmark, EditConversion)(benchmark::State& state)
+{
+  const QVariant qt_variant(42.0);
+  for (auto dummy : state)
+  {
+    benchmark::DoNotOptimize(GetQtVariant(GetStdVariant(qt_variant)));
+  }
+}
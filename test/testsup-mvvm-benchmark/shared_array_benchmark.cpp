@@ -0,0 +1,88 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/core/shared_array.h"
+
+#include <mvvm/model/session_item.h>
+#include <mvvm/model/session_item_data.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace mvvm;
+
+namespace
+{
+
+const std::size_t kArraySize = 100 * 1024 * 1024 / sizeof(double);  // 100 MB
+
+}  // namespace
+
+//! Testing the cost of reading and snapshotting large arrays stored in the item. Arrays stored as
+//! std::vector<double> are given for comparison.
+
+class SharedArrayBenchmark : public benchmark::Fixture
+{
+};
+
+BENCHMARK_F(SharedArrayBenchmark, ReadVector)(benchmark::State& state)
+{
+  SessionItem item;
+  item.SetData(std::vector<double>(kArraySize, 42.0));
+
+  for (auto dummy : state)
+  {
+    benchmark::DoNotOptimize(item.Data<std::vector<double>>());
+  }
+}
+
+BENCHMARK_F(SharedArrayBenchmark, ReadSharedArray)(benchmark::State& state)
+{
+  SessionItem item;
+  item.SetData(SharedArray<double>(std::vector<double>(kArraySize, 42.0)));
+
+  for (auto dummy : state)
+  {
+    benchmark::DoNotOptimize(item.Data<SharedArray<double>>());
+  }
+}
+
+BENCHMARK_F(SharedArrayBenchmark, SnapshotVector)(benchmark::State& state)
+{
+  SessionItem item;
+  item.SetData(std::vector<double>(kArraySize, 42.0));
+
+  for (auto dummy : state)
+  {
+    const SessionItemData snapshot(*item.GetItemData());
+    benchmark::DoNotOptimize(snapshot);
+  }
+}
+
+BENCHMARK_F(SharedArrayBenchmark, SnapshotSharedArray)(benchmark::State& state)
+{
+  SessionItem item;
+  item.SetData(SharedArray<double>(std::vector<double>(kArraySize, 42.0)));
+
+  for (auto dummy : state)
+  {
+    const SessionItemData snapshot(*item.GetItemData());
+    benchmark::DoNotOptimize(snapshot);
+  }
+}
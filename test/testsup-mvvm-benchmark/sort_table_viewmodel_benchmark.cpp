@@ -0,0 +1,165 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/viewmodel/sort_table_viewmodel.h"
+
+#include <mvvm/model/application_model.h>
+#include <mvvm/standarditems/vector_item.h>
+#include <mvvm/viewmodel/property_table_viewmodel.h>
+
+#include <benchmark/benchmark.h>
+
+#include <QSortFilterProxyModel>
+
+#include <random>
+
+using namespace mvvm;
+
+namespace
+{
+
+const int kRowCount = 100000;
+
+//! Returns model with VectorItem in every row, with random coordinates.
+std::unique_ptr<ApplicationModel> CreateModel()
+{
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1e3, 1e3);
+  auto result = std::make_unique<ApplicationModel>();
+  for (int index = 0; index < kRowCount; ++index)
+  {
+    result->InsertItem<VectorItem>()->SetXYZ(distribution(generator), distribution(generator),
+                                             distribution(generator));
+  }
+  return result;
+}
+
+//! Returns the model shared by all benchmarks, it takes a while to create it.
+ApplicationModel& GetModel()
+{
+  static auto model = CreateModel();
+  return *model;
+}
+
+//! Returns vector items of the model.
+std::vector<VectorItem*> GetVectors()
+{
+  std::vector<VectorItem*> result;
+  for (auto item : GetModel().GetRootItem()->GetAllItems())
+  {
+    result.push_back(static_cast<VectorItem*>(item));
+  }
+  return result;
+}
+
+}  // namespace
+
+//! Testing performance of sorting of PropertyTableViewModel with 100k rows. QSortFilterProxyModel
+//! is given for comparison.
+
+class SortTableViewModelBenchmark : public benchmark::Fixture
+{
+};
+
+//! Initial sorting by two columns.
+
+BENCHMARK_DEFINE_F(SortTableViewModelBenchmark, Sort)(benchmark::State& state)
+{
+  PropertyTableViewModel view_model(&GetModel());
+
+  for (auto dummy : state)
+  {
+    state.PauseTiming();
+    SortTableViewModel proxy;
+    proxy.setSourceModel(&view_model);
+    state.ResumeTiming();
+
+    proxy.SetSortColumns({{0, Qt::AscendingOrder}, {1, Qt::AscendingOrder}});
+  }
+  state.SetItemsProcessed(state.iterations() * kRowCount);
+}
+
+BENCHMARK_REGISTER_F(SortTableViewModelBenchmark, Sort)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(3);
+
+BENCHMARK_DEFINE_F(SortTableViewModelBenchmark, LegacySort)(benchmark::State& state)
+{
+  PropertyTableViewModel view_model(&GetModel());
+
+  for (auto dummy : state)
+  {
+    state.PauseTiming();
+    QSortFilterProxyModel proxy;
+    proxy.setSourceModel(&view_model);
+    state.ResumeTiming();
+
+    proxy.sort(1);
+    proxy.sort(0);
+  }
+  state.SetItemsProcessed(state.iterations() * kRowCount);
+}
+
+BENCHMARK_REGISTER_F(SortTableViewModelBenchmark, LegacySort)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(3);
+
+//! Editing sort key of random rows of the sorted table.
+
+BENCHMARK_DEFINE_F(SortTableViewModelBenchmark, EditSortKey)(benchmark::State& state)
+{
+  PropertyTableViewModel view_model(&GetModel());
+  SortTableViewModel proxy;
+  proxy.setSourceModel(&view_model);
+  proxy.sort(0);
+
+  const auto vectors = GetVectors();
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<std::size_t> row_distribution(0, vectors.size() - 1);
+  std::uniform_real_distribution<double> value_distribution(-1e3, 1e3);
+  for (auto dummy : state)
+  {
+    vectors[row_distribution(generator)]->SetX(value_distribution(generator));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_REGISTER_F(SortTableViewModelBenchmark, EditSortKey)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(SortTableViewModelBenchmark, LegacyEditSortKey)(benchmark::State& state)
+{
+  PropertyTableViewModel view_model(&GetModel());
+  QSortFilterProxyModel proxy;
+  proxy.setSourceModel(&view_model);
+  proxy.sort(0);
+
+  const auto vectors = GetVectors();
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<std::size_t> row_distribution(0, vectors.size() - 1);
+  std::uniform_real_distribution<double> value_distribution(-1e3, 1e3);
+  for (auto dummy : state)
+  {
+    vectors[row_distribution(generator)]->SetX(value_distribution(generator));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_REGISTER_F(SortTableViewModelBenchmark, LegacyEditSortKey)
+    ->Unit(benchmark::kMicrosecond);
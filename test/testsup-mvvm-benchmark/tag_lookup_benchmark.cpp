@@ -0,0 +1,148 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <mvvm/model/compound_item.h>
+#include <mvvm/model/property_item.h>
+#include <mvvm/model/tagged_items.h>
+#include <mvvm/model/taginfo.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace mvvm;
+
+//! Testing performance of tag and type lookups on hot paths.
+
+class TagLookupBenchmark : public benchmark::Fixture
+{
+public:
+  //! Returns compound item with given number of properties.
+  static std::unique_ptr<CompoundItem> CreateCompound(int property_count)
+  {
+    auto result = std::make_unique<CompoundItem>();
+    for (int index = 0; index < property_count; ++index)
+    {
+      result->AddProperty(GetPropertyName(index), 42.0);
+    }
+    return result;
+  }
+
+  //! Returns the name of the property with given index, long enough to avoid small string
+  //! optimisation.
+  static std::string GetPropertyName(int index)
+  {
+    return "compound_property_name_" + std::to_string(index);
+  }
+
+  //! Returns the name of the item type with given index.
+  static std::string GetItemTypeName(int index)
+  {
+    return "AllowedItemTypeName" + std::to_string(index);
+  }
+};
+
+//! Reading the last property of the compound item.
+
+BENCHMARK_F(TagLookupBenchmark, PropertyRead)(benchmark::State& state)
+{
+  const int property_count{10};
+  auto item = CreateCompound(property_count);
+  const auto tag = GetPropertyName(property_count - 1);
+
+  for (auto dummy : state)
+  {
+    benchmark::DoNotOptimize(item->Property<double>(tag));
+  }
+}
+
+//! Writing the last property of the compound item.
+
+BENCHMARK_F(TagLookupBenchmark, PropertyWrite)(benchmark::State& state)
+{
+  const int property_count{10};
+  auto item = CreateCompound(property_count);
+  const auto tag = GetPropertyName(property_count - 1);
+
+  double value{0.0};
+  for (auto dummy : state)
+  {
+    item->SetProperty(tag, value);
+    value += 1.0;
+  }
+}
+
+//! Validation of item insert into the tag with several allowed types.
+
+BENCHMARK_F(TagLookupBenchmark, InsertValidation)(benchmark::State& state)
+{
+  const int type_count{5};
+  std::vector<std::string> item_types;
+  for (int index = 0; index < type_count; ++index)
+  {
+    item_types.push_back(GetItemTypeName(index));
+  }
+  item_types.push_back(PropertyItem::GetStaticType());
+
+  auto parent = CreateCompound(5);
+  parent->RegisterTag(TagInfo::CreateUniversalTag("universal_tag_name", item_types));
+
+  const PropertyItem item;
+  const TagIndex tag_index{"universal_tag_name", 0};
+
+  for (auto dummy : state)
+  {
+    benchmark::DoNotOptimize(parent->GetTaggedItems()->CanInsertItem(&item, tag_index));
+  }
+}
+
+//! Insert/take of an item into the tag with several allowed types.
+
+BENCHMARK_F(TagLookupBenchmark, InsertAndTake)(benchmark::State& state)
+{
+  const int type_count{5};
+  std::vector<std::string> item_types;
+  for (int index = 0; index < type_count; ++index)
+  {
+    item_types.push_back(GetItemTypeName(index));
+  }
+  item_types.push_back(PropertyItem::GetStaticType());
+
+  auto parent = CreateCompound(5);
+  parent->RegisterTag(TagInfo::CreateUniversalTag("universal_tag_name", item_types));
+  const TagIndex tag_index{"universal_tag_name", 0};
+
+  std::unique_ptr<SessionItem> item = std::make_unique<PropertyItem>();
+  for (auto dummy : state)
+  {
+    parent->InsertItem(std::move(item), tag_index);
+    item = parent->TakeItem(tag_index);
+  }
+}
+
+//! Accessing the type of the item.
+
+BENCHMARK_F(TagLookupBenchmark, GetType)(benchmark::State& state)
+{
+  const PropertyItem item;
+
+  for (auto dummy : state)
+  {
+    benchmark::DoNotOptimize(item.GetType());
+  }
+}
@@ -0,0 +1,102 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <mvvm/model/application_model.h>
+#include <mvvm/standarditems/axis_items.h>
+#include <mvvm/standarditems/data1d_item.h>
+#include <mvvm/standarditems/graph_item.h>
+#include <mvvm/standarditems/graph_viewport_item.h>
+#include <mvvm/utils/data_range.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+
+using namespace mvvm;
+
+namespace
+{
+
+const int kGraphCount = 50;
+const int kPointCount = 100000;
+
+//! Returns vector of random doubles.
+std::vector<double> CreateValues(std::size_t size)
+{
+  std::mt19937_64 generator(42);
+  std::uniform_real_distribution<double> distribution(-1e6, 1e6);
+  std::vector<double> result(size);
+  std::generate(result.begin(), result.end(), [&]() { return distribution(generator); });
+  return result;
+}
+
+}  // namespace
+
+//! Testing performance of auto-ranging of the viewport with many large graphs.
+
+class ViewportRangeBenchmark : public benchmark::Fixture
+{
+};
+
+//! Setting the viewport to the range of its content.
+
+BENCHMARK_F(ViewportRangeBenchmark, SetViewportToContent)(benchmark::State& state)
+{
+  ApplicationModel model;
+  auto viewport_item = model.InsertItem<GraphViewportItem>();
+  const auto values = CreateValues(kPointCount);
+  for (int index = 0; index < kGraphCount; ++index)
+  {
+    auto data_item = model.InsertItem<Data1DItem>();
+    data_item->SetAxis<FixedBinAxisItem>(kPointCount, 0.0, 1.0);
+    data_item->SetValues(values);
+    model.InsertItem<GraphItem>(viewport_item)->SetDataItem(data_item);
+  }
+
+  for (auto dummy : state)
+  {
+    viewport_item->SetViewportToContent();
+  }
+}
+
+//! Min/max of a large array with SIMD kernel.
+
+BENCHMARK_F(ViewportRangeBenchmark, FindDataRange)(benchmark::State& state)
+{
+  const auto values = CreateValues(kPointCount);
+  for (auto dummy : state)
+  {
+    benchmark::DoNotOptimize(utils::FindDataRange(values));
+  }
+  state.SetItemsProcessed(state.iterations() * kPointCount);
+}
+
+//! Min/max of a large array with the standard algorithm, for comparison.
+
+BENCHMARK_F(ViewportRangeBenchmark, MinMaxElement)(benchmark::State& state)
+{
+  const auto values = CreateValues(kPointCount);
+  for (auto dummy : state)
+  {
+    benchmark::DoNotOptimize(std::minmax_element(values.begin(), values.end()));
+  }
+  state.SetItemsProcessed(state.iterations() * kPointCount);
+}
@@ -376,6 +376,97 @@ TEST_F(ApplicationModelTest, TakeItem)
   testing::Mock::VerifyAndClearExpectations(&listener);
 }
 
+//! Inserting several items at once.
+TEST_F(ApplicationModelTest, InsertItems)
+{
+  auto parent = m_model.InsertItem<CompoundItem>();
+  parent->RegisterTag(TagInfo::CreateUniversalTag("tag"), true);
+  m_model.InsertItem<PropertyItem>(parent);
+
+  std::vector<std::unique_ptr<SessionItem>> items;
+  items.push_back(std::make_unique<PropertyItem>());
+  items.push_back(std::make_unique<PropertyItem>());
+  const TagIndex tag_index{"tag", 1};
+
+  mock_listener_t listener(&m_model);
+
+  {
+    const ::testing::InSequence seq;
+    const AboutToInsertItemsEvent expected_event1{parent, tag_index, 2};
+    const ItemsInsertedEvent expected_event2{parent, tag_index, 2};
+    EXPECT_CALL(listener, OnAboutToInsertItems(expected_event1)).Times(1);
+    EXPECT_CALL(listener, OnItemsInserted(expected_event2)).Times(1);
+  }
+
+  auto inserted = m_model.InsertItems(std::move(items), parent, tag_index);
+  ASSERT_EQ(inserted.size(), 2);
+  EXPECT_EQ(parent->GetTotalItemCount(), 3);
+  EXPECT_EQ(parent->GetItem(tag_index), inserted[0]);
+  EXPECT_EQ(inserted[1]->GetTagIndex(), TagIndex("tag", 2));
+  EXPECT_EQ(inserted[1]->GetModel(), &m_model);
+  EXPECT_EQ(inserted[1]->GetParent(), parent);
+
+  // verify here, and not on MockModelListener destruction (to mute OnModelAboutToBeDestroyed)
+  testing::Mock::VerifyAndClearExpectations(&listener);
+}
+
+//! Attempt to insert several items when one of them can't be inserted.
+TEST_F(ApplicationModelTest, InvalidInsertItems)
+{
+  auto parent = m_model.InsertItem<CompoundItem>();
+  parent->RegisterTag(TagInfo("tag", 0, 2, {}), true);
+
+  std::vector<std::unique_ptr<SessionItem>> items;
+  items.push_back(std::make_unique<PropertyItem>());
+  items.push_back(std::make_unique<PropertyItem>());
+  items.push_back(std::make_unique<PropertyItem>());
+
+  mock_listener_t listener(&m_model);
+
+  EXPECT_THROW(m_model.InsertItems(std::move(items), parent, {"tag", 0}),
+               InvalidOperationException);
+  EXPECT_EQ(parent->GetTotalItemCount(), 0);
+
+  // verify here, and not on MockModelListener destruction (to mute OnModelAboutToBeDestroyed)
+  testing::Mock::VerifyAndClearExpectations(&listener);
+}
+
+//! Taking several items at once.
+TEST_F(ApplicationModelTest, TakeItems)
+{
+  auto parent = m_model.InsertItem<CompoundItem>();
+  parent->RegisterTag(TagInfo::CreateUniversalTag("tag"), true);
+  auto child0 = m_model.InsertItem<PropertyItem>(parent);
+  auto child1 = m_model.InsertItem<PropertyItem>(parent);
+  auto child2 = m_model.InsertItem<PropertyItem>(parent);
+  const TagIndex tag_index{"tag", 0};
+
+  mock_listener_t listener(&m_model);
+
+  {
+    const ::testing::InSequence seq;
+    const AboutToRemoveItemsEvent expected_event1{parent, tag_index, 2};
+    const ItemsRemovedEvent expected_event2{parent, tag_index, 2};
+    EXPECT_CALL(listener, OnAboutToRemoveItems(expected_event1)).Times(1);
+    EXPECT_CALL(listener, OnItemsRemoved(expected_event2)).Times(1);
+  }
+
+  auto taken = m_model.TakeItems(parent, tag_index, 2);
+  ASSERT_EQ(taken.size(), 2);
+  EXPECT_EQ(taken[0].get(), child0);
+  EXPECT_EQ(taken[1].get(), child1);
+  EXPECT_EQ(taken[1]->GetModel(), nullptr);
+  EXPECT_EQ(taken[1]->GetParent(), nullptr);
+  EXPECT_EQ(parent->GetTotalItemCount(), 1);
+  EXPECT_EQ(parent->GetItem(tag_index), child2);
+
+  // verify here, and not on MockModelListener destruction (to mute OnModelAboutToBeDestroyed)
+  testing::Mock::VerifyAndClearExpectations(&listener);
+
+  // range is too long
+  EXPECT_THROW(m_model.TakeItems(parent, tag_index, 2), InvalidOperationException);
+}
+
 //! Removing item.
 TEST_F(ApplicationModelTest, RemoveItem)
 {
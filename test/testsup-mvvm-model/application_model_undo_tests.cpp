@@ -91,6 +91,48 @@ TEST_F(ApplicationModelUndoTests, InsertItemSetDataRemoveItem)
   EXPECT_EQ(m_model.GetRootItem()->GetItem(TagIndex())->Data(), variant_t(42));
 }
 
+//! Inserting several items at once, undoing, redoing, then taking them at once.
+TEST_F(ApplicationModelUndoTests, InsertItemsTakeItems)
+{
+  m_model.SetUndoEnabled(true);
+  auto commands = m_model.GetCommandStack();
+
+  std::vector<std::unique_ptr<SessionItem>> items;
+  for (int index = 0; index < 3; ++index)
+  {
+    auto item = std::make_unique<PropertyItem>();
+    item->SetData(index);
+    items.push_back(std::move(item));
+  }
+
+  // single command for the whole range
+  auto inserted = m_model.InsertItems(std::move(items), m_model.GetRootItem(), TagIndex::Append());
+  EXPECT_EQ(commands->GetCommandCount(), 1);
+  EXPECT_EQ(m_model.GetRootItem()->GetTotalItemCount(), 3);
+  const auto identifier = inserted.at(2)->GetIdentifier();
+
+  commands->Undo();
+  EXPECT_EQ(m_model.GetRootItem()->GetTotalItemCount(), 0);
+
+  // redo inserts the same items again
+  commands->Redo();
+  ASSERT_EQ(m_model.GetRootItem()->GetTotalItemCount(), 3);
+  EXPECT_EQ(m_model.GetRootItem()->GetItem(TagIndex::Default(2))->Data(), variant_t(2));
+  EXPECT_EQ(m_model.GetRootItem()->GetItem(TagIndex::Default(2))->GetIdentifier(), identifier);
+
+  // taking two last items
+  auto taken = m_model.TakeItems(m_model.GetRootItem(), TagIndex::Default(1), 2);
+  EXPECT_EQ(taken.size(), 2);
+  EXPECT_EQ(taken[0]->Data(), variant_t(1));
+  EXPECT_EQ(commands->GetCommandCount(), 2);
+  EXPECT_EQ(m_model.GetRootItem()->GetTotalItemCount(), 1);
+
+  commands->Undo();
+  ASSERT_EQ(m_model.GetRootItem()->GetTotalItemCount(), 3);
+  EXPECT_EQ(m_model.GetRootItem()->GetItem(TagIndex::Default(1))->Data(), variant_t(1));
+  EXPECT_EQ(m_model.GetRootItem()->GetItem(TagIndex::Default(2))->Data(), variant_t(2));
+}
+
 //! Add GraphItem and Data1DItem, add data to graph, undo, then redo. GraphItem should be pointing
 //! again to Data1DItem. This is real bug case.
 TEST_F(ApplicationModelUndoTests, InsertDataAndGraph)
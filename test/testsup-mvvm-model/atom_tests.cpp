@@ -0,0 +1,100 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/core/atom.h"
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <vector>
+
+using namespace mvvm;
+
+/**
+ * @brief Tests for Atom class.
+ */
+class AtomTests : public ::testing::Test
+{
+};
+
+TEST_F(AtomTests, InitialState)
+{
+  const Atom atom;
+  EXPECT_TRUE(atom.IsEmpty());
+  EXPECT_EQ(atom.GetId(), 0);
+  EXPECT_EQ(atom.GetName(), std::string());
+  EXPECT_EQ(atom, Atom(std::string()));
+}
+
+TEST_F(AtomTests, Intern)
+{
+  const Atom atom1("AtomTests.Intern.abc");
+  const Atom atom2("AtomTests.Intern.def");
+  const Atom atom3("AtomTests.Intern.abc");
+
+  EXPECT_FALSE(atom1.IsEmpty());
+  EXPECT_EQ(atom1.GetName(), std::string("AtomTests.Intern.abc"));
+  EXPECT_EQ(atom2.GetName(), std::string("AtomTests.Intern.def"));
+
+  EXPECT_EQ(atom1, atom3);
+  EXPECT_EQ(atom1.GetId(), atom3.GetId());
+  EXPECT_EQ(&atom1.GetName(), &atom3.GetName());
+  EXPECT_NE(atom1, atom2);
+}
+
+TEST_F(AtomTests, Find)
+{
+  EXPECT_FALSE(Atom::Find("AtomTests.Find.abc").has_value());
+
+  const Atom atom("AtomTests.Find.abc");
+  auto found = Atom::Find("AtomTests.Find.abc");
+  ASSERT_TRUE(found.has_value());
+  EXPECT_EQ(found.value(), atom);
+
+  EXPECT_EQ(Atom::Find(""), Atom());
+}
+
+TEST_F(AtomTests, InternFromSeveralThreads)
+{
+  const int thread_count{4};
+  const int name_count{100};
+
+  auto intern = [name_count]()
+  {
+    std::vector<Atom> result;
+    for (int index = 0; index < name_count; ++index)
+    {
+      result.emplace_back("AtomTests.Threads." + std::to_string(index));
+    }
+    return result;
+  };
+
+  std::vector<std::future<std::vector<Atom>>> futures;
+  for (int index = 0; index < thread_count; ++index)
+  {
+    futures.push_back(std::async(std::launch::async, intern));
+  }
+
+  const auto expected = intern();
+  for (auto& future : futures)
+  {
+    EXPECT_EQ(future.get(), expected);
+  }
+}
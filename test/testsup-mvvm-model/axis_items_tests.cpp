@@ -20,6 +20,7 @@
 
 #include "mvvm/standarditems/axis_items.h"
 
+#include <mvvm/model/item_utils.h>
 #include <mvvm/standarditems/plottable_items.h>
 
 #include <gtest/gtest.h>
@@ -108,6 +109,27 @@ TEST_F(AxisItemsTests, FixedBinAxisRange)
   EXPECT_EQ(upper, 4.0);
 }
 
+//! Bin centers are rebuilt after the change of axis parameters.
+
+TEST_F(AxisItemsTests, FixedBinAxisBinCentersCache)
+{
+  auto axis = FixedBinAxisItem::Create(2, 0.0, 2.0);
+  EXPECT_EQ(axis->GetBinCenters(), std::vector<double>({0.5, 1.5}));
+
+  auto range = axis->GetBinCentersRange();
+  EXPECT_EQ(range.min, 0.5);
+  EXPECT_EQ(range.max, 1.5);
+  EXPECT_EQ(range.count, 2);
+
+  axis->SetMax(4.0);
+  EXPECT_EQ(axis->GetBinCenters(), std::vector<double>({1.0, 3.0}));
+  EXPECT_EQ(axis->GetBinCentersRange().max, 3.0);
+
+  axis->SetParameters(4, 0.0, 4.0);
+  EXPECT_EQ(axis->GetBinCenters(), std::vector<double>({0.5, 1.5, 2.5, 3.5}));
+  EXPECT_EQ(axis->GetBinCentersRange().count, 4);
+}
+
 TEST_F(AxisItemsTests, PointwiseAxisInitialState)
 {
   PointwiseAxisItem axis;
@@ -132,3 +154,39 @@ TEST_F(AxisItemsTests, PointwiseAxisFactoryMethod)
   EXPECT_EQ(axis->GetBinCenters(), expected_centers);
   EXPECT_EQ(axis->GetSize(), 3);
 }
+
+//! Points stored in a plain vector, as in projects saved before points were shared.
+
+TEST_F(AxisItemsTests, PointwiseAxisLegacyPoints)
+{
+  PointwiseAxisItem axis;
+  utils::ReplaceData(axis, std::vector<double>{1.0, 2.0, 3.0}, DataRole::kData);
+  EXPECT_EQ(axis.GetBinCenters(), std::vector<double>({1.0, 2.0, 3.0}));
+  EXPECT_EQ(axis.GetSize(), 3);
+  EXPECT_EQ(axis.GetRange(), std::make_pair(1.0, 3.0));
+
+  axis.SetParameters({4.0, 5.0});
+  EXPECT_EQ(axis.GetBinCenters(), std::vector<double>({4.0, 5.0}));
+  EXPECT_TRUE(std::holds_alternative<SharedArray<double>>(axis.Data<variant_t>()));
+}
+
+//! Size and ranges of pointwise axis follow the change of points.
+
+TEST_F(AxisItemsTests, PointwiseAxisRange)
+{
+  auto axis = PointwiseAxisItem::Create({1.0, 4.0, 2.0});
+  EXPECT_EQ(axis->GetRange(), std::make_pair(1.0, 2.0));
+  auto range = axis->GetBinCentersRange();
+  EXPECT_EQ(range.min, 1.0);
+  EXPECT_EQ(range.max, 4.0);
+  EXPECT_EQ(range.count, 3);
+
+  axis->SetParameters({-1.0, 0.0});
+  EXPECT_EQ(axis->GetSize(), 2);
+  EXPECT_EQ(axis->GetRange(), std::make_pair(-1.0, 0.0));
+  EXPECT_EQ(axis->GetBinCentersRange().min, -1.0);
+
+  // clone gets its own copy of the data
+  auto clone = axis->Clone();
+  EXPECT_EQ(dynamic_cast<PointwiseAxisItem*>(clone.get())->GetSize(), 2);
+}
@@ -20,7 +20,10 @@
 
 #include "mvvm/standarditems/data1d_item.h"
 
+#include <mvvm/commands/i_command_stack.h>
 #include <mvvm/core/mvvm_exceptions.h>
+#include <mvvm/model/application_model.h>
+#include <mvvm/model/item_utils.h>
 #include <mvvm/model/session_model.h>
 #include <mvvm/standarditems/axis_items.h>
 
@@ -158,6 +161,132 @@ TEST_F(Data1DItemTests, SetErrors)
   EXPECT_EQ(item.GetErrors(), expected_errors);
 }
 
+//! Ranges of bin centers, values and errors.
+
+TEST_F(Data1DItemTests, Ranges)
+{
+  Data1DItem item;
+  EXPECT_TRUE(item.GetBinCentersRange().IsEmpty());
+  EXPECT_TRUE(item.GetValuesRange().IsEmpty());
+  EXPECT_TRUE(item.GetErrorsRange().IsEmpty());
+
+  item.SetAxis<FixedBinAxisItem>(3, 0.0, 3.0);
+  EXPECT_EQ(item.GetBinCentersRange().min, 0.5);
+  EXPECT_EQ(item.GetBinCentersRange().max, 2.5);
+
+  item.SetValues({1.0, -2.0, 3.0});
+  EXPECT_EQ(item.GetValuesRange().min, -2.0);
+  EXPECT_EQ(item.GetValuesRange().max, 3.0);
+  EXPECT_EQ(item.GetValuesRange().count, 3);
+
+  item.SetErrors({0.1, 0.3, 0.2});
+  EXPECT_EQ(item.GetErrorsRange().min, 0.1);
+  EXPECT_EQ(item.GetErrorsRange().max, 0.3);
+
+  // cached range follows the change of values
+  item.SetValues({10.0, 20.0, 30.0});
+  EXPECT_EQ(item.GetValuesRange().min, 10.0);
+  EXPECT_EQ(item.GetValuesRange().max, 30.0);
+}
+
+//! Cached range follows the change of values in the model, including undo.
+
+TEST_F(Data1DItemTests, RangesInModel)
+{
+  ApplicationModel model;
+  model.SetUndoEnabled(true);
+  auto item = model.InsertItem<Data1DItem>();
+  item->SetAxis<FixedBinAxisItem>(2, 0.0, 2.0);
+  item->SetValues({1.0, 2.0});
+  EXPECT_EQ(item->GetValuesRange().max, 2.0);
+
+  item->SetValues({1.0, 5.0});
+  EXPECT_EQ(item->GetValuesRange().max, 5.0);
+
+  model.GetCommandStack()->Undo();
+  EXPECT_EQ(item->GetValuesRange().max, 2.0);
+}
+
+//! Values stored in narrow numeric types.
+
+TEST_F(Data1DItemTests, SetRawValues)
+{
+  Data1DItem item;
+  EXPECT_THROW(item.SetRawValues(std::vector<int32>({1, 2})), RuntimeException);
+
+  item.SetAxis<FixedBinAxisItem>(2, 0.0, 2.0);
+  EXPECT_THROW(item.SetRawValues(std::vector<int32>({1, 2, 3})), RuntimeException);
+  EXPECT_THROW(item.SetRawValues(42.0), RuntimeException);
+
+  // values keep their type, and are converted to double on request
+  item.SetRawValues(std::vector<uint16>({1, 65535}));
+  EXPECT_EQ(item.GetRawValues(), variant_t(std::vector<uint16>({1, 65535})));
+  EXPECT_EQ(item.GetValues(), std::vector<double>({1.0, 65535.0}));
+  EXPECT_EQ(item.GetValuesRange().max, 65535.0);
+
+  item.SetRawValues(std::vector<float32>({-1.5f, 2.0f}));
+  EXPECT_EQ(item.GetValues(), std::vector<double>({-1.5, 2.0}));
+  EXPECT_EQ(item.GetValuesRange().min, -1.5);
+
+  // switching back to doubles, they are stored in a shared array
+  item.SetValues({3.0, 4.0});
+  EXPECT_EQ(item.GetRawValues(), variant_t(SharedArray<double>({3.0, 4.0})));
+  EXPECT_EQ(item.GetValuesRange().max, 4.0);
+}
+
+//! Double values are kept in the shared array, values stored in a plain vector by older projects
+//! can be read and replaced.
+
+TEST_F(Data1DItemTests, SharedValues)
+{
+  Data1DItem item;
+  item.SetAxis<FixedBinAxisItem>(2, 0.0, 2.0);
+  item.SetValues({1.0, 2.0});
+  item.SetErrors({0.1, 0.2});
+
+  auto values = std::get<SharedArray<double>>(item.GetRawValues());
+  EXPECT_TRUE(values.IsSharedWith(std::get<SharedArray<double>>(item.GetRawValues())));
+  EXPECT_EQ(item.GetErrors(), std::vector<double>({0.1, 0.2}));
+
+  utils::ReplaceData(*item.GetItem(Data1DItem::kValues), std::vector<double>{3.0, 4.0},
+                     DataRole::kData);
+  utils::ReplaceData(*item.GetItem(Data1DItem::kErrors), std::vector<double>{0.3, 0.4},
+                     DataRole::kData);
+  EXPECT_EQ(item.GetValues(), std::vector<double>({3.0, 4.0}));
+  EXPECT_EQ(item.GetErrors(), std::vector<double>({0.3, 0.4}));
+
+  item.SetValues({5.0, 6.0});
+  item.SetErrors({0.5, 0.6});
+  EXPECT_EQ(item.GetValues(), std::vector<double>({5.0, 6.0}));
+  EXPECT_EQ(item.GetErrors(), std::vector<double>({0.5, 0.6}));
+}
+
+//! Values of narrow numeric type in the model, including undo.
+
+TEST_F(Data1DItemTests, SetRawValuesInModel)
+{
+  ApplicationModel model;
+  model.SetUndoEnabled(true);
+  auto item = model.InsertItem<Data1DItem>();
+  item->SetAxis<FixedBinAxisItem>(2, 0.0, 2.0);
+  item->SetValues({1.0, 2.0});
+
+  const auto command_count = model.GetCommandStack()->GetCommandCount();
+  item->SetRawValues(std::vector<int64>({10, 20}));
+  EXPECT_EQ(item->GetValues(), std::vector<double>({10.0, 20.0}));
+  EXPECT_EQ(item->GetValuesRange().max, 20.0);
+
+  // the change of type is done with a single command
+  EXPECT_EQ(model.GetCommandStack()->GetCommandCount(), command_count + 1);
+  model.GetCommandStack()->Undo();
+  EXPECT_EQ(item->GetValues(), std::vector<double>({1.0, 2.0}));
+  EXPECT_EQ(item->GetValuesRange().max, 2.0);
+  EXPECT_TRUE(std::holds_alternative<SharedArray<double>>(item->GetRawValues()));
+
+  model.GetCommandStack()->Redo();
+  EXPECT_EQ(item->GetRawValues(), variant_t(std::vector<int64>({10, 20})));
+}
+
 //! Checking the signals when axes changed.
 //! FIXME enable tests checkSignalsOnAxisChange
 
@@ -0,0 +1,212 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/standarditems/data2d_item.h"
+
+#include <mvvm/commands/i_command_stack.h>
+#include <mvvm/core/mvvm_exceptions.h>
+#include <mvvm/model/application_model.h>
+#include <mvvm/signals/model_listener.h>
+#include <mvvm/standarditems/axis_items.h>
+
+#include <gtest/gtest.h>
+
+using namespace mvvm;
+
+//! Testing Data2DItem.
+
+class Data2DItemTests : public ::testing::Test
+{
+public:
+  //! Sets axes with 3 bins along x and 2 bins along y.
+  static void SetAxes(Data2DItem& item)
+  {
+    item.SetAxes(FixedBinAxisItem::Create(3, 0.0, 3.0), FixedBinAxisItem::Create(2, 0.0, 2.0));
+  }
+};
+
+//! Initial state.
+
+TEST_F(Data2DItemTests, InitialState)
+{
+  const Data2DItem item;
+
+  EXPECT_EQ(item.GetXAxis(), nullptr);
+  EXPECT_EQ(item.GetYAxis(), nullptr);
+  EXPECT_EQ(item.GetXSize(), 0);
+  EXPECT_EQ(item.GetYSize(), 0);
+  EXPECT_TRUE(item.GetValues().empty());
+  EXPECT_TRUE(item.GetValuesRange().IsEmpty());
+}
+
+TEST_F(Data2DItemTests, SetAxes)
+{
+  Data2DItem item;
+  SetAxes(item);
+
+  ASSERT_NE(item.GetXAxis(), nullptr);
+  ASSERT_NE(item.GetYAxis(), nullptr);
+  EXPECT_EQ(item.GetXSize(), 3);
+  EXPECT_EQ(item.GetYSize(), 2);
+  EXPECT_EQ(item.GetXAxis()->GetBinCenters(), std::vector<double>({0.5, 1.5, 2.5}));
+  EXPECT_EQ(item.GetValues(), std::vector<double>(6, 0.0));
+
+  // for the moment we have disabled possibility to re-create axes to faciltate undo/redo
+  EXPECT_THROW(SetAxes(item), RuntimeException);
+}
+
+TEST_F(Data2DItemTests, SetValues)
+{
+  Data2DItem item;
+  EXPECT_THROW(item.SetValues(std::vector<double>({1.0})), RuntimeException);
+
+  SetAxes(item);
+  EXPECT_THROW(item.SetValues(std::vector<double>({1.0})), RuntimeException);
+
+  item.SetValues(std::vector<double>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}));
+  EXPECT_EQ(item.GetValues(), std::vector<double>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}));
+  EXPECT_EQ(item.GetValuesRange().min, 1.0);
+  EXPECT_EQ(item.GetValuesRange().max, 6.0);
+
+  // array is shared with the item
+  const SharedArray<double> array({6.0, 5.0, 4.0, 3.0, 2.0, 1.0});
+  item.SetValues(array);
+  EXPECT_TRUE(item.GetValuesArray().IsSharedWith(array));
+  EXPECT_EQ(item.GetValuesRange().min, 1.0);
+}
+
+TEST_F(Data2DItemTests, SetValuesInRegion)
+{
+  Data2DItem item;
+  SetAxes(item);
+  const auto array = item.GetValuesArray();
+
+  EXPECT_THROW(item.SetValuesInRegion(DataRegion{2, 0, 4, 1}, {1.0, 2.0}), RuntimeException);
+  EXPECT_THROW(item.SetValuesInRegion(DataRegion{1, 0, 3, 2}, {1.0, 2.0}), RuntimeException);
+
+  item.SetValuesInRegion(DataRegion{1, 0, 3, 2}, {1.0, 2.0, 3.0, 4.0});
+  EXPECT_EQ(item.GetValues(), std::vector<double>({0.0, 1.0, 2.0, 0.0, 3.0, 4.0}));
+  EXPECT_EQ(item.GetValuesRange().max, 4.0);
+
+  // previous array wasn't touched
+  EXPECT_EQ(array.ToVector(), std::vector<double>(6, 0.0));
+}
+
+//! Values of the region are modified in place, when the buffer isn't shared.
+
+TEST_F(Data2DItemTests, SetValuesInRegionInPlace)
+{
+  Data2DItem item;
+  SetAxes(item);
+  const auto* buffer = item.GetValuesArray().data();
+
+  item.SetValuesInRegion(DataRegion{0, 0, 1, 1}, {42.0});
+  EXPECT_EQ(item.GetValuesArray().data(), buffer);
+  EXPECT_EQ(item.GetValues(), std::vector<double>({42.0, 0.0, 0.0, 0.0, 0.0, 0.0}));
+}
+
+//! The cached range of values is updated with the region, unless the minimum or the maximum is
+//! overwritten.
+
+TEST_F(Data2DItemTests, ValuesRangeAfterRegionUpdate)
+{
+  Data2DItem item;
+  SetAxes(item);
+  item.SetValues(std::vector<double>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}));
+  EXPECT_EQ(item.GetValuesRange(), (DataRange{1.0, 6.0, 6}));
+
+  item.SetValuesInRegion(DataRegion{1, 0, 2, 1}, {10.0});
+  EXPECT_EQ(item.GetValuesRange(), (DataRange{1.0, 10.0, 6}));
+
+  // the maximum is overwritten
+  item.SetValuesInRegion(DataRegion{1, 0, 2, 1}, {2.0});
+  EXPECT_EQ(item.GetValuesRange(), (DataRange{1.0, 6.0, 6}));
+
+  // the minimum is overwritten
+  item.SetValuesInRegion(DataRegion{0, 0, 1, 1}, {3.0});
+  EXPECT_EQ(item.GetValuesRange(), (DataRange{2.0, 6.0, 6}));
+}
+
+//! The region update is reported by a single DataRegionChangedEvent and is recorded in the undo
+//! stack as a single command.
+
+TEST_F(Data2DItemTests, SetValuesInRegionInModel)
+{
+  ApplicationModel model;
+  model.SetUndoEnabled(true);
+  auto item = model.InsertItem<Data2DItem>();
+  SetAxes(*item);
+  const auto command_count = model.GetCommandStack()->GetCommandCount();
+
+  std::vector<DataRegion> reported_regions;
+  int data_changed_count{0};
+  ModelListener listener(&model);
+  listener.Connect<DataRegionChangedEvent>(
+      [&reported_regions, item](const DataRegionChangedEvent& event)
+      {
+        EXPECT_EQ(event.item, item);
+        reported_regions.push_back(event.region);
+      });
+  listener.Connect<DataChangedEvent>([&data_changed_count](const DataChangedEvent&)
+                                     { ++data_changed_count; });
+
+  item->SetValuesInRegion(DataRegion{0, 1, 1, 2}, {42.0});
+  EXPECT_EQ(item->GetValues(), std::vector<double>({0.0, 0.0, 0.0, 42.0, 0.0, 0.0}));
+  EXPECT_EQ(reported_regions, std::vector<DataRegion>({DataRegion{0, 1, 1, 2}}));
+  EXPECT_EQ(data_changed_count, 0);
+  EXPECT_EQ(model.GetCommandStack()->GetCommandCount(), command_count + 1);
+
+  // undo and redo are reported for the same region
+  model.GetCommandStack()->Undo();
+  EXPECT_EQ(item->GetValues(), std::vector<double>(6, 0.0));
+  model.GetCommandStack()->Redo();
+  EXPECT_EQ(item->GetValues(), std::vector<double>({0.0, 0.0, 0.0, 42.0, 0.0, 0.0}));
+  EXPECT_EQ(reported_regions, std::vector<DataRegion>(3, DataRegion{0, 1, 1, 2}));
+  EXPECT_EQ(data_changed_count, 0);
+}
+
+//! Region updates and updates of all values are undone in reverse order.
+
+TEST_F(Data2DItemTests, UndoSetValuesAndRegion)
+{
+  ApplicationModel model;
+  model.SetUndoEnabled(true);
+  auto item = model.InsertItem<Data2DItem>();
+  SetAxes(*item);
+
+  item->SetValues(std::vector<double>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}));
+  item->SetValuesInRegion(DataRegion{1, 0, 3, 1}, {20.0, 30.0});
+  item->SetValues(std::vector<double>({10.0, 20.0, 30.0, 40.0, 50.0, 60.0}));
+
+  model.GetCommandStack()->Undo();
+  EXPECT_EQ(item->GetValues(), std::vector<double>({1.0, 20.0, 30.0, 4.0, 5.0, 6.0}));
+  EXPECT_EQ(item->GetValuesRange(), DataRange({1.0, 30.0, 6}));
+
+  model.GetCommandStack()->Undo();
+  EXPECT_EQ(item->GetValues(), std::vector<double>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}));
+  EXPECT_EQ(item->GetValuesRange(), DataRange({1.0, 6.0, 6}));
+
+  model.GetCommandStack()->Redo();
+  model.GetCommandStack()->Redo();
+  EXPECT_EQ(item->GetValues(), std::vector<double>({10.0, 20.0, 30.0, 40.0, 50.0, 60.0}));
+
+  model.GetCommandStack()->Undo();
+  EXPECT_EQ(item->GetValues(), std::vector<double>({1.0, 20.0, 30.0, 4.0, 5.0, 6.0}));
+}
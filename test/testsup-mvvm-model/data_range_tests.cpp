@@ -0,0 +1,122 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/utils/data_range.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace mvvm;
+
+/**
+ * @brief Tests for DataRange struct and utils::FindDataRange function.
+ */
+class DataRangeTests : public ::testing::Test
+{
+};
+
+TEST_F(DataRangeTests, InitialState)
+{
+  const DataRange range;
+  EXPECT_TRUE(range.IsEmpty());
+  EXPECT_EQ(range.count, 0);
+  EXPECT_EQ(range, DataRange());
+}
+
+TEST_F(DataRangeTests, AddAndMerge)
+{
+  DataRange range1;
+  range1.Add(2.0);
+  EXPECT_FALSE(range1.IsEmpty());
+  EXPECT_EQ(range1.min, 2.0);
+  EXPECT_EQ(range1.max, 2.0);
+  EXPECT_EQ(range1.count, 1);
+
+  range1.Add(-1.0);
+  range1.Add(1.0);
+  EXPECT_EQ(range1.min, -1.0);
+  EXPECT_EQ(range1.max, 2.0);
+  EXPECT_EQ(range1.count, 3);
+
+  DataRange range2;
+  range2.Add(5.0);
+  range1.Merge(range2);
+  EXPECT_EQ(range1.min, -1.0);
+  EXPECT_EQ(range1.max, 5.0);
+  EXPECT_EQ(range1.count, 4);
+
+  // merging with empty range doesn't change min and max
+  range1.Merge(DataRange());
+  EXPECT_EQ(range1.min, -1.0);
+  EXPECT_EQ(range1.max, 5.0);
+  EXPECT_EQ(range1.count, 4);
+}
+
+TEST_F(DataRangeTests, FindDataRange)
+{
+  EXPECT_TRUE(utils::FindDataRange(std::vector<double>{}).IsEmpty());
+
+  // sizes around the vector width of SIMD kernel
+  for (std::size_t size = 1; size < 20; ++size)
+  {
+    std::vector<double> data(size);
+    for (std::size_t index = 0; index < size; ++index)
+    {
+      data[index] = std::sin(static_cast<double>(index)) * 10.0;
+    }
+    auto [expected_min, expected_max] = std::minmax_element(data.begin(), data.end());
+
+    auto range = utils::FindDataRange(data);
+    EXPECT_EQ(range.min, *expected_min);
+    EXPECT_EQ(range.max, *expected_max);
+    EXPECT_EQ(range.count, size);
+  }
+}
+
+TEST_F(DataRangeTests, LargeArray)
+{
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1e6, 1e6);
+  std::vector<double> data(100003);
+  std::generate(data.begin(), data.end(), [&]() { return distribution(generator); });
+  auto [expected_min, expected_max] = std::minmax_element(data.begin(), data.end());
+
+  auto range = utils::FindDataRange(data.data(), data.size());
+  EXPECT_EQ(range.min, *expected_min);
+  EXPECT_EQ(range.max, *expected_max);
+  EXPECT_EQ(range.count, data.size());
+}
+
+TEST_F(DataRangeTests, NaNValues)
+{
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+
+  auto range = utils::FindDataRange(std::vector<double>{nan, 1.0, nan, -2.0, 3.0, nan, nan});
+  EXPECT_EQ(range.min, -2.0);
+  EXPECT_EQ(range.max, 3.0);
+  EXPECT_EQ(range.count, 7);
+
+  range = utils::FindDataRange(std::vector<double>{nan, nan, nan, nan, nan});
+  EXPECT_TRUE(range.IsEmpty());
+  EXPECT_EQ(range.count, 5);
+}
@@ -69,6 +69,24 @@ public:
       OnModelAboutToBeDestroyedEvent(event);
     }
     MOCK_METHOD(void, OnModelAboutToBeDestroyedEvent, (const ModelAboutToBeDestroyedEvent& event));
+
+    void operator()(const AboutToInsertItemsEvent& event) { OnAboutToInsertItemsEvent(event); }
+    MOCK_METHOD(void, OnAboutToInsertItemsEvent, (const AboutToInsertItemsEvent& event));
+
+    void operator()(const ItemsInsertedEvent& event) { OnItemsInsertedEvent(event); }
+    MOCK_METHOD(void, OnItemsInsertedEvent, (const ItemsInsertedEvent& event));
+
+    void operator()(const AboutToRemoveItemsEvent& event) { OnAboutToRemoveItemsEvent(event); }
+    MOCK_METHOD(void, OnAboutToRemoveItemsEvent, (const AboutToRemoveItemsEvent& event));
+
+    void operator()(const ItemsRemovedEvent& event) { OnItemsRemovedEvent(event); }
+    MOCK_METHOD(void, OnItemsRemovedEvent, (const ItemsRemovedEvent& event));
+
+    void operator()(const DataAppendedEvent& event) { OnDataAppendedEvent(event); }
+    MOCK_METHOD(void, OnDataAppendedEvent, (const DataAppendedEvent& event));
+
+    void operator()(const DataRegionChangedEvent& event) { OnDataRegionChangedEvent(event); }
+    MOCK_METHOD(void, OnDataRegionChangedEvent, (const DataRegionChangedEvent& event));
   };
 };
 
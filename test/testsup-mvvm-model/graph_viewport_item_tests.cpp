@@ -153,3 +153,46 @@ TEST_F(GraphViewportItemTests, SetViewportToContentWithMargins)
   EXPECT_DOUBLE_EQ(yaxis->GetMin(), expected_ymin);
   EXPECT_DOUBLE_EQ(yaxis->GetMax(), expected_ymax);
 }
+
+//! Viewport content range is combined from the ranges of visible graphs.
+
+TEST_F(GraphViewportItemTests, SetViewportToContentWithSeveralGraphs)
+{
+  ApplicationModel model;
+  auto viewport_item = model.InsertItem<GraphViewportItem>();
+
+  auto get_range = [viewport_item](auto axis)
+  { return std::make_pair(axis->GetMin(), axis->GetMax()); };
+
+  // no graphs
+  viewport_item->SetViewportToContent();
+  EXPECT_EQ(get_range(viewport_item->GetXAxis()), std::make_pair(0.0, 1.0));
+  EXPECT_EQ(get_range(viewport_item->GetYAxis()), std::make_pair(0.0, 1.0));
+
+  auto data_item1 = model.InsertItem<Data1DItem>();
+  data_item1->SetAxis<FixedBinAxisItem>(2, 0.0, 2.0);
+  data_item1->SetValues({1.0, 2.0});
+  auto graph_item1 = model.InsertItem<GraphItem>(viewport_item);
+  graph_item1->SetDataItem(data_item1);
+
+  auto data_item2 = model.InsertItem<Data1DItem>();
+  data_item2->SetAxis<PointwiseAxisItem>(std::vector<double>{-5.0, 1.0, 3.0});
+  data_item2->SetValues({-1.0, 0.0, 10.0});
+  auto graph_item2 = model.InsertItem<GraphItem>(viewport_item);
+  graph_item2->SetDataItem(data_item2);
+
+  viewport_item->SetViewportToContent();
+  EXPECT_EQ(get_range(viewport_item->GetXAxis()), std::make_pair(-5.0, 3.0));
+  EXPECT_EQ(get_range(viewport_item->GetYAxis()), std::make_pair(-1.0, 10.0));
+
+  // changing the data
+  data_item1->SetValues({1.0, 20.0});
+  viewport_item->SetViewportToContent();
+  EXPECT_EQ(get_range(viewport_item->GetYAxis()), std::make_pair(-1.0, 20.0));
+
+  // hidden graph doesn't contribute
+  viewport_item->SetVisible({graph_item1});
+  viewport_item->SetViewportToContent();
+  EXPECT_EQ(get_range(viewport_item->GetXAxis()), std::make_pair(0.5, 1.5));
+  EXPECT_EQ(get_range(viewport_item->GetYAxis()), std::make_pair(1.0, 20.0));
+}
@@ -0,0 +1,152 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/model/item_arena.h"
+
+#include <mvvm/core/mvvm_exceptions.h>
+#include <mvvm/model/application_model.h>
+#include <mvvm/model/compound_item.h>
+#include <mvvm/model/item_utils.h>
+#include <mvvm/model/property_item.h>
+#include <mvvm/model/session_model.h>
+#include <mvvm/standarditems/container_item.h>
+
+#include <gtest/gtest.h>
+
+using namespace mvvm;
+
+/**
+ * @brief Tests for ItemArena class and its usage by SessionModel.
+ */
+class ItemArenaTest : public ::testing::Test
+{
+};
+
+TEST_F(ItemArenaTest, InitialState)
+{
+  const ItemArena arena;
+  EXPECT_EQ(arena.GetAllocationCount(), 0);
+  EXPECT_EQ(arena.GetAllocatedBytes(), 0);
+  EXPECT_EQ(GetItemMemoryResource(), std::pmr::get_default_resource());
+}
+
+TEST_F(ItemArenaTest, MemoryScope)
+{
+  ItemArena arena1;
+  ItemArena arena2;
+
+  {
+    const ItemMemoryScope scope1(&arena1);
+    EXPECT_EQ(GetItemMemoryResource(), &arena1);
+    {
+      const ItemMemoryScope scope2(&arena2);
+      EXPECT_EQ(GetItemMemoryResource(), &arena2);
+    }
+    EXPECT_EQ(GetItemMemoryResource(), &arena1);
+  }
+
+  EXPECT_EQ(GetItemMemoryResource(), std::pmr::get_default_resource());
+}
+
+TEST_F(ItemArenaTest, ItemInArena)
+{
+  ItemArena arena;
+
+  std::unique_ptr<CompoundItem> item;
+  {
+    const ItemMemoryScope scope(&arena);
+    item = std::make_unique<CompoundItem>();
+    item->AddProperty("height", 42);
+  }
+  EXPECT_GT(arena.GetAllocationCount(), 0);
+  EXPECT_GT(arena.GetAllocatedBytes(), 0);
+
+  // item created outside of the scope doesn't use arena
+  const auto count = arena.GetAllocationCount();
+  auto item2 = std::make_unique<CompoundItem>();
+  item2->AddProperty("width", 42);
+  EXPECT_EQ(arena.GetAllocationCount(), count);
+
+  EXPECT_FALSE(arena.Release());
+
+  // clone of arena item created outside of the scope is not in the arena
+  auto clone = item->Clone();
+  EXPECT_EQ(arena.GetAllocationCount(), count);
+  EXPECT_EQ(clone->GetItem({"height", 0})->Data<int>(), 42);
+
+  item.reset();
+  EXPECT_EQ(arena.GetAllocationCount(), 0);
+  EXPECT_EQ(arena.GetAllocatedBytes(), 0);
+  EXPECT_TRUE(arena.Release());
+}
+
+TEST_F(ItemArenaTest, ModelWithArena)
+{
+  SessionModel model;
+  EXPECT_EQ(model.GetItemArena(), nullptr);
+
+  model.SetItemArena(std::make_unique<ItemArena>());
+  auto arena = model.GetItemArena();
+  ASSERT_NE(arena, nullptr);
+
+  {
+    const ItemMemoryScope scope(arena);
+    auto parent = model.InsertItem<ContainerItem>();
+    for (int i = 0; i < 10; ++i)
+    {
+      model.InsertItem<PropertyItem>(parent, TagIndex::Append())->SetData(i);
+    }
+  }
+
+  EXPECT_GT(arena->GetAllocationCount(), 0);
+
+  int count{0};
+  utils::iterate(model.GetRootItem(), [&count](const SessionItem*) { ++count; });
+  EXPECT_EQ(count, 12);
+
+  // it is not possible to replace an arena while items are still alive
+  EXPECT_THROW(model.SetItemArena(std::make_unique<ItemArena>()), LogicErrorException);
+
+  model.Clear();
+  EXPECT_EQ(arena->GetAllocationCount(), 0);
+  EXPECT_EQ(model.GetRootItem()->GetTotalItemCount(), 0);
+}
+
+TEST_F(ItemArenaTest, TakenItemKeepsArenaAlive)
+{
+  ApplicationModel model;
+  model.SetItemArena(std::make_unique<ItemArena>());
+  auto arena = model.GetItemArena();
+
+  {
+    const ItemMemoryScope scope(arena);
+    model.InsertItem<PropertyItem>()->SetData(42);
+  }
+
+  auto taken = model.TakeItem(model.GetRootItem(), TagIndex::First());
+
+  // the arena can't be released since the item is still alive
+  model.Clear();
+  EXPECT_GT(arena->GetAllocationCount(), 0);
+  EXPECT_EQ(taken->Data<int>(), 42);
+
+  taken.reset();
+  EXPECT_EQ(arena->GetAllocationCount(), 0);
+}
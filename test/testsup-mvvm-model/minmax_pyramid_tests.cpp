@@ -0,0 +1,232 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/utils/minmax_pyramid.h"
+
+#include <mvvm/core/mvvm_exceptions.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+using namespace mvvm;
+
+/**
+ * @brief Tests for MinMaxPyramid class.
+ */
+class MinMaxPyramidTests : public ::testing::Test
+{
+public:
+  //! Returns sorted x-coordinates and random y-values.
+  static std::pair<std::vector<double>, std::vector<double>> CreateData(std::size_t size)
+  {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    std::vector<double> x(size);
+    std::vector<double> y(size);
+    for (std::size_t index = 0; index < size; ++index)
+    {
+      x[index] = static_cast<double>(index);
+      y[index] = distribution(generator);
+    }
+    return {x, y};
+  }
+
+  //! Checks that decimated data contains the minimum and the maximum of every pixel of the
+  //! visible range, computed by the brute force.
+  static void ValidateEnvelope(const std::vector<double>& x, const std::vector<double>& y,
+                               double xmin, double xmax, std::size_t pixel_count,
+                               const DecimatedData& data)
+  {
+    ASSERT_EQ(data.x.size(), data.y.size());
+    ASSERT_EQ(data.x.size(), data.indices.size());
+    EXPECT_TRUE(std::is_sorted(data.indices.begin(), data.indices.end()));
+    EXPECT_LE(data.x.size(), 2 * pixel_count + 4);
+
+    const double pixel_width = (xmax - xmin) / static_cast<double>(pixel_count);
+    for (std::size_t pixel = 0; pixel < pixel_count; ++pixel)
+    {
+      const double begin = xmin + pixel_width * static_cast<double>(pixel);
+      const double end = pixel + 1 == pixel_count ? xmax : begin + pixel_width;
+
+      double expected_min{std::numeric_limits<double>::max()};
+      double expected_max{std::numeric_limits<double>::lowest()};
+      double found_min{std::numeric_limits<double>::max()};
+      double found_max{std::numeric_limits<double>::lowest()};
+      for (std::size_t index = 0; index < x.size(); ++index)
+      {
+        const bool inside = x[index] >= begin && (x[index] < end || pixel + 1 == pixel_count);
+        if (inside && x[index] <= xmax)
+        {
+          expected_min = std::min(expected_min, y[index]);
+          expected_max = std::max(expected_max, y[index]);
+        }
+      }
+      for (std::size_t index = 0; index < data.x.size(); ++index)
+      {
+        const bool inside =
+            data.x[index] >= begin && (data.x[index] < end || pixel + 1 == pixel_count);
+        if (inside && data.x[index] <= xmax)
+        {
+          found_min = std::min(found_min, data.y[index]);
+          found_max = std::max(found_max, data.y[index]);
+        }
+      }
+      EXPECT_EQ(found_min, expected_min);
+      EXPECT_EQ(found_max, expected_max);
+    }
+  }
+};
+
+TEST_F(MinMaxPyramidTests, InitialState)
+{
+  const MinMaxPyramid pyramid;
+  EXPECT_EQ(pyramid.GetSize(), 0);
+  EXPECT_EQ(pyramid.GetLevelCount(), 0);
+  EXPECT_TRUE(pyramid.IsSorted());
+  EXPECT_TRUE(pyramid.GetPoints(0.0, 1.0, 100).x.empty());
+  EXPECT_TRUE(pyramid.GetPoints(100).x.empty());
+}
+
+TEST_F(MinMaxPyramidTests, SetData)
+{
+  MinMaxPyramid pyramid;
+  EXPECT_THROW(pyramid.SetData({1.0, 2.0}, {1.0}), RuntimeException);
+
+  auto [x, y] = CreateData(1024);
+  pyramid.SetData(x, y);
+  EXPECT_EQ(pyramid.GetSize(), 1024);
+
+  // levels with buckets of 4, 8, ..., 1024 points
+  EXPECT_EQ(pyramid.GetLevelCount(), 9);
+}
+
+TEST_F(MinMaxPyramidTests, SmallDataIsNotDecimated)
+{
+  const MinMaxPyramid pyramid({1.0, 2.0, 3.0}, {10.0, 20.0, 30.0});
+
+  auto data = pyramid.GetPoints(100);
+  EXPECT_EQ(data.x, std::vector<double>({1.0, 2.0, 3.0}));
+  EXPECT_EQ(data.y, std::vector<double>({10.0, 20.0, 30.0}));
+  EXPECT_EQ(data.indices, std::vector<std::size_t>({0, 1, 2}));
+
+  // the neighbours of the visible range are included
+  data = pyramid.GetPoints(1.5, 1.9, 100);
+  EXPECT_EQ(data.x, std::vector<double>({1.0, 2.0}));
+  data = pyramid.GetPoints(2.0, 2.1, 100);
+  EXPECT_EQ(data.x, std::vector<double>({1.0, 2.0, 3.0}));
+
+  // wrong range
+  EXPECT_TRUE(pyramid.GetPoints(2.0, 1.0, 100).x.empty());
+}
+
+TEST_F(MinMaxPyramidTests, UnsortedDataIsNotDecimated)
+{
+  const MinMaxPyramid pyramid({3.0, 1.0, 2.0}, {30.0, 10.0, 20.0});
+  EXPECT_FALSE(pyramid.IsSorted());
+
+  auto data = pyramid.GetPoints(1.5, 1.9, 1);
+  EXPECT_EQ(data.x, std::vector<double>({3.0, 1.0, 2.0}));
+}
+
+TEST_F(MinMaxPyramidTests, PeakIsPreserved)
+{
+  const std::size_t size{100000};
+  std::vector<double> x(size);
+  std::vector<double> y(size, 0.0);
+  for (std::size_t index = 0; index < size; ++index)
+  {
+    x[index] = static_cast<double>(index);
+  }
+  y[12345] = 42.0;
+  y[54321] = -42.0;
+
+  const MinMaxPyramid pyramid(x, y);
+  auto data = pyramid.GetPoints(10);
+  EXPECT_LE(data.x.size(), 24);
+  EXPECT_NE(std::find(data.indices.begin(), data.indices.end(), 12345), data.indices.end());
+  EXPECT_NE(std::find(data.indices.begin(), data.indices.end(), 54321), data.indices.end());
+}
+
+TEST_F(MinMaxPyramidTests, FullRangeEnvelope)
+{
+  auto [x, y] = CreateData(10007);
+  const MinMaxPyramid pyramid(x, y);
+
+  const std::size_t pixel_count{97};
+  auto data = pyramid.GetPoints(pixel_count);
+  ValidateEnvelope(x, y, x.front(), x.back(), pixel_count, data);
+  EXPECT_EQ(data.indices.front(), 0);
+  EXPECT_EQ(data.indices.back(), x.size() - 1);
+}
+
+TEST_F(MinMaxPyramidTests, VisibleRangeEnvelope)
+{
+  auto [x, y] = CreateData(10007);
+  const MinMaxPyramid pyramid(x, y);
+
+  const std::vector<std::pair<double, double>> ranges = {
+      {100.5, 9000.0}, {0.0, 2999.0}, {-100.0, 5000.0}, {5000.0, 20000.0}};
+  for (auto [xmin, xmax] : ranges)
+  {
+    auto data = pyramid.GetPoints(xmin, xmax, 50);
+    ValidateEnvelope(x, y, xmin, xmax, 50, data);
+  }
+
+  // neighbours of the visible range
+  auto data = pyramid.GetPoints(100.5, 9000.0, 50);
+  ASSERT_GT(data.x.size(), 4);
+  EXPECT_EQ(data.x[0], 100.0);
+  EXPECT_EQ(data.x[1], 101.0);
+  EXPECT_EQ(data.x[data.x.size() - 2], 9000.0);
+  EXPECT_EQ(data.x.back(), 9001.0);
+}
+
+
+TEST_F(MinMaxPyramidTests, SetPoint)
+{
+  auto [x, y] = CreateData(10007);
+  MinMaxPyramid pyramid(x, y);
+  EXPECT_THROW(pyramid.SetPoint(x.size(), 0.0, 0.0), RuntimeException);
+
+  // new peaks, including the one in trailing points not covered by buckets
+  for (auto [index, value] : std::vector<std::pair<std::size_t, double>>{
+           {1234, 42.0}, {1235, -42.0}, {0, 10.0}, {10006, -10.0}, {1234, 0.5}})
+  {
+    y[index] = value;
+    pyramid.SetPoint(index, x[index], value);
+    ValidateEnvelope(x, y, x.front(), x.back(), 97, pyramid.GetPoints(97));
+    ValidateEnvelope(x, y, 1000.5, 2000.0, 50, pyramid.GetPoints(1000.5, 2000.0, 50));
+  }
+  EXPECT_EQ(pyramid.GetPoints(97).indices, MinMaxPyramid(x, y).GetPoints(97).indices);
+
+  // x-coordinate breaking the order, and restoring it
+  pyramid.SetPoint(100, 200.0, y[100]);
+  EXPECT_FALSE(pyramid.IsSorted());
+  pyramid.SetPoint(100, 100.0, y[100]);
+  EXPECT_TRUE(pyramid.IsSorted());
+  pyramid.SetPoint(0, 5.0, y[0]);
+  EXPECT_FALSE(pyramid.IsSorted());
+  pyramid.SetPoint(0, -1.0, y[0]);
+  EXPECT_TRUE(pyramid.IsSorted());
+  pyramid.SetPoint(10006, 0.0, y[10006]);
+  EXPECT_FALSE(pyramid.IsSorted());
+}
@@ -22,6 +22,8 @@
 
 #include <mvvm/model/application_model.h>
 #include <mvvm/model/property_item.h>
+#include <mvvm/standarditems/axis_items.h>
+#include <mvvm/standarditems/data2d_item.h>
 
 #include <gtest/gtest.h>
 
@@ -85,6 +87,21 @@ TEST_F(ModelHasChangedControllerTests, dataChanged)
   EXPECT_TRUE(controller.IsChanged());
 }
 
+//! Tests if controller sees the update of a region of 2D data.
+
+TEST_F(ModelHasChangedControllerTests, dataRegionChanged)
+{
+  ApplicationModel model;
+  auto item = model.InsertItem<Data2DItem>();
+  item->SetAxes(FixedBinAxisItem::Create(2, 0.0, 2.0), FixedBinAxisItem::Create(1, 0.0, 1.0));
+
+  ModelHasChangedController controller(&model);
+  EXPECT_FALSE(controller.IsChanged());
+
+  item->SetValuesInRegion(DataRegion{0, 0, 1, 1}, {42.0});
+  EXPECT_TRUE(controller.IsChanged());
+}
+
 //! Tests if controller sees model reset.
 
 TEST_F(ModelHasChangedControllerTests, modelReset)
@@ -0,0 +1,90 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/utils/numeric_array_utils.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+using namespace mvvm;
+
+/**
+ * @brief Tests for utility functions from numeric_array_utils.h.
+ */
+class NumericArrayUtilsTests : public ::testing::Test
+{
+};
+
+TEST_F(NumericArrayUtilsTests, IsNumericArray)
+{
+  EXPECT_FALSE(utils::IsNumericArray(variant_t()));
+  EXPECT_FALSE(utils::IsNumericArray(variant_t(42.0)));
+  EXPECT_FALSE(utils::IsNumericArray(variant_t(std::string("abc"))));
+
+  EXPECT_TRUE(utils::IsNumericArray(variant_t(std::vector<double>())));
+  EXPECT_TRUE(utils::IsNumericArray(variant_t(std::vector<float32>())));
+  EXPECT_TRUE(utils::IsNumericArray(variant_t(std::vector<int32>())));
+  EXPECT_TRUE(utils::IsNumericArray(variant_t(std::vector<int64>())));
+  EXPECT_TRUE(utils::IsNumericArray(variant_t(std::vector<uint16>())));
+  EXPECT_TRUE(utils::IsNumericArray(variant_t(SharedArray<double>())));
+}
+
+TEST_F(NumericArrayUtilsTests, GetNumericArraySize)
+{
+  EXPECT_EQ(utils::GetNumericArraySize(variant_t(std::vector<double>({1.0, 2.0}))), 2);
+  EXPECT_EQ(utils::GetNumericArraySize(variant_t(std::vector<uint16>({1, 2, 3}))), 3);
+  EXPECT_EQ(utils::GetNumericArraySize(variant_t(SharedArray<double>({1.0}))), 1);
+  EXPECT_THROW(utils::GetNumericArraySize(variant_t(42)), RuntimeException);
+}
+
+TEST_F(NumericArrayUtilsTests, ToDoubleVector)
+{
+  const std::vector<double> expected{-1.0, 0.0, 42.0};
+
+  EXPECT_EQ(utils::ToDoubleVector(variant_t(expected)), expected);
+  EXPECT_EQ(utils::ToDoubleVector(variant_t(std::vector<float32>({-1.0f, 0.0f, 42.0f}))),
+            expected);
+  EXPECT_EQ(utils::ToDoubleVector(variant_t(std::vector<int32>({-1, 0, 42}))), expected);
+  EXPECT_EQ(utils::ToDoubleVector(variant_t(std::vector<int64>({-1, 0, 42}))), expected);
+  EXPECT_EQ(utils::ToDoubleVector(variant_t(std::vector<uint16>({1, 2}))),
+            std::vector<double>({1.0, 2.0}));
+  EXPECT_EQ(utils::ToDoubleVector(variant_t(SharedArray<double>(expected))), expected);
+  EXPECT_THROW(utils::ToDoubleVector(variant_t(42.0)), RuntimeException);
+}
+
+TEST_F(NumericArrayUtilsTests, FindNumericArrayRange)
+{
+  EXPECT_TRUE(utils::FindNumericArrayRange(variant_t(std::vector<int32>())).IsEmpty());
+
+  auto range = utils::FindNumericArrayRange(variant_t(std::vector<uint16>({5, 1, 65535})));
+  EXPECT_EQ(range.min, 1.0);
+  EXPECT_EQ(range.max, 65535.0);
+  EXPECT_EQ(range.count, 3);
+
+  range = utils::FindNumericArrayRange(variant_t(std::vector<float32>({1.0f, NAN, -2.0f})));
+  EXPECT_EQ(range.min, -2.0);
+  EXPECT_EQ(range.max, 1.0);
+  EXPECT_EQ(range.count, 3);
+
+  range = utils::FindNumericArrayRange(variant_t(std::vector<double>({3.0, 2.0})));
+  EXPECT_EQ(range.min, 2.0);
+  EXPECT_EQ(range.max, 3.0);
+}
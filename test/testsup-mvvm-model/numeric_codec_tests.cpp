@@ -0,0 +1,256 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/utils/numeric_codec.h"
+
+#include <mvvm/core/basic_scalar_types.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+
+using namespace mvvm;
+
+/**
+ * @brief Tests for utility functions from numeric_codec.h.
+ */
+class NumericCodecTests : public ::testing::Test
+{
+public:
+  //! Returns true if two doubles have the same bit pattern.
+  template <typename T>
+  static bool AreBitwiseEqual(T value1, T value2)
+  {
+    return std::memcmp(&value1, &value2, sizeof(T)) == 0;
+  }
+
+  //! Checks that the value is converted to string and back without any change.
+  template <typename T>
+  static bool IsRoundTripExact(T value)
+  {
+    auto parsed = utils::ParseNumber<T>(utils::FloatToString(value));
+    return parsed.has_value() && AreBitwiseEqual(parsed.value(), value);
+  }
+};
+
+TEST_F(NumericCodecTests, FloatToString)
+{
+  using utils::FloatToString;
+
+  EXPECT_EQ(FloatToString(0.0), "0.0");
+  EXPECT_EQ(FloatToString(-0.0), "-0.0");
+  EXPECT_EQ(FloatToString(42.0), "42.0");
+  EXPECT_EQ(FloatToString(-42.5), "-42.5");
+  EXPECT_EQ(FloatToString(0.1), "0.1");
+  EXPECT_EQ(FloatToString(1e-20), "1e-20");
+  EXPECT_EQ(FloatToString(1.0 / 3.0), "0.3333333333333333");
+  EXPECT_EQ(FloatToString(std::numeric_limits<double>::infinity()), "inf");
+  EXPECT_EQ(FloatToString(-std::numeric_limits<double>::infinity()), "-inf");
+  EXPECT_EQ(FloatToString(std::numeric_limits<double>::quiet_NaN()), "nan");
+
+  EXPECT_EQ(FloatToString(48.0F), "48.0");
+  EXPECT_EQ(FloatToString(0.1F), "0.1");
+}
+
+TEST_F(NumericCodecTests, IntegerToString)
+{
+  using utils::IntegerToString;
+
+  EXPECT_EQ(IntegerToString(char8{'a'}), "97");
+  EXPECT_EQ(IntegerToString(int8{-8}), "-8");
+  EXPECT_EQ(IntegerToString(uint8{255}), "255");
+  EXPECT_EQ(IntegerToString(std::numeric_limits<int64>::min()), "-9223372036854775808");
+  EXPECT_EQ(IntegerToString(std::numeric_limits<uint64>::max()), "18446744073709551615");
+}
+
+TEST_F(NumericCodecTests, ParseNumber)
+{
+  using utils::ParseNumber;
+
+  EXPECT_EQ(ParseNumber<double>("42"), 42.0);
+  EXPECT_EQ(ParseNumber<double>("+42.5"), 42.5);
+  EXPECT_EQ(ParseNumber<double>("-1e-3"), -1e-3);
+  EXPECT_TRUE(std::isinf(ParseNumber<double>("inf").value()));
+  EXPECT_TRUE(std::isnan(ParseNumber<double>("nan").value()));
+  EXPECT_FALSE(ParseNumber<double>("").has_value());
+  EXPECT_FALSE(ParseNumber<double>("+").has_value());
+  EXPECT_FALSE(ParseNumber<double>("+-1").has_value());
+  EXPECT_FALSE(ParseNumber<double>(" 42").has_value());
+  EXPECT_FALSE(ParseNumber<double>("42a").has_value());
+  EXPECT_FALSE(ParseNumber<double>("1e400").has_value());
+
+  EXPECT_EQ(ParseNumber<int32>("-42"), -42);
+  EXPECT_EQ(ParseNumber<uint8>("255"), uint8{255});
+  EXPECT_FALSE(ParseNumber<uint8>("256").has_value());
+  EXPECT_FALSE(ParseNumber<uint32>("-1").has_value());
+  EXPECT_FALSE(ParseNumber<int32>("4.2").has_value());
+}
+
+//! Every double should be parsed back to exactly the same value.
+TEST_F(NumericCodecTests, DoubleRoundTrip)
+{
+  const std::vector<double> special_values = {0.0,
+                                              -0.0,
+                                              0.1,
+                                              1.0 / 3.0,
+                                              std::numeric_limits<double>::min(),
+                                              std::numeric_limits<double>::max(),
+                                              std::numeric_limits<double>::lowest(),
+                                              std::numeric_limits<double>::denorm_min(),
+                                              std::numeric_limits<double>::epsilon(),
+                                              std::numeric_limits<double>::infinity(),
+                                              -std::numeric_limits<double>::infinity()};
+  for (auto value : special_values)
+  {
+    EXPECT_TRUE(IsRoundTripExact(value)) << utils::FloatToString(value);
+  }
+
+  // random bit patterns cover all exponents
+  std::mt19937_64 generator(42);
+  for (int index = 0; index < 100000; ++index)
+  {
+    const auto bits = generator();
+    double value{0.0};
+    std::memcpy(&value, &bits, sizeof(value));
+    if (std::isnan(value))
+    {
+      continue;
+    }
+    ASSERT_TRUE(IsRoundTripExact(value)) << utils::FloatToString(value);
+  }
+}
+
+//! Every float should be parsed back to exactly the same value.
+TEST_F(NumericCodecTests, FloatRoundTrip)
+{
+  std::mt19937 generator(42);
+  for (int index = 0; index < 100000; ++index)
+  {
+    const auto bits = static_cast<std::uint32_t>(generator());
+    float value{0.0F};
+    std::memcpy(&value, &bits, sizeof(value));
+    if (std::isnan(value))
+    {
+      continue;
+    }
+    ASSERT_TRUE(IsRoundTripExact(value)) << utils::FloatToString(value);
+  }
+}
+
+TEST_F(NumericCodecTests, ToSeparatedString)
+{
+  using utils::ToSeparatedString;
+
+  EXPECT_EQ(ToSeparatedString({}, ", "), std::string());
+  EXPECT_EQ(ToSeparatedString({1.0}, ", "), std::string("1.0"));
+  EXPECT_EQ(ToSeparatedString({1.0, 0.1, 1e-20}, ", "), std::string("1.0, 0.1, 1e-20"));
+  EXPECT_EQ(ToSeparatedString({1.0, 2.0}, " "), std::string("1.0 2.0"));
+}
+
+TEST_F(NumericCodecTests, ParseSeparatedDoubles)
+{
+  using utils::ParseSeparatedDoubles;
+
+  std::vector<double> result;
+  EXPECT_TRUE(ParseSeparatedDoubles("", ',', result));
+  EXPECT_TRUE(ParseSeparatedDoubles(" \t\n", ',', result));
+  EXPECT_TRUE(result.empty());
+
+  EXPECT_TRUE(ParseSeparatedDoubles(" 1.0,2.0 , +3e2 ", ',', result));
+  EXPECT_EQ(result, std::vector<double>({1.0, 2.0, 300.0}));
+
+  result.clear();
+  EXPECT_FALSE(ParseSeparatedDoubles(", 1.0", ',', result));
+  EXPECT_FALSE(ParseSeparatedDoubles("1.0, 2.0, ", ',', result));
+  EXPECT_FALSE(ParseSeparatedDoubles("1.0a, 2.0", ',', result));
+  EXPECT_FALSE(ParseSeparatedDoubles("1.0 2.0", ',', result));
+}
+
+TEST_F(NumericCodecTests, ParseWhitespaceSeparatedDoubles)
+{
+  using utils::ParseWhitespaceSeparatedDoubles;
+
+  std::vector<double> result;
+  EXPECT_EQ(ParseWhitespaceSeparatedDoubles("", result), 0);
+  EXPECT_EQ(ParseWhitespaceSeparatedDoubles("a 1", result), 0);
+  EXPECT_EQ(ParseWhitespaceSeparatedDoubles(" 1\t2\n3 ", result), 3);
+  EXPECT_EQ(ParseWhitespaceSeparatedDoubles("4 5,6", result), 2);
+  EXPECT_EQ(result, std::vector<double>({1.0, 2.0, 3.0, 4.0, 5.0}));
+}
+
+TEST_F(NumericCodecTests, NarrowTypes)
+{
+  using utils::ParseSeparatedNumbers;
+  using utils::ToSeparatedString;
+
+  const std::vector<float> floats{1.0f, 0.1f, -2.5f};
+  EXPECT_EQ(ToSeparatedString(floats.data(), floats.size(), ", "), std::string("1.0, 0.1, -2.5"));
+  std::vector<float> parsed_floats;
+  EXPECT_TRUE(ParseSeparatedNumbers("1.0, 0.1, -2.5", ',', parsed_floats));
+  EXPECT_EQ(parsed_floats, floats);
+
+  const std::vector<std::int32_t> ints{-1, 0, 42};
+  EXPECT_EQ(ToSeparatedString(ints.data(), ints.size(), ", "), std::string("-1, 0, 42"));
+  std::vector<std::int32_t> parsed_ints;
+  EXPECT_TRUE(ParseSeparatedNumbers(" -1,0 , +42", ',', parsed_ints));
+  EXPECT_EQ(parsed_ints, ints);
+  EXPECT_FALSE(ParseSeparatedNumbers("1.0", ',', parsed_ints));
+  EXPECT_FALSE(ParseSeparatedNumbers("2147483648", ',', parsed_ints));
+
+  const std::vector<std::int64_t> longs{-9223372036854775807, 9223372036854775807};
+  EXPECT_EQ(ToSeparatedString(longs.data(), longs.size(), " "),
+            std::string("-9223372036854775807 9223372036854775807"));
+  std::vector<std::int64_t> parsed_longs;
+  EXPECT_TRUE(ParseSeparatedNumbers("-9223372036854775807,9223372036854775807", ',', parsed_longs));
+  EXPECT_EQ(parsed_longs, longs);
+
+  const std::vector<std::uint16_t> shorts{0, 65535};
+  EXPECT_EQ(ToSeparatedString(shorts.data(), shorts.size(), ", "), std::string("0, 65535"));
+  std::vector<std::uint16_t> parsed_shorts;
+  EXPECT_TRUE(ParseSeparatedNumbers("0, 65535", ',', parsed_shorts));
+  EXPECT_EQ(parsed_shorts, shorts);
+  EXPECT_FALSE(ParseSeparatedNumbers("-1", ',', parsed_shorts));
+  EXPECT_FALSE(ParseSeparatedNumbers("65536", ',', parsed_shorts));
+}
+
+//! Vector of doubles should be converted to string and back without any change.
+TEST_F(NumericCodecTests, VectorRoundTrip)
+{
+  std::mt19937_64 generator(42);
+  std::uniform_real_distribution<double> distribution(-1e6, 1e6);
+
+  std::vector<double> values(10000);
+  for (auto& value : values)
+  {
+    value = distribution(generator);
+  }
+
+  std::vector<double> parsed;
+  ASSERT_TRUE(utils::ParseSeparatedDoubles(utils::ToSeparatedString(values, ", "), ',', parsed));
+  EXPECT_EQ(parsed, values);
+
+  parsed.clear();
+  EXPECT_EQ(utils::ParseWhitespaceSeparatedDoubles(utils::ToSeparatedString(values, " "), parsed),
+            values.size());
+  EXPECT_EQ(parsed, values);
+}
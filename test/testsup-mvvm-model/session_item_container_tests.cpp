@@ -388,3 +388,63 @@ TEST_F(SessionItemContainerTest, CanMoveWithinContainer)
   EXPECT_TRUE(container.CanMoveItem(child1_ptr, 2));
   EXPECT_FALSE(container.CanMoveItem(child1_ptr, 3));
 }
+
+TEST_F(SessionItemContainerTest, InsertItems)
+{
+  SessionItemContainer container(TagInfo("tag", 0, 3, {}));
+
+  auto [child0, child0_ptr] = CreateItem();
+  container.InsertItem(std::move(child0), 0);
+
+  auto [child1, child1_ptr] = CreateItem();
+  auto [child2, child2_ptr] = CreateItem();
+  std::vector<std::unique_ptr<SessionItem>> items;
+  items.push_back(std::move(child1));
+  items.push_back(std::move(child2));
+
+  // wrong index
+  EXPECT_FALSE(container.CanInsertItems(items, 2));
+
+  // inserting in front
+  EXPECT_TRUE(container.CanInsertItems(items, 0));
+  const std::vector<SessionItem*> expected_inserted = {child1_ptr, child2_ptr};
+  EXPECT_EQ(container.InsertItems(std::move(items), 0), expected_inserted);
+
+  const std::vector<SessionItem*> expected = {child1_ptr, child2_ptr, child0_ptr};
+  EXPECT_EQ(container.GetItems(), expected);
+
+  // maximum number of items is exceeded
+  std::vector<std::unique_ptr<SessionItem>> more_items;
+  more_items.push_back(std::make_unique<SessionItem>());
+  EXPECT_FALSE(container.CanInsertItems(more_items, 0));
+  EXPECT_TRUE(container.InsertItems(std::move(more_items), 0).empty());
+  EXPECT_EQ(container.GetItemCount(), 3);
+}
+
+TEST_F(SessionItemContainerTest, TakeItems)
+{
+  SessionItemContainer container(TagInfo("tag", 1, {}, {}));
+
+  auto [child0, child0_ptr] = CreateItem();
+  auto [child1, child1_ptr] = CreateItem();
+  auto [child2, child2_ptr] = CreateItem();
+  container.InsertItem(std::move(child0), 0);
+  container.InsertItem(std::move(child1), 1);
+  container.InsertItem(std::move(child2), 2);
+
+  // wrong range
+  EXPECT_FALSE(container.CanTakeItems(2, 2));
+  EXPECT_TRUE(container.TakeItems(2, 2).empty());
+
+  // container can't have less than one item
+  EXPECT_FALSE(container.CanTakeItems(0, 3));
+
+  EXPECT_TRUE(container.CanTakeItems(0, 2));
+  auto taken = container.TakeItems(0, 2);
+  ASSERT_EQ(taken.size(), 2);
+  EXPECT_EQ(taken[0].get(), child0_ptr);
+  EXPECT_EQ(taken[1].get(), child1_ptr);
+
+  const std::vector<SessionItem*> expected = {child2_ptr};
+  EXPECT_EQ(container.GetItems(), expected);
+}
@@ -149,6 +149,42 @@ TEST_F(SessionItemDataTest, HasRole)
   EXPECT_FALSE(data.HasData(role));
 }
 
+//! Reference to the data points to the stored variant.
+
+TEST_F(SessionItemDataTest, DataReference)
+{
+  SessionItemData data;
+  EXPECT_FALSE(utils::IsValid(data.DataReference(1)));
+
+  const int role = 99;
+  data.SetData(variant_t(std::vector<double>({1.0, 2.0})), role);
+  const auto& value = data.DataReference(role);
+  EXPECT_EQ(value, variant_t(std::vector<double>({1.0, 2.0})));
+  EXPECT_EQ(&value, &data.DataReference(role));
+
+  // array of numbers can't change its element type
+  EXPECT_THROW(data.SetData(variant_t(std::vector<float32>({3.0f})), role), RuntimeException);
+  EXPECT_THROW(data.SetData(variant_t(42.0), role), RuntimeException);
+}
+
+TEST_F(SessionItemDataTest, GetMutableData)
+{
+  SessionItemData data;
+  EXPECT_EQ(data.GetMutableData(1), nullptr);
+
+  const int role = 99;
+  data.SetData(variant_t(42), role);
+  const auto revision = data.GetRevision();
+
+  auto value = data.GetMutableData(role);
+  ASSERT_NE(value, nullptr);
+  EXPECT_EQ(value, &data.DataReference(role));
+  EXPECT_NE(data.GetRevision(), revision);
+
+  *value = variant_t(43);
+  EXPECT_EQ(data.Data(role), variant_t(43));
+}
+
 TEST_F(SessionItemDataTest, CopyConstructor)
 {
   {  // from default constructed
@@ -200,3 +236,56 @@ TEST_F(SessionItemDataTest, AssignmentOperator)
     EXPECT_TRUE(copy.Data(role) == variant);
   }
 }
+
+//! Revision of the container is updated on each data change.
+
+TEST_F(SessionItemDataTest, Revision)
+{
+  SessionItemData data;
+  const auto initial_revision = data.GetRevision();
+  EXPECT_NE(initial_revision, 0);
+
+  EXPECT_TRUE(data.SetData(variant_t(42.0), 1));
+  const auto revision1 = data.GetRevision();
+  EXPECT_NE(revision1, initial_revision);
+
+  // same value doesn't change revision
+  EXPECT_FALSE(data.SetData(variant_t(42.0), 1));
+  EXPECT_EQ(data.GetRevision(), revision1);
+
+  // new value
+  EXPECT_TRUE(data.SetData(variant_t(43.0), 1));
+  const auto revision2 = data.GetRevision();
+  EXPECT_NE(revision2, revision1);
+
+  // removal of the value
+  EXPECT_TRUE(data.SetData(variant_t(), 1));
+  EXPECT_NE(data.GetRevision(), revision2);
+
+  // copies get their own revision
+  const SessionItemData copy(data);
+  EXPECT_NE(copy.GetRevision(), data.GetRevision());
+
+  SessionItemData assigned;
+  assigned = data;
+  EXPECT_NE(assigned.GetRevision(), data.GetRevision());
+  EXPECT_NE(assigned.GetRevision(), copy.GetRevision());
+}
+
+//! Move construction and move assignment keep the values and the revision.
+
+TEST_F(SessionItemDataTest, MoveOperations)
+{
+  SessionItemData data;
+  EXPECT_TRUE(data.SetData(variant_t(42.0), 1));
+  const auto revision = data.GetRevision();
+
+  SessionItemData moved(std::move(data));
+  EXPECT_EQ(moved.Data(1), variant_t(42.0));
+  EXPECT_EQ(moved.GetRevision(), revision);
+
+  SessionItemData assigned;
+  assigned = std::move(moved);
+  EXPECT_EQ(assigned.Data(1), variant_t(42.0));
+  EXPECT_EQ(assigned.GetRevision(), revision);
+}
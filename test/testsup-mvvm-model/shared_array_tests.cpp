@@ -0,0 +1,117 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/core/shared_array.h"
+
+#include <mvvm/model/session_item.h>
+#include <mvvm/model/session_item_data.h>
+
+#include <gtest/gtest.h>
+
+using namespace mvvm;
+
+/**
+ * @brief Tests for SharedArray class.
+ */
+class SharedArrayTests : public ::testing::Test
+{
+};
+
+TEST_F(SharedArrayTests, InitialState)
+{
+  const SharedArray<double> array;
+  EXPECT_TRUE(array.empty());
+  EXPECT_EQ(array.size(), 0);
+  EXPECT_EQ(array.data(), nullptr);
+  EXPECT_EQ(array.begin(), array.end());
+  EXPECT_TRUE(array.ToVector().empty());
+  EXPECT_FALSE(array.IsSharedWith(SharedArray<double>()));
+  EXPECT_EQ(array, SharedArray<double>());
+}
+
+TEST_F(SharedArrayTests, Construction)
+{
+  const std::vector<double> values{1.0, 2.0, 3.0};
+  const SharedArray<double> array(values);
+  EXPECT_FALSE(array.empty());
+  EXPECT_EQ(array.size(), 3);
+  EXPECT_EQ(array[1], 2.0);
+  EXPECT_EQ(array.ToVector(), values);
+  EXPECT_EQ(std::vector<double>(array.begin(), array.end()), values);
+
+  EXPECT_EQ(array, SharedArray<double>({1.0, 2.0, 3.0}));
+  EXPECT_NE(array, SharedArray<double>({1.0, 2.0}));
+}
+
+TEST_F(SharedArrayTests, Copy)
+{
+  const SharedArray<double> array({1.0, 2.0});
+
+  const auto copy = array;
+  EXPECT_TRUE(copy.IsSharedWith(array));
+  EXPECT_EQ(copy.data(), array.data());
+  EXPECT_EQ(copy, array);
+
+  // equal content in different storage
+  const SharedArray<double> other({1.0, 2.0});
+  EXPECT_FALSE(other.IsSharedWith(array));
+  EXPECT_EQ(other, array);
+}
+
+TEST_F(SharedArrayTests, CopyOnWrite)
+{
+  const SharedArray<double> array({1.0, 2.0});
+
+  auto copy = array;
+  copy.GetMutableVector().push_back(3.0);
+  EXPECT_FALSE(copy.IsSharedWith(array));
+  EXPECT_EQ(copy.ToVector(), std::vector<double>({1.0, 2.0, 3.0}));
+  EXPECT_EQ(array.ToVector(), std::vector<double>({1.0, 2.0}));
+
+  // the storage isn't copied when not shared
+  const auto* data = copy.data();
+  copy.GetMutableVector()[0] = 42.0;
+  EXPECT_EQ(copy.data(), data);
+  EXPECT_EQ(copy[0], 42.0);
+
+  // empty array gets its storage
+  SharedArray<double> empty;
+  empty.GetMutableVector().push_back(1.0);
+  EXPECT_EQ(empty.size(), 1);
+}
+
+//! Reading the array from the item doesn't copy the data.
+
+TEST_F(SharedArrayTests, SessionItemData)
+{
+  SessionItem item;
+  const SharedArray<double> array(std::vector<double>(1000, 42.0));
+  EXPECT_TRUE(item.SetData(array));
+
+  const auto data = item.Data<SharedArray<double>>();
+  EXPECT_TRUE(data.IsSharedWith(array));
+
+  // setting the same array is ignored
+  EXPECT_FALSE(item.SetData(array));
+
+  // snapshot of the item data shares the array too
+  const SessionItemData snapshot(*item.GetItemData());
+  EXPECT_TRUE(std::get<SharedArray<double>>(snapshot.Data(DataRole::kData)).IsSharedWith(array));
+}
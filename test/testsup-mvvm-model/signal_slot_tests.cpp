@@ -25,6 +25,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <vector>
+
 using ::testing::_;
 
 class SignalSlotTests : public ::testing::Test
@@ -258,3 +260,177 @@ TEST_F(SignalSlotTests, SubscribeLambdaRecursive)
   EXPECT_TRUE(x >= 11);  // was called more than once
   EXPECT_EQ(y, 22);      // was called
 }
+
+//! Disconnecting connection using the connection itself.
+
+TEST_F(SignalSlotTests, DisconnectUsingConnection)
+{
+  MockWidget widget;
+  mvvm::Signal<void(mvvm::SessionItem*)> signal;
+
+  auto connection = signal.connect(&widget, &MockWidget::onItemDestroy);
+
+  mvvm::SessionItem item;
+  EXPECT_CALL(widget, onItemDestroy(&item)).Times(1);
+  signal(&item);
+
+  connection.disconnect();
+  EXPECT_FALSE(connection.is_locked());
+
+  EXPECT_CALL(widget, onItemDestroy(_)).Times(0);
+  signal(&item);
+}
+
+//! Lambda disconnects itself and another lambda during the emission. The emission should continue
+//! safely, disconnected callbacks should not be called.
+
+TEST_F(SignalSlotTests, DisconnectDuringEmission)
+{
+  mvvm::Signal<void(int num)> signal;
+
+  std::vector<int> calls;
+  mvvm::Connection connection0;
+  mvvm::Connection connection2;
+
+  connection0 = signal.connect(
+      [&](int)
+      {
+        calls.push_back(0);
+        signal.disconnect(connection0);
+        signal.disconnect(connection2);
+      });
+  signal.connect([&](int) { calls.push_back(1); });
+  connection2 = signal.connect([&](int) { calls.push_back(2); });
+
+  signal(1);
+  EXPECT_EQ(calls, std::vector<int>({0, 1}));
+
+  calls.clear();
+  signal(1);
+  EXPECT_EQ(calls, std::vector<int>({1}));
+}
+
+//! Slot is destroyed during the emission.
+
+TEST_F(SignalSlotTests, SlotDestroyedDuringEmission)
+{
+  mvvm::Signal<void(int num)> signal;
+
+  std::vector<int> calls;
+  auto slot = std::make_unique<mvvm::Slot>();
+
+  signal.connect(
+      [&](int)
+      {
+        calls.push_back(0);
+        slot.reset();
+      });
+  signal.connect([&](int) { calls.push_back(1); }, slot.get());
+  signal.connect([&](int) { calls.push_back(2); });
+
+  signal(1);
+  EXPECT_EQ(calls, std::vector<int>({0, 2}));
+
+  calls.clear();
+  signal(1);
+  EXPECT_EQ(calls, std::vector<int>({0, 2}));
+}
+
+//! Slot connected to two signals. Disconnection from one signal shouldn't affect another.
+
+TEST_F(SignalSlotTests, SlotConnectedToTwoSignals)
+{
+  MockWidget widget;
+  mvvm::Signal<void(mvvm::SessionItem*)> signal1;
+  mvvm::Signal<void(mvvm::SessionItem*, int)> signal2;
+
+  auto slot = std::make_unique<mvvm::Slot>();
+  signal1.connect(&widget, &MockWidget::onItemDestroy, slot.get());
+  signal2.connect(&widget, &MockWidget::onDataChange, slot.get());
+
+  signal1.disconnect(slot.get());
+
+  mvvm::SessionItem item;
+  EXPECT_CALL(widget, onItemDestroy(_)).Times(0);
+  EXPECT_CALL(widget, onDataChange(&item, 42)).Times(1);
+  signal1(&item);
+  signal2(&item, 42);
+
+  slot.reset();
+
+  EXPECT_CALL(widget, onDataChange(_, _)).Times(0);
+  signal2(&item, 42);
+}
+
+//! Many connections are disconnected one by one, remaining callbacks keep their order.
+
+TEST_F(SignalSlotTests, DisconnectManyConnections)
+{
+  mvvm::Signal<void()> signal;
+
+  std::vector<int> calls;
+  std::vector<mvvm::Connection> connections;
+  const int count{10};
+  for (int index = 0; index < count; ++index)
+  {
+    connections.push_back(signal.connect([&calls, index]() { calls.push_back(index); }));
+  }
+
+  for (int index = 0; index < count; index += 2)
+  {
+    signal.disconnect(connections[index]);
+  }
+  connections[3].set_lock(true);
+
+  signal();
+  EXPECT_EQ(calls, std::vector<int>({1, 5, 7, 9}));
+}
+
+//! Signal is destroyed by its own callback during the emission.
+
+TEST_F(SignalSlotTests, SignalDestroyedDuringEmission)
+{
+  auto signal = std::make_unique<mvvm::Signal<void(int num)>>();
+
+  std::vector<int> calls;
+  signal->connect(
+      [&](int)
+      {
+        calls.push_back(0);
+        signal.reset();
+        calls.push_back(1);  // the callback itself is still alive
+      });
+  signal->connect([&](int) { calls.push_back(2); });
+
+  (*signal)(1);
+  EXPECT_EQ(signal, nullptr);
+  EXPECT_EQ(calls, std::vector<int>({0, 1}));
+}
+
+//! Moved-from signal remains valid and has no connections.
+
+TEST_F(SignalSlotTests, MovedFromSignal)
+{
+  mvvm::Signal<void(int num)> signal;
+
+  std::vector<int> calls;
+  signal.connect([&](int) { calls.push_back(0); });
+
+  auto moved = std::move(signal);
+  signal(1);
+  EXPECT_TRUE(calls.empty());
+
+  moved(1);
+  EXPECT_EQ(calls, std::vector<int>({0}));
+
+  calls.clear();
+  signal.connect([&](int) { calls.push_back(1); });
+  signal(1);
+  EXPECT_EQ(calls, std::vector<int>({1}));
+
+  signal = std::move(moved);
+  calls.clear();
+  signal(1);
+  moved(1);
+  EXPECT_EQ(calls, std::vector<int>({0}));
+}
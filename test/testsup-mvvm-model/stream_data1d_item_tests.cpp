@@ -0,0 +1,236 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/standarditems/stream_data1d_item.h"
+
+#include <mvvm/core/mvvm_exceptions.h>
+#include <mvvm/model/application_model.h>
+#include <mvvm/model/item_factory.h>
+#include <mvvm/standarditems/axis_items.h>
+#include <mvvm/standarditems/graph_item.h>
+#include <mvvm/test/mock_model_listener.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <limits>
+
+using namespace mvvm;
+using ::testing::_;
+
+/**
+ * @brief Tests for StreamData1DItem class.
+ */
+class StreamData1DItemTest : public ::testing::Test
+{
+public:
+  using mock_listener_t = ::testing::StrictMock<mvvm::test::MockModelListener>;
+};
+
+TEST_F(StreamData1DItemTest, InitialState)
+{
+  const StreamData1DItem item;
+  EXPECT_EQ(item.GetType(), StreamData1DItem::GetStaticType());
+  EXPECT_EQ(item.GetCapacity(), 0);
+  EXPECT_EQ(item.GetPointCount(), 0);
+  EXPECT_TRUE(item.GetBinCenters().empty());
+  EXPECT_TRUE(item.GetValues().empty());
+  EXPECT_TRUE(item.GetErrors().empty());
+  EXPECT_THROW(item.GetPoint(0), RuntimeException);
+
+  EXPECT_TRUE(GetGlobalItemFactory().IsRegistered(StreamData1DItem::GetStaticType()));
+}
+
+TEST_F(StreamData1DItemTest, AppendPoints)
+{
+  StreamData1DItem item;
+  item.AppendPoint(1.0, 10.0);
+  item.AppendPoints({2.0, 3.0}, {20.0, 30.0});
+  EXPECT_THROW(item.AppendPoints({4.0}, {}), RuntimeException);
+
+  EXPECT_EQ(item.GetPointCount(), 3);
+  EXPECT_EQ(item.GetBinCenters(), std::vector<double>({1.0, 2.0, 3.0}));
+  EXPECT_EQ(item.GetValues(), std::vector<double>({10.0, 20.0, 30.0}));
+  EXPECT_EQ(item.GetPoint(1), std::make_pair(2.0, 20.0));
+
+  auto clone = item.Clone();
+  EXPECT_EQ(dynamic_cast<StreamData1DItem*>(clone.get())->GetValues(), item.GetValues());
+
+  item.ClearPoints();
+  EXPECT_EQ(item.GetPointCount(), 0);
+}
+
+TEST_F(StreamData1DItemTest, Capacity)
+{
+  StreamData1DItem item;
+  item.SetCapacity(3);
+  EXPECT_EQ(item.GetCapacity(), 3);
+
+  item.AppendPoints({1.0, 2.0}, {10.0, 20.0});
+  item.AppendPoints({3.0, 4.0}, {30.0, 40.0});
+  EXPECT_EQ(item.GetBinCenters(), std::vector<double>({2.0, 3.0, 4.0}));
+
+  // more points than capacity
+  item.AppendPoints({5.0, 6.0, 7.0, 8.0}, {50.0, 60.0, 70.0, 80.0});
+  EXPECT_EQ(item.GetBinCenters(), std::vector<double>({6.0, 7.0, 8.0}));
+
+  item.SetCapacity(2);
+  EXPECT_EQ(item.GetBinCenters(), std::vector<double>({7.0, 8.0}));
+  EXPECT_EQ(item.GetValues(), std::vector<double>({70.0, 80.0}));
+}
+
+//! Data ranges follow appended and dropped samples.
+TEST_F(StreamData1DItemTest, DataRanges)
+{
+  StreamData1DItem item;
+  EXPECT_TRUE(item.GetBinCentersRange().IsEmpty());
+  EXPECT_TRUE(item.GetValuesRange().IsEmpty());
+
+  item.SetCapacity(3);
+  item.AppendPoints({1.0, 2.0, 3.0}, {10.0, -20.0, 30.0});
+  EXPECT_EQ(item.GetBinCentersRange(), DataRange({1.0, 3.0, 3}));
+  EXPECT_EQ(item.GetValuesRange(), DataRange({-20.0, 30.0, 3}));
+
+  // the minimum of x is dropped, the range of values stays
+  item.AppendPoint(4.0, 0.0);
+  EXPECT_EQ(item.GetBinCentersRange(), DataRange({2.0, 4.0, 3}));
+  EXPECT_EQ(item.GetValuesRange(), DataRange({-20.0, 30.0, 3}));
+
+  // both extremes of values are dropped
+  item.AppendPoints({5.0, 6.0}, {1.0, 2.0});
+  EXPECT_EQ(item.GetBinCentersRange(), DataRange({4.0, 6.0, 3}));
+  EXPECT_EQ(item.GetValuesRange(), DataRange({0.0, 2.0, 3}));
+
+  item.SetCapacity(1);
+  EXPECT_EQ(item.GetValuesRange(), DataRange({2.0, 2.0, 1}));
+
+  item.ClearPoints();
+  EXPECT_TRUE(item.GetBinCentersRange().IsEmpty());
+  EXPECT_TRUE(item.GetValuesRange().IsEmpty());
+}
+
+//! Data ranges of a long stream in a ring buffer match ranges found over remaining samples.
+TEST_F(StreamData1DItemTest, DataRangesOfSlidingWindow)
+{
+  StreamData1DItem item;
+  item.SetCapacity(5);
+
+  const std::vector<double> values = {3.0, 1.0, 4.0, 1.0, 5.0, 9.0, 2.0, 6.0, 5.0, 3.0, 5.0, 8.0};
+  for (std::size_t index = 0; index < values.size(); ++index)
+  {
+    // x is increasing, values go up and down
+    item.AppendPoint(static_cast<double>(index), values[index]);
+    EXPECT_EQ(item.GetBinCentersRange(), utils::FindDataRange(item.GetBinCenters()));
+    EXPECT_EQ(item.GetValuesRange(), utils::FindDataRange(item.GetValues()));
+  }
+
+  // NaN is counted, but doesn't change the range
+  item.AppendPoint(12.0, std::numeric_limits<double>::quiet_NaN());
+  EXPECT_EQ(item.GetValuesRange(), DataRange({3.0, 8.0, 5}));
+}
+
+//! Every append is reported with a single event.
+TEST_F(StreamData1DItemTest, DataAppendedEvent)
+{
+  ApplicationModel model;
+  auto item = model.InsertItem<StreamData1DItem>();
+  item->SetCapacity(3);
+
+  mock_listener_t listener(&model);
+
+  {
+    const ::testing::InSequence seq;
+    EXPECT_CALL(listener, OnDataAppended(DataAppendedEvent{item, 1, 0})).Times(1);
+    EXPECT_CALL(listener, OnDataAppended(DataAppendedEvent{item, 2, 0})).Times(1);
+    EXPECT_CALL(listener, OnDataAppended(DataAppendedEvent{item, 2, 2})).Times(1);
+    EXPECT_CALL(listener, OnDataAppended(DataAppendedEvent{item, 3, 3})).Times(1);
+    EXPECT_CALL(listener, OnDataChanged(DataChangedEvent{item, DataRole::kData})).Times(1);
+  }
+
+  item->AppendPoint(1.0, 10.0);
+  item->AppendPoints({2.0, 3.0}, {20.0, 30.0});
+  item->AppendPoints({4.0, 5.0}, {40.0, 50.0});
+  item->AppendPoints({6.0, 7.0, 8.0, 9.0}, {60.0, 70.0, 80.0, 90.0});
+  item->ClearPoints();
+  item->ClearPoints();  // no event for empty buffer
+
+  ::testing::Mock::VerifyAndClearExpectations(&listener);
+}
+
+//! Dropping samples by the capacity change is reported as a change of the data.
+TEST_F(StreamData1DItemTest, CapacityChangeEvent)
+{
+  ApplicationModel model;
+  auto item = model.InsertItem<StreamData1DItem>();
+  item->AppendPoints({1.0, 2.0, 3.0}, {10.0, 20.0, 30.0});
+  auto capacity_item = item->GetItem(StreamData1DItem::kCapacity);
+
+  mock_listener_t listener(&model);
+
+  {
+    const ::testing::InSequence seq;
+    EXPECT_CALL(listener, OnDataChanged(DataChangedEvent{capacity_item, DataRole::kData}))
+        .Times(1);
+    EXPECT_CALL(listener, OnDataChanged(DataChangedEvent{item, DataRole::kData})).Times(1);
+    EXPECT_CALL(listener, OnDataChanged(DataChangedEvent{capacity_item, DataRole::kData}))
+        .Times(1);
+  }
+
+  item->SetCapacity(2);
+  item->SetCapacity(5);  // nothing is dropped
+  EXPECT_EQ(item->GetBinCenters(), std::vector<double>({2.0, 3.0}));
+
+  ::testing::Mock::VerifyAndClearExpectations(&listener);
+}
+
+//! Stream item can be used by the graph in place of Data1DItem.
+TEST_F(StreamData1DItemTest, LinkedToGraph)
+{
+  ApplicationModel model;
+  auto item = model.InsertItem<StreamData1DItem>();
+  auto graph = model.InsertItem<GraphItem>();
+  graph->SetDataItem(item);
+
+  item->AppendPoints({1.0, 2.0}, {10.0, 20.0});
+  EXPECT_EQ(graph->GetDataItem(), item);
+  EXPECT_EQ(graph->GetBinCenters(), std::vector<double>({1.0, 2.0}));
+  EXPECT_EQ(graph->GetValues(), std::vector<double>({10.0, 20.0}));
+  EXPECT_TRUE(graph->GetErrors().empty());
+  EXPECT_EQ(graph->GetBinCentersRange(), DataRange({1.0, 2.0, 2}));
+  EXPECT_EQ(graph->GetValuesRange(), DataRange({10.0, 20.0, 2}));
+}
+
+//! Stream item accessed via a pointer to Data1DItem reports its samples, setters of the base throw.
+TEST_F(StreamData1DItemTest, AccessViaBaseClass)
+{
+  StreamData1DItem item;
+  item.AppendPoints({1.0, 2.0}, {10.0, 20.0});
+
+  Data1DItem* data_item = &item;
+  EXPECT_EQ(data_item->GetBinCenters(), std::vector<double>({1.0, 2.0}));
+  EXPECT_EQ(data_item->GetValues(), std::vector<double>({10.0, 20.0}));
+  EXPECT_TRUE(data_item->GetErrors().empty());
+  EXPECT_EQ(data_item->GetValuesRange(), DataRange({10.0, 20.0, 2}));
+
+  EXPECT_THROW(data_item->SetValues({1.0, 2.0}), RuntimeException);
+  EXPECT_THROW(data_item->SetErrors({1.0, 2.0}), RuntimeException);
+  EXPECT_THROW(data_item->SetAxis<FixedBinAxisItem>(2, 0.0, 2.0), RuntimeException);
+  EXPECT_EQ(data_item->GetAxis(), nullptr);
+}
@@ -78,6 +78,9 @@ TEST_F(TagInfoTests, PropertyTag)
   EXPECT_EQ(tag.GetMax(), 1);
   EXPECT_TRUE(tag.IsValidType("model_type"));
   EXPECT_FALSE(tag.IsValidType("abc"));
+  EXPECT_TRUE(tag.IsValidType(Atom("model_type")));
+  EXPECT_FALSE(tag.IsValidType(Atom("abc")));
+  EXPECT_EQ(tag.GetNameAtom(), Atom("name"));
 }
 
 TEST_F(TagInfoTests, EqualityOperator)
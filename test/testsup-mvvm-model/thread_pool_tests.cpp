@@ -0,0 +1,95 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/utils/thread_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <set>
+
+using namespace mvvm;
+
+//! Testing ThreadPool.
+
+class ThreadPoolTests : public ::testing::Test
+{
+};
+
+TEST_F(ThreadPoolTests, InitialState)
+{
+  const ThreadPool pool(2);
+  EXPECT_EQ(pool.GetThreadCount(), 2);
+
+  const ThreadPool single_thread_pool(0);
+  EXPECT_EQ(single_thread_pool.GetThreadCount(), 1);
+}
+
+//! Submitted task is executed in a worker thread.
+
+TEST_F(ThreadPoolTests, Submit)
+{
+  ThreadPool pool(1);
+
+  std::promise<std::thread::id> promise;
+  auto future = promise.get_future();
+  pool.Submit([&promise]() { promise.set_value(std::this_thread::get_id()); });
+
+  EXPECT_NE(future.get(), std::this_thread::get_id());
+}
+
+//! Tasks submitted from many threads are shared between workers, all tasks are completed before
+//! the pool is destroyed.
+
+TEST_F(ThreadPoolTests, ConcurrentSubmit)
+{
+  const int task_count = 1000;
+  std::atomic<int> counter{0};
+  std::mutex mutex;
+  std::set<std::thread::id> worker_ids;
+
+  {
+    ThreadPool pool(4);
+    auto task = [&]()
+    {
+      ++counter;
+      const std::lock_guard<std::mutex> lock(mutex);
+      worker_ids.insert(std::this_thread::get_id());
+    };
+
+    auto submit = [&pool, task]()
+    {
+      for (int i = 0; i < task_count / 2; ++i)
+      {
+        pool.Submit(task);
+      }
+    };
+    auto submit1 = std::async(std::launch::async, submit);
+    auto submit2 = std::async(std::launch::async, submit);
+    submit1.wait();
+    submit2.wait();
+  }
+
+  EXPECT_EQ(counter.load(), task_count);
+  EXPECT_GE(worker_ids.size(), 1);
+  EXPECT_LE(worker_ids.size(), 4);
+}
@@ -0,0 +1,220 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/utils/tile_pyramid.h"
+
+#include <mvvm/core/mvvm_exceptions.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+using namespace mvvm;
+
+/**
+ * @brief Tests for TilePyramid class.
+ */
+class TilePyramidTests : public ::testing::Test
+{
+public:
+  //! Returns array with value of the cell equal to its index.
+  static SharedArray<double> CreateData(std::size_t size_x, std::size_t size_y)
+  {
+    std::vector<double> result(size_x * size_y);
+    std::iota(result.begin(), result.end(), 0.0);
+    return SharedArray<double>(std::move(result));
+  }
+};
+
+TEST_F(TilePyramidTests, DataRegion)
+{
+  const DataRegion region{1, 2, 5, 4};
+  EXPECT_EQ(region.GetWidth(), 4);
+  EXPECT_EQ(region.GetHeight(), 2);
+  EXPECT_FALSE(region.IsEmpty());
+  EXPECT_TRUE(DataRegion{}.IsEmpty());
+  EXPECT_TRUE((DataRegion{3, 3, 3, 5}.IsEmpty()));
+
+  EXPECT_EQ(region.Intersected(DataRegion{0, 0, 3, 10}), (DataRegion{1, 2, 3, 4}));
+  EXPECT_EQ(region.Intersected(DataRegion{5, 0, 10, 10}), DataRegion{});
+}
+
+TEST_F(TilePyramidTests, InitialState)
+{
+  TilePyramid pyramid;
+  EXPECT_EQ(pyramid.GetSizeX(), 0);
+  EXPECT_EQ(pyramid.GetSizeY(), 0);
+  EXPECT_EQ(pyramid.GetLevelCount(), 0);
+  EXPECT_TRUE(pyramid.GetValues({}, 0, DataRegion{0, 0, 1, 1}).empty());
+
+  EXPECT_THROW(TilePyramid(0), RuntimeException);
+}
+
+TEST_F(TilePyramidTests, SetSize)
+{
+  TilePyramid pyramid(2);
+  pyramid.SetSize(5, 3);
+  EXPECT_EQ(pyramid.GetSizeX(), 5);
+  EXPECT_EQ(pyramid.GetSizeY(), 3);
+
+  // 5x3 -> 3x2 -> 2x1
+  EXPECT_EQ(pyramid.GetLevelCount(), 3);
+  EXPECT_EQ(pyramid.GetLevelRegion(1), (DataRegion{0, 0, 3, 2}));
+  EXPECT_EQ(pyramid.GetLevelRegion(2), (DataRegion{0, 0, 2, 1}));
+  EXPECT_EQ(pyramid.GetLevelRegion(3), DataRegion{});
+  EXPECT_EQ(pyramid.GetComputedTileCount(), 0);
+
+  // data should match dimensions
+  EXPECT_THROW(pyramid.GetValues(CreateData(2, 2), 0, DataRegion{0, 0, 1, 1}), RuntimeException);
+}
+
+TEST_F(TilePyramidTests, LevelZeroValues)
+{
+  TilePyramid pyramid(2);
+  pyramid.SetSize(4, 3);
+  const auto data = CreateData(4, 3);
+
+  EXPECT_EQ(pyramid.GetValues(data, 0, DataRegion{1, 1, 3, 3}),
+            std::vector<double>({5, 6, 9, 10}));
+
+  // region is clipped to data
+  EXPECT_EQ(pyramid.GetValues(data, 0, DataRegion{3, 2, 10, 10}), std::vector<double>({11}));
+  EXPECT_EQ(pyramid.GetComputedTileCount(), 0);
+}
+
+//! Values of the coarse level are means of 2x2 cells, cells on the border are averaged over
+//! existing cells.
+
+TEST_F(TilePyramidTests, ReducedValues)
+{
+  //  0  1  2
+  //  3  4  5
+  //  6  7  8
+  TilePyramid pyramid(1);
+  pyramid.SetSize(3, 3);
+  ASSERT_EQ(pyramid.GetLevelCount(), 3);
+  const auto data = CreateData(3, 3);
+
+  EXPECT_EQ(pyramid.GetValues(data, 1, pyramid.GetLevelRegion(1)),
+            std::vector<double>({2.0, 3.5, 6.5, 8.0}));
+  EXPECT_EQ(pyramid.GetComputedTileCount(), 4);
+
+  EXPECT_EQ(pyramid.GetValues(data, 2, pyramid.GetLevelRegion(2)), std::vector<double>({5.0}));
+  EXPECT_EQ(pyramid.GetComputedTileCount(), 5);
+}
+
+TEST_F(TilePyramidTests, NaNValuesAreIgnored)
+{
+  const auto nan = std::numeric_limits<double>::quiet_NaN();
+  TilePyramid pyramid(1);
+  pyramid.SetSize(2, 2);
+  EXPECT_EQ(pyramid.GetValues(SharedArray<double>({nan, 1.0, 3.0, nan}), 1,
+                              pyramid.GetLevelRegion(1)),
+            std::vector<double>({2.0}));
+
+  pyramid.SetSize(2, 2);
+  const auto values =
+      pyramid.GetValues(SharedArray<double>({nan, nan, nan, nan}), 1, pyramid.GetLevelRegion(1));
+  ASSERT_EQ(values.size(), 1);
+  EXPECT_TRUE(std::isnan(values[0]));
+}
+
+//! Only tiles of the requested region are computed.
+
+TEST_F(TilePyramidTests, LazyTiles)
+{
+  TilePyramid pyramid(4);
+  pyramid.SetSize(32, 32);
+  ASSERT_EQ(pyramid.GetLevelCount(), 4);  // 32 -> 16 -> 8 -> 4
+  const auto data = CreateData(32, 32);
+
+  // cell of level 1 is computed from level 0 directly
+  pyramid.GetValues(data, 1, DataRegion{0, 0, 1, 1});
+  EXPECT_EQ(pyramid.GetComputedTileCount(), 1);
+
+  // cell of level 3 requires 4 tiles of level 2 and 16 tiles of level 1
+  pyramid.GetValues(data, 3, DataRegion{0, 0, 1, 1});
+  EXPECT_EQ(pyramid.GetComputedTileCount(), 1 + 4 + 16);
+
+  // full level 1 covered
+  pyramid.GetValues(data, 1, pyramid.GetLevelRegion(1));
+  EXPECT_EQ(pyramid.GetComputedTileCount(), 1 + 4 + 16);
+}
+
+TEST_F(TilePyramidTests, LevelRegions)
+{
+  TilePyramid pyramid(4);
+  pyramid.SetSize(32, 16);
+
+  EXPECT_EQ(pyramid.ToLevelRegion(DataRegion{3, 1, 9, 16}, 1), (DataRegion{1, 0, 5, 8}));
+  EXPECT_EQ(pyramid.ToLevelRegion(DataRegion{3, 1, 9, 16}, 2), (DataRegion{0, 0, 3, 4}));
+  EXPECT_EQ(pyramid.FromLevelRegion(DataRegion{1, 0, 5, 8}, 1), (DataRegion{2, 0, 10, 16}));
+  EXPECT_EQ(pyramid.FromLevelRegion(DataRegion{0, 0, 100, 100}, 1), (DataRegion{0, 0, 32, 16}));
+}
+
+TEST_F(TilePyramidTests, FindLevel)
+{
+  TilePyramid pyramid(4);
+  pyramid.SetSize(64, 64);
+  ASSERT_EQ(pyramid.GetLevelCount(), 5);
+  const auto full = pyramid.GetLevelRegion(0);
+
+  EXPECT_EQ(pyramid.FindLevel(full, 64, 64), 0);
+  EXPECT_EQ(pyramid.FindLevel(full, 100, 100), 0);
+  EXPECT_EQ(pyramid.FindLevel(full, 32, 32), 1);
+  EXPECT_EQ(pyramid.FindLevel(full, 20, 20), 1);
+  EXPECT_EQ(pyramid.FindLevel(full, 16, 32), 1);
+  EXPECT_EQ(pyramid.FindLevel(full, 1, 1), 4);
+  EXPECT_EQ(pyramid.FindLevel(full, 0, 0), 4);
+
+  // zoomed in
+  EXPECT_EQ(pyramid.FindLevel(DataRegion{0, 0, 16, 16}, 4, 4), 2);
+}
+
+//! Invalidating a region of the data, modified in place, drops only tiles covering it.
+
+TEST_F(TilePyramidTests, InvalidateRegion)
+{
+  TilePyramid pyramid(2);
+  auto data = CreateData(8, 8);
+  pyramid.SetSize(8, 8);
+  ASSERT_EQ(pyramid.GetLevelCount(), 3);  // 8 -> 4 -> 2
+
+  pyramid.GetValues(data, 2, pyramid.GetLevelRegion(2));
+  EXPECT_EQ(pyramid.GetComputedTileCount(), 4 + 1);
+  EXPECT_EQ(pyramid.GetValues(data, 2, DataRegion{0, 0, 1, 1}), std::vector<double>({13.5}));
+
+  auto& values = data.GetMutableVector();
+  for (std::size_t y = 0; y < 4; ++y)
+  {
+    for (std::size_t x = 0; x < 4; ++x)
+    {
+      values[y * 8 + x] = 0.0;
+    }
+  }
+  pyramid.InvalidateRegion(DataRegion{0, 0, 4, 4});
+  EXPECT_EQ(pyramid.GetComputedTileCount(), 3 + 0);
+
+  EXPECT_EQ(pyramid.GetValues(data, 2, pyramid.GetLevelRegion(2)),
+            std::vector<double>({0.0, 17.5, 45.5, 49.5}));
+  EXPECT_EQ(pyramid.GetComputedTileCount(), 4 + 1);
+}
@@ -174,14 +174,29 @@ TEST_F(TreeDataVariantConverterTests, DoubleDataRole)
   auto role_data = ToRoleData(*tree_data);
   EXPECT_EQ(role_data, role_data_t(43, variant_t(42.3)));
 
-  // converting back
+  // converting back, double is written in the shortest form which is parsed back exactly
   auto new_tree_data = ToTreeData(role_data);
-  // Here we can't compare new TreeData with the old one because of the internal conversion of
-  // double to string and lost of precision.
-  EXPECT_DOUBLE_EQ(std::stod(new_tree_data.GetContent()), 42.3);
-  EXPECT_EQ(new_tree_data.GetNodeName(), "Variant");
-  EXPECT_EQ(new_tree_data.GetNumberOfAttributes(), 2);
-  EXPECT_EQ(new_tree_data.GetAttribute("role"), std::string("43"));
+  EXPECT_EQ(new_tree_data, *tree_data);
+}
+
+//! Doubles and floats should survive conversion to TreeData and back without loss of precision.
+
+TEST_F(TreeDataVariantConverterTests, FloatingPointRoundTrip)
+{
+  for (const double value : {0.1, 1.0 / 3.0, 1e-300, -123456.789012345678})
+  {
+    const role_data_t role_data(42, variant_t(value));
+    EXPECT_EQ(ToRoleData(ToTreeData(role_data)), role_data);
+  }
+
+  for (const float value : {0.1F, 1.0F / 3.0F, 1e-30F})
+  {
+    const role_data_t role_data(42, variant_t(value));
+    EXPECT_EQ(ToRoleData(ToTreeData(role_data)), role_data);
+  }
+
+  const role_data_t role_data(42, variant_t(std::vector<double>{0.1, 1.0 / 3.0, 1e-300}));
+  EXPECT_EQ(ToRoleData(ToTreeData(role_data)), role_data);
 }
 
 //! Parsing XML data string representing role_data_t with std::string data.
@@ -241,6 +256,82 @@ TEST_F(TreeDataVariantConverterTests, VectorOfDoubleRole)
   EXPECT_EQ(new_tree_data, *tree_data);
 }
 
+//! Parsing XML data string representing role_data_t with shared vector.
+
+TEST_F(TreeDataVariantConverterTests, SharedVectorOfDoubleRole)
+{
+  using mvvm::ParseXMLElementString;
+
+  auto tree_data =
+      ParseXMLElementString(R"(<Variant role="42" type="shared_vector_double">1.0, 2.0</Variant>)");
+  EXPECT_TRUE(IsDataRoleConvertible(*tree_data));
+
+  // converting tree_data to role_data
+  auto role_data = ToRoleData(*tree_data);
+  EXPECT_EQ(role_data, role_data_t(42, variant_t(SharedArray<double>({1.0, 2.0}))));
+
+  // converting back
+  auto new_tree_data = ToTreeData(role_data);
+  EXPECT_EQ(new_tree_data, *tree_data);
+}
+
+//! Parsing XML data string representing role_data_t with vectors of narrow numeric types.
+
+TEST_F(TreeDataVariantConverterTests, NarrowVectorRoles)
+{
+  using mvvm::ParseXMLElementString;
+
+  {
+    auto tree_data =
+        ParseXMLElementString(R"(<Variant role="0" type="vector_float32">1.0, 0.1</Variant>)");
+    auto role_data = ToRoleData(*tree_data);
+    EXPECT_EQ(role_data, role_data_t(0, variant_t(std::vector<float32>({1.0f, 0.1f}))));
+    EXPECT_EQ(ToTreeData(role_data), *tree_data);
+  }
+
+  {
+    auto tree_data =
+        ParseXMLElementString(R"(<Variant role="0" type="vector_int32">-1, 2</Variant>)");
+    auto role_data = ToRoleData(*tree_data);
+    EXPECT_EQ(role_data, role_data_t(0, variant_t(std::vector<int32>({-1, 2}))));
+    EXPECT_EQ(ToTreeData(role_data), *tree_data);
+  }
+
+  {
+    auto tree_data = ParseXMLElementString(
+        R"(<Variant role="0" type="vector_int64">9223372036854775807, 2</Variant>)");
+    auto role_data = ToRoleData(*tree_data);
+    EXPECT_EQ(role_data, role_data_t(0, variant_t(std::vector<int64>({9223372036854775807, 2}))));
+    EXPECT_EQ(ToTreeData(role_data), *tree_data);
+  }
+
+  {
+    auto tree_data =
+        ParseXMLElementString(R"(<Variant role="0" type="vector_uint16">0, 65535</Variant>)");
+    auto role_data = ToRoleData(*tree_data);
+    EXPECT_EQ(role_data, role_data_t(0, variant_t(std::vector<uint16>({0, 65535}))));
+    EXPECT_EQ(ToTreeData(role_data), *tree_data);
+  }
+
+  {
+    auto tree_data = ParseXMLElementString(R"(<Variant role="0" type="vector_int32"></Variant>)");
+    EXPECT_EQ(ToRoleData(*tree_data), role_data_t(0, variant_t(std::vector<int32>())));
+  }
+
+  // values which don't fit into the type, or have wrong format, are not accepted
+  {
+    auto tree_data =
+        ParseXMLElementString(R"(<Variant role="0" type="vector_uint16">65536</Variant>)");
+    EXPECT_THROW(ToRoleData(*tree_data), mvvm::RuntimeException);
+  }
+
+  {
+    auto tree_data =
+        ParseXMLElementString(R"(<Variant role="0" type="vector_int32">1.5</Variant>)");
+    EXPECT_THROW(ToRoleData(*tree_data), mvvm::RuntimeException);
+  }
+}
+
 //! Parsing XML data string representing role_data_t with ComboProperty.
 
 TEST_F(TreeDataVariantConverterTests, ComboPropertyRole)
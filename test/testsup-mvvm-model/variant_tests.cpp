@@ -71,6 +71,43 @@ TEST_F(VariantTests, VectorOfDouble)
   EXPECT_EQ(std::get<std::vector<double>>(variant1), std::vector<double>({1.0, 2.0}));
 }
 
+//! SharedArray<double>
+
+TEST_F(VariantTests, SharedVectorOfDouble)
+{
+  const SharedArray<double> array({1.0, 2.0});
+  variant_t variant1(array);
+  variant_t variant2(SharedArray<double>({1.0, 2.0}));
+  EXPECT_TRUE(variant1 == variant2);
+  EXPECT_FALSE(variant1 == variant_t(SharedArray<double>({1.0})));
+
+  // copy of the variant shares the data
+  const variant_t copy = variant1;
+  EXPECT_TRUE(std::get<SharedArray<double>>(copy).IsSharedWith(array));
+
+  // shared array and vector are different types
+  EXPECT_FALSE(utils::AreCompatible(variant1, variant_t(std::vector<double>({1.0, 2.0}))));
+}
+
+//! Vectors of narrow numeric types.
+
+TEST_F(VariantTests, NarrowVectors)
+{
+  const variant_t float_variant(std::vector<float32>({1.0f, 2.0f}));
+  const variant_t int32_variant(std::vector<int32>({1, 2}));
+  const variant_t int64_variant(std::vector<int64>({1, 2}));
+  const variant_t uint16_variant(std::vector<uint16>({1, 2}));
+
+  EXPECT_EQ(float_variant, variant_t(std::vector<float32>({1.0f, 2.0f})));
+  EXPECT_NE(int32_variant, variant_t(std::vector<int32>({1})));
+
+  // vectors of different numeric types are not compatible
+  const variant_t double_variant(std::vector<double>({1.0, 2.0}));
+  EXPECT_FALSE(utils::AreCompatible(double_variant, float_variant));
+  EXPECT_FALSE(utils::AreCompatible(int32_variant, int64_variant));
+  EXPECT_FALSE(utils::AreCompatible(int32_variant, uint16_variant));
+}
+
 TEST_F(VariantTests, ComboPropertyVariantEquality)
 {
   ComboProperty c1 = ComboProperty() << "a1"
@@ -188,6 +225,12 @@ TEST_F(VariantTests, TypeName)
             constants::kComboPropertyTypeName);
   EXPECT_EQ(TypeName(variant_t(ExternalProperty("text", "red"))),
             constants::kExternalPropertyTypeName);
+  EXPECT_EQ(TypeName(variant_t(SharedArray<double>({1.0, 1.1}))),
+            constants::kSharedVectorDoubleTypeName);
+  EXPECT_EQ(TypeName(variant_t(std::vector<float32>({1.0f}))), constants::kVectorFloat32TypeName);
+  EXPECT_EQ(TypeName(variant_t(std::vector<int32>({1}))), constants::kVectorInt32TypeName);
+  EXPECT_EQ(TypeName(variant_t(std::vector<int64>({1}))), constants::kVectorInt64TypeName);
+  EXPECT_EQ(TypeName(variant_t(std::vector<uint16>({1}))), constants::kVectorUInt16TypeName);
 }
 
 TEST_F(VariantTests, DataRoleComparison)
@@ -315,4 +358,34 @@ TEST_F(VariantTests, GetTypeCode)
     EXPECT_EQ(GetTypeCode(variant_t(value)), TypeCode::ExternalProperty);
     EXPECT_EQ(ValueToString(variant_t(value)), std::string("text;color;identifier"));
   }
+
+  {
+    const SharedArray<double> value{1.0, 2.0, 3.0};
+    EXPECT_EQ(GetTypeCode(variant_t(value)), TypeCode::SharedVectorOfDouble);
+    EXPECT_EQ(ValueToString(variant_t(value)), std::string("1.0, 2.0, 3.0"));
+  }
+
+  {
+    const std::vector<float32> value{1.0f, 2.5f, 0.1f};
+    EXPECT_EQ(GetTypeCode(variant_t(value)), TypeCode::VectorOfFloat32);
+    EXPECT_EQ(ValueToString(variant_t(value)), std::string("1.0, 2.5, 0.1"));
+  }
+
+  {
+    const std::vector<int32> value{-1, 0, 2147483647};
+    EXPECT_EQ(GetTypeCode(variant_t(value)), TypeCode::VectorOfInt32);
+    EXPECT_EQ(ValueToString(variant_t(value)), std::string("-1, 0, 2147483647"));
+  }
+
+  {
+    const std::vector<int64> value{-9223372036854775807, 42};
+    EXPECT_EQ(GetTypeCode(variant_t(value)), TypeCode::VectorOfInt64);
+    EXPECT_EQ(ValueToString(variant_t(value)), std::string("-9223372036854775807, 42"));
+  }
+
+  {
+    const std::vector<uint16> value{0, 65535};
+    EXPECT_EQ(GetTypeCode(variant_t(value)), TypeCode::VectorOfUInt16);
+    EXPECT_EQ(ValueToString(variant_t(value)), std::string("0, 65535"));
+  }
 }
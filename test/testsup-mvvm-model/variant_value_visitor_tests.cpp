@@ -127,3 +127,24 @@ TEST_F(VariantValueVisitorTests, Visit)
     EXPECT_EQ(visitor.operator()(value), std::string("text;color;identifier"));
   }
 }
+
+//! Floating point values are shown in the shortest form which parses back to the same value.
+TEST_F(VariantValueVisitorTests, ShortestRoundTripFloatingPoint)
+{
+  VariantValueVisitor visitor;
+
+  EXPECT_EQ(visitor.operator()(mvvm::float64{0.1}), std::string("0.1"));
+  EXPECT_EQ(visitor.operator()(mvvm::float64{1.0 / 3.0}), std::string("0.3333333333333333"));
+  EXPECT_EQ(visitor.operator()(mvvm::float64{1.0000000000001}), std::string("1.0000000000001"));
+  EXPECT_EQ(visitor.operator()(mvvm::float64{1e-20}), std::string("1e-20"));
+  EXPECT_EQ(visitor.operator()(mvvm::float32{0.1F}), std::string("0.1"));
+  EXPECT_EQ(visitor.operator()(mvvm::float32{1.0F / 3.0F}), std::string("0.33333334"));
+
+  // previously values were cut to 12 significant digits
+  const double value{0.123456789012345};
+  EXPECT_EQ(visitor.operator()(mvvm::float64{value}), std::string("0.123456789012345"));
+  EXPECT_EQ(utils::StringToDouble(visitor.operator()(mvvm::float64{value})).value(), value);
+
+  const std::vector<double> values{0.1, 1.0 / 3.0};
+  EXPECT_EQ(visitor.operator()(values), std::string("0.1, 0.3333333333333333"));
+}
@@ -0,0 +1,251 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <mvvm/model/application_model.h>
+#include <mvvm/plotting/charts/chart_viewport_controller.h>
+#include <mvvm/plotting/charts/line_series_data_controller.h>
+#include <mvvm/plotting/charts/qt_charts.h>
+#include <mvvm/standarditems/chart_viewport_item.h>
+#include <mvvm/standarditems/line_series_data_item.h>
+#include <mvvm/standarditems/line_series_item.h>
+
+#include <benchmark/benchmark.h>
+
+#include <QCoreApplication>
+#include <QImage>
+#include <QPainter>
+#include <cmath>
+
+using namespace mvvm;
+
+namespace
+{
+
+const int kCanvasWidth = 1200;
+const int kCanvasHeight = 800;
+
+//! Returns sine wave with given number of points and phase.
+std::vector<std::pair<double, double>> CreateWaveform(std::size_t size, double phase)
+{
+  std::vector<std::pair<double, double>> result(size);
+  for (std::size_t index = 0; index < size; ++index)
+  {
+    const auto x = static_cast<double>(index);
+    result[index] = {x, std::sin(phase + 0.01 * x)};
+  }
+  return result;
+}
+
+}  // namespace
+
+//! Testing the latency of plotting on QtCharts canvas, from the model update to the rendered
+//! frame. The first benchmark argument is the number of line series, the second is the number of
+//! points in each series. The chart view is not shown, the frame is rendered into an image.
+
+class ChartPlotBenchmark : public benchmark::Fixture
+{
+public:
+  ChartPlotBenchmark() : m_image(kCanvasWidth, kCanvasHeight, QImage::Format_ARGB32_Premultiplied)
+  {
+  }
+
+  void SetUp(const benchmark::State&) override
+  {
+    m_chart_view = std::make_unique<QChartView>(new QChart);
+    m_chart_view->resize(kCanvasWidth, kCanvasHeight);
+  }
+
+  void TearDown(const benchmark::State&) override
+  {
+    m_chart_view.reset();
+    m_data_items.clear();
+    m_viewport = nullptr;
+    m_model.Clear();
+  }
+
+  //! Populates the model with viewport containing given number of line series.
+  void PopulateModel(int series_count, std::size_t point_count)
+  {
+    m_viewport = m_model.InsertItem<ChartViewportItem>();
+    for (int index = 0; index < series_count; ++index)
+    {
+      auto data_item = m_model.InsertItem<LineSeriesDataItem>();
+      data_item->SetWaveform(CreateWaveform(point_count, index));
+      m_data_items.push_back(data_item);
+
+      auto line_series_item = m_model.InsertItem<LineSeriesItem>(m_viewport);
+      line_series_item->SetDataItem(data_item);
+    }
+  }
+
+  //! Processes pending events of the chart and renders the frame into the image.
+  void RenderFrame()
+  {
+    QCoreApplication::processEvents();
+    QPainter painter(&m_image);
+    m_chart_view->render(&painter);
+  }
+
+  //! Removes all series and axes from the chart.
+  void ClearChart()
+  {
+    GetChart()->removeAllSeries();
+    for (auto axis : GetChart()->axes())
+    {
+      GetChart()->removeAxis(axis);
+      delete axis;
+    }
+  }
+
+  QChart* GetChart() { return m_chart_view->chart(); }
+
+  ApplicationModel m_model;
+  ChartViewportItem* m_viewport{nullptr};
+  std::vector<LineSeriesDataItem*> m_data_items;
+  std::unique_ptr<QChartView> m_chart_view;
+  QImage m_image;
+};
+
+//! Creation of all line series on the chart when the viewport is attached to the controller.
+
+BENCHMARK_DEFINE_F(ChartPlotBenchmark, ChartViewportSetItem)(benchmark::State& state)
+{
+  PopulateModel(static_cast<int>(state.range(0)), static_cast<std::size_t>(state.range(1)));
+
+  for (auto dummy : state)
+  {
+    auto controller = std::make_unique<ChartViewportController>(GetChart());
+    controller->SetItem(m_viewport);
+    RenderFrame();
+
+    // controller doesn't clean up the chart, it is done here to start the next iteration afresh
+    state.PauseTiming();
+    controller.reset();
+    ClearChart();
+    state.ResumeTiming();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+}
+
+BENCHMARK_REGISTER_F(ChartPlotBenchmark, ChartViewportSetItem)
+    ->Args({1, 1000})
+    ->Args({1, 10000})
+    ->Args({10, 1000})
+    ->Unit(benchmark::kMillisecond);
+
+//! Replacement of the waveform of all line series followed by the frame.
+
+BENCHMARK_DEFINE_F(ChartPlotBenchmark, ChartViewportUpdate)(benchmark::State& state)
+{
+  const auto point_count = static_cast<std::size_t>(state.range(1));
+  const std::vector<std::vector<std::pair<double, double>>> waveforms = {
+      CreateWaveform(point_count, 0.0), CreateWaveform(point_count, 1.0)};
+
+  PopulateModel(static_cast<int>(state.range(0)), point_count);
+  ChartViewportController controller(GetChart());
+  controller.SetItem(m_viewport);
+  RenderFrame();
+
+  std::size_t iteration{0};
+  for (auto dummy : state)
+  {
+    for (auto data_item : m_data_items)
+    {
+      data_item->SetWaveform(waveforms[iteration % waveforms.size()]);
+    }
+    RenderFrame();
+    ++iteration;
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+}
+
+BENCHMARK_REGISTER_F(ChartPlotBenchmark, ChartViewportUpdate)
+    ->Args({1, 1000})
+    ->Args({1, 10000})
+    ->Args({10, 1000})
+    ->Unit(benchmark::kMillisecond);
+
+//! Change of a single point of the line series followed by the frame. The visible range is set,
+//! so large series are decimated.
+
+BENCHMARK_DEFINE_F(ChartPlotBenchmark, LineSeriesPointUpdate)(benchmark::State& state)
+{
+  const auto point_count = static_cast<std::size_t>(state.range(1));
+  auto data_item = m_model.InsertItem<LineSeriesDataItem>();
+  data_item->SetWaveform(CreateWaveform(point_count, 0.0));
+
+  auto line_series = new QLineSeries;
+  GetChart()->addSeries(line_series);
+  GetChart()->createDefaultAxes();
+  LineSeriesDataController controller(line_series);
+  controller.SetItem(data_item);
+  controller.SetVisibleRange(0.0, static_cast<double>(point_count), kCanvasWidth);
+  RenderFrame();
+
+  const int index = static_cast<int>(point_count / 2);
+  double value{0.0};
+  for (auto dummy : state)
+  {
+    data_item->SetPointCoordinates(index, {static_cast<double>(index), value});
+    RenderFrame();
+    value = value > 1.0 ? -1.0 : value + 0.1;
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_REGISTER_F(ChartPlotBenchmark, LineSeriesPointUpdate)
+    ->Args({1, 1000})
+    ->Args({1, 100000})
+    ->Unit(benchmark::kMicrosecond);
+
+//! Appending points to the line series one by one, each followed by the frame, as in the case of
+//! the data arriving from the acquisition.
+
+BENCHMARK_DEFINE_F(ChartPlotBenchmark, LineSeriesAppend)(benchmark::State& state)
+{
+  const auto point_count = static_cast<std::size_t>(state.range(1));
+  auto data_item = m_model.InsertItem<LineSeriesDataItem>();
+  data_item->SetWaveform(CreateWaveform(point_count, 0.0));
+
+  auto line_series = new QLineSeries;
+  GetChart()->addSeries(line_series);
+  GetChart()->createDefaultAxes();
+  LineSeriesDataController controller(line_series);
+  controller.SetItem(data_item);
+  RenderFrame();
+
+  double x = static_cast<double>(point_count);
+  for (auto dummy : state)
+  {
+    data_item->InsertPoint(data_item->GetPointCount(), {x, std::sin(0.01 * x)});
+    RenderFrame();
+    x += 1.0;
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_REGISTER_F(ChartPlotBenchmark, LineSeriesAppend)
+    ->Args({1, 1000})
+    ->Args({1, 10000})
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,252 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <mvvm/model/application_model.h>
+#include <mvvm/plotting/customplot/data1d_plot_controller.h>
+#include <mvvm/plotting/customplot/graph_viewport_plot_controller.h>
+#include <mvvm/plotting/customplot/replot_scheduler.h>
+#include <mvvm/standarditems/axis_items.h>
+#include <mvvm/standarditems/data1d_item.h>
+#include <mvvm/standarditems/graph_item.h>
+#include <mvvm/standarditems/graph_viewport_item.h>
+
+#include <benchmark/benchmark.h>
+#include <qcustomplot.h>
+
+#include <cmath>
+
+using namespace mvvm;
+
+namespace
+{
+
+const int kCanvasWidth = 1200;
+const int kCanvasHeight = 800;
+
+//! Returns sine wave with given number of points and phase.
+std::vector<double> CreateValues(std::size_t size, double phase)
+{
+  std::vector<double> result(size);
+  for (std::size_t index = 0; index < size; ++index)
+  {
+    result[index] = std::sin(phase + 0.01 * static_cast<double>(index));
+  }
+  return result;
+}
+
+//! Returns canvas of typical size, it is not shown but renders into its paint buffers.
+std::unique_ptr<QCustomPlot> CreateCustomPlot()
+{
+  auto result = std::make_unique<QCustomPlot>();
+  result->resize(kCanvasWidth, kCanvasHeight);
+  return result;
+}
+
+//! Renders the frame if the replot was requested by controllers.
+void RenderFrame(QCustomPlot* custom_plot)
+{
+  ReplotScheduler::GetScheduler(custom_plot)->Flush();
+}
+
+}  // namespace
+
+//! Testing the latency of plotting on QCustomPlot canvas, from the model update to the rendered
+//! frame. The first benchmark argument is the number of graphs, the second is the number of points
+//! in each graph. Frames rendered per iteration, and the time spent in the last replot according
+//! to QCustomPlot, are reported as counters.
+
+class CustomPlotBenchmark : public benchmark::Fixture
+{
+public:
+  //! Populates the model with viewport containing given number of graphs.
+  void PopulateModel(int graph_count, std::size_t point_count)
+  {
+    m_viewport = m_model.InsertItem<GraphViewportItem>();
+    for (int index = 0; index < graph_count; ++index)
+    {
+      auto data_item = m_model.InsertItem<Data1DItem>();
+      data_item->SetAxis<FixedBinAxisItem>(static_cast<int>(point_count), 0.0,
+                                           static_cast<double>(point_count));
+      data_item->SetValues(CreateValues(point_count, index));
+      m_data_items.push_back(data_item);
+
+      auto graph_item = m_model.InsertItem<GraphItem>(m_viewport);
+      graph_item->SetDataItem(data_item);
+    }
+    m_viewport->SetViewportToContent();
+  }
+
+  //! Reports processed points and frame statistics.
+  void SetCounters(benchmark::State& state, QCustomPlot* custom_plot)
+  {
+    auto scheduler = ReplotScheduler::GetScheduler(custom_plot);
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+    const auto frames = static_cast<double>(scheduler->GetPerformedReplotCount());
+    state.counters["frames"] = benchmark::Counter(frames, benchmark::Counter::kAvgIterations);
+    state.counters["replot_ms"] = custom_plot->replotTime();
+  }
+
+  void TearDown(const benchmark::State&) override
+  {
+    m_data_items.clear();
+    m_viewport = nullptr;
+    m_model.Clear();
+  }
+
+  ApplicationModel m_model;
+  GraphViewportItem* m_viewport{nullptr};
+  std::vector<Data1DItem*> m_data_items;
+};
+
+//! Creation of all graphs on the canvas when the viewport is attached to the controller.
+
+BENCHMARK_DEFINE_F(CustomPlotBenchmark, GraphViewportSetItem)(benchmark::State& state)
+{
+  auto custom_plot = CreateCustomPlot();
+  GraphViewportPlotController controller(custom_plot.get());
+  PopulateModel(static_cast<int>(state.range(0)), static_cast<std::size_t>(state.range(1)));
+  ReplotScheduler::GetScheduler(custom_plot.get())->ResetCounters();
+
+  for (auto dummy : state)
+  {
+    controller.SetItem(m_viewport);
+    RenderFrame(custom_plot.get());
+
+    state.PauseTiming();
+    controller.SetItem(nullptr);
+    state.ResumeTiming();
+  }
+
+  SetCounters(state, custom_plot.get());
+}
+
+BENCHMARK_REGISTER_F(CustomPlotBenchmark, GraphViewportSetItem)
+    ->Args({1, 1000})
+    ->Args({1, 100000})
+    ->Args({10, 10000})
+    ->Args({50, 10000})
+    ->Unit(benchmark::kMillisecond);
+
+//! Update of values of all graphs followed by the frame.
+
+BENCHMARK_DEFINE_F(CustomPlotBenchmark, GraphViewportUpdate)(benchmark::State& state)
+{
+  const auto point_count = static_cast<std::size_t>(state.range(1));
+  const std::vector<std::vector<double>> values = {CreateValues(point_count, 0.0),
+                                                   CreateValues(point_count, 1.0)};
+
+  auto custom_plot = CreateCustomPlot();
+  GraphViewportPlotController controller(custom_plot.get());
+  PopulateModel(static_cast<int>(state.range(0)), point_count);
+  controller.SetItem(m_viewport);
+  RenderFrame(custom_plot.get());
+  ReplotScheduler::GetScheduler(custom_plot.get())->ResetCounters();
+
+  std::size_t iteration{0};
+  for (auto dummy : state)
+  {
+    for (auto data_item : m_data_items)
+    {
+      data_item->SetValues(values[iteration % values.size()]);
+    }
+    RenderFrame(custom_plot.get());
+    ++iteration;
+  }
+
+  SetCounters(state, custom_plot.get());
+}
+
+BENCHMARK_REGISTER_F(CustomPlotBenchmark, GraphViewportUpdate)
+    ->Args({1, 1000})
+    ->Args({1, 100000})
+    ->Args({1, 1000000})
+    ->Args({10, 10000})
+    ->Args({50, 10000})
+    ->Unit(benchmark::kMillisecond);
+
+//! Panning of the viewport along the x-axis, graphs recompute visible points for the new range.
+
+BENCHMARK_DEFINE_F(CustomPlotBenchmark, GraphViewportPan)(benchmark::State& state)
+{
+  const auto point_count = static_cast<double>(state.range(1));
+
+  auto custom_plot = CreateCustomPlot();
+  GraphViewportPlotController controller(custom_plot.get());
+  PopulateModel(static_cast<int>(state.range(0)), static_cast<std::size_t>(state.range(1)));
+  controller.SetItem(m_viewport);
+  RenderFrame(custom_plot.get());
+  ReplotScheduler::GetScheduler(custom_plot.get())->ResetCounters();
+
+  // a quarter of the data is visible, the window moves by 1% of the data on each step
+  const double width = point_count / 4.0;
+  const double step = point_count / 100.0;
+  double lower{0.0};
+  for (auto dummy : state)
+  {
+    lower = lower + width + step > point_count ? 0.0 : lower + step;
+    m_viewport->GetXAxis()->SetRange(lower, lower + width);
+    RenderFrame(custom_plot.get());
+  }
+
+  SetCounters(state, custom_plot.get());
+}
+
+BENCHMARK_REGISTER_F(CustomPlotBenchmark, GraphViewportPan)
+    ->Args({1, 100000})
+    ->Args({1, 1000000})
+    ->Args({10, 100000})
+    ->Unit(benchmark::kMillisecond);
+
+//! Update of values of a single graph served by Data1DPlotController directly.
+
+BENCHMARK_DEFINE_F(CustomPlotBenchmark, Data1DUpdate)(benchmark::State& state)
+{
+  const auto point_count = static_cast<std::size_t>(state.range(1));
+  const std::vector<std::vector<double>> values = {CreateValues(point_count, 0.0),
+                                                   CreateValues(point_count, 1.0)};
+
+  auto custom_plot = CreateCustomPlot();
+  custom_plot->xAxis->setRange(0.0, static_cast<double>(point_count));
+  custom_plot->yAxis->setRange(-1.0, 1.0);
+  Data1DPlotController controller(custom_plot->addGraph());
+
+  auto data_item = m_model.InsertItem<Data1DItem>();
+  data_item->SetAxis<FixedBinAxisItem>(static_cast<int>(point_count), 0.0,
+                                       static_cast<double>(point_count));
+  controller.SetItem(data_item);
+  RenderFrame(custom_plot.get());
+  ReplotScheduler::GetScheduler(custom_plot.get())->ResetCounters();
+
+  std::size_t iteration{0};
+  for (auto dummy : state)
+  {
+    data_item->SetValues(values[iteration % values.size()]);
+    RenderFrame(custom_plot.get());
+    ++iteration;
+  }
+
+  SetCounters(state, custom_plot.get());
+}
+
+BENCHMARK_REGISTER_F(CustomPlotBenchmark, Data1DUpdate)
+    ->Args({1, 1000})
+    ->Args({1, 100000})
+    ->Args({1, 1000000})
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,53 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <mvvm/model/session_item.h>
+
+#include <benchmark/benchmark.h>
+
+#ifdef BUILD_QCUSTOMPLOT
+#include <qcustomplot.h>
+#endif
+
+#include <QApplication>
+#include <QMetaType>
+
+//! Plotting benchmarks measure the time from the model update to the rendered frame. They run
+//! without a display, the offscreen platform is used unless another one is requested explicitly.
+
+int main(int argc, char** argv)
+{
+  if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+  {
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+  }
+
+  QApplication app(argc, argv);
+  Q_UNUSED(app)
+
+  qRegisterMetaType<mvvm::SessionItem*>("mvvm::SessionItem*");
+#ifdef BUILD_QCUSTOMPLOT
+  qRegisterMetaType<QCPRange>("QCPRange");
+#endif
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+}
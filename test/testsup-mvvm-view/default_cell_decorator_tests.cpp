@@ -69,6 +69,27 @@ TEST_F(DefaultCellDecoratorTest, BoolDecorations)
   EXPECT_EQ(decorator.GetText(index), std::string("False"));
 }
 
+TEST_F(DefaultCellDecoratorTest, SharedArrayDecorations)
+{
+  const TestDecorator decorator;
+
+  auto index = AddDataToModel(SharedArray<double>({1.0, 2.0, 3.0}));
+  EXPECT_TRUE(decorator.HasCustomDecoration(index));
+  EXPECT_EQ(decorator.GetText(index), std::string("[3 values]"));
+}
+
+TEST_F(DefaultCellDecoratorTest, NarrowVectorDecorations)
+{
+  const TestDecorator decorator;
+
+  auto index = AddDataToModel(std::vector<uint16>({1, 2}));
+  EXPECT_TRUE(decorator.HasCustomDecoration(index));
+  EXPECT_EQ(decorator.GetText(index), std::string("[2 values]"));
+
+  index = AddDataToModel(std::vector<float32>({1.0f}));
+  EXPECT_EQ(decorator.GetText(index), std::string("[1 values]"));
+}
+
 TEST_F(DefaultCellDecoratorTest, ComboPropertyDecorations)
 {
   const TestDecorator decorator;
@@ -261,6 +261,38 @@ TEST_F(ItemViewComponentProviderTest, SelectItem)
   EXPECT_EQ(mvvm::test::GetSendItem<mvvm::SessionItem*>(spy_selected), nullptr);
 }
 
+//! Selecting many items at once. Selection of adjacent rows is merged into a single range.
+
+TEST_F(ItemViewComponentProviderTest, SetSelectedItems)
+{
+  QTreeView view;
+
+  std::vector<mvvm::SessionItem*> items;
+  for (int index = 0; index < 5; ++index)
+  {
+    items.push_back(m_model.InsertItem<mvvm::PropertyItem>());
+  }
+
+  auto provider = CreateProvider(&view);
+  QSignalSpy spy_selected(provider.get(), &ItemViewComponentProvider::SelectedItemChanged);
+
+  const std::vector<mvvm::SessionItem*> expected({items[1], items[2], items[3]});
+  EXPECT_EQ(provider->GetViewSelection({items[3], items[1], items[2]}).size(), 1);
+
+  provider->SetSelectedItems({items[3], items[1], items[2]});
+  EXPECT_EQ(provider->GetSelectedItems(), expected);
+  EXPECT_EQ(view.selectionModel()->selection().size(), 1);
+  EXPECT_EQ(spy_selected.count(), 1);
+
+  // non-adjacent rows
+  provider->SetSelectedItems({items[0], items[4]});
+  EXPECT_EQ(provider->GetSelectedItems(), std::vector<mvvm::SessionItem*>({items[0], items[4]}));
+  EXPECT_EQ(view.selectionModel()->selection().size(), 2);
+
+  provider->SetSelectedItems({});
+  EXPECT_TRUE(provider->GetSelectedItems().empty());
+}
+
 //! Checking selection when acting through the view.
 
 TEST_F(ItemViewComponentProviderTest, SetCurrentIndex)
@@ -545,6 +577,10 @@ TEST_F(ItemViewComponentProviderTest, TwoProxyModels)
   EXPECT_EQ(provider->GetSelectedItem(), nullptr);
   provider->SetSelectedItem(property2);
   EXPECT_EQ(provider->GetSelectedItem(), property2);
+
+  // batch selection skips filtered out items
+  provider->SetSelectedItems({property0, property1, property2});
+  EXPECT_EQ(provider->GetSelectedItems(), std::vector<mvvm::SessionItem*>({property2}));
 }
 
 //! Setting the new model leads to the change in view's underlying selection model. This test
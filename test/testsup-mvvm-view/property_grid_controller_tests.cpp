@@ -43,6 +43,8 @@
 #include <QTest>
 #include <QWidget>
 
+#include <algorithm>
+
 using namespace mvvm;
 
 /**
@@ -375,6 +377,135 @@ TEST_F(PropertyGridControllerTest, GridChanged)
   EXPECT_EQ(spy_grid_changed.count(), 1);
 }
 
+//! Checking that the grid is regenerated on row insertion and removal, when the user doesn't
+//! listen for row-wise signals.
+TEST_F(PropertyGridControllerTest, GridChangedWithoutRowSignals)
+{
+  ApplicationModel model;
+  auto item0 = model.InsertItem<PropertyItem>();
+
+  AllItemsViewModel view_model(&model);
+
+  PropertyGridController controller(&view_model);
+  auto editor_grid = controller.CreateWidgetGrid();
+  ASSERT_EQ(editor_grid.size(), 1);
+
+  const QSignalSpy spy_grid_changed(&controller, &PropertyGridController::GridChanged);
+
+  model.InsertItem<PropertyItem>();
+  EXPECT_EQ(spy_grid_changed.count(), 1);
+
+  editor_grid = controller.CreateWidgetGrid();
+  ASSERT_EQ(editor_grid.size(), 2);
+
+  model.RemoveItem(item0);
+  EXPECT_EQ(spy_grid_changed.count(), 2);
+}
+
+//! Checking incremental update of the grid on row insertion and removal.
+TEST_F(PropertyGridControllerTest, InsertAndRemoveRows)
+{
+  ApplicationModel model;
+  auto item0 = model.InsertItem<PropertyItem>();
+  item0->SetDisplayName("abc");
+  item0->SetData(42.0);
+
+  AllItemsViewModel view_model(&model);
+
+  PropertyGridController controller(&view_model);
+  auto editor_grid = controller.CreateWidgetGrid();
+  ASSERT_EQ(editor_grid.size(), 1);
+  auto editor0 = dynamic_cast<FloatSpinBox*>(editor_grid[0][1].get());
+  ASSERT_NE(editor0, nullptr);
+
+  QSignalSpy spy_grid_changed(&controller, &PropertyGridController::GridChanged);
+  QSignalSpy spy_inserted(&controller, &PropertyGridController::RowsInserted);
+  QSignalSpy spy_removed(&controller, &PropertyGridController::RowsAboutToBeRemoved);
+
+  // inserting new row in front of existing one
+  auto item1 = model.InsertItem<PropertyItem>(model.GetRootItem(), TagIndex::First());
+  item1->SetDisplayName("def");
+  item1->SetData(43.0);
+
+  EXPECT_EQ(spy_grid_changed.count(), 0);
+  ASSERT_EQ(spy_inserted.count(), 1);
+  auto arguments = spy_inserted.takeFirst();
+  EXPECT_EQ(arguments.at(0).value<int>(), 0);
+  EXPECT_EQ(arguments.at(1).value<int>(), 0);
+
+  auto new_rows = controller.CreateWidgetRows(0, 0);
+  ASSERT_EQ(new_rows.size(), 1);
+  ASSERT_EQ(new_rows[0].size(), 2);
+  auto label1 = dynamic_cast<QLabel*>(new_rows[0][0].get());
+  ASSERT_NE(label1, nullptr);
+  EXPECT_EQ(label1->text(), QString("def"));
+
+  // editor of the shifted row is still looking at its item
+  editor0->setValue(44.0);
+  EXPECT_TRUE(controller.Submit());
+  EXPECT_DOUBLE_EQ(item0->Data<double>(), 44.0);
+  EXPECT_DOUBLE_EQ(item1->Data<double>(), 43.0);
+
+  // removing the first row
+  model.RemoveItem(item1);
+
+  EXPECT_EQ(spy_grid_changed.count(), 0);
+  ASSERT_EQ(spy_removed.count(), 1);
+  arguments = spy_removed.takeFirst();
+  EXPECT_EQ(arguments.at(0).value<int>(), 0);
+  EXPECT_EQ(arguments.at(1).value<int>(), 0);
+
+  item0->SetData(45.0);
+  EXPECT_DOUBLE_EQ(editor0->value().toDouble(), 45.0);
+}
+
+//! Widgets given back to the controller are reused for the new grid.
+TEST_F(PropertyGridControllerTest, RecycleWidgets)
+{
+  ApplicationModel model;
+  auto vector = model.InsertItem<VectorItem>();
+
+  PropertyViewModel view_model(&model);
+  view_model.SetRootSessionItem(vector);
+
+  PropertyGridController controller(&view_model);
+  auto editor_grid = controller.CreateWidgetGrid();
+
+  std::vector<QWidget*> recycled_widgets;
+  for (const auto& widget_row : editor_grid)
+  {
+    for (const auto& widget : widget_row)
+    {
+      recycled_widgets.push_back(widget.get());
+    }
+  }
+  controller.RecycleWidgets(std::move(editor_grid));
+
+  editor_grid = controller.CreateWidgetGrid();
+  ASSERT_EQ(editor_grid.size(), 3);
+  ASSERT_EQ(editor_grid[0].size(), 2);
+
+  // labels and editors of limitless properties are reused
+  for (const auto& widget_row : editor_grid)
+  {
+    for (const auto& widget : widget_row)
+    {
+      EXPECT_NE(std::find(recycled_widgets.begin(), recycled_widgets.end(), widget.get()),
+                recycled_widgets.end());
+    }
+  }
+
+  auto x_label = dynamic_cast<QLabel*>(editor_grid[0][0].get());
+  ASSERT_NE(x_label, nullptr);
+  EXPECT_EQ(x_label->text(), QString("X"));
+
+  auto x_double_spin_box = dynamic_cast<FloatSpinBox*>(editor_grid[0][1].get());
+  ASSERT_NE(x_double_spin_box, nullptr);
+  x_double_spin_box->setValue(42.1);
+  EXPECT_TRUE(controller.Submit());
+  EXPECT_DOUBLE_EQ(vector->X(), 42.1);
+}
+
 //! Validating that internal mapping is working. The data is set via the editor
 TEST_F(PropertyGridControllerTest, SetDataThroughObtainedEditor)
 {
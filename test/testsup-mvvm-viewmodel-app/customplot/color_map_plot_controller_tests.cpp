@@ -0,0 +1,261 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <mvvm/model/application_model.h>
+#include <mvvm/plotting/customplot/color_map_plot_controller.h>
+#include <mvvm/standarditems/axis_items.h>
+#include <mvvm/standarditems/data2d_item.h>
+
+#include <gtest/gtest.h>
+#include <qcustomplot.h>
+
+#include <numeric>
+
+using namespace mvvm;
+
+//! Testing ColorMapPlotController.
+
+class ColorMapPlotControllerTest : public ::testing::Test
+{
+public:
+  //! Inserts into the model data item with values equal to the index of the bin.
+  static Data2DItem* CreateDataItem(ApplicationModel& model, int size_x, int size_y)
+  {
+    auto result = model.InsertItem<Data2DItem>();
+    result->SetAxes(FixedBinAxisItem::Create(size_x, 0.0, size_x),
+                    FixedBinAxisItem::Create(size_y, 0.0, size_y));
+    std::vector<double> values(result->GetXSize() * result->GetYSize());
+    std::iota(values.begin(), values.end(), 0.0);
+    result->SetValues(values);
+    return result;
+  }
+};
+
+//! Initial state.
+
+TEST_F(ColorMapPlotControllerTest, InitialState)
+{
+  // Constructor accept valid QCPColorMap
+  EXPECT_THROW(ColorMapPlotController(nullptr), RuntimeException);
+
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  auto color_map = new QCPColorMap(custom_plot->xAxis, custom_plot->yAxis);
+
+  ColorMapPlotController controller(color_map);
+  EXPECT_EQ(controller.GetItem(), nullptr);
+  EXPECT_EQ(controller.GetDisplayedLevel(), 0);
+}
+
+//! Color map shows all cells of the data, when axes cover the whole data.
+
+TEST_F(ColorMapPlotControllerTest, DataCells)
+{
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  auto color_map = new QCPColorMap(custom_plot->xAxis, custom_plot->yAxis);
+  custom_plot->xAxis->setRange(0.0, 4.0);
+  custom_plot->yAxis->setRange(0.0, 3.0);
+
+  ApplicationModel model;
+  auto data_item = CreateDataItem(model, 4, 3);
+
+  ColorMapPlotController controller(color_map);
+  controller.SetItem(data_item);
+
+  EXPECT_EQ(controller.GetDisplayedLevel(), 0);
+  EXPECT_EQ(color_map->data()->keySize(), 4);
+  EXPECT_EQ(color_map->data()->valueSize(), 3);
+  EXPECT_DOUBLE_EQ(color_map->data()->keyRange().lower, 0.5);
+  EXPECT_DOUBLE_EQ(color_map->data()->keyRange().upper, 3.5);
+  EXPECT_DOUBLE_EQ(color_map->data()->valueRange().lower, 0.5);
+  EXPECT_DOUBLE_EQ(color_map->data()->valueRange().upper, 2.5);
+  EXPECT_EQ(color_map->data()->cell(1, 2), 9.0);
+  EXPECT_EQ(color_map->data()->cell(3, 0), 3.0);
+  EXPECT_DOUBLE_EQ(color_map->dataRange().lower, 0.0);
+  EXPECT_DOUBLE_EQ(color_map->dataRange().upper, 11.0);
+}
+
+//! Only cells of the visible region are passed to the color map.
+
+TEST_F(ColorMapPlotControllerTest, VisibleRegion)
+{
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  auto color_map = new QCPColorMap(custom_plot->xAxis, custom_plot->yAxis);
+  custom_plot->xAxis->setRange(0.0, 4.0);
+  custom_plot->yAxis->setRange(0.0, 3.0);
+
+  ApplicationModel model;
+  auto data_item = CreateDataItem(model, 4, 3);
+
+  ColorMapPlotController controller(color_map);
+  controller.SetItem(data_item);
+
+  // zooming to bins 1 and 2 along x, and bin 1 along y
+  custom_plot->xAxis->setRange(1.2, 2.5);
+  custom_plot->yAxis->setRange(1.1, 1.9);
+  EXPECT_EQ(color_map->data()->keySize(), 2);
+  EXPECT_EQ(color_map->data()->valueSize(), 1);
+  EXPECT_DOUBLE_EQ(color_map->data()->keyRange().lower, 1.5);
+  EXPECT_DOUBLE_EQ(color_map->data()->keyRange().upper, 2.5);
+  EXPECT_EQ(color_map->data()->cell(0, 0), 5.0);
+  EXPECT_EQ(color_map->data()->cell(1, 0), 6.0);
+}
+
+//! Data larger than the axis rectangle is shown using coarse level of the pyramid.
+
+TEST_F(ColorMapPlotControllerTest, CoarseLevel)
+{
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  auto color_map = new QCPColorMap(custom_plot->xAxis, custom_plot->yAxis);
+  custom_plot->xAxis->setRange(0.0, 1024.0);
+  custom_plot->yAxis->setRange(0.0, 1024.0);
+  custom_plot->resize(200, 200);
+
+  ApplicationModel model;
+  auto data_item = CreateDataItem(model, 1024, 1024);
+
+  ColorMapPlotController controller(color_map);
+  controller.SetItem(data_item);
+
+  // layout of the plot triggers the choice of the level according to the axis rectangle size
+  custom_plot->replot();
+  const auto width = static_cast<int>(custom_plot->axisRect()->width());
+  ASSERT_GT(width, 0);
+  EXPECT_GT(controller.GetDisplayedLevel(), 0);
+  EXPECT_LT(color_map->data()->keySize(), 1024);
+  EXPECT_GE(color_map->data()->keySize(), width);
+
+  // zooming in to the region smaller than the number of pixels
+  custom_plot->xAxis->setRange(0.0, 10.0);
+  custom_plot->yAxis->setRange(0.0, 10.0);
+  EXPECT_EQ(controller.GetDisplayedLevel(), 0);
+  EXPECT_EQ(color_map->data()->keySize(), 10);
+  EXPECT_EQ(color_map->data()->cell(3, 2), 2 * 1024 + 3);
+}
+
+//! Region update changes only cells of the region.
+
+TEST_F(ColorMapPlotControllerTest, RegionUpdate)
+{
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  auto color_map = new QCPColorMap(custom_plot->xAxis, custom_plot->yAxis);
+  custom_plot->xAxis->setRange(0.0, 4.0);
+  custom_plot->yAxis->setRange(0.0, 3.0);
+
+  ApplicationModel model;
+  auto data_item = CreateDataItem(model, 4, 3);
+
+  ColorMapPlotController controller(color_map);
+  controller.SetItem(data_item);
+
+  data_item->SetValuesInRegion(DataRegion{1, 1, 3, 2}, {42.0, 43.0});
+  EXPECT_EQ(color_map->data()->cell(1, 1), 42.0);
+  EXPECT_EQ(color_map->data()->cell(2, 1), 43.0);
+  EXPECT_EQ(color_map->data()->cell(0, 1), 4.0);
+  EXPECT_EQ(color_map->data()->cell(3, 2), 11.0);
+  EXPECT_DOUBLE_EQ(color_map->dataRange().upper, 43.0);
+
+  // the buffer isn't shared with the controller and is modified in place
+  const auto* buffer = data_item->GetValuesArray().data();
+  data_item->SetValuesInRegion(DataRegion{0, 0, 1, 1}, {-1.0});
+  EXPECT_EQ(data_item->GetValuesArray().data(), buffer);
+  EXPECT_EQ(color_map->data()->cell(0, 0), -1.0);
+  EXPECT_DOUBLE_EQ(color_map->dataRange().lower, -1.0);
+}
+
+//! Changes of axes rebuild the color map.
+
+TEST_F(ColorMapPlotControllerTest, AxisChange)
+{
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  auto color_map = new QCPColorMap(custom_plot->xAxis, custom_plot->yAxis);
+  custom_plot->xAxis->setRange(0.0, 8.0);
+  custom_plot->yAxis->setRange(0.0, 3.0);
+
+  ApplicationModel model;
+  auto data_item = CreateDataItem(model, 4, 3);
+
+  ColorMapPlotController controller(color_map);
+  controller.SetItem(data_item);
+  EXPECT_DOUBLE_EQ(color_map->data()->keyRange().upper, 3.5);
+
+  // same number of bins, twice as wide
+  dynamic_cast<FixedBinAxisItem*>(data_item->GetXAxis())->SetParameters(4, 0.0, 8.0);
+  EXPECT_EQ(color_map->data()->keySize(), 4);
+  EXPECT_DOUBLE_EQ(color_map->data()->keyRange().lower, 1.0);
+  EXPECT_DOUBLE_EQ(color_map->data()->keyRange().upper, 7.0);
+  EXPECT_EQ(color_map->data()->cell(1, 2), 9.0);
+
+  // values don't match axes, the color map is empty until new values are set
+  dynamic_cast<FixedBinAxisItem*>(data_item->GetXAxis())->SetParameters(2, 0.0, 8.0);
+  EXPECT_EQ(color_map->data()->keySize(), 0);
+
+  data_item->SetValues(std::vector<double>(6, 1.0));
+  EXPECT_EQ(color_map->data()->keySize(), 2);
+  EXPECT_EQ(color_map->data()->cell(1, 2), 1.0);
+}
+
+//! Cells of pointwise axes are centered at axis points.
+
+TEST_F(ColorMapPlotControllerTest, PointwiseAxes)
+{
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  auto color_map = new QCPColorMap(custom_plot->xAxis, custom_plot->yAxis);
+  custom_plot->xAxis->setRange(0.0, 10.0);
+  custom_plot->yAxis->setRange(0.0, 10.0);
+
+  ApplicationModel model;
+  auto data_item = model.InsertItem<Data2DItem>();
+  data_item->SetAxes(PointwiseAxisItem::Create({1.0, 3.0, 5.0}),
+                     PointwiseAxisItem::Create({2.0, 4.0}));
+  data_item->SetValues(std::vector<double>({0.0, 1.0, 2.0, 3.0, 4.0, 5.0}));
+
+  ColorMapPlotController controller(color_map);
+  controller.SetItem(data_item);
+
+  EXPECT_EQ(color_map->data()->keySize(), 3);
+  EXPECT_EQ(color_map->data()->valueSize(), 2);
+  EXPECT_DOUBLE_EQ(color_map->data()->keyRange().lower, 1.0);
+  EXPECT_DOUBLE_EQ(color_map->data()->keyRange().upper, 5.0);
+  EXPECT_DOUBLE_EQ(color_map->data()->valueRange().lower, 2.0);
+  EXPECT_DOUBLE_EQ(color_map->data()->valueRange().upper, 4.0);
+
+  // zooming to the first bin along x, which spans [0, 2]
+  custom_plot->xAxis->setRange(0.0, 1.9);
+  EXPECT_EQ(color_map->data()->keySize(), 1);
+  EXPECT_EQ(color_map->data()->cell(0, 1), 3.0);
+}
+
+//! Color map is cleared when the controller is detached from the item.
+
+TEST_F(ColorMapPlotControllerTest, SetItemToNullptr)
+{
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  auto color_map = new QCPColorMap(custom_plot->xAxis, custom_plot->yAxis);
+
+  ApplicationModel model;
+  auto data_item = CreateDataItem(model, 4, 3);
+
+  ColorMapPlotController controller(color_map);
+  controller.SetItem(data_item);
+  EXPECT_GT(color_map->data()->keySize(), 0);
+
+  controller.SetItem(nullptr);
+  EXPECT_EQ(color_map->data()->keySize(), 0);
+}
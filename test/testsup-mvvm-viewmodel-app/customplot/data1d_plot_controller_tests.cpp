@@ -28,6 +28,8 @@
 #include <gtest/gtest.h>
 #include <qcustomplot.h>
 
+#include <algorithm>
+
 using namespace mvvm;
 
 //! Testing Data1DPlotController.
@@ -182,3 +184,45 @@ TEST_F(Data1DPlotControllerTest, TwoDataItems)
   EXPECT_EQ(data_item2->GetBinCenters(), testutils::GetBinCenters(graph));
   EXPECT_EQ(data_item2->GetValues(), testutils::GetValues(graph));
 }
+
+//! Testing level-of-detail decimation of large data.
+TEST_F(Data1DPlotControllerTest, DecimationOfLargeData)
+{
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  auto graph = custom_plot->addGraph();
+
+  const int point_count{100000};
+  ApplicationModel model;
+  auto data_item = model.InsertItem<Data1DItem>();
+  data_item->SetAxis<FixedBinAxisItem>(point_count, 0.0, static_cast<double>(point_count));
+  std::vector<double> values(point_count, 0.0);
+  values[12345] = 42.0;
+  data_item->SetValues(values);
+
+  custom_plot->xAxis->setRange(0.0, static_cast<double>(point_count));
+
+  Data1DPlotController controller(graph);
+  controller.SetItem(data_item);
+
+  // graph contains per-pixel envelope, the peak is preserved
+  const auto max_points = 2 * static_cast<std::size_t>(graph->keyAxis()->axisRect()->width()) + 4;
+  auto graph_values = testutils::GetValues(graph);
+  EXPECT_LE(graph_values.size(), std::max<std::size_t>(max_points, 4004));
+  EXPECT_NE(std::find(graph_values.begin(), graph_values.end(), 42.0), graph_values.end());
+
+  // zooming into the small region shows original points
+  custom_plot->xAxis->setRange(12340.0, 12350.0);
+  auto bin_centers = testutils::GetBinCenters(graph);
+  ASSERT_EQ(bin_centers.size(), 12);
+  EXPECT_EQ(bin_centers.front(), 12339.5);
+  EXPECT_EQ(bin_centers.back(), 12350.5);
+  EXPECT_EQ(testutils::GetValues(graph)[6], 42.0);
+
+  // error bars follow visible points
+  std::vector<double> errors(point_count, 0.1);
+  errors[12345] = 0.5;
+  data_item->SetErrors(errors);
+  auto graph_errors = testutils::GetErrors(graph);
+  ASSERT_EQ(graph_errors.size(), 12);
+  EXPECT_EQ(graph_errors[6], 0.5);
+}
@@ -0,0 +1,143 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/plotting/customplot/graph_pool.h"
+
+#include <mvvm/core/mvvm_exceptions.h>
+
+#include <gtest/gtest.h>
+#include <qcustomplot.h>
+
+using namespace mvvm;
+
+//! Testing GraphPool.
+
+class GraphPoolTest : public ::testing::Test
+{
+};
+
+TEST_F(GraphPoolTest, InitialState)
+{
+  EXPECT_THROW(GraphPool(nullptr), RuntimeException);
+
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  const GraphPool pool(custom_plot.get());
+  EXPECT_EQ(pool.GetIdleCount(), 0);
+  EXPECT_EQ(pool.GetCapacity(), GraphPool::kUnlimitedCapacity);
+  EXPECT_EQ(custom_plot->graphCount(), 0);
+}
+
+TEST_F(GraphPoolTest, AcquireAndRelease)
+{
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  GraphPool pool(custom_plot.get());
+
+  auto graph = pool.Acquire();
+  ASSERT_NE(graph, nullptr);
+  EXPECT_EQ(custom_plot->graphCount(), 1);
+  EXPECT_EQ(custom_plot->legend->itemCount(), 1);
+
+  graph->setData(QVector<double>{1.0, 2.0}, QVector<double>{3.0, 4.0});
+  graph->setName("abc");
+
+  // released graph is cleared and hidden, but stays on the plot
+  pool.Release(graph);
+  EXPECT_EQ(pool.GetIdleCount(), 1);
+  EXPECT_EQ(custom_plot->graphCount(), 1);
+  EXPECT_FALSE(graph->visible());
+  EXPECT_TRUE(graph->data()->isEmpty());
+  EXPECT_TRUE(graph->name().isEmpty());
+  EXPECT_EQ(custom_plot->legend->itemCount(), 0);
+
+  // graph is reused
+  EXPECT_EQ(pool.Acquire(), graph);
+  EXPECT_EQ(pool.GetIdleCount(), 0);
+  EXPECT_TRUE(graph->visible());
+  EXPECT_EQ(custom_plot->legend->itemCount(), 1);
+
+  // new graph is created when no idle graphs left
+  auto graph2 = pool.Acquire();
+  EXPECT_NE(graph2, graph);
+  EXPECT_EQ(custom_plot->graphCount(), 2);
+}
+
+TEST_F(GraphPoolTest, Clear)
+{
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  auto pool = std::make_unique<GraphPool>(custom_plot.get());
+
+  auto graph0 = pool->Acquire();
+  auto graph1 = pool->Acquire();
+  pool->Acquire();
+  pool->Release(graph0);
+  pool->Release(graph1);
+  EXPECT_EQ(custom_plot->graphCount(), 3);
+
+  pool->Clear();
+  EXPECT_EQ(pool->GetIdleCount(), 0);
+  EXPECT_EQ(custom_plot->graphCount(), 1);
+
+  // idle graphs are removed on pool destruction
+  pool->Release(custom_plot->graph(0));
+  pool.reset();
+  EXPECT_EQ(custom_plot->graphCount(), 0);
+}
+
+//! Graphs released above the capacity are removed from the plot.
+
+TEST_F(GraphPoolTest, Capacity)
+{
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  GraphPool pool(custom_plot.get(), 1);
+
+  auto graph0 = pool.Acquire();
+  auto graph1 = pool.Acquire();
+  pool.Acquire();
+  pool.Release(graph0);
+  pool.Release(graph1);
+  EXPECT_EQ(pool.GetIdleCount(), 1);
+  EXPECT_EQ(custom_plot->graphCount(), 2);
+
+  pool.SetCapacity(0);
+  EXPECT_EQ(pool.GetIdleCount(), 0);
+  EXPECT_EQ(custom_plot->graphCount(), 1);
+
+  pool.Release(custom_plot->graph(0));
+  EXPECT_EQ(custom_plot->graphCount(), 0);
+}
+
+//! Reused graph is drawn on top of other graphs and goes to the end of the legend.
+
+TEST_F(GraphPoolTest, ReusedGraphOrder)
+{
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  GraphPool pool(custom_plot.get());
+
+  auto graph0 = pool.Acquire();
+  auto graph1 = pool.Acquire();
+  pool.Release(graph0);
+
+  EXPECT_EQ(pool.Acquire(), graph0);
+  auto layer = custom_plot->currentLayer();
+  EXPECT_EQ(graph0->layer(), layer);
+  EXPECT_GT(layer->children().indexOf(graph0), layer->children().indexOf(graph1));
+  ASSERT_EQ(custom_plot->legend->itemCount(), 2);
+  EXPECT_EQ(custom_plot->legend->itemWithPlottable(graph0), custom_plot->legend->item(1));
+}
@@ -32,6 +32,8 @@
 #include <gtest/gtest.h>
 #include <qcustomplot.h>
 
+#include <algorithm>
+
 using namespace mvvm;
 
 //! Testing GraphViewportPlotController.
@@ -391,3 +393,59 @@ TEST_F(GraphViewportPlotControllerTest, addGraphUndoRedoMacro)
   EXPECT_EQ(testutils::GetBinCenters(custom_plot->graph()), expected_centers);
   EXPECT_EQ(testutils::GetValues(custom_plot->graph()), expected_values);
 }
+
+//! Removing many graphs and undoing the removal reuses QCPGraph objects, when the graph pool is
+//! enabled.
+TEST_F(GraphViewportPlotControllerTest, RemoveGraphsUndo)
+{
+  const int graph_count{10};
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  GraphViewportPlotController controller(custom_plot.get());
+  controller.SetGraphPoolCapacity(graph_count);
+
+  ApplicationModel model;
+  auto viewport_item = model.InsertItem<GraphViewportItem>();
+  controller.SetItem(viewport_item);
+
+  std::vector<GraphItem*> graph_items;
+  for (int index = 0; index < graph_count; ++index)
+  {
+    graph_items.push_back(model.InsertItem<GraphItem>(viewport_item));
+  }
+  EXPECT_EQ(custom_plot->graphCount(), graph_count);
+  std::vector<QCPGraph*> graphs;
+  for (int index = 0; index < graph_count; ++index)
+  {
+    graphs.push_back(custom_plot->graph(index));
+  }
+
+  model.SetUndoEnabled(true);
+  model.GetCommandStack()->BeginMacro("remove");
+  for (auto graph_item : graph_items)
+  {
+    model.RemoveItem(graph_item);
+  }
+  model.GetCommandStack()->EndMacro();
+  EXPECT_EQ(custom_plot->graphCount(), graph_count);
+  EXPECT_TRUE(std::none_of(graphs.begin(), graphs.end(),
+                           [](auto graph) { return graph->visible(); }));
+
+  // undo inserts graph items back, no new graphs are created
+  model.GetCommandStack()->Undo();
+  EXPECT_EQ(viewport_item->GetGraphItems().size(), graph_count);
+  EXPECT_EQ(custom_plot->graphCount(), graph_count);
+  for (int index = 0; index < graph_count; ++index)
+  {
+    EXPECT_EQ(custom_plot->graph(index), graphs[index]);
+    EXPECT_TRUE(custom_plot->graph(index)->visible());
+  }
+
+  // redo removes graph items again, graphs go back to the pool
+  model.GetCommandStack()->Redo();
+  EXPECT_EQ(viewport_item->GetGraphItems().size(), 0);
+  EXPECT_EQ(custom_plot->graphCount(), graph_count);
+
+  // reducing the capacity removes idle graphs
+  controller.SetGraphPoolCapacity(0);
+  EXPECT_EQ(custom_plot->graphCount(), 0);
+}
@@ -0,0 +1,149 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/plotting/customplot/replot_scheduler.h"
+
+#include <mvvm/model/application_model.h>
+#include <mvvm/plotting/customplot/data1d_plot_controller.h>
+#include <mvvm/standarditems/axis_items.h>
+#include <mvvm/standarditems/data1d_item.h>
+
+#include <gtest/gtest.h>
+#include <qcustomplot.h>
+
+#include <QSignalSpy>
+
+using namespace mvvm;
+
+//! Testing ReplotScheduler.
+
+class ReplotSchedulerTest : public ::testing::Test
+{
+};
+
+TEST_F(ReplotSchedulerTest, InitialState)
+{
+  EXPECT_THROW(ReplotScheduler(nullptr), RuntimeException);
+
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  auto scheduler = ReplotScheduler::GetScheduler(custom_plot.get());
+  ASSERT_NE(scheduler, nullptr);
+  EXPECT_EQ(scheduler->parent(), custom_plot.get());
+  EXPECT_EQ(ReplotScheduler::GetScheduler(custom_plot.get()), scheduler);
+
+  EXPECT_EQ(scheduler->GetMaxFrameRate(), ReplotScheduler::kDefaultMaxFrameRate);
+  EXPECT_FALSE(scheduler->IsReplotPending());
+  EXPECT_EQ(scheduler->GetRequestedReplotCount(), 0);
+  EXPECT_EQ(scheduler->GetPerformedReplotCount(), 0);
+  EXPECT_THROW(scheduler->SetMaxFrameRate(-1), RuntimeException);
+}
+
+//! Several requests result in a single replot on the next frame.
+
+TEST_F(ReplotSchedulerTest, ScheduleReplot)
+{
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  auto scheduler = ReplotScheduler::GetScheduler(custom_plot.get());
+  QSignalSpy spy_replot(custom_plot.get(), &QCustomPlot::afterReplot);
+
+  for (int i = 0; i < 50; ++i)
+  {
+    scheduler->ScheduleReplot();
+  }
+  EXPECT_TRUE(scheduler->IsReplotPending());
+  EXPECT_EQ(spy_replot.count(), 0);
+
+  EXPECT_TRUE(spy_replot.wait(1000));
+  EXPECT_FALSE(scheduler->IsReplotPending());
+  EXPECT_EQ(spy_replot.count(), 1);
+  EXPECT_EQ(scheduler->GetRequestedReplotCount(), 50);
+  EXPECT_EQ(scheduler->GetPerformedReplotCount(), 1);
+
+  scheduler->ResetCounters();
+  EXPECT_EQ(scheduler->GetRequestedReplotCount(), 0);
+  EXPECT_EQ(scheduler->GetPerformedReplotCount(), 0);
+}
+
+//! Pending replot can be performed immediately.
+
+TEST_F(ReplotSchedulerTest, Flush)
+{
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  auto scheduler = ReplotScheduler::GetScheduler(custom_plot.get());
+  QSignalSpy spy_replot(custom_plot.get(), &QCustomPlot::afterReplot);
+
+  // nothing to flush
+  scheduler->Flush();
+  EXPECT_EQ(spy_replot.count(), 0);
+
+  scheduler->ScheduleReplot();
+  scheduler->Flush();
+  EXPECT_FALSE(scheduler->IsReplotPending());
+  EXPECT_EQ(spy_replot.count(), 1);
+  EXPECT_EQ(scheduler->GetPerformedReplotCount(), 1);
+}
+
+//! Replot performed by somebody else satisfies pending requests.
+
+TEST_F(ReplotSchedulerTest, ExternalReplot)
+{
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  auto scheduler = ReplotScheduler::GetScheduler(custom_plot.get());
+
+  scheduler->ScheduleReplot();
+  EXPECT_TRUE(scheduler->IsReplotPending());
+
+  custom_plot->replot();
+  EXPECT_FALSE(scheduler->IsReplotPending());
+  EXPECT_EQ(scheduler->GetPerformedReplotCount(), 0);
+}
+
+//! Updates of many data items result in a single replot.
+
+TEST_F(ReplotSchedulerTest, ManyDataItems)
+{
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  auto scheduler = ReplotScheduler::GetScheduler(custom_plot.get());
+  QSignalSpy spy_replot(custom_plot.get(), &QCustomPlot::afterReplot);
+
+  const int item_count{50};
+  ApplicationModel model;
+  std::vector<Data1DItem*> items;
+  std::vector<std::unique_ptr<Data1DPlotController>> controllers;
+  for (int i = 0; i < item_count; ++i)
+  {
+    auto item = model.InsertItem<Data1DItem>();
+    item->SetAxis<FixedBinAxisItem>(3, 0.0, 3.0);
+    items.push_back(item);
+    controllers.push_back(std::make_unique<Data1DPlotController>(custom_plot->addGraph()));
+    controllers.back()->SetItem(item);
+  }
+  scheduler->Flush();
+  scheduler->ResetCounters();
+
+  for (auto item : items)
+  {
+    item->SetValues({1.0, 2.0, 3.0});
+  }
+
+  EXPECT_TRUE(spy_replot.wait(1000));
+  EXPECT_EQ(scheduler->GetRequestedReplotCount(), item_count);
+  EXPECT_EQ(scheduler->GetPerformedReplotCount(), 1);
+}
@@ -0,0 +1,149 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/plotting/customplot/stream_data1d_plot_controller.h"
+
+#include "custom_plot_test_utils.h"
+
+#include <mvvm/model/application_model.h>
+#include <mvvm/standarditems/stream_data1d_item.h>
+
+#include <gtest/gtest.h>
+#include <qcustomplot.h>
+
+using namespace mvvm;
+
+//! Testing StreamData1DPlotController.
+
+class StreamData1DPlotControllerTest : public ::testing::Test
+{
+};
+
+//! Initial state.
+
+TEST_F(StreamData1DPlotControllerTest, InitialState)
+{
+  EXPECT_THROW(StreamData1DPlotController(nullptr), RuntimeException);
+
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  auto graph = custom_plot->addGraph();
+
+  StreamData1DPlotController controller(graph);
+  EXPECT_EQ(controller.GetItem(), nullptr);
+  EXPECT_EQ(std::vector<double>(), testutils::GetBinCenters(graph));
+  EXPECT_EQ(std::vector<double>(), testutils::GetValues(graph));
+}
+
+//! Graph gets samples which were in the buffer before the controller setup.
+
+TEST_F(StreamData1DPlotControllerTest, ExistingSamples)
+{
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  auto graph = custom_plot->addGraph();
+
+  ApplicationModel model;
+  auto data_item = model.InsertItem<StreamData1DItem>();
+  data_item->AppendPoints({1.0, 2.0}, {10.0, 20.0});
+
+  StreamData1DPlotController controller(graph);
+  controller.SetItem(data_item);
+
+  EXPECT_EQ(testutils::GetBinCenters(graph), std::vector<double>({1.0, 2.0}));
+  EXPECT_EQ(testutils::GetValues(graph), std::vector<double>({10.0, 20.0}));
+
+  // removing the item from the controller clears the graph
+  controller.SetItem(nullptr);
+  EXPECT_EQ(std::vector<double>(), testutils::GetBinCenters(graph));
+}
+
+//! Appending samples to the unlimited buffer.
+
+TEST_F(StreamData1DPlotControllerTest, AppendPoints)
+{
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  auto graph = custom_plot->addGraph();
+
+  ApplicationModel model;
+  auto data_item = model.InsertItem<StreamData1DItem>();
+
+  StreamData1DPlotController controller(graph);
+  controller.SetItem(data_item);
+
+  data_item->AppendPoint(1.0, 10.0);
+  EXPECT_EQ(testutils::GetBinCenters(graph), std::vector<double>({1.0}));
+  EXPECT_EQ(testutils::GetValues(graph), std::vector<double>({10.0}));
+
+  data_item->AppendPoints({2.0, 3.0}, {20.0, 30.0});
+  EXPECT_EQ(testutils::GetBinCenters(graph), std::vector<double>({1.0, 2.0, 3.0}));
+  EXPECT_EQ(testutils::GetValues(graph), std::vector<double>({10.0, 20.0, 30.0}));
+
+  data_item->ClearPoints();
+  EXPECT_EQ(std::vector<double>(), testutils::GetBinCenters(graph));
+  EXPECT_EQ(std::vector<double>(), testutils::GetValues(graph));
+}
+
+//! Appending samples to the ring buffer, the oldest samples should disappear from the graph.
+
+TEST_F(StreamData1DPlotControllerTest, RingBuffer)
+{
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  auto graph = custom_plot->addGraph();
+
+  ApplicationModel model;
+  auto data_item = model.InsertItem<StreamData1DItem>();
+  data_item->SetCapacity(3);
+
+  StreamData1DPlotController controller(graph);
+  controller.SetItem(data_item);
+
+  data_item->AppendPoints({1.0, 2.0, 3.0}, {10.0, 20.0, 30.0});
+  data_item->AppendPoint(4.0, 40.0);
+  EXPECT_EQ(testutils::GetBinCenters(graph), std::vector<double>({2.0, 3.0, 4.0}));
+  EXPECT_EQ(testutils::GetValues(graph), std::vector<double>({20.0, 30.0, 40.0}));
+
+  // more samples than the capacity in one go
+  data_item->AppendPoints({5.0, 6.0, 7.0, 8.0}, {50.0, 60.0, 70.0, 80.0});
+  EXPECT_EQ(testutils::GetBinCenters(graph), std::vector<double>({6.0, 7.0, 8.0}));
+  EXPECT_EQ(testutils::GetValues(graph), std::vector<double>({60.0, 70.0, 80.0}));
+
+  data_item->SetCapacity(2);
+  EXPECT_EQ(testutils::GetBinCenters(graph), std::vector<double>({7.0, 8.0}));
+  EXPECT_EQ(testutils::GetValues(graph), std::vector<double>({70.0, 80.0}));
+}
+
+//! Samples with decreasing x-coordinate lead to the full update, the graph keeps them sorted.
+
+TEST_F(StreamData1DPlotControllerTest, UnsortedSamples)
+{
+  auto custom_plot = std::make_unique<QCustomPlot>();
+  auto graph = custom_plot->addGraph();
+
+  ApplicationModel model;
+  auto data_item = model.InsertItem<StreamData1DItem>();
+  data_item->SetCapacity(3);
+
+  StreamData1DPlotController controller(graph);
+  controller.SetItem(data_item);
+
+  data_item->AppendPoints({3.0, 2.0}, {30.0, 20.0});
+  data_item->AppendPoints({1.0, 0.0}, {10.0, 0.0});
+  EXPECT_EQ(testutils::GetBinCenters(graph), std::vector<double>({0.0, 1.0, 2.0}));
+  EXPECT_EQ(testutils::GetValues(graph), std::vector<double>({0.0, 10.0, 20.0}));
+}
@@ -0,0 +1,254 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/plotting/charts/line_series_decimator.h"
+
+#include <mvvm/model/application_model.h>
+#include <mvvm/plotting/charts/line_series_data_controller.h>
+#include <mvvm/plotting/charts/qt_charts.h>
+#include <mvvm/standarditems/line_series_data_item.h>
+
+#include <gtest/gtest.h>
+
+#include <QSignalSpy>
+#include <QTest>
+
+#include <algorithm>
+#include <memory>
+
+using namespace mvvm;
+
+class LineSeriesDecimatorTest : public ::testing::Test
+{
+public:
+  //! Returns waveform of given size with a single peak.
+  static std::vector<std::pair<double, double>> CreateWaveform(int point_count, int peak_index)
+  {
+    std::vector<std::pair<double, double>> result;
+    for (int index = 0; index < point_count; ++index)
+    {
+      result.emplace_back(static_cast<double>(index), index == peak_index ? 42.0 : 0.0);
+    }
+    return result;
+  }
+
+  //! Returns x and y coordinates of the waveform as separate vectors.
+  static std::pair<std::vector<double>, std::vector<double>> CreateData(int point_count,
+                                                                        int peak_index)
+  {
+    std::vector<double> x_values;
+    std::vector<double> y_values;
+    for (auto [x, y] : CreateWaveform(point_count, peak_index))
+    {
+      x_values.push_back(x);
+      y_values.push_back(y);
+    }
+    return {x_values, y_values};
+  }
+};
+
+//! Decimated points are delivered from the background thread via the event loop.
+
+TEST_F(LineSeriesDecimatorTest, RequestPoints)
+{
+  std::vector<DecimatedData> results;
+  LineSeriesDecimator decimator([&results](const DecimatedData& data) { results.push_back(data); });
+  EXPECT_FALSE(decimator.IsPending());
+
+  auto [x_values, y_values] = CreateData(10000, 1234);
+  decimator.SetData(std::move(x_values), std::move(y_values));
+  decimator.RequestPoints(0.0, 10000.0, 10);
+  EXPECT_TRUE(decimator.IsPending());
+
+  EXPECT_TRUE(QTest::qWaitFor([&decimator]() { return !decimator.IsPending(); }));
+
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_LE(results.at(0).x.size(), 24);
+  auto on_peak = [](double value) { return value == 42.0; };
+  EXPECT_TRUE(std::any_of(results.at(0).y.begin(), results.at(0).y.end(), on_peak));
+}
+
+//! Only the result of the latest request is delivered.
+
+TEST_F(LineSeriesDecimatorTest, OutdatedRequests)
+{
+  std::vector<DecimatedData> results;
+  LineSeriesDecimator decimator([&results](const DecimatedData& data) { results.push_back(data); });
+
+  auto [x_values, y_values] = CreateData(10000, 1234);
+  decimator.SetData(std::move(x_values), std::move(y_values));
+  decimator.RequestPoints(0.0, 10000.0, 10);
+  decimator.RequestPoints(1230.0, 1235.0, 10);
+
+  EXPECT_TRUE(QTest::qWaitFor([&decimator]() { return !decimator.IsPending(); }));
+
+  // original points [1229, 1236] of the second request
+  ASSERT_EQ(results.size(), 1);
+  ASSERT_EQ(results.at(0).x.size(), 8);
+  EXPECT_EQ(results.at(0).x.at(0), 1229.0);
+  EXPECT_EQ(results.at(0).y.at(5), 42.0);
+}
+
+//! Decimators share worker threads, each of them receives its own result. Destroying the
+//! decimator with the pending request is safe.
+
+TEST_F(LineSeriesDecimatorTest, SharedWorkerThreads)
+{
+  const int decimator_count = 16;
+  std::vector<int> result_sizes(decimator_count, 0);
+  std::vector<std::unique_ptr<LineSeriesDecimator>> decimators;
+  for (int index = 0; index < decimator_count; ++index)
+  {
+    auto on_result = [&result_sizes, index](const DecimatedData& data)
+    { result_sizes[index] = static_cast<int>(data.x.size()); };
+    decimators.push_back(std::make_unique<LineSeriesDecimator>(on_result));
+
+    auto [x_values, y_values] = CreateData(10000, 1234);
+    decimators.back()->SetData(std::move(x_values), std::move(y_values));
+    decimators.back()->RequestPoints(1230.0, 1231.0 + index, 100);
+  }
+
+  // the last decimator is destroyed before its result is delivered
+  decimators.pop_back();
+
+  auto is_delivered = [&decimators]()
+  {
+    return std::none_of(decimators.begin(), decimators.end(),
+                        [](const auto& decimator) { return decimator->IsPending(); });
+  };
+  EXPECT_TRUE(QTest::qWaitFor(is_delivered));
+
+  // original points [1229, 1232 + index] are delivered
+  for (int index = 0; index < decimator_count - 1; ++index)
+  {
+    EXPECT_EQ(result_sizes[index], index + 4);
+  }
+  EXPECT_EQ(result_sizes.back(), 0);
+}
+
+//! Controller decimates large series in the background and replaces points at once.
+
+TEST_F(LineSeriesDecimatorTest, ControllerBackgroundDecimation)
+{
+  ApplicationModel model;
+  auto data_item = model.InsertItem<LineSeriesDataItem>();
+  data_item->SetWaveform(CreateWaveform(1000, 123));
+
+  QLineSeries line_series;
+  LineSeriesDataController controller(&line_series);
+  controller.SetBackgroundThreshold(1);
+  controller.SetItem(data_item);
+  EXPECT_EQ(line_series.count(), 1000);
+
+  QSignalSpy spy_points_replaced(&line_series, &QLineSeries::pointsReplaced);
+
+  controller.SetVisibleRange(1120.0, 1125.0, 10);
+  controller.SetXOffset(1000.0);
+  EXPECT_TRUE(controller.IsDecimated());
+  EXPECT_TRUE(controller.IsDecimationPending());
+
+  EXPECT_TRUE(QTest::qWaitFor([&controller]() { return !controller.IsDecimationPending(); }));
+
+  // original points [119, 126] are shown, shifted by the offset
+  EXPECT_EQ(spy_points_replaced.count(), 1);
+  ASSERT_EQ(line_series.count(), 8);
+  EXPECT_EQ(line_series.points().at(0).x(), 1119.0);
+  EXPECT_EQ(line_series.points().at(4).y(), 42.0);
+
+  // switching background decimation off computes points immediately
+  controller.SetBackgroundThreshold(0);
+  EXPECT_FALSE(controller.IsDecimationPending());
+  EXPECT_EQ(line_series.count(), 8);
+}
+
+//! Controller in decimated mode rebuilds the pyramid once for points inserted one by one.
+
+TEST_F(LineSeriesDecimatorTest, ControllerInsertPointsWhenDecimated)
+{
+  ApplicationModel model;
+  auto data_item = model.InsertItem<LineSeriesDataItem>();
+  data_item->SetWaveform(CreateWaveform(1000, 123));
+
+  QLineSeries line_series;
+  LineSeriesDataController controller(&line_series);
+  controller.SetBackgroundThreshold(0);
+  controller.SetItem(data_item);
+  controller.SetVisibleRange(1000.0, 1010.0, 10);
+  EXPECT_TRUE(controller.IsDecimated());
+
+  QSignalSpy spy_points_replaced(&line_series, &QLineSeries::pointsReplaced);
+
+  for (int index = 1000; index < 1010; ++index)
+  {
+    data_item->InsertPoint(index, {static_cast<double>(index), 1.0});
+  }
+  EXPECT_TRUE(controller.IsDecimationPending());
+  EXPECT_EQ(spy_points_replaced.count(), 0);
+
+  EXPECT_TRUE(QTest::qWaitFor([&controller]() { return !controller.IsDecimationPending(); }));
+
+  // new points are shown after a single update
+  EXPECT_EQ(spy_points_replaced.count(), 1);
+  auto qt_points = line_series.points();
+  ASSERT_FALSE(qt_points.empty());
+  EXPECT_TRUE(std::all_of(qt_points.begin() + 1, qt_points.end(),
+                          [](const QPointF& point) { return point.y() == 1.0; }));
+}
+
+//! Controller defers the x-offset shift of a large series in full mode, consecutive offset changes
+//! lead to a single shift.
+
+TEST_F(LineSeriesDecimatorTest, ControllerDeferredXOffset)
+{
+  ApplicationModel model;
+  auto data_item = model.InsertItem<LineSeriesDataItem>();
+  data_item->SetWaveform(CreateWaveform(1000, 123));
+
+  QLineSeries line_series;
+  LineSeriesDataController controller(&line_series);
+  controller.SetBackgroundThreshold(1);
+  controller.SetItem(data_item);
+  EXPECT_FALSE(controller.IsDecimated());
+
+  QSignalSpy spy_points_replaced(&line_series, &QLineSeries::pointsReplaced);
+
+  controller.SetXOffset(10.0);
+  controller.SetXOffset(20.0);
+  EXPECT_TRUE(controller.IsXOffsetPending());
+  EXPECT_EQ(spy_points_replaced.count(), 0);
+  EXPECT_EQ(line_series.points().at(0).x(), 0.0);
+
+  // the point changed meanwhile is shifted together with others
+  data_item->SetPointCoordinates(1, {1.0, 1.0});
+
+  EXPECT_TRUE(QTest::qWaitFor([&controller]() { return !controller.IsXOffsetPending(); }));
+
+  EXPECT_EQ(spy_points_replaced.count(), 1);
+  ASSERT_EQ(line_series.count(), 1000);
+  EXPECT_EQ(line_series.points().at(0).x(), 20.0);
+  EXPECT_EQ(line_series.points().at(1).x(), 21.0);
+  EXPECT_EQ(line_series.points().at(1).y(), 1.0);
+
+  // switching deferral off applies the offset immediately
+  controller.SetXOffset(30.0);
+  EXPECT_TRUE(controller.IsXOffsetPending());
+  controller.SetBackgroundThreshold(0);
+  EXPECT_EQ(line_series.points().at(0).x(), 30.0);
+}
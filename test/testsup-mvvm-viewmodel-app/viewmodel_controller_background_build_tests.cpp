@@ -0,0 +1,249 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/viewmodel/viewmodel_controller_impl.h"
+
+#include <mvvm/model/application_model.h>
+#include <mvvm/utils/progress_handler.h>
+#include <mvvm/viewmodel/standard_children_strategies.h>
+#include <mvvm/viewmodel/standard_row_strategies.h>
+#include <mvvm/viewmodel/viewmodel_controller.h>
+#include <mvvm/viewmodelbase/viewmodel_base.h>
+
+#include <gtest/gtest.h>
+
+#include <QCoreApplication>
+#include <QTest>
+
+using namespace mvvm;
+
+//! Tests of ViewModelControllerImpl building large view trees in steps.
+
+class ViewModelControllerBackgroundBuildTest : public ::testing::Test
+{
+public:
+  //! Creates controller listening the model, which builds trees in steps of given size.
+  std::unique_ptr<ViewModelController> CreateController(std::size_t items_per_step,
+                                                        ProgressHandler* progress_handler = nullptr)
+  {
+    auto impl = std::make_unique<ViewModelControllerImpl>(
+        &m_viewmodel, std::make_unique<AllChildrenStrategy>(),
+        std::make_unique<LabelDataRowStrategy>());
+    impl->SetBackgroundBuild(items_per_step, progress_handler);
+    m_impl = impl.get();
+    auto result = std::make_unique<ViewModelController>(std::move(impl));
+    result->SetModel(&m_model);
+    return result;
+  }
+
+  //! Inserts given number of items into the model.
+  void PopulateModel(int item_count)
+  {
+    for (int index = 0; index < item_count; ++index)
+    {
+      m_model.InsertItem<SessionItem>()->SetData(index);
+    }
+  }
+
+  //! Waits until the tree is built, returns false on timeout.
+  bool WaitForBuild() const
+  {
+    return QTest::qWaitFor([this]() { return !m_impl->IsBuildPending(); });
+  }
+
+  ApplicationModel m_model;
+  ViewModelBase m_viewmodel;
+  ViewModelControllerImpl* m_impl{nullptr};
+};
+
+//! Small tree is built at once.
+
+TEST_F(ViewModelControllerBackgroundBuildTest, SmallTree)
+{
+  PopulateModel(5);
+
+  auto controller = CreateController(10);
+  EXPECT_FALSE(m_impl->IsBuildPending());
+  EXPECT_EQ(m_viewmodel.rowCount(), 5);
+}
+
+//! Large tree is shown empty first, and appears after few steps of the event loop.
+
+TEST_F(ViewModelControllerBackgroundBuildTest, LargeTree)
+{
+  PopulateModel(100);
+
+  auto controller = CreateController(10);
+  EXPECT_TRUE(m_impl->IsBuildPending());
+  EXPECT_EQ(m_viewmodel.rowCount(), 0);
+
+  EXPECT_TRUE(WaitForBuild());
+  ASSERT_EQ(m_viewmodel.rowCount(), 100);
+  EXPECT_EQ(m_viewmodel.data(m_viewmodel.index(42, 1), Qt::EditRole).toInt(), 42);
+
+  // after the build the viewmodel reacts on the model as usual
+  m_model.InsertItem<SessionItem>();
+  EXPECT_FALSE(m_impl->IsBuildPending());
+  EXPECT_EQ(m_viewmodel.rowCount(), 101);
+}
+
+//! Items inserted and removed during the build are taken into account.
+
+TEST_F(ViewModelControllerBackgroundBuildTest, ModelChangedDuringBuild)
+{
+  PopulateModel(100);
+
+  auto controller = CreateController(10);
+  EXPECT_TRUE(m_impl->IsBuildPending());
+
+  m_model.InsertItem<SessionItem>();
+  m_model.RemoveItem(m_model.GetRootItem()->GetAllItems().at(0));
+  m_model.RemoveItem(m_model.GetRootItem()->GetAllItems().at(0));
+  EXPECT_TRUE(m_impl->IsBuildPending());
+
+  EXPECT_TRUE(WaitForBuild());
+  ASSERT_EQ(m_viewmodel.rowCount(), 99);
+  EXPECT_EQ(m_viewmodel.data(m_viewmodel.index(0, 1), Qt::EditRole).toInt(), 2);
+}
+
+//! Items inserted and removed after first steps are applied to the part of the tree already built.
+
+TEST_F(ViewModelControllerBackgroundBuildTest, ModelChangedAfterFirstSteps)
+{
+  PopulateModel(100);
+
+  auto controller = CreateController(10);
+  QCoreApplication::processEvents();  // let first step run
+
+  m_model.InsertItem<SessionItem>(m_model.GetRootItem(), TagIndex::First())->SetData(-1);
+  m_model.RemoveItem(m_model.GetRootItem()->GetAllItems().at(1));
+  m_model.RemoveItem(m_model.GetRootItem()->GetAllItems().at(99));
+
+  EXPECT_TRUE(WaitForBuild());
+  ASSERT_EQ(m_viewmodel.rowCount(), 99);
+  EXPECT_EQ(m_viewmodel.data(m_viewmodel.index(0, 1), Qt::EditRole).toInt(), -1);
+  EXPECT_EQ(m_viewmodel.data(m_viewmodel.index(1, 1), Qt::EditRole).toInt(), 1);
+  EXPECT_EQ(m_viewmodel.data(m_viewmodel.index(98, 1), Qt::EditRole).toInt(), 98);
+}
+
+//! The build finishes while the model keeps receiving new items.
+
+TEST_F(ViewModelControllerBackgroundBuildTest, ItemsInsertedContinuously)
+{
+  PopulateModel(100);
+
+  auto controller = CreateController(10);
+  int inserted_count{0};
+  while (m_impl->IsBuildPending() && inserted_count < 100)
+  {
+    m_model.InsertItem<SessionItem>()->SetData(100 + inserted_count);
+    ++inserted_count;
+    QCoreApplication::processEvents();
+  }
+
+  EXPECT_FALSE(m_impl->IsBuildPending());
+  EXPECT_LT(inserted_count, 100);
+  ASSERT_EQ(m_viewmodel.rowCount(), 100 + inserted_count);
+  EXPECT_EQ(m_viewmodel.data(m_viewmodel.index(99 + inserted_count, 1), Qt::EditRole).toInt(),
+            99 + inserted_count);
+}
+
+//! Data changed during the build is shown by the final tree.
+
+TEST_F(ViewModelControllerBackgroundBuildTest, DataChangedDuringBuild)
+{
+  PopulateModel(100);
+
+  auto controller = CreateController(10);
+  QTest::qWait(1);  // let first steps run
+  m_model.GetRootItem()->GetAllItems().at(0)->SetData(42);
+
+  EXPECT_TRUE(WaitForBuild());
+  EXPECT_EQ(m_viewmodel.data(m_viewmodel.index(0, 1), Qt::EditRole).toInt(), 42);
+}
+
+//! Progress is reported and the build can be interrupted.
+
+TEST_F(ViewModelControllerBackgroundBuildTest, Progress)
+{
+  PopulateModel(100);
+
+  std::vector<std::size_t> reported;
+  ProgressHandler handler([&reported](std::size_t percentage)
+                          { reported.push_back(percentage); return false; }, 0);
+
+  auto controller = CreateController(10, &handler);
+  EXPECT_TRUE(WaitForBuild());
+
+  ASSERT_FALSE(reported.empty());
+  EXPECT_LT(reported.front(), 100);
+  EXPECT_EQ(reported.back(), 100);
+  EXPECT_EQ(m_viewmodel.rowCount(), 100);
+}
+
+TEST_F(ViewModelControllerBackgroundBuildTest, Interrupt)
+{
+  PopulateModel(100);
+
+  ProgressHandler handler([](std::size_t) { return true; }, 0);
+
+  auto controller = CreateController(10, &handler);
+  EXPECT_TRUE(WaitForBuild());
+  EXPECT_EQ(m_viewmodel.rowCount(), 0);
+}
+
+//! Interrupted build is restarted by the next structural change of the model, instead of applying
+//! the change to the empty tree.
+
+TEST_F(ViewModelControllerBackgroundBuildTest, ModelChangedAfterInterrupt)
+{
+  PopulateModel(100);
+
+  bool interrupt{true};
+  ProgressHandler handler([&interrupt](std::size_t) { return interrupt; }, 0);
+
+  auto controller = CreateController(10, &handler);
+  EXPECT_TRUE(WaitForBuild());
+  EXPECT_EQ(m_viewmodel.rowCount(), 0);
+
+  interrupt = false;
+  m_model.InsertItem<SessionItem>()->SetData(100);
+  EXPECT_TRUE(m_impl->IsBuildPending());
+  EXPECT_EQ(m_viewmodel.rowCount(), 0);
+
+  EXPECT_TRUE(WaitForBuild());
+  ASSERT_EQ(m_viewmodel.rowCount(), 101);
+  EXPECT_EQ(m_viewmodel.data(m_viewmodel.index(100, 1), Qt::EditRole).toInt(), 100);
+}
+
+//! Pending build is cancelled when the controller is destroyed.
+
+TEST_F(ViewModelControllerBackgroundBuildTest, DestroyDuringBuild)
+{
+  PopulateModel(100);
+
+  auto controller = CreateController(10);
+  EXPECT_TRUE(m_impl->IsBuildPending());
+  controller.reset();
+  m_impl = nullptr;
+
+  QTest::qWait(10);  // queued steps must not reach the destroyed controller
+  EXPECT_EQ(m_viewmodel.rowCount(), 0);
+}
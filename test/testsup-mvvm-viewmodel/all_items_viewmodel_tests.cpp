@@ -20,6 +20,7 @@
 
 #include "mvvm/viewmodel/all_items_viewmodel.h"
 
+#include <mvvm/commands/i_command_stack.h>
 #include <mvvm/model/application_model.h>
 #include <mvvm/model/compound_item.h>
 #include <mvvm/model/property_item.h>
@@ -407,6 +408,74 @@ TEST_F(AllItemsViewModelTest, RemoveMiddleChild)
   EXPECT_EQ(arguments.at(2).value<int>(), 1);
 }
 
+//! Inserting several children at once. ViewModel should emit a single rowsInserted signal.
+TEST_F(AllItemsViewModelTest, InsertItems)
+{
+  auto parent = m_model.InsertItem<CompoundItem>();
+  parent->RegisterTag(TagInfo::CreateUniversalTag("ITEMS"), /*set_as_default*/ true);
+  auto child0 = m_model.InsertItem<SessionItem>(parent, TagIndex::Default(0));
+
+  auto parent_index = m_viewmodel.index(0, 0);
+
+  QSignalSpy spy_insert(&m_viewmodel, &mvvm::ViewModelBase::rowsInserted);
+  const QSignalSpy spy_remove(&m_viewmodel, &mvvm::ViewModelBase::rowsRemoved);
+
+  std::vector<std::unique_ptr<SessionItem>> items;
+  items.push_back(std::make_unique<SessionItem>());
+  items.push_back(std::make_unique<SessionItem>());
+  items.push_back(std::make_unique<SessionItem>());
+  auto inserted = m_model.InsertItems(std::move(items), parent, TagIndex::Default(0));
+  ASSERT_EQ(inserted.size(), 3);
+
+  EXPECT_EQ(spy_insert.count(), 1);
+  EXPECT_EQ(spy_remove.count(), 0);
+
+  EXPECT_EQ(m_viewmodel.rowCount(parent_index), 4);
+  EXPECT_EQ(m_viewmodel.GetSessionItemFromIndex(m_viewmodel.index(0, 0, parent_index)),
+            inserted[0]);
+  EXPECT_EQ(m_viewmodel.GetSessionItemFromIndex(m_viewmodel.index(2, 0, parent_index)),
+            inserted[2]);
+  EXPECT_EQ(m_viewmodel.GetSessionItemFromIndex(m_viewmodel.index(3, 0, parent_index)), child0);
+
+  const QList<QVariant> arguments = spy_insert.takeFirst();
+  EXPECT_EQ(arguments.size(), 3);  // QModelIndex &parent, int first, int last
+  EXPECT_EQ(arguments.at(0).value<QModelIndex>(), parent_index);
+  EXPECT_EQ(arguments.at(1).value<int>(), 0);
+  EXPECT_EQ(arguments.at(2).value<int>(), 2);
+}
+
+//! Taking several children at once. ViewModel should emit a single rowsRemoved signal.
+TEST_F(AllItemsViewModelTest, TakeItems)
+{
+  auto parent = m_model.InsertItem<CompoundItem>();
+  parent->RegisterTag(TagInfo::CreateUniversalTag("ITEMS"), /*set_as_default*/ true);
+  auto child0 = m_model.InsertItem<SessionItem>(parent, TagIndex::Default(0));
+  m_model.InsertItem<SessionItem>(parent, TagIndex::Default(1));
+  m_model.InsertItem<SessionItem>(parent, TagIndex::Default(2));
+  auto child3 = m_model.InsertItem<SessionItem>(parent, TagIndex::Default(3));
+
+  auto parent_index = m_viewmodel.index(0, 0);
+
+  const QSignalSpy spy_insert(&m_viewmodel, &mvvm::ViewModelBase::rowsInserted);
+  QSignalSpy spy_remove(&m_viewmodel, &mvvm::ViewModelBase::rowsRemoved);
+
+  auto taken = m_model.TakeItems(parent, TagIndex::Default(1), 2);
+  EXPECT_EQ(taken.size(), 2);
+
+  EXPECT_EQ(spy_insert.count(), 0);
+  EXPECT_EQ(spy_remove.count(), 1);
+
+  EXPECT_EQ(m_viewmodel.rowCount(parent_index), 2);
+  EXPECT_EQ(m_viewmodel.GetSessionItemFromIndex(m_viewmodel.index(0, 0, parent_index)), child0);
+  EXPECT_EQ(m_viewmodel.GetSessionItemFromIndex(m_viewmodel.index(1, 0, parent_index)), child3);
+
+  const QList<QVariant> arguments = spy_remove.takeFirst();
+  EXPECT_EQ(arguments.size(), 3);  // QModelIndex &parent, int first, int last
+  EXPECT_EQ(arguments.at(0).value<QModelIndex>(), parent_index);
+  EXPECT_EQ(arguments.at(1).value<int>(), 1);
+  EXPECT_EQ(arguments.at(2).value<int>(), 2);
+}
+
 //! The data is manipulated through the ApplicationModel. Checking that ViewModel emits signals.
 TEST_F(AllItemsViewModelTest, SetData)
 {
@@ -1139,3 +1208,26 @@ TEST_F(AllItemsViewModelTest, InsertIntoEmptyTag)
   auto child_index2 = viewmodel.index(1, 0, parent_index);
   EXPECT_EQ(viewmodel.GetSessionItemFromIndex(child_index2), child);
 }
+
+//! Cached display data of the view follows changes of the item, including undo.
+
+TEST_F(AllItemsViewModelTest, CachedDataAfterSetData)
+{
+  m_model.SetUndoEnabled(true);
+  auto item = m_model.InsertItem<PropertyItem>();
+  item->SetData(42.0);
+
+  AllItemsViewModel view_model(&m_model);
+  const QModelIndex data_index = view_model.index(0, 1);
+  EXPECT_EQ(view_model.data(data_index, Qt::DisplayRole), QVariant(42.0));
+
+  m_model.SetData(item, 43.0, DataRole::kData);
+  EXPECT_EQ(view_model.data(data_index, Qt::DisplayRole), QVariant(43.0));
+
+  EXPECT_TRUE(view_model.setData(data_index, QVariant(44.0), Qt::EditRole));
+  EXPECT_EQ(view_model.data(data_index, Qt::DisplayRole), QVariant(44.0));
+  EXPECT_EQ(view_model.data(data_index, Qt::EditRole), QVariant(44.0));
+
+  m_model.GetCommandStack()->Undo();
+  EXPECT_EQ(view_model.data(data_index, Qt::DisplayRole), QVariant(43.0));
+}
@@ -43,6 +43,8 @@ TEST_F(CustomVariantTest, IsVariantType)
       {QVariant::fromValue(std::vector<double>({1, 2})), utils::IsDoubleVectorVariant},
       {QVariant::fromValue(ComboProperty::CreateFrom({"a1", "a2"})), utils::IsComboPropertyVariant},
       {QVariant::fromValue(ExternalProperty("text", "color")), utils::IsExternalPropertyVariant},
+      {QVariant::fromValue(SharedArray<double>({1, 2})), utils::IsSharedDoubleVectorVariant},
+      {QVariant::fromValue(std::vector<float32>({1, 2})), utils::IsNarrowNumericVectorVariant},
   };
 
   for (size_t i = 0; i < data.size(); ++i)
@@ -62,3 +64,15 @@ TEST_F(CustomVariantTest, IsVariantType)
     }
   }
 }
+
+//! Vectors of all narrow numeric types are recognized.
+
+TEST_F(CustomVariantTest, IsNarrowNumericVectorVariant)
+{
+  EXPECT_TRUE(utils::IsNarrowNumericVectorVariant(QVariant::fromValue(std::vector<float32>())));
+  EXPECT_TRUE(utils::IsNarrowNumericVectorVariant(QVariant::fromValue(std::vector<int32>())));
+  EXPECT_TRUE(utils::IsNarrowNumericVectorVariant(QVariant::fromValue(std::vector<int64>())));
+  EXPECT_TRUE(utils::IsNarrowNumericVectorVariant(QVariant::fromValue(std::vector<uint16>())));
+  EXPECT_FALSE(utils::IsNarrowNumericVectorVariant(QVariant::fromValue(std::vector<double>())));
+  EXPECT_FALSE(utils::IsNarrowNumericVectorVariant(QVariant()));
+}
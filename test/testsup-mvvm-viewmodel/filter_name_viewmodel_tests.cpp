@@ -57,3 +57,95 @@ TEST_F(FilterNameViewModelTest, SimplePattern)
   EXPECT_EQ(proxy.data(proxy.index(1, 0, QModelIndex()), Qt::DisplayRole).toString(),
             QString("ABC"));
 }
+
+//! Extending and shrinking the pattern.
+
+TEST_F(FilterNameViewModelTest, ChangePattern)
+{
+  QStandardItemModel source_view_model;
+  auto parent_item = source_view_model.invisibleRootItem();
+  parent_item->appendRow(CreateItemRow("Alpha"));
+  parent_item->appendRow(CreateItemRow("Alphabet"));
+  parent_item->appendRow(CreateItemRow("Beta"));
+  parent_item->appendRow(CreateItemRow("Gamma"));
+
+  FilterNameViewModel proxy;
+  proxy.setSourceModel(&source_view_model);
+  EXPECT_EQ(proxy.rowCount(), 4);
+
+  proxy.SetPattern("al");
+  EXPECT_EQ(proxy.rowCount(), 2);
+
+  proxy.SetPattern("alp");
+  EXPECT_EQ(proxy.rowCount(), 2);
+
+  proxy.SetPattern("alphab");
+  ASSERT_EQ(proxy.rowCount(), 1);
+  EXPECT_EQ(proxy.data(proxy.index(0, 0), Qt::DisplayRole).toString(), QString("Alphabet"));
+
+  proxy.SetPattern("a");
+  EXPECT_EQ(proxy.rowCount(), 4);
+
+  proxy.SetPattern("xyz");
+  EXPECT_EQ(proxy.rowCount(), 0);
+
+  proxy.SetPattern("");
+  EXPECT_EQ(proxy.rowCount(), 4);
+}
+
+//! Ancestors of matching rows are accepted, other children are filtered out.
+
+TEST_F(FilterNameViewModelTest, ParentOfMatchingRow)
+{
+  QStandardItemModel source_view_model;
+  auto parent_row = CreateItemRow("Parent");
+  parent_row.at(0)->appendRow(CreateItemRow("Child"));
+  parent_row.at(0)->appendRow(CreateItemRow("Other"));
+  source_view_model.invisibleRootItem()->appendRow(parent_row);
+  source_view_model.invisibleRootItem()->appendRow(CreateItemRow("Sibling"));
+
+  FilterNameViewModel proxy;
+  proxy.setSourceModel(&source_view_model);
+  proxy.SetPattern("chi");
+
+  ASSERT_EQ(proxy.rowCount(), 1);
+  const auto parent_index = proxy.index(0, 0);
+  EXPECT_EQ(proxy.data(parent_index, Qt::DisplayRole).toString(), QString("Parent"));
+  ASSERT_EQ(proxy.rowCount(parent_index), 1);
+  EXPECT_EQ(proxy.data(proxy.index(0, 0, parent_index), Qt::DisplayRole).toString(),
+            QString("Child"));
+}
+
+//! Insertion, removal and renaming of source rows while the pattern is set.
+
+TEST_F(FilterNameViewModelTest, SourceModelChanges)
+{
+  QStandardItemModel source_view_model;
+  auto parent_row = CreateItemRow("Parent");
+  auto parent_item = parent_row.at(0);
+  source_view_model.invisibleRootItem()->appendRow(parent_row);
+  source_view_model.invisibleRootItem()->appendRow(CreateItemRow("Sibling"));
+
+  FilterNameViewModel proxy;
+  proxy.setSourceModel(&source_view_model);
+  proxy.SetPattern("child");
+  EXPECT_EQ(proxy.rowCount(), 0);
+
+  // matching child makes its parent visible
+  parent_item->appendRow(CreateItemRow("Child"));
+  ASSERT_EQ(proxy.rowCount(), 1);
+  EXPECT_EQ(proxy.rowCount(proxy.index(0, 0)), 1);
+
+  // removal of the only matching child hides the parent
+  parent_item->removeRow(0);
+  EXPECT_EQ(proxy.rowCount(), 0);
+
+  // renamed row starts to match
+  source_view_model.item(1)->setData("Sibling child", Qt::DisplayRole);
+  ASSERT_EQ(proxy.rowCount(), 1);
+  EXPECT_EQ(proxy.data(proxy.index(0, 0), Qt::DisplayRole).toString(), QString("Sibling child"));
+
+  // renamed row stops to match
+  source_view_model.item(1)->setData("Sibling", Qt::DisplayRole);
+  EXPECT_EQ(proxy.rowCount(), 0);
+}
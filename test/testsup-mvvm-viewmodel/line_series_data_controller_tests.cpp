@@ -30,6 +30,8 @@
 
 #include <QSignalSpy>
 
+#include <algorithm>
+
 using namespace mvvm;
 
 class LineSeriesDataControllerTest : public ::testing::Test
@@ -228,3 +230,104 @@ TEST_F(LineSeriesDataControllerTest, SetXOffset)
   EXPECT_EQ(qt_points.at(1).x(), 12.0);
   EXPECT_EQ(qt_points.at(1).y(), 20.0);
 }
+
+TEST_F(LineSeriesDataControllerTest, Decimation)
+{
+  mvvm::ApplicationModel model;
+
+  const int point_count{1000};
+  std::vector<std::pair<double, double>> waveform;
+  for (int index = 0; index < point_count; ++index)
+  {
+    waveform.emplace_back(static_cast<double>(index), index == 123 ? 42.0 : 0.0);
+  }
+  auto data_item = std::make_unique<LineSeriesDataItem>();
+  data_item->SetWaveform(waveform);
+  auto data_item_ptr = data_item.get();
+  model.InsertItem(std::move(data_item), model.GetRootItem(), mvvm::TagIndex::Append());
+
+  QLineSeries line_series;
+  LineSeriesDataController controller(&line_series);
+  controller.SetItem(data_item_ptr);
+  EXPECT_FALSE(controller.IsDecimated());
+  EXPECT_EQ(line_series.count(), point_count);
+
+  // viewport is too narrow, per-pixel envelope is shown, the peak is preserved
+  controller.SetVisibleRange(0.0, static_cast<double>(point_count), 10);
+  EXPECT_TRUE(controller.IsDecimated());
+  EXPECT_LE(line_series.count(), 24);
+  auto qt_points = line_series.points();
+  auto on_peak = [](const QPointF& point) { return point.y() == 42.0; };
+  EXPECT_TRUE(std::any_of(qt_points.begin(), qt_points.end(), on_peak));
+
+  // zooming in shows original points of the visible range with their neighbours
+  controller.SetVisibleRange(120.0, 125.0, 10);
+  EXPECT_TRUE(controller.IsDecimated());
+  EXPECT_EQ(line_series.count(), 8);
+  EXPECT_EQ(line_series.points().at(0).x(), 119.0);
+  EXPECT_EQ(line_series.points().at(4).y(), 42.0);
+
+  // data change is propagated in decimated mode
+  data_item_ptr->SetPointCoordinates(124, {124.0, 43.0});
+  EXPECT_EQ(line_series.points().at(5).y(), 43.0);
+
+  // wide viewport switches decimation off
+  controller.SetVisibleRange(0.0, static_cast<double>(point_count), 1000);
+  EXPECT_FALSE(controller.IsDecimated());
+  EXPECT_EQ(line_series.count(), point_count);
+}
+
+//! Offset in decimated mode shifts visible range of original coordinates.
+
+TEST_F(LineSeriesDataControllerTest, DecimationWithXOffset)
+{
+  mvvm::ApplicationModel model;
+
+  const int point_count{1000};
+  std::vector<std::pair<double, double>> waveform;
+  for (int index = 0; index < point_count; ++index)
+  {
+    waveform.emplace_back(static_cast<double>(index), index == 123 ? 42.0 : 0.0);
+  }
+  auto data_item = model.InsertItem<LineSeriesDataItem>();
+  data_item->SetWaveform(waveform);
+
+  QLineSeries line_series;
+  LineSeriesDataController controller(&line_series);
+  controller.SetItem(data_item);
+
+  controller.SetVisibleRange(1120.0, 1125.0, 10);
+  EXPECT_TRUE(controller.IsDecimated());
+  EXPECT_EQ(line_series.count(), 1);  // only the last point as a neighbour of the range
+
+  QSignalSpy spy_points_replaced(&line_series, &QLineSeries::pointsReplaced);
+
+  // original points [119, 126] are now visible, shifted by the offset
+  controller.SetXOffset(1000.0);
+  EXPECT_EQ(spy_points_replaced.count(), 1);
+  EXPECT_EQ(line_series.count(), 8);
+  EXPECT_EQ(line_series.points().at(0).x(), 1119.0);
+  EXPECT_EQ(line_series.points().at(4).x(), 1123.0);
+  EXPECT_EQ(line_series.points().at(4).y(), 42.0);
+}
+
+//! Points inserted in non-decimated mode are shifted by the offset.
+
+TEST_F(LineSeriesDataControllerTest, OnPointInsertedWithXOffset)
+{
+  mvvm::ApplicationModel model;
+
+  auto data_item = model.InsertItem<LineSeriesDataItem>();
+  data_item->SetWaveform({{1.0, 10.0}});
+
+  QLineSeries line_series;
+  LineSeriesDataController controller(&line_series);
+  controller.SetItem(data_item);
+  controller.SetXOffset(10.0);
+
+  data_item->InsertPoint(1, {2.0, 20.0});
+
+  ASSERT_EQ(line_series.count(), 2);
+  EXPECT_EQ(line_series.points().at(0).x(), 11.0);
+  EXPECT_EQ(line_series.points().at(1).x(), 12.0);
+}
@@ -0,0 +1,195 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/viewmodel/model_view_hub.h"
+
+#include <mvvm/core/mvvm_exceptions.h>
+#include <mvvm/model/application_model.h>
+#include <mvvm/model/compound_item.h>
+#include <mvvm/model/property_item.h>
+#include <mvvm/standarditems/container_item.h>
+#include <mvvm/standarditems/vector_item.h>
+#include <mvvm/utils/container_utils.h>
+#include <mvvm/viewmodel/all_items_viewmodel.h>
+#include <mvvm/viewmodel/standard_children_strategies.h>
+#include <mvvm/viewmodel/top_items_viewmodel.h>
+
+#include <gtest/gtest.h>
+
+using namespace mvvm;
+
+//! Tests for ModelViewHub class.
+
+class ModelViewHubTest : public ::testing::Test
+{
+public:
+  ApplicationModel m_model;
+};
+
+//! There is only one hub per model, it lives while somebody holds it.
+
+TEST_F(ModelViewHubTest, Acquire)
+{
+  EXPECT_THROW(ModelViewHub::Acquire(nullptr), RuntimeException);
+
+  auto hub = ModelViewHub::Acquire(&m_model);
+  EXPECT_EQ(hub->GetModel(), &m_model);
+  EXPECT_EQ(hub->GetControllerCount(), 0);
+  EXPECT_EQ(hub->GetCacheSize(), 0);
+  EXPECT_EQ(ModelViewHub::Acquire(&m_model), hub);
+
+  ApplicationModel other_model;
+  EXPECT_NE(ModelViewHub::Acquire(&other_model), hub);
+
+  std::weak_ptr<ModelViewHub> weak_hub = hub;
+  hub.reset();
+  EXPECT_TRUE(weak_hub.expired());
+}
+
+//! Viewmodels looking at the same model are served by the same hub.
+
+TEST_F(ModelViewHubTest, SharedByViewModels)
+{
+  auto hub = ModelViewHub::Acquire(&m_model);
+
+  {
+    AllItemsViewModel all_items_viewmodel(&m_model);
+    TopItemsViewModel top_items_viewmodel(&m_model);
+    EXPECT_EQ(hub->GetControllerCount(), 2);
+
+    auto container = m_model.InsertItem<ContainerItem>();
+    m_model.InsertItem<VectorItem>(container);
+    auto property = m_model.InsertItem<PropertyItem>(container, TagIndex::Default(0));
+
+    EXPECT_EQ(all_items_viewmodel.rowCount(all_items_viewmodel.index(0, 0)), 2);
+    EXPECT_EQ(top_items_viewmodel.rowCount(top_items_viewmodel.index(0, 0)), 2);
+    EXPECT_EQ(all_items_viewmodel.GetSessionItemFromIndex(all_items_viewmodel.index(
+                  0, 0, all_items_viewmodel.index(0, 0))),
+              property);
+
+    // data change reaches views of both viewmodels
+    property->SetData(42);
+    EXPECT_EQ(all_items_viewmodel.index(0, 1, all_items_viewmodel.index(0, 0)).data().toInt(), 42);
+
+    m_model.RemoveItem(property);
+    EXPECT_EQ(all_items_viewmodel.rowCount(all_items_viewmodel.index(0, 0)), 1);
+    EXPECT_EQ(top_items_viewmodel.rowCount(top_items_viewmodel.index(0, 0)), 1);
+  }
+
+  EXPECT_EQ(hub->GetControllerCount(), 0);
+}
+
+//! Positions of children are cached per parent and strategy and invalidated by model changes.
+
+TEST_F(ModelViewHubTest, GetChildIndex)
+{
+  auto hub = ModelViewHub::Acquire(&m_model);
+  const AllChildrenStrategy all_children;
+  const TopItemsStrategy top_items;
+
+  auto container = m_model.InsertItem<ContainerItem>();
+  auto vector0 = m_model.InsertItem<VectorItem>(container);
+  auto vector1 = m_model.InsertItem<VectorItem>(container);
+
+  EXPECT_EQ(hub->GetChildIndex(all_children, container, vector0), 0);
+  EXPECT_EQ(hub->GetChildIndex(all_children, container, vector1), 1);
+  EXPECT_EQ(hub->GetChildIndex(top_items, container, vector1), 1);
+  EXPECT_EQ(hub->GetChildIndex(all_children, vector0, vector0->GetItem(VectorItem::kY)), 1);
+  EXPECT_EQ(hub->GetChildIndex(top_items, vector0, vector0->GetItem(VectorItem::kY)), -1);
+  EXPECT_EQ(hub->GetCacheSize(), 4);
+
+  // insertion invalidates children of the parent
+  auto vector2 = m_model.InsertItem<VectorItem>(container, TagIndex::Default(0));
+  EXPECT_EQ(hub->GetCacheSize(), 2);
+  EXPECT_EQ(hub->GetChildIndex(all_children, container, vector2), 0);
+  EXPECT_EQ(hub->GetChildIndex(all_children, container, vector1), 2);
+
+  // hiding the item changes what strategies report
+  vector2->SetVisible(false);
+  EXPECT_EQ(hub->GetChildIndex(top_items, container, vector2), -1);
+  EXPECT_EQ(hub->GetChildIndex(top_items, container, vector1), 1);
+
+  // strategies without cache key are asked directly
+  class DerivedStrategy : public AllChildrenStrategy
+  {
+  };
+  const auto cache_size = hub->GetCacheSize();
+  EXPECT_EQ(hub->GetChildIndex(DerivedStrategy(), container, vector1), 2);
+  EXPECT_EQ(hub->GetCacheSize(), cache_size);
+
+  // removal of the branch invalidates the whole branch
+  m_model.RemoveItem(container);
+  EXPECT_EQ(hub->GetCacheSize(), 0);
+}
+
+//! Positions of children found by tag index. Numbers of reported children are updated
+//! incrementally on insertion.
+
+TEST_F(ModelViewHubTest, GetChildIndexByTagIndex)
+{
+  auto hub = ModelViewHub::Acquire(&m_model);
+  const TopItemsStrategy top_items;
+
+  auto container = m_model.InsertItem<ContainerItem>();
+  auto vector0 = m_model.InsertItem<VectorItem>(container);
+  EXPECT_EQ(hub->GetChildIndex(top_items, container, TagIndex::Default(0)), 0);
+  EXPECT_EQ(hub->GetCacheSize(), 1);
+
+  // appended item
+  m_model.InsertItem<VectorItem>(container);
+  EXPECT_EQ(hub->GetCacheSize(), 1);
+  EXPECT_EQ(hub->GetChildIndex(top_items, container, TagIndex::Default(1)), 1);
+
+  // hidden item inserted in the middle isn't reported
+  auto hidden_item = std::make_unique<VectorItem>();
+  hidden_item->SetVisible(false);
+  m_model.InsertItem(std::move(hidden_item), container, TagIndex::Default(1));
+  EXPECT_EQ(hub->GetChildIndex(top_items, container, TagIndex::Default(1)), -1);
+  EXPECT_EQ(hub->GetChildIndex(top_items, container, TagIndex::Default(2)), 1);
+
+  // batch insertion in front
+  std::vector<std::unique_ptr<SessionItem>> items;
+  items.push_back(std::make_unique<VectorItem>());
+  items.push_back(std::make_unique<VectorItem>());
+  m_model.InsertItems(std::move(items), container, TagIndex::Default(0));
+  EXPECT_EQ(hub->GetChildIndex(top_items, container, TagIndex::Default(1)), 1);
+  EXPECT_EQ(hub->GetChildIndex(top_items, container, TagIndex::Default(2)), 2);
+  EXPECT_EQ(container->GetItem(TagIndex::Default(2)), vector0);
+
+  // counts are dropped if nobody asked for them since the last insertion
+  m_model.InsertItem<VectorItem>(container);
+  m_model.InsertItem<VectorItem>(container);
+  EXPECT_EQ(hub->GetCacheSize(), 0);
+
+  // positions agree with the list of reported children
+  const auto children = top_items.GetChildren(container);
+  for (int index = 0; index < static_cast<int>(container->GetTotalItemCount()); ++index)
+  {
+    auto child = container->GetItem(TagIndex::Default(index));
+    EXPECT_EQ(hub->GetChildIndex(top_items, container, TagIndex::Default(index)),
+              utils::IndexOfItem(children, child));
+  }
+  EXPECT_EQ(hub->GetCacheSize(), 1);
+
+  // children in several containers
+  const AllChildrenStrategy all_children;
+  EXPECT_EQ(hub->GetChildIndex(all_children, vector0, TagIndex(VectorItem::kZ, 0)), 2);
+  EXPECT_EQ(hub->GetChildIndex(top_items, vector0, TagIndex(VectorItem::kZ, 0)), -1);
+}
@@ -0,0 +1,313 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/viewmodel/sort_table_viewmodel.h"
+
+#include <mvvm/model/application_model.h>
+#include <mvvm/model/model_utils.h>
+#include <mvvm/standarditems/vector_item.h>
+#include <mvvm/viewmodel/property_table_viewmodel.h>
+
+#include <gtest/gtest.h>
+
+#include <QSignalSpy>
+#include <QStandardItemModel>
+
+using namespace mvvm;
+
+//! Tests for SortTableViewModel class.
+
+class SortTableViewModelTest : public ::testing::Test
+{
+public:
+  //! Returns values of the column in the order of proxy rows.
+  static std::vector<double> GetColumnValues(const QAbstractItemModel& proxy, int column)
+  {
+    std::vector<double> result;
+    for (int row = 0; row < proxy.rowCount(); ++row)
+    {
+      result.push_back(proxy.data(proxy.index(row, column), Qt::DisplayRole).toDouble());
+    }
+    return result;
+  }
+
+  //! Returns source rows in the order of proxy rows.
+  static std::vector<int> GetSourceRows(const QAbstractProxyModel& proxy)
+  {
+    std::vector<int> result;
+    for (int row = 0; row < proxy.rowCount(); ++row)
+    {
+      const auto source_index = proxy.mapToSource(proxy.index(row, 0));
+      EXPECT_EQ(proxy.mapFromSource(source_index), proxy.index(row, 0));
+      result.push_back(source_index.row());
+    }
+    return result;
+  }
+};
+
+TEST_F(SortTableViewModelTest, InitialState)
+{
+  SortTableViewModel proxy;
+  EXPECT_EQ(proxy.rowCount(), 0);
+  EXPECT_EQ(proxy.columnCount(), 0);
+  EXPECT_TRUE(proxy.GetSortColumns().empty());
+  EXPECT_FALSE(proxy.IsSortByDisplayData());
+  EXPECT_FALSE(proxy.index(0, 0).isValid());
+}
+
+//! Sorting table of vectors by the first column.
+
+TEST_F(SortTableViewModelTest, SortByColumn)
+{
+  ApplicationModel model;
+  model.InsertItem<VectorItem>()->SetX(3.0);
+  model.InsertItem<VectorItem>()->SetX(1.0);
+  model.InsertItem<VectorItem>()->SetX(2.0);
+  PropertyTableViewModel view_model(&model);
+
+  SortTableViewModel proxy;
+  proxy.setSourceModel(&view_model);
+  EXPECT_EQ(proxy.rowCount(), 3);
+  EXPECT_EQ(proxy.columnCount(), 3);
+  EXPECT_EQ(proxy.headerData(0, Qt::Horizontal, Qt::DisplayRole).toString(), QString("X"));
+  EXPECT_EQ(GetColumnValues(proxy, 0), std::vector<double>({3.0, 1.0, 2.0}));
+
+  const QPersistentModelIndex persistent_index(proxy.index(0, 1));
+  QSignalSpy spy_layout_changed(&proxy, &SortTableViewModel::layoutChanged);
+
+  proxy.sort(0, Qt::AscendingOrder);
+  EXPECT_EQ(GetColumnValues(proxy, 0), std::vector<double>({1.0, 2.0, 3.0}));
+  EXPECT_EQ(GetSourceRows(proxy), std::vector<int>({1, 2, 0}));
+  EXPECT_EQ(spy_layout_changed.count(), 1);
+  EXPECT_EQ(persistent_index.row(), 2);
+  EXPECT_EQ(persistent_index.column(), 1);
+
+  proxy.sort(0, Qt::DescendingOrder);
+  EXPECT_EQ(GetColumnValues(proxy, 0), std::vector<double>({3.0, 2.0, 1.0}));
+  EXPECT_EQ(persistent_index.row(), 0);
+
+  // negative column restores the order of the source
+  proxy.sort(-1);
+  EXPECT_TRUE(proxy.GetSortColumns().empty());
+  EXPECT_EQ(GetColumnValues(proxy, 0), std::vector<double>({3.0, 1.0, 2.0}));
+}
+
+//! Rows of ViewModel can be sorted by display data of views, the order is rebuilt on switch.
+
+TEST_F(SortTableViewModelTest, SortByDisplayData)
+{
+  ApplicationModel model;
+  model.InsertItem<VectorItem>()->SetX(3.0);
+  model.InsertItem<VectorItem>()->SetX(1.0);
+  model.InsertItem<VectorItem>()->SetX(2.0);
+  PropertyTableViewModel view_model(&model);
+
+  SortTableViewModel proxy;
+  proxy.setSourceModel(&view_model);
+  proxy.sort(0, Qt::AscendingOrder);
+
+  QSignalSpy spy_layout_changed(&proxy, &SortTableViewModel::layoutChanged);
+  proxy.SetSortByDisplayData(true);
+  EXPECT_TRUE(proxy.IsSortByDisplayData());
+  EXPECT_EQ(spy_layout_changed.count(), 1);
+  EXPECT_EQ(GetColumnValues(proxy, 0), std::vector<double>({1.0, 2.0, 3.0}));
+
+  // the order is maintained with keys taken from views
+  utils::GetTopItem<VectorItem>(&model)->SetX(0.0);
+  EXPECT_EQ(GetColumnValues(proxy, 0), std::vector<double>({0.0, 1.0, 2.0}));
+
+  // the same mode doesn't trigger resorting
+  proxy.SetSortByDisplayData(true);
+  EXPECT_EQ(spy_layout_changed.count(), 1);
+}
+
+//! Sorting by two columns, rows with equal keys keep the order of the source.
+
+TEST_F(SortTableViewModelTest, MultiColumnSort)
+{
+  ApplicationModel model;
+  model.InsertItem<VectorItem>()->SetXYZ(1.0, 2.0, 0.0);
+  model.InsertItem<VectorItem>()->SetXYZ(0.0, 5.0, 0.0);
+  model.InsertItem<VectorItem>()->SetXYZ(1.0, 1.0, 0.0);
+  model.InsertItem<VectorItem>()->SetXYZ(0.0, 5.0, 0.0);
+  PropertyTableViewModel view_model(&model);
+
+  SortTableViewModel proxy;
+  proxy.setSourceModel(&view_model);
+
+  proxy.SetSortColumns({{0, Qt::AscendingOrder}});
+  EXPECT_EQ(GetSourceRows(proxy), std::vector<int>({1, 3, 0, 2}));
+
+  // the previous column becomes secondary one
+  proxy.sort(1, Qt::AscendingOrder);
+  ASSERT_EQ(proxy.GetSortColumns().size(), 2);
+  EXPECT_EQ(proxy.GetSortColumns().at(0).column, 1);
+  EXPECT_EQ(proxy.GetSortColumns().at(1).column, 0);
+  EXPECT_EQ(GetSourceRows(proxy), std::vector<int>({2, 0, 1, 3}));
+
+  proxy.SetSortColumns({{0, Qt::DescendingOrder}, {1, Qt::AscendingOrder}});
+  EXPECT_EQ(GetSourceRows(proxy), std::vector<int>({2, 0, 1, 3}));
+}
+
+//! Change of the sort key moves the row to its new position, other changes don't move rows.
+
+TEST_F(SortTableViewModelTest, DataChanged)
+{
+  ApplicationModel model;
+  std::vector<VectorItem*> vectors;
+  for (int index = 0; index < 5; ++index)
+  {
+    vectors.push_back(model.InsertItem<VectorItem>());
+    vectors.back()->SetX(index);
+  }
+  PropertyTableViewModel view_model(&model);
+
+  SortTableViewModel proxy;
+  proxy.setSourceModel(&view_model);
+  proxy.sort(0);
+
+  QSignalSpy spy_moved(&proxy, &SortTableViewModel::rowsMoved);
+  QSignalSpy spy_layout_changed(&proxy, &SortTableViewModel::layoutChanged);
+  QSignalSpy spy_data_changed(&proxy, &SortTableViewModel::dataChanged);
+
+  vectors.at(0)->SetX(3.5);
+  EXPECT_EQ(GetColumnValues(proxy, 0), std::vector<double>({1.0, 2.0, 3.0, 3.5, 4.0}));
+  ASSERT_EQ(spy_moved.count(), 1);
+  auto arguments = spy_moved.takeFirst();
+  EXPECT_EQ(arguments.at(1).value<int>(), 0);
+  EXPECT_EQ(arguments.at(2).value<int>(), 0);
+  EXPECT_EQ(arguments.at(4).value<int>(), 4);
+  EXPECT_EQ(spy_layout_changed.count(), 0);
+
+  ASSERT_FALSE(spy_data_changed.empty());
+  arguments = spy_data_changed.takeLast();
+  EXPECT_EQ(arguments.at(0).value<QModelIndex>(), proxy.index(3, 0));
+
+  // moving towards the beginning
+  vectors.at(4)->SetX(0.0);
+  EXPECT_EQ(GetColumnValues(proxy, 0), std::vector<double>({0.0, 1.0, 2.0, 3.0, 3.5}));
+  EXPECT_EQ(spy_moved.count(), 1);
+
+  // key changes without change of the order, and changes of other columns
+  vectors.at(3)->SetX(3.2);
+  vectors.at(2)->SetY(42.0);
+  EXPECT_EQ(GetColumnValues(proxy, 0), std::vector<double>({0.0, 1.0, 2.0, 3.2, 3.5}));
+  EXPECT_EQ(spy_moved.count(), 1);
+  EXPECT_EQ(spy_layout_changed.count(), 0);
+}
+
+//! Inserted rows take their sorted position, removed rows are removed from their position.
+
+TEST_F(SortTableViewModelTest, InsertAndRemove)
+{
+  ApplicationModel model;
+  auto vector0 = model.InsertItem<VectorItem>();
+  vector0->SetX(1.0);
+  model.InsertItem<VectorItem>()->SetX(-1.0);
+  PropertyTableViewModel view_model(&model);
+
+  SortTableViewModel proxy;
+  proxy.setSourceModel(&view_model);
+  proxy.sort(0, Qt::DescendingOrder);
+  EXPECT_EQ(GetColumnValues(proxy, 0), std::vector<double>({1.0, -1.0}));
+
+  QSignalSpy spy_inserted(&proxy, &SortTableViewModel::rowsInserted);
+  QSignalSpy spy_removed(&proxy, &SortTableViewModel::rowsRemoved);
+
+  model.InsertItem<VectorItem>(model.GetRootItem(), TagIndex::First());
+  EXPECT_EQ(GetColumnValues(proxy, 0), std::vector<double>({1.0, 0.0, -1.0}));
+  EXPECT_EQ(GetSourceRows(proxy), std::vector<int>({1, 0, 2}));
+  ASSERT_EQ(spy_inserted.count(), 1);
+  auto arguments = spy_inserted.takeFirst();
+  EXPECT_EQ(arguments.at(1).value<int>(), 1);
+  EXPECT_EQ(arguments.at(2).value<int>(), 1);
+
+  model.RemoveItem(vector0);
+  EXPECT_EQ(GetColumnValues(proxy, 0), std::vector<double>({0.0, -1.0}));
+  EXPECT_EQ(GetSourceRows(proxy), std::vector<int>({0, 1}));
+  ASSERT_EQ(spy_removed.count(), 1);
+  arguments = spy_removed.takeFirst();
+  EXPECT_EQ(arguments.at(1).value<int>(), 0);
+  EXPECT_EQ(arguments.at(2).value<int>(), 0);
+
+  // reset of the source
+  QSignalSpy spy_reset(&proxy, &SortTableViewModel::modelReset);
+  model.Clear();
+  EXPECT_EQ(spy_reset.count(), 1);
+  EXPECT_EQ(proxy.rowCount(), 0);
+  EXPECT_EQ(proxy.GetSortColumns().size(), 1);
+}
+
+//! Sorting of an arbitrary source model by its display data.
+
+TEST_F(SortTableViewModelTest, StandardItemModel)
+{
+  QStandardItemModel source;
+  for (const auto& [name, number] :
+       std::vector<std::pair<QString, int>>({{"b", 9}, {"a", 10}, {"c", 100}}))
+  {
+    auto number_item = new QStandardItem;
+    number_item->setData(number, Qt::DisplayRole);
+    source.appendRow({new QStandardItem(name), number_item});
+  }
+
+  SortTableViewModel proxy;
+  proxy.setSourceModel(&source);
+
+  proxy.sort(0);
+  EXPECT_EQ(GetSourceRows(proxy), std::vector<int>({1, 0, 2}));
+
+  // numbers are compared as numbers, and not as strings
+  proxy.SetSortColumns({{1, Qt::DescendingOrder}});
+  EXPECT_EQ(GetSourceRows(proxy), std::vector<int>({2, 1, 0}));
+
+  source.item(0, 1)->setData(1000, Qt::DisplayRole);
+  EXPECT_EQ(GetSourceRows(proxy), std::vector<int>({0, 2, 1}));
+}
+
+//! Source rows are mapped correctly while several rows are being inserted, when the source already
+//! has more rows than the proxy.
+
+TEST_F(SortTableViewModelTest, MapFromSourceDuringInsertion)
+{
+  QStandardItemModel source;
+  for (const auto& name : {"b", "a", "c"})
+  {
+    source.appendRow(new QStandardItem(name));
+  }
+
+  SortTableViewModel proxy;
+  proxy.setSourceModel(&source);
+  proxy.sort(0);
+
+  std::vector<int> mapped_rows;
+  auto on_rows_inserted = [&source, &proxy, &mapped_rows]()
+  {
+    // the last source row is "c", it is already in the proxy
+    mapped_rows.push_back(proxy.mapFromSource(source.index(source.rowCount() - 1, 0)).row());
+  };
+  QObject::connect(&proxy, &SortTableViewModel::rowsInserted, on_rows_inserted);
+
+  source.insertRows(0, 2);
+
+  // rows without data go first
+  EXPECT_EQ(mapped_rows, std::vector<int>({3, 4}));
+  EXPECT_EQ(GetSourceRows(proxy), std::vector<int>({0, 1, 3, 2, 4}));
+}
@@ -216,3 +216,59 @@ TEST_F(StandardChildrenStrategiesTest, FixedItemTypeStrategy)
   EXPECT_EQ(strategy.GetChildren(&particle_item),
             std::vector<SessionItem*>({particle_item.GetItem("position")}));
 }
+
+//! Results of stateless strategies can be shared, FixedItemTypeStrategy takes types into account.
+TEST_F(StandardChildrenStrategiesTest, GetCacheKey)
+{
+  EXPECT_EQ(AllChildrenStrategy().GetCacheKey(), AllChildrenStrategy().GetCacheKey());
+  EXPECT_FALSE(AllChildrenStrategy().GetCacheKey().empty());
+  EXPECT_NE(AllChildrenStrategy().GetCacheKey(), AllVisibleChildrenStrategy().GetCacheKey());
+  EXPECT_NE(TopItemsStrategy().GetCacheKey(), PropertyItemsStrategy().GetCacheKey());
+
+  const FixedItemTypeStrategy vector_strategy({VectorItem::GetStaticType()});
+  const FixedItemTypeStrategy property_strategy({PropertyItem::GetStaticType()});
+  EXPECT_NE(vector_strategy.GetCacheKey(), property_strategy.GetCacheKey());
+  EXPECT_EQ(vector_strategy.GetCacheKey(),
+            FixedItemTypeStrategy({VectorItem::GetStaticType()}).GetCacheKey());
+
+  // derived strategies might report other children
+  class DerivedStrategy : public AllChildrenStrategy
+  {
+  };
+  EXPECT_TRUE(DerivedStrategy().GetCacheKey().empty());
+}
+
+//! Standard strategies are child filters, reported children agree with GetChildren.
+TEST_F(StandardChildrenStrategiesTest, IsReportedChild)
+{
+  TestItem item;
+  item.GetAllItems().at(1)->SetVisible(false);
+
+  const AllChildrenStrategy all_children;
+  const AllVisibleChildrenStrategy all_visible_children;
+  const TopItemsStrategy top_items;
+  const PropertyItemsStrategy property_items;
+  const FixedItemTypeStrategy fixed_types({PropertyItem::GetStaticType()});
+
+  for (const IChildrenStrategy* strategy : std::vector<const IChildrenStrategy*>{
+           &all_children, &all_visible_children, &top_items, &property_items, &fixed_types})
+  {
+    EXPECT_TRUE(strategy->IsChildFilter());
+
+    std::vector<SessionItem*> reported_children;
+    for (auto child : item.GetAllItems())
+    {
+      if (strategy->IsReportedChild(*child))
+      {
+        reported_children.push_back(child);
+      }
+    }
+    EXPECT_EQ(reported_children, strategy->GetChildren(&item));
+  }
+
+  // derived strategies might report other children
+  class DerivedStrategy : public TopItemsStrategy
+  {
+  };
+  EXPECT_FALSE(DerivedStrategy().IsChildFilter());
+}
@@ -275,6 +275,43 @@ TEST_F(VariantConverterTest, GetStdVariant)
     EXPECT_EQ(variant, variant_t(value));
   }
 
+  {
+    const SharedArray<double> value{1.0, 2.0};
+    auto qt_variant = QVariant::fromValue(value);
+    auto variant = GetStdVariant(qt_variant);
+    EXPECT_EQ(GetTypeCode(variant), TypeCode::SharedVectorOfDouble);
+    EXPECT_EQ(variant, variant_t(value));
+    EXPECT_TRUE(std::get<SharedArray<double>>(variant).IsSharedWith(value));
+  }
+
+  {
+    const std::vector<float32> value{1.0f, 2.0f};
+    auto variant = GetStdVariant(QVariant::fromValue(value));
+    EXPECT_EQ(GetTypeCode(variant), TypeCode::VectorOfFloat32);
+    EXPECT_EQ(variant, variant_t(value));
+  }
+
+  {
+    const std::vector<int32> value{1, 2};
+    auto variant = GetStdVariant(QVariant::fromValue(value));
+    EXPECT_EQ(GetTypeCode(variant), TypeCode::VectorOfInt32);
+    EXPECT_EQ(variant, variant_t(value));
+  }
+
+  {
+    const std::vector<int64> value{1, 2};
+    auto variant = GetStdVariant(QVariant::fromValue(value));
+    EXPECT_EQ(GetTypeCode(variant), TypeCode::VectorOfInt64);
+    EXPECT_EQ(variant, variant_t(value));
+  }
+
+  {
+    const std::vector<uint16> value{1, 2};
+    auto variant = GetStdVariant(QVariant::fromValue(value));
+    EXPECT_EQ(GetTypeCode(variant), TypeCode::VectorOfUInt16);
+    EXPECT_EQ(variant, variant_t(value));
+  }
+
   {
     const ComboProperty value = ComboProperty::CreateFrom({"a1"});
     auto qt_variant = QVariant::fromValue(value);
@@ -417,6 +454,24 @@ TEST_F(VariantConverterTest, GetQtVariant)
     EXPECT_TRUE(variant.canConvert<ExternalProperty>());
     EXPECT_EQ(std::string(variant.typeName()), constants::kExternalPropertyQtTypeName);
   }
+
+  {
+    SharedArray<double> value;
+    auto variant = GetQtVariant(variant_t{value});
+    EXPECT_TRUE(variant.canConvert<SharedArray<double>>());
+    EXPECT_EQ(std::string(variant.typeName()), constants::kSharedVectorDoubleQtTypeName);
+  }
+
+  {
+    auto variant = GetQtVariant(variant_t{std::vector<float32>({1.0f})});
+    EXPECT_EQ(variant.userType(), qMetaTypeId<std::vector<float32>>());
+    variant = GetQtVariant(variant_t{std::vector<int32>({1})});
+    EXPECT_EQ(variant.userType(), qMetaTypeId<std::vector<int32>>());
+    variant = GetQtVariant(variant_t{std::vector<int64>({1})});
+    EXPECT_EQ(variant.userType(), qMetaTypeId<std::vector<int64>>());
+    variant = GetQtVariant(variant_t{std::vector<uint16>({1})});
+    EXPECT_EQ(variant.userType(), qMetaTypeId<std::vector<uint16>>());
+  }
 }
 
 //! Testing function to convert std variant to Qt variant.
@@ -495,6 +550,11 @@ TEST_F(VariantConverterTest, GetQtVariantExtended)
   auto external_from_mvvm = std::get<ExternalProperty>(mvvm_external_variant);
   EXPECT_EQ(external_from_qt, external);
   EXPECT_EQ(external_from_mvvm, external);
+
+  // from SharedArray<double>, the data is shared and not copied
+  const SharedArray<double> array({1.0, 2.0});
+  auto qt_array_variant = GetQtVariant(variant_t(array));
+  EXPECT_TRUE(qt_array_variant.value<SharedArray<double>>().IsSharedWith(array));
 }
 
 //! Special test for comparison of Qt variants based on vector<double>.
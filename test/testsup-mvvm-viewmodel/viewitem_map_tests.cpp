@@ -100,3 +100,32 @@ TEST_F(ViewItemMapTest, OnItemRemove)
   map.OnItemRemove(&vector);
   EXPECT_EQ(map.GetSize(), 1);
 }
+
+//! Registering many views presenting the same item.
+
+TEST_F(ViewItemMapTest, AddViewThenFindAllViews)
+{
+  ViewItemMap map;
+  VectorItem vector;
+
+  ViewItem vector_label_view, vector_data_view, x_view;
+
+  EXPECT_TRUE(map.FindAllViews(&vector).empty());
+
+  map.AddView(&vector, &vector_label_view);
+  map.AddView(&vector, &vector_data_view);
+  map.AddView(vector.GetItem(VectorItem::kX), &x_view);
+
+  EXPECT_EQ(map.FindAllViews(&vector),
+            std::vector<ViewItem*>({&vector_label_view, &vector_data_view}));
+  EXPECT_EQ(map.FindAllViews(vector.GetItem(VectorItem::kX)), std::vector<ViewItem*>({&x_view}));
+
+  // views of the whole branch are forgotten on removal
+  map.OnItemRemove(&vector);
+  EXPECT_TRUE(map.FindAllViews(&vector).empty());
+  EXPECT_TRUE(map.FindAllViews(vector.GetItem(VectorItem::kX)).empty());
+
+  map.AddView(&vector, &vector_label_view);
+  map.Clear();
+  EXPECT_TRUE(map.FindAllViews(&vector).empty());
+}
@@ -22,6 +22,8 @@
 
 #include <mvvm/core/mvvm_exceptions.h>
 #include <mvvm/utils/container_utils.h>
+#include <mvvm/viewmodelbase/viewitem_data.h>
+#include <mvvm/viewmodelbase/viewitem_data_interface.h>
 
 #include <gtest/gtest.h>
 #include <testutils/test_container_helper.h>
@@ -212,6 +214,51 @@ TEST_F(ViewItemTest, InsertRowsThenRemove)
   EXPECT_EQ(expected_row1[1]->Column(), 1);
 }
 
+//! Insert several rows at once, then remove them at once.
+
+TEST_F(ViewItemTest, InsertRowsRemoveRows)
+{
+  auto [children_row0, expected_row0] = GetTestData(/*ncolumns*/ 2);
+  auto [children_row1, expected_row1] = GetTestData(/*ncolumns*/ 2);
+  auto [children_row2, expected_row2] = GetTestData(/*ncolumns*/ 2);
+
+  ViewItem view_item;
+  view_item.AppendRow(std::move(children_row0));
+
+  std::vector<children_t> rows;
+  rows.push_back(std::move(children_row1));
+  rows.push_back(std::move(children_row2));
+  view_item.InsertRows(0, std::move(rows));  // inserting in front
+
+  EXPECT_EQ(view_item.GetRowCount(), 3);
+  EXPECT_EQ(view_item.GetColumnCount(), 2);
+  EXPECT_EQ(view_item.GetChild(0, 0), expected_row1[0]);
+  EXPECT_EQ(view_item.GetChild(1, 1), expected_row2[1]);
+  EXPECT_EQ(view_item.GetChild(2, 0), expected_row0[0]);
+  EXPECT_EQ(expected_row1[0]->GetParent(), &view_item);
+  EXPECT_EQ(expected_row2[1]->GetParent(), &view_item);
+  EXPECT_EQ(expected_row2[1]->Row(), 1);
+  EXPECT_EQ(expected_row2[1]->Column(), 1);
+  EXPECT_EQ(expected_row0[0]->Row(), 2);
+
+  // wrong number of columns
+  std::vector<children_t> wrong_rows;
+  wrong_rows.push_back(GetTestData(/*ncolumns*/ 3).first);
+  EXPECT_THROW(view_item.InsertRows(0, std::move(wrong_rows)), RuntimeException);
+
+  EXPECT_THROW(view_item.RemoveRows(2, 2), RuntimeException);
+
+  // removing two first rows
+  view_item.RemoveRows(0, 2);
+  EXPECT_EQ(view_item.GetRowCount(), 1);
+  EXPECT_EQ(view_item.GetChild(0, 0), expected_row0[0]);
+  EXPECT_EQ(expected_row0[0]->Row(), 0);
+
+  view_item.RemoveRows(0, 1);
+  EXPECT_EQ(view_item.GetRowCount(), 0);
+  EXPECT_EQ(view_item.GetColumnCount(), 0);
+}
+
 //! Clean item's children.
 
 TEST_F(ViewItemTest, Clear)
@@ -254,3 +301,76 @@ TEST_F(ViewItemTest, GetFlags)
   view_item.SetData(42, Qt::EditRole);
   EXPECT_TRUE(view_item.Flags() & Qt::ItemIsEditable);
 }
+
+//! Display and edit data of cacheable presentation is requested from the presentation once.
+
+TEST_F(ViewItemTest, DataCache)
+{
+  //! Presentation counting data requests.
+  class TestData : public ViewItemDataInterface
+  {
+  public:
+    explicit TestData(int* request_count) : m_request_count(request_count) {}
+    QVariant Data(int role) const override
+    {
+      ++(*m_request_count);
+      return role == Qt::DisplayRole ? m_value : QVariant();
+    }
+    bool SetData(const QVariant& data, int role) override
+    {
+      m_value = data;
+      return role == Qt::EditRole;
+    }
+    bool IsEnabled() const override { return true; }
+    bool IsEditable() const override { return true; }
+    bool IsCacheable() const override { return true; }
+
+  private:
+    int* m_request_count{nullptr};
+    QVariant m_value{42};
+  };
+
+  int request_count{0};
+  ViewItem view_item(std::make_unique<TestData>(&request_count));
+
+  EXPECT_EQ(view_item.Data(Qt::DisplayRole), QVariant(42));
+  EXPECT_EQ(view_item.Data(Qt::DisplayRole), QVariant(42));
+  EXPECT_EQ(request_count, 1);
+
+  // other roles are not cached
+  view_item.Data(Qt::ToolTipRole);
+  view_item.Data(Qt::ToolTipRole);
+  EXPECT_EQ(request_count, 3);
+
+  // successful SetData resets the cache
+  EXPECT_TRUE(view_item.SetData(QVariant(43), Qt::EditRole));
+  EXPECT_EQ(view_item.Data(Qt::DisplayRole), QVariant(43));
+  EXPECT_EQ(request_count, 4);
+
+  // explicit reset
+  view_item.ResetDataCache();
+  EXPECT_EQ(view_item.Data(Qt::DisplayRole), QVariant(43));
+  EXPECT_EQ(request_count, 5);
+}
+
+//! Replacing underlying data item.
+
+TEST_F(ViewItemTest, SetItemData)
+{
+  auto data = std::make_unique<ViewItemData>();
+  data->SetData(QVariant(42), Qt::DisplayRole);
+  ViewItem view_item(std::move(data));
+  EXPECT_EQ(view_item.Data(Qt::DisplayRole), QVariant(42));
+
+  auto other_data = std::make_unique<ViewItemData>();
+  other_data->SetData(QVariant(43), Qt::DisplayRole);
+  auto other_data_ptr = other_data.get();
+  view_item.SetItemData(std::move(other_data));
+  EXPECT_EQ(view_item.GetItemData(), other_data_ptr);
+  EXPECT_EQ(view_item.Data(Qt::DisplayRole), QVariant(43));
+
+  auto taken = view_item.TakeItemData();
+  EXPECT_EQ(taken.get(), other_data_ptr);
+  EXPECT_EQ(view_item.GetItemData(), nullptr);
+  EXPECT_FALSE(view_item.Data(Qt::DisplayRole).isValid());
+}
@@ -76,3 +76,49 @@ TEST_F(ViewModelBaseUtilsTest, iterate)
 
   EXPECT_EQ(result, expected);
 }
+
+//! Validate utils::CreateMergedSelection function.
+
+TEST_F(ViewModelBaseUtilsTest, CreateMergedSelection)
+{
+  QStandardItemModel model;
+  model.setColumnCount(3);
+  for (int row = 0; row < 5; ++row)
+  {
+    model.invisibleRootItem()->appendRow(GetStandardItems({row, row, row}));
+  }
+  model.item(0, 0)->appendRow(GetStandardItems({42, 42, 42}));
+  const auto child_parent = model.index(0, 0);
+
+  EXPECT_TRUE(utils::CreateMergedSelection({}).isEmpty());
+  EXPECT_TRUE(utils::CreateMergedSelection({QModelIndex()}).isEmpty());
+
+  // two full adjacent rows are merged into one range, duplicates are ignored
+  QModelIndexList indexes{model.index(2, 0), model.index(2, 1), model.index(1, 2),
+                          model.index(1, 0), model.index(1, 1), model.index(2, 2),
+                          model.index(1, 1), QModelIndex()};
+  auto selection = utils::CreateMergedSelection(indexes);
+  ASSERT_EQ(selection.size(), 1);
+  EXPECT_EQ(selection.at(0).topLeft(), model.index(1, 0));
+  EXPECT_EQ(selection.at(0).bottomRight(), model.index(2, 2));
+
+  // gap between rows, different column span, and a child row give separate ranges
+  indexes = {model.index(0, 0), model.index(0, 1), model.index(2, 0), model.index(2, 1),
+             model.index(3, 0), model.index(0, 1, child_parent)};
+  selection = utils::CreateMergedSelection(indexes);
+  ASSERT_EQ(selection.size(), 4);
+  EXPECT_EQ(selection.at(0).topLeft(), model.index(0, 0));
+  EXPECT_EQ(selection.at(0).bottomRight(), model.index(0, 1));
+  EXPECT_EQ(selection.at(1).topLeft(), model.index(2, 0));
+  EXPECT_EQ(selection.at(1).bottomRight(), model.index(2, 1));
+  EXPECT_EQ(selection.at(2).topLeft(), model.index(3, 0));
+  EXPECT_EQ(selection.at(2).bottomRight(), model.index(3, 0));
+  EXPECT_EQ(selection.at(3).topLeft(), model.index(0, 1, child_parent));
+  EXPECT_EQ(selection.at(3).bottomRight(), model.index(0, 1, child_parent));
+
+  // gap between columns gives separate ranges
+  selection = utils::CreateMergedSelection({model.index(4, 0), model.index(4, 2)});
+  ASSERT_EQ(selection.size(), 2);
+  EXPECT_EQ(selection.at(0).bottomRight(), model.index(4, 0));
+  EXPECT_EQ(selection.at(1).topLeft(), model.index(4, 2));
+}
@@ -77,6 +77,18 @@ public:
     return utils::FindViewsForItem<SessionItem>(&m_viewmodel, item);
   }
 
+  //! Creates controller which reuses views of unchanged items on model reset.
+  std::unique_ptr<AbstractViewModelController> CreateReconcilingController()
+  {
+    factory::ViewModelControllerFactoryContext context;
+    context.children_strategy = std::make_unique<AllChildrenStrategy>();
+    context.row_strategy = std::make_unique<LabelDataRowStrategy>();
+    context.model = &m_model;
+    context.view_model = &m_viewmodel;
+    context.reconcile_on_reset = true;
+    return factory::CreateViewModelController(std::move(context));
+  }
+
   ApplicationModel m_model;
   ViewModelBase m_viewmodel;
 };
@@ -625,6 +637,117 @@ TEST_F(ViewModelControllerTest, onEmptyModelResetAndContinue)
   EXPECT_EQ(spy_insert.count(), 1);
 }
 
+//! Model reset with reconciliation. Views of items which are still present after the reset are
+//! reused, the rest is updated by row insertion and removal.
+
+TEST_F(ViewModelControllerTest, ReconcileOnReset)
+{
+  auto controller = CreateReconcilingController();
+
+  m_model.InsertItem<SessionItem>()->SetData(0);
+  m_model.InsertItem<SessionItem>()->SetData(1);
+  m_model.InsertItem<SessionItem>()->SetData(2);
+
+  auto view1 = m_viewmodel.itemFromIndex(m_viewmodel.index(1, 0));
+  const QPersistentModelIndex persistent_index(m_viewmodel.index(1, 1));
+
+  // new content: first item is removed, data of the second item is changed, new item is appended
+  auto root_item = m_model.GetRootItem()->Clone();
+  root_item->TakeItem(TagIndex::First());
+  root_item->GetAllItems().at(0)->SetData(42);
+  root_item->InsertItem<SessionItem>(TagIndex::Append())->SetData(3);
+
+  QSignalSpy spy_about_reset(&m_viewmodel, &ViewModelBase::modelAboutToBeReset);
+  QSignalSpy spy_reset(&m_viewmodel, &ViewModelBase::modelReset);
+  QSignalSpy spy_remove(&m_viewmodel, &ViewModelBase::rowsRemoved);
+  QSignalSpy spy_insert(&m_viewmodel, &ViewModelBase::rowsInserted);
+  QSignalSpy spy_data_changed(&m_viewmodel, &ViewModelBase::dataChanged);
+
+  m_model.ReplaceRootItem(std::move(root_item));
+
+  EXPECT_EQ(spy_about_reset.count(), 0);
+  EXPECT_EQ(spy_reset.count(), 0);
+  EXPECT_EQ(spy_remove.count(), 1);
+  EXPECT_EQ(spy_insert.count(), 1);
+  // both reused rows changed their flags (frozen views are read-only), reported at once
+  ASSERT_EQ(spy_data_changed.count(), 1);
+  auto arguments = spy_data_changed.takeFirst();
+  EXPECT_EQ(arguments.at(0).value<QModelIndex>(), m_viewmodel.index(0, 0));
+  EXPECT_EQ(arguments.at(1).value<QModelIndex>(), m_viewmodel.index(1, 1));
+
+  auto items = m_model.GetRootItem()->GetAllItems();
+  ASSERT_EQ(m_viewmodel.rowCount(), 3);
+  EXPECT_EQ(m_viewmodel.itemFromIndex(m_viewmodel.index(0, 0)), view1);
+  EXPECT_EQ(persistent_index, m_viewmodel.index(0, 1));
+  EXPECT_EQ(GetSessionItem(m_viewmodel.index(0, 0)), items.at(0));
+  EXPECT_EQ(GetSessionItem(m_viewmodel.index(2, 0)), items.at(2));
+  EXPECT_EQ(m_viewmodel.data(m_viewmodel.index(0, 1), Qt::EditRole).toInt(), 42);
+  EXPECT_EQ(m_viewmodel.data(m_viewmodel.index(1, 1), Qt::EditRole).toInt(), 2);
+  EXPECT_EQ(m_viewmodel.data(m_viewmodel.index(2, 1), Qt::EditRole).toInt(), 3);
+  EXPECT_EQ(controller->GetRootItem(), m_model.GetRootItem());
+
+  // viewmodel continues to follow the model
+  items.at(1)->SetData(43);
+  EXPECT_EQ(spy_data_changed.count(), 1);
+  m_model.RemoveItem(items.at(2));
+  EXPECT_EQ(m_viewmodel.rowCount(), 2);
+}
+
+//! Model reset with reconciliation for items with children.
+
+TEST_F(ViewModelControllerTest, ReconcileOnResetNested)
+{
+  auto controller = CreateReconcilingController();
+
+  auto vector_item = m_model.InsertItem<VectorItem>();
+  vector_item->SetX(1.0);
+
+  auto vector_index = m_viewmodel.index(0, 0);
+  auto x_view = m_viewmodel.itemFromIndex(m_viewmodel.index(0, 0, vector_index));
+
+  auto root_item = m_model.GetRootItem()->Clone();
+  static_cast<VectorItem*>(root_item->GetAllItems().at(0))->SetY(2.0);
+
+  QSignalSpy spy_reset(&m_viewmodel, &ViewModelBase::modelReset);
+  QSignalSpy spy_remove(&m_viewmodel, &ViewModelBase::rowsRemoved);
+  QSignalSpy spy_insert(&m_viewmodel, &ViewModelBase::rowsInserted);
+
+  m_model.ReplaceRootItem(std::move(root_item));
+
+  EXPECT_EQ(spy_reset.count(), 0);
+  EXPECT_EQ(spy_remove.count(), 0);
+  EXPECT_EQ(spy_insert.count(), 0);
+
+  vector_item = m_model.GetRootItem()->GetItem<VectorItem>(TagIndex::First());
+  vector_index = m_viewmodel.index(0, 0);
+  ASSERT_EQ(m_viewmodel.rowCount(vector_index), 3);
+  EXPECT_EQ(m_viewmodel.itemFromIndex(m_viewmodel.index(0, 0, vector_index)), x_view);
+  EXPECT_EQ(FindViews(vector_item->GetItem(VectorItem::kY)).size(), 2);
+  EXPECT_EQ(m_viewmodel.data(m_viewmodel.index(1, 1, vector_index), Qt::EditRole).toDouble(), 2.0);
+}
+
+//! Model clear with reconciliation removes all rows at once.
+
+TEST_F(ViewModelControllerTest, ReconcileOnClear)
+{
+  auto controller = CreateReconcilingController();
+
+  m_model.InsertItem<VectorItem>();
+  m_model.InsertItem<SessionItem>();
+
+  QSignalSpy spy_reset(&m_viewmodel, &ViewModelBase::modelReset);
+  QSignalSpy spy_remove(&m_viewmodel, &ViewModelBase::rowsRemoved);
+
+  m_model.Clear();
+
+  EXPECT_EQ(spy_reset.count(), 0);
+  EXPECT_EQ(spy_remove.count(), 1);
+  EXPECT_EQ(m_viewmodel.rowCount(), 0);
+
+  m_model.InsertItem<SessionItem>();
+  EXPECT_EQ(m_viewmodel.rowCount(), 1);
+}
+
 TEST_F(ViewModelControllerTest, GetHorizontalHeaderLabels)
 {
   auto controller = CreateController(m_model, m_viewmodel);
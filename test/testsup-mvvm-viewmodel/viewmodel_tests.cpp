@@ -122,3 +122,21 @@ TEST_F(ViewModelTest, GetIndexOfSessionItem)
   // FIXME Is this behavior correct? Might be having QModelIndex() in a list is more consistent.
   EXPECT_EQ(view_model.GetIndexOfSessionItem(m_model.GetRootItem()), QModelIndexList());
 }
+
+TEST_F(ViewModelTest, GetIndexOfSessionItems)
+{
+  auto item0 = m_model.GetRootItem()->GetItem({"", 0});
+  auto item1 = m_model.InsertItem<PropertyItem>();
+  auto item2 = m_model.InsertItem<PropertyItem>();
+  const TestViewModel view_model(&m_model);
+
+  EXPECT_TRUE(view_model.GetIndexOfSessionItems({}).empty());
+  EXPECT_TRUE(view_model.GetIndexOfSessionItems({nullptr, m_model.GetRootItem()}).empty());
+
+  // indexes are given in the order of items, duplicates are ignored
+  QModelIndexList expected{view_model.index(2, 0), view_model.index(2, 1),
+                           view_model.index(0, 0), view_model.index(0, 1)};
+  EXPECT_EQ(view_model.GetIndexOfSessionItems({item2, nullptr, item0, item2}), expected);
+
+  EXPECT_EQ(view_model.GetIndexOfSessionItems({item1}), view_model.GetIndexOfSessionItem(item1));
+}
@@ -0,0 +1,189 @@
+/******************************************************************************
+ *
+ * Project       : Operational Applications UI Foundation
+ *
+ * Description   : The model-view-viewmodel library of generic UI components
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2025 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "mvvm/viewmodel/virtual_table_viewmodel.h"
+
+#include <mvvm/model/application_model.h>
+#include <mvvm/standarditems/container_item.h>
+#include <mvvm/standarditems/vector_item.h>
+#include <mvvm/viewmodel/viewmodel_utils.h>
+
+#include <gtest/gtest.h>
+#include <testutils/toy_items.h>
+
+#include <QSignalSpy>
+
+using namespace mvvm;
+
+//! Tests for VirtualTableViewModel class.
+
+class VirtualTableViewModelTest : public ::testing::Test
+{
+};
+
+TEST_F(VirtualTableViewModelTest, InitialState)
+{
+  ApplicationModel model;
+  VirtualTableViewModel view_model(&model);
+  EXPECT_EQ(view_model.rowCount(), 0);
+  EXPECT_EQ(view_model.columnCount(), 0);
+  EXPECT_EQ(view_model.GetSessionItemFromIndex(QModelIndex()), model.GetRootItem());
+  EXPECT_FALSE(view_model.index(0, 0).isValid());
+}
+
+//! Table of two vectors. Checking cell layout, data and index/item conversion.
+
+TEST_F(VirtualTableViewModelTest, VectorItems)
+{
+  ApplicationModel model;
+  auto vector0 = model.InsertItem<VectorItem>();
+  auto vector1 = model.InsertItem<VectorItem>();
+  vector1->SetY(42.0);
+
+  VirtualTableViewModel view_model(&model);
+
+  EXPECT_EQ(view_model.rowCount(), 2);
+  EXPECT_EQ(view_model.columnCount(), 3);
+  EXPECT_EQ(view_model.headerData(0, Qt::Horizontal, Qt::DisplayRole).toString(), QString("X"));
+  EXPECT_EQ(view_model.headerData(2, Qt::Horizontal, Qt::DisplayRole).toString(), QString("Z"));
+
+  auto index = view_model.index(1, 1);
+  EXPECT_FALSE(view_model.parent(index).isValid());
+  EXPECT_EQ(view_model.rowCount(index), 0);
+  EXPECT_FALSE(view_model.hasChildren(index));
+  EXPECT_EQ(view_model.data(index, Qt::DisplayRole).toDouble(), 42.0);
+  EXPECT_TRUE(view_model.flags(index).testFlag(Qt::ItemIsEditable));
+  EXPECT_EQ(view_model.GetViewItemFromIndex(index), nullptr);
+
+  // index to item and back
+  EXPECT_EQ(view_model.GetSessionItemFromIndex(index), vector1->GetItem(VectorItem::kY));
+  EXPECT_EQ(utils::ItemFromIndex(index), vector1->GetItem(VectorItem::kY));
+  EXPECT_EQ(view_model.GetIndexOfSessionItem(vector1->GetItem(VectorItem::kY)),
+            QModelIndexList({index}));
+  const QModelIndexList expected_indexes(
+      {view_model.index(0, 0), view_model.index(0, 1), view_model.index(0, 2)});
+  EXPECT_EQ(view_model.GetIndexOfSessionItem(vector0), expected_indexes);
+}
+
+//! Setting data through the view model and through the model.
+
+TEST_F(VirtualTableViewModelTest, SetData)
+{
+  ApplicationModel model;
+  auto vector = model.InsertItem<VectorItem>();
+
+  VirtualTableViewModel view_model(&model);
+  QSignalSpy spy_data_changed(&view_model, &VirtualTableViewModel::dataChanged);
+
+  auto index = view_model.index(0, 2);
+  EXPECT_TRUE(view_model.setData(index, QVariant::fromValue(43.0), Qt::EditRole));
+  EXPECT_EQ(vector->Z(), 43.0);
+  EXPECT_EQ(view_model.data(index, Qt::DisplayRole).toDouble(), 43.0);
+  ASSERT_EQ(spy_data_changed.count(), 1);
+
+  vector->SetZ(44.0);
+  EXPECT_EQ(view_model.data(index, Qt::EditRole).toDouble(), 44.0);
+  ASSERT_EQ(spy_data_changed.count(), 2);
+
+  auto arguments = spy_data_changed.takeLast();
+  EXPECT_EQ(arguments.at(0).value<QModelIndex>(), index);
+  EXPECT_EQ(arguments.at(1).value<QModelIndex>(), index);
+}
+
+//! Inserting and removing rows with row-wise notifications.
+
+TEST_F(VirtualTableViewModelTest, InsertAndRemove)
+{
+  ApplicationModel model;
+  auto container = model.InsertItem<ContainerItem>();
+
+  VirtualTableViewModel view_model(&model);
+  view_model.SetRootSessionItem(container);
+  EXPECT_EQ(view_model.rowCount(), 0);
+  EXPECT_EQ(view_model.columnCount(), 0);
+
+  QSignalSpy spy_insert(&view_model, &VirtualTableViewModel::rowsInserted);
+  QSignalSpy spy_remove(&view_model, &VirtualTableViewModel::rowsRemoved);
+  QSignalSpy spy_reset(&view_model, &VirtualTableViewModel::modelReset);
+
+  // first row defines columns with the reset
+  auto vector0 = model.InsertItem<VectorItem>(container);
+  EXPECT_EQ(view_model.rowCount(), 1);
+  EXPECT_EQ(view_model.columnCount(), 3);
+  EXPECT_EQ(spy_reset.count(), 1);
+
+  // appending and inserting in front
+  auto vector2 = model.InsertItem<VectorItem>(container);
+  auto vector1 = model.InsertItem<VectorItem>(container, TagIndex::First());
+  EXPECT_EQ(spy_insert.count(), 2);
+  auto arguments = spy_insert.takeLast();
+  EXPECT_EQ(arguments.at(1).value<int>(), 0);
+  EXPECT_EQ(arguments.at(2).value<int>(), 0);
+
+  EXPECT_EQ(view_model.GetIndexOfSessionItem(vector1).at(0).row(), 0);
+  EXPECT_EQ(view_model.GetIndexOfSessionItem(vector0).at(0).row(), 1);
+  EXPECT_EQ(view_model.GetIndexOfSessionItem(vector2).at(0).row(), 2);
+
+  // removing the row in the middle
+  model.RemoveItem(vector0);
+  EXPECT_EQ(view_model.rowCount(), 2);
+  ASSERT_EQ(spy_remove.count(), 1);
+  arguments = spy_remove.takeFirst();
+  EXPECT_EQ(arguments.at(1).value<int>(), 1);
+  EXPECT_EQ(arguments.at(2).value<int>(), 1);
+  EXPECT_EQ(view_model.GetIndexOfSessionItem(vector2).at(0).row(), 1);
+
+  // removing the root item
+  model.RemoveItem(container);
+  EXPECT_EQ(view_model.rowCount(), 0);
+  EXPECT_EQ(view_model.columnCount(), 0);
+  EXPECT_EQ(view_model.GetRootSessionItem(), nullptr);
+}
+
+//! MultiLayer with layers, multilayer is given as root index.
+
+TEST_F(VirtualTableViewModelTest, MultiLayer)
+{
+  using namespace mvvm::test::toyitems;
+
+  SampleModel model;
+  auto multilayer = model.InsertItem<MultiLayerItem>();
+  model.InsertItem<LayerItem>(multilayer);
+  model.InsertItem<LayerItem>(multilayer);
+
+  VirtualTableViewModel view_model(&model);
+  EXPECT_EQ(view_model.rowCount(), 1);  // multilayer itself
+
+  view_model.SetRootSessionItem(multilayer);
+  EXPECT_EQ(view_model.rowCount(), 2);     // two layers
+  EXPECT_EQ(view_model.columnCount(), 2);  // layer thickness and color
+  EXPECT_EQ(view_model.headerData(0, Qt::Horizontal, Qt::DisplayRole).toString(),
+            QString("Thickness"));
+  EXPECT_EQ(view_model.headerData(1, Qt::Horizontal, Qt::DisplayRole).toString(), QString("Color"));
+
+  model.InsertItem<LayerItem>(multilayer);
+  EXPECT_EQ(view_model.rowCount(), 3);
+
+  // model reset makes the model's root item our root
+  model.Clear();
+  EXPECT_EQ(view_model.rowCount(), 0);
+  EXPECT_EQ(view_model.columnCount(), 0);
+  EXPECT_EQ(view_model.GetRootSessionItem(), model.GetRootItem());
+}